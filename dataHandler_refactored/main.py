@@ -17,6 +17,7 @@ from utils.images import ImageRemove
 
 from server_adaptor.grpc_adaptor import gRPCAdaptor
 from server_adaptor.redis_adaptor import RedisAdaptor
+from server_adaptor.shm_adaptor import ShmAdaptor
 from server_adaptor.volt_adaptor import VoltDBAdaptor
 from server_adaptor.sqlite_adaptor import SqliteAdaptor
 
@@ -49,7 +50,11 @@ class Main:
         # Build Data Receivers 
         self.receivers = []
         for ch in self.config["redis_rcv"]:
-            adaptor = RedisAdaptor(ch)
+            # 같은 호스트 공유메모리 링 수신 (DeepStream redis.shm_ring 대상 채널)
+            if ch.get("transport") == "shm":
+                adaptor = ShmAdaptor(ch)
+            else:
+                adaptor = RedisAdaptor(ch)
             to_merge_q = None
             to_ocr_q = self.to_ocr_q
             if ch["label"] == dt.VEHICLE_2K:
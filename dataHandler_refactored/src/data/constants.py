@@ -79,6 +79,9 @@ class FieldKey(object):
     CAR_ID_2K                = "vhcl_dttn_2k_id"        # 2K 차량 고유 ID
     CAR_ID_4K                = "vhcl_dttn_4k_id"        # 4K 차량 고유 ID
     CAR_ID                   = "vhcl_dttn_id"           # 병합 후 차량 고유 ID
+    APPROACH_DELAY           = "aprch_dly_sec"          # 접근로 지체 (초)
+    STOP_SEC                 = "stop_sec"               # 접근로 정지 시간 (초)
+    STOP_CNT                 = "stop_cnt"               # 접근로 정지 횟수
     
     # ========================================================================
     # 통계 / 대기행렬 관련 필드
@@ -294,8 +294,8 @@ class Merger:
                     merged[fk.PLATE_IMAGE_FILE_NAME] = item_4k[fk.PLATE_IMAGE_FILE_NAME]
                     merged[fk.PLATE_NUM] = item_4k[fk.PLATE_NUM]
                     
-                    # 루원 사이트 특수 처리
-                    if self.luwon_cfg:
+                    # 루원 사이트 특수 처리 (DS 규칙 테이블이 카메라를 재지정한 경우 제외)
+                    if self.luwon_cfg and fk.SPOT_CAMR_ID not in item_2k:
                         # 차로 번호 변환 및 추가 데이터 생성
                         res = build_luwon(merged)
                         merged = res.to_server[0]
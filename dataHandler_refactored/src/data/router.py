@@ -68,6 +68,9 @@ class BuildResult:
 # ============================================================================
 
 # DS(DeepStream)가 생성한 2K 차량 데이터 파싱
+# - 기본 13개 컬럼(0~12), 확장 컬럼은 DS에서 기능 사용 시에만 추가 (위치 고정, 필드 수로 구분)
+#   13개: 기본 형식 / 14개: + 카메라 ID / 17개: + 카메라 ID(빈 값 가능) + 지체 지표 3개
+# - 없는 확장 컬럼은 zip에서 제외되어 키가 생기지 않음
 CSV_JSON_MAP_2K = [
     fk.CAR_ID_2K,           # 0: 차량 고유 ID
     fk.CAR_TYPE,            # 1: 차종 코드
@@ -82,8 +85,17 @@ CSV_JSON_MAP_2K = [
     fk.OBSERVE_TIME,        # 10: 관측 시각
     fk.IMAGE_PATH_NAME,     # 11: 이미지 파일 경로
     fk.CAR_IMAGE_FILE_NAME, # 12: 차량 이미지 파일명
+    fk.SPOT_CAMR_ID,        # 13: 카메라 ID (Special Site 규칙 재지정, 빈 값/없음: 기본 카메라)
+    fk.APPROACH_DELAY,      # 14: 접근로 지체 (초, 지체 산출 활성 시)
+    fk.STOP_SEC,            # 15: 정지 시간 (초, 지체 산출 활성 시)
+    fk.STOP_CNT,            # 16: 정지 횟수 (지체 산출 활성 시)
 ]
 
+# 2K 선택 컬럼 (없거나 빈 값이면 키 제거)
+# - 카메라 ID: sender에서 기본 카메라 ID 설정
+# - 지체 지표: 서버 전송 시 NULL
+CSV_OPTIONAL_2K = (fk.SPOT_CAMR_ID, fk.APPROACH_DELAY, fk.STOP_SEC, fk.STOP_CNT)
+
 # DS(DeepStream)가 생성한 보행자 데이터 파싱
 CSV_JSON_MAP_PED = [
     fk.TRACE_ID,     # 0: 추적 ID
@@ -285,6 +297,10 @@ def _route_2k(redis_data, ltype):
     3. 루원 사이트인 경우 특수 처리
     4. 일반 사이트: 2K + 병합 테이블 데이터 생성
     
+    카메라 재지정:
+    - DS Special Site 규칙이 카메라를 재지정하면 13번 컬럼에 카메라 ID 포함
+    - 이 경우 카메라/차로는 DS에서 결정된 값이므로 루원 변환을 적용하지 않음
+    
     Returns:
         BuildResult:
         - to_server: [2K 데이터, 병합 테이블 데이터]
@@ -295,14 +311,19 @@ def _route_2k(redis_data, ltype):
     redis_data = dict(zip(CSV_JSON_MAP_2K, redis_data))
     redis_data[fk.DATA_TYPE] = ltype
     
+    # 빈 선택 컬럼 제거
+    for key in CSV_OPTIONAL_2K:
+        if not redis_data.get(key):
+            redis_data.pop(key, None)
+    
     # 고유 키 생성 (로깅 및 추적용)
     redis_data[fk.UK_PLAIN] = _serialize_2k(redis_data)
     
     logger.info("Received Data!", extra={"datatype":redis_data[fk.DATA_TYPE], "data":redis_data[fk.UK_PLAIN]})
     logger.debug(f"Full Data: [{dict(redis_data)}]")
     
-    # 루원 사이트 특수 처리
-    if luwon_cfg["enabled"]:
+    # 루원 사이트 특수 처리 (DS 규칙 테이블이 카메라를 재지정한 경우 DS 결과 사용)
+    if luwon_cfg["enabled"] and fk.SPOT_CAMR_ID not in redis_data:
         result = build_luwon(redis_data)
         return result
     
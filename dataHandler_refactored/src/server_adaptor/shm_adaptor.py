@@ -0,0 +1,300 @@
+"""
+Shared Memory Adaptor Module
+============================
+DeepStream 앱의 공유메모리 링(redis.shm_ring)에서 데이터를 수신하는 어댑터
+
+주요 기능:
+1. /dev/shm 링 세그먼트 매핑 및 레코드 읽기 (Receiver 모드 전용)
+2. 순번(seq) 기반 손실 감지 및 overrun 복구
+3. futex 대기로 새 레코드 즉시 수신 (폴링 없음)
+4. 기록자 재시작(세그먼트 교체) 시 자동 재연결
+
+레이아웃/리더 규칙:
+- deepstream-6.0_refactored_fin/data/redis/shm_ring.h 참조
+- 같은 호스트에서만 사용 가능 (Redis Pub/Sub의 대체 경로)
+
+설정 (redis_rcv 항목에 추가):
+- "transport": "shm" 이면 RedisAdaptor 대신 사용
+- "shm_prefix": 세그먼트 이름 접두사 (기본 "ds_", C++ name_prefix와 동일해야 함)
+- "shm_wait_ms": 1회 대기 시간 (기본 100ms, 초과 시 None 반환)
+"""
+
+import ctypes
+import mmap
+import os
+import platform
+import struct
+import time
+
+from utils.logger import get_logger
+
+from server_adaptor.server_adaptor import ServerAdaptor
+
+
+# 링 헤더 (shm_ring.h ShmRingHeader)
+RING_MAGIC      = 0x52525344    # "DSRR"
+RING_VERSION    = 1
+HEADER_FMT      = "<IIQIi"      # magic, version, capacity, header_size, writer_pid
+OFF_RESERVE_POS = 64
+OFF_COMMIT_POS  = 72
+OFF_NOTIFY      = 88
+OFF_WAITERS     = 92
+
+# 레코드 헤더 (shm_ring.h ShmRecordHeader)
+RECORD_FMT  = "<IIQq"           # length, channel, seq, timestamp_ns
+RECORD_SIZE = 24
+RECORD_PAD  = 0xFFFFFFFF
+
+# futex (아키텍처별 시스템 호출 번호)
+FUTEX_WAIT = 0
+SYS_FUTEX  = {"x86_64": 202, "aarch64": 98}.get(platform.machine())
+
+REOPEN_CHECK_SEC = 5
+
+
+class _Timespec(ctypes.Structure):
+    _fields_ = [("tv_sec", ctypes.c_long), ("tv_nsec", ctypes.c_long)]
+
+
+class ShmAdaptor(ServerAdaptor):
+    """
+    공유메모리 링 수신 어댑터 (RedisAdaptor Receiver 모드와 같은 인터페이스)
+    
+    Attributes:
+        stype: 서버 타입 ("shm")
+        channel: Redis 채널명 (세그먼트 이름 결정)
+        label: 데이터 타입 라벨
+        send_to: 데이터 전송 대상 서버 목록
+        path: 세그먼트 파일 경로 (/dev/shm/<prefix><채널명>)
+        read_pos: 다음 읽을 누적 위치
+        next_seq: 다음 기대 순번 (None: 첫 레코드에서 결정)
+        lost: 누적 손실 레코드 수
+        
+    주의사항:
+    - Python에는 원자 연산이 없어 waiters 증감이 다른 리더와 경합할 수 있음
+      (잘못된 값이어도 대기에 타임아웃이 있으므로 최대 shm_wait_ms 지연만 발생)
+    - 연결 시점 이후 레코드부터 수신 (Redis 구독과 같은 의미)
+    """
+    
+    def __init__(self, config):
+        self.stype   = "shm"
+        self.host    = None
+        self.port    = None
+        self.channel = config["channel"]
+        self.label   = config["label"]
+        self.send_to = config.get("send_to", None)
+        self.logger  = get_logger("redis_rcv")
+        
+        prefix = config.get("shm_prefix", "ds_")
+        name = "".join(c if c.isalnum() else "_" for c in self.channel)
+        self.path = f"/dev/shm/{prefix}{name}"
+        self.wait_ms = int(config.get("shm_wait_ms", 100))
+        
+        self.mm = None
+        self.read_pos = 0
+        self.next_seq = None
+        self.lost = 0
+        self._inode = None
+        self._last_reopen_check = 0.0
+        self._notify = None
+        self._waiters = None
+        self._libc = ctypes.CDLL(None, use_errno=True)
+        
+    def connect(self):
+        """
+        링 세그먼트 매핑
+        
+        처리:
+        1. 세그먼트 파일 열기 및 전체 매핑 (MAP_SHARED)
+        2. 헤더 검증 (magic/version/크기)
+        3. 현재 commit 위치부터 읽기 시작
+        
+        주의사항:
+        - DeepStream 앱이 아직 링을 만들지 않았으면 실패 로그 후 get()에서 재시도
+        """
+        self.disconnect()
+        try:
+            fd = os.open(self.path, os.O_RDWR)
+            try:
+                st = os.fstat(fd)
+                self.mm = mmap.mmap(fd, st.st_size)
+            finally:
+                os.close(fd)
+            
+            magic, version, capacity, header_size, writer_pid = struct.unpack_from(HEADER_FMT, self.mm, 0)
+            if magic != RING_MAGIC or version != RING_VERSION or header_size + capacity != st.st_size:
+                raise ValueError(f"invalid ring header (magic={magic:#x}, version={version})")
+            
+            self.capacity = capacity
+            self.mask = capacity - 1
+            self.data_offset = header_size
+            self._inode = st.st_ino
+            self._notify = ctypes.c_uint32.from_buffer(self.mm, OFF_NOTIFY)
+            self._waiters = ctypes.c_uint32.from_buffer(self.mm, OFF_WAITERS)
+            
+            self.read_pos = self._u64(OFF_COMMIT_POS)
+            self.next_seq = None
+            
+            self.logger.info("Connection Success!", extra={
+                "server": f"{self.stype}|{self.path}|{capacity // 1024}KB|pid {writer_pid}"
+            })
+        except Exception as e:
+            self.disconnect()
+            self.logger.error("Connection Failed!", extra={"error": e})
+            
+    def disconnect(self):
+        """
+        매핑 해제 (ctypes 참조를 먼저 해제해야 mmap을 닫을 수 있음)
+        """
+        self._notify = None
+        self._waiters = None
+        if self.mm is not None:
+            self.mm.close()
+            self.mm = None
+            
+    def insert(self, data, dtype):
+        """
+        공유메모리 링은 DeepStream 앱만 기록 (Sender 모드 미지원)
+        """
+        self.logger.error("Insert Not Supported!", extra={"server": f"{self.stype}|{self.path}"})
+        return False
+    
+    def get(self):
+        """
+        다음 레코드 수신
+        
+        Returns:
+            str or None: 레코드 문자열 (Redis 메시지와 동일)
+            - shm_wait_ms 동안 새 레코드가 없으면 None (수신 루프가 종료 플래그 확인 가능)
+            
+        처리 흐름:
+        1. 미연결 시 재연결 시도
+        2. 레코드가 있으면 즉시 반환
+        3. 없으면 futex 대기 후 한 번 더 확인
+        4. 대기 시간 초과가 이어지면 세그먼트 교체 여부 확인
+        """
+        if self.mm is None:
+            self.connect()
+            if self.mm is None:
+                time.sleep(1)
+                return None
+        
+        try:
+            record = self._read_record()
+            if record is None:
+                self._wait()
+                record = self._read_record()
+            if record is None:
+                self._check_reopen()
+            return record
+        except Exception as e:
+            self.logger.error("Something Went Wrong!", extra={"error": e})
+            self.connect()
+            return None
+    
+    def _u64(self, offset):
+        return struct.unpack_from("<Q", self.mm, offset)[0]
+    
+    def _read_record(self):
+        """
+        레코드 1개 읽기 (shm_ring.h 리더 규칙)
+        
+        Returns:
+            str or None: 레코드 문자열, 새 레코드가 없으면 None
+        """
+        while True:
+            commit = self._u64(OFF_COMMIT_POS)
+            if commit == self.read_pos:
+                return None
+            if commit < self.read_pos:
+                # 기록자가 링을 다시 초기화함
+                self.logger.warning("Ring Reset By Writer!", extra={"server": f"{self.stype}|{self.path}"})
+                self.read_pos = commit
+                self.next_seq = None
+                return None
+            if commit - self.read_pos > self.capacity:
+                self._overrun(commit)
+                continue
+            
+            offset = self.read_pos & self.mask
+            remain = self.capacity - offset
+            if remain < RECORD_SIZE:
+                self.read_pos += remain
+                continue
+            
+            length, channel, seq, timestamp_ns = struct.unpack_from(RECORD_FMT, self.mm, self.data_offset + offset)
+            if length == RECORD_PAD:
+                self.read_pos += remain
+                continue
+            
+            size = (RECORD_SIZE + length + 7) & ~7
+            if size > remain:
+                # 읽는 중 덮어쓰인 헤더
+                self._overrun(self._u64(OFF_COMMIT_POS))
+                continue
+            
+            start = self.data_offset + offset + RECORD_SIZE
+            payload = self.mm[start:start + length]
+            
+            # 복사 중 덮어쓰기 확인
+            if self._u64(OFF_RESERVE_POS) - self.read_pos > self.capacity:
+                self._overrun(self._u64(OFF_COMMIT_POS))
+                continue
+            
+            if self.next_seq is not None and seq > self.next_seq:
+                self._record_lost(seq - self.next_seq)
+            self.next_seq = seq + 1
+            self.read_pos += size
+            return payload.decode("utf-8", errors="replace")
+    
+    def _overrun(self, commit):
+        """
+        리더가 기록자보다 링 한 바퀴 이상 뒤처짐 - 최신 위치로 이동
+        (손실 수는 다음 레코드의 seq 차이로 집계)
+        """
+        self.logger.warning("Ring Overrun! Skipping To Latest", extra={
+            "server": f"{self.stype}|{self.path}"
+        })
+        self.read_pos = commit
+    
+    def _record_lost(self, count):
+        self.lost += count
+        self.logger.warning("Records Lost!", extra={
+            "server": f"{self.stype}|{self.path}",
+            "data": f"lost {count} (total {self.lost})"
+        })
+    
+    def _wait(self):
+        """
+        새 레코드 대기 (futex, 최대 shm_wait_ms)
+        """
+        if SYS_FUTEX is None:
+            time.sleep(self.wait_ms / 1000.0)
+            return
+        
+        self._waiters.value += 1
+        try:
+            expected = self._notify.value
+            if self._u64(OFF_COMMIT_POS) != self.read_pos:
+                return
+            timeout = _Timespec(self.wait_ms // 1000, (self.wait_ms % 1000) * 1000000)
+            self._libc.syscall(SYS_FUTEX, ctypes.byref(self._notify), FUTEX_WAIT,
+                               ctypes.c_uint32(expected), ctypes.byref(timeout), None, 0)
+        finally:
+            if self._waiters.value > 0:
+                self._waiters.value -= 1
+    
+    def _check_reopen(self):
+        """
+        기록자가 세그먼트를 새로 만든 경우(링 크기 변경 등) 재연결
+        """
+        now = time.monotonic()
+        if now - self._last_reopen_check < REOPEN_CHECK_SEC:
+            return
+        self._last_reopen_check = now
+        try:
+            if os.stat(self.path).st_ino != self._inode:
+                self.logger.info("Ring Segment Replaced! Reconnecting..")
+                self.connect()
+        except FileNotFoundError:
+            pass
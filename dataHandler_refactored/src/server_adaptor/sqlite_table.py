@@ -290,7 +290,15 @@ class MainTable(BaseTable):
         - executescript() 사용으로 여러 쿼리 한번에 실행
         - IF NOT EXISTS로 중복 생성 방지
         - timestamp는 Unix timestamp (초 단위)
+        - DeepStream 앱(스키마 v2 이상)이 같은 DB에 main_table을 호환 뷰로 만든 경우
+          생성하지 않음 (뷰의 INSTEAD OF 트리거가 vehicle_record에 기록, 정리도 DeepStream 트리거가 수행)
         """
+        row = conn.execute(
+            "SELECT type FROM sqlite_master WHERE name = ?", (self.table,)
+        ).fetchone()
+        if row and row[0] == "view":
+            return
+        
         create_script = f"""
                          CREATE TABLE IF NOT EXISTS "{self.table}" (
                              row_id INTEGER PRIMARY KEY AUTOINCREMENT,
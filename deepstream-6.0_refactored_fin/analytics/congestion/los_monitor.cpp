@@ -0,0 +1,346 @@
+﻿/*
+ * los_monitor.cpp
+ *
+ * 실시간 차로별/접근로 서비스수준(LOS) 모니터 구현
+ * - 프레임 단위 누적, 초 단위 EWMA 및 히스테리시스 등급 판정
+ * - 등급 변경시에만 Redis 전송
+ */
+
+#include "los_monitor.h"
+#include "../../calibration/calibration.h"
+#include "../../data/redis/channel_types.h"
+#include "../../data/redis/redis_client.h"
+#include "../../json/json.h"
+#include "../../roi_module/roi_handler.h"
+#include "../../utils/config_manager.h"
+#include <algorithm>
+
+LOSMonitor::LOSMonitor() {
+    logger = getLogger("DS_LOSMonitor_log");
+    logger->info("LOSMonitor 생성");
+}
+
+bool LOSMonitor::initialize(RedisClient* redis_client, ROIHandler* roi_handler, int total_lanes) {
+    try {
+        redis_client_ = redis_client;
+        roi_handler_ = roi_handler;
+        total_lanes_ = total_lanes;
+
+        if (!redis_client_) {
+            logger->error("Redis 클라이언트가 없음 - LOS 모니터 초기화 실패");
+            return false;
+        }
+
+        if (total_lanes_ <= 0) {
+            logger->error("차로 수가 유효하지 않음: {}", total_lanes_);
+            return false;
+        }
+
+        loadConfig();
+        initializeLaneLengths();
+
+        accum_.assign(total_lanes_ + 1, LaneFrameAccumulator());
+        states_.assign(total_lanes_ + 1, LaneLOSState());
+        frames_in_second_ = 0;
+
+        logger->info("LOS 모니터 초기화 완료 - 차로: {}, 등급: {}개, alpha: {}, 히스테리시스: {:.0f}%, 최소 유지: {}초",
+                    total_lanes_, config_.level_names.size(), config_.ewma_alpha,
+                    config_.hysteresis_ratio * 100.0, config_.min_hold_sec);
+        return true;
+
+    } catch (const std::exception& e) {
+        logger->error("LOS 모니터 초기화 실패: {}", e.what());
+        return false;
+    }
+}
+
+void LOSMonitor::loadConfig() {
+    auto& config = ConfigManager::getInstance();
+    const std::string base_key = "processing_modules.vehicle_analytics.los";
+
+    config_.enabled = config.isLOSEnabled();
+    config_.ewma_alpha = config.getDouble(base_key + ".ewma_alpha", 0.2);
+    config_.hysteresis_ratio = config.getDouble(base_key + ".hysteresis_ratio", 0.1);
+    config_.min_hold_sec = config.getInt(base_key + ".min_hold_sec", 10);
+    config_.breakdown_speed_kmh = config.getDouble(base_key + ".breakdown_speed_kmh", 10.0);
+    config_.breakdown_occupancy = config.getDouble(base_key + ".breakdown_occupancy", 0.5);
+    config_.level_names = config.getStringArray(base_key + ".level_names");
+    config_.density_thresholds = config.getDoubleArray(base_key + ".density_thresholds");
+
+    if (config_.ewma_alpha <= 0.0 || config_.ewma_alpha > 1.0) {
+        logger->warn("잘못된 ewma_alpha 값: {} - 기본값 0.2 사용", config_.ewma_alpha);
+        config_.ewma_alpha = 0.2;
+    }
+    config_.hysteresis_ratio = std::clamp(config_.hysteresis_ratio, 0.0, 0.5);
+    config_.min_hold_sec = std::max(0, config_.min_hold_sec);
+
+    // 등급/임계값 검증 - 불일치하면 LOS A~F 기본값 사용
+    bool sorted = std::is_sorted(config_.density_thresholds.begin(), config_.density_thresholds.end());
+    if (config_.level_names.size() < 2 ||
+        config_.density_thresholds.size() + 1 != config_.level_names.size() || !sorted) {
+        if (!config_.level_names.empty() || !config_.density_thresholds.empty()) {
+            logger->warn("LOS 등급 설정 불일치 (등급 {}개, 임계값 {}개) - 기본 A~F 사용",
+                        config_.level_names.size(), config_.density_thresholds.size());
+        }
+        config_.level_names = {"A", "B", "C", "D", "E", "F"};
+        config_.density_thresholds = {7.0, 11.0, 16.0, 22.0, 28.0};
+    }
+
+    for (size_t i = 0; i < config_.density_thresholds.size(); i++) {
+        logger->debug("  - {} / {} 경계: {:.1f}대/km", config_.level_names[i],
+                     config_.level_names[i + 1], config_.density_thresholds[i]);
+    }
+}
+
+void LOSMonitor::initializeLaneLengths() {
+    lane_length_km_.assign(total_lanes_ + 1, DEFAULT_LANE_LENGTH_M / 1000.0);
+
+    std::map<int, double> lengths;
+    if (roi_handler_) {
+        lengths = roi_handler_->getAllLaneLengths();
+    }
+
+    // 차선 길이가 없으면 캘리브레이션 거리, 그것도 없으면 기본값
+    double fallback_m = (DISTANCE[0] > 0 && DISTANCE[0] < 10000) ? DISTANCE[0] : DEFAULT_LANE_LENGTH_M;
+
+    for (int lane = 1; lane <= total_lanes_; lane++) {
+        auto it = lengths.find(lane);
+        double length_m = (it != lengths.end() && it->second > 0) ? it->second : fallback_m;
+        lane_length_km_[lane] = length_m / 1000.0;
+        logger->debug("차로 {} 길이: {:.2f}m", lane, length_m);
+    }
+}
+
+void LOSMonitor::updateFrame(const LaneArray<int>& lane_counts,
+                             const LaneArray<double>& lane_speed_sums,
+                             const LaneArray<int>& lane_speed_samples) {
+    if (!config_.enabled) return;
+
+    std::lock_guard<std::mutex> lock(los_mutex_);
+
+    frames_in_second_++;
+
+    int lanes = std::min(lane_counts.lanes(), total_lanes_);
+    for (int lane = 1; lane <= lanes; lane++) {
+        int count = lane_counts[lane];
+        accum_[lane].vehicle_sum += count;
+        if (count > 0) {
+            accum_[lane].occupied_frames++;
+        }
+
+        int samples = lane_speed_samples[lane];
+        if (samples <= 0) continue;
+        accum_[lane].speed_sum += lane_speed_sums[lane];
+        accum_[lane].speed_samples += samples;
+    }
+}
+
+void LOSMonitor::updatePerSecond(int current_time) {
+    if (!config_.enabled) return;
+
+    std::vector<LOSChangeEvent> events;
+
+    {
+        std::lock_guard<std::mutex> lock(los_mutex_);
+
+        if (frames_in_second_ == 0) {
+            return;
+        }
+
+        double frames = static_cast<double>(frames_in_second_);
+
+        // 접근로 합계
+        double approach_vehicles = 0.0;
+        double approach_length_km = 0.0;
+        double approach_occupancy = 0.0;
+        double approach_speed_sum = 0.0;
+        int approach_speed_samples = 0;
+
+        for (int lane = 1; lane <= total_lanes_; lane++) {
+            LaneFrameAccumulator& acc = accum_[lane];
+
+            double mean_count = acc.vehicle_sum / frames;
+            double density = mean_count / lane_length_km_[lane];
+            double occupancy = acc.occupied_frames / frames;
+            bool has_speed = acc.speed_samples > 0;
+            double speed = has_speed ? acc.speed_sum / acc.speed_samples : -1.0;
+
+            approach_vehicles += mean_count;
+            approach_length_km += lane_length_km_[lane];
+            approach_occupancy += occupancy;
+            approach_speed_sum += acc.speed_sum;
+            approach_speed_samples += acc.speed_samples;
+
+            LaneLOSState& state = states_[lane];
+            int prev_level = state.level;
+            if (updateState(state, density, speed, occupancy, has_speed, current_time)) {
+                LOSChangeEvent event;
+                event.lane_no = lane;
+                event.timestamp = current_time;
+                event.level = levelName(state.level);
+                event.prev_level = levelName(prev_level);
+                event.density = state.ewma_density;
+                event.speed = state.ewma_speed;
+                event.occupancy = state.ewma_occupancy * 100.0;
+                events.push_back(event);
+            }
+
+            acc = LaneFrameAccumulator();
+        }
+
+        // 접근로 전체 (차로당 평균 밀도)
+        double density = approach_length_km > 0.0 ? approach_vehicles / approach_length_km : 0.0;
+        double occupancy = approach_occupancy / total_lanes_;
+        bool has_speed = approach_speed_samples > 0;
+        double speed = has_speed ? approach_speed_sum / approach_speed_samples : -1.0;
+
+        LaneLOSState& approach = states_[0];
+        int prev_level = approach.level;
+        if (updateState(approach, density, speed, occupancy, has_speed, current_time)) {
+            LOSChangeEvent event;
+            event.lane_no = 0;
+            event.timestamp = current_time;
+            event.level = levelName(approach.level);
+            event.prev_level = levelName(prev_level);
+            event.density = approach.ewma_density;
+            event.speed = approach.ewma_speed;
+            event.occupancy = approach.ewma_occupancy * 100.0;
+            events.push_back(event);
+        }
+
+        frames_in_second_ = 0;
+    }
+
+    for (const auto& event : events) {
+        sendLOSEvent(event);
+    }
+}
+
+bool LOSMonitor::updateState(LaneLOSState& state, double density, double speed,
+                             double occupancy, bool has_speed, int current_time) {
+    const double alpha = config_.ewma_alpha;
+
+    if (!state.initialized) {
+        // 첫 측정값으로 초기화 (등급 변경 이벤트 없음)
+        state.ewma_density = density;
+        state.ewma_occupancy = occupancy;
+        state.ewma_speed = has_speed ? speed : -1.0;
+        state.level = classifyWithHysteresis(state);
+        state.level_since = current_time;
+        state.initialized = true;
+        return false;
+    }
+
+    state.ewma_density += alpha * (density - state.ewma_density);
+    state.ewma_occupancy += alpha * (occupancy - state.ewma_occupancy);
+    if (has_speed) {
+        state.ewma_speed = (state.ewma_speed < 0.0) ? speed
+                         : state.ewma_speed + alpha * (speed - state.ewma_speed);
+    }
+
+    int new_level = classifyWithHysteresis(state);
+    if (new_level == state.level) {
+        return false;
+    }
+
+    // 최소 유지 시간 내 변경 억제
+    if (current_time - state.level_since < config_.min_hold_sec) {
+        return false;
+    }
+
+    state.level = new_level;
+    state.level_since = current_time;
+    state.changes++;
+    return true;
+}
+
+int LOSMonitor::classifyWithHysteresis(const LaneLOSState& state) const {
+    const auto& thresholds = config_.density_thresholds;
+    const int max_level = static_cast<int>(config_.level_names.size()) - 1;
+
+    // 저속 + 고점유 = 정체 (밀도와 무관하게 최하위 등급)
+    if (state.ewma_speed >= 0.0 &&
+        state.ewma_speed < config_.breakdown_speed_kmh &&
+        state.ewma_occupancy >= config_.breakdown_occupancy) {
+        return max_level;
+    }
+
+    // 상향: 현재 등급 상한 * (1 + h) 초과시 / 하향: 하한 * (1 - h) 미만시
+    const double up = 1.0 + config_.hysteresis_ratio;
+    const double down = 1.0 - config_.hysteresis_ratio;
+
+    int level = std::clamp(state.level, 0, max_level);
+    while (level < max_level && state.ewma_density > thresholds[level] * up) {
+        level++;
+    }
+    while (level > 0 && state.ewma_density < thresholds[level - 1] * down) {
+        level--;
+    }
+    return level;
+}
+
+std::string LOSMonitor::levelName(int level) const {
+    if (level < 0 || level >= static_cast<int>(config_.level_names.size())) {
+        return "";
+    }
+    return config_.level_names[level];
+}
+
+bool LOSMonitor::sendLOSEvent(const LOSChangeEvent& event) {
+    try {
+        Json::Value root;
+        Json::FastWriter writer;
+
+        root["lane_no"] = event.lane_no;
+        root["unix_tm"] = event.timestamp;
+        root["los_grd"] = event.level;
+        root["prev_los_grd"] = event.prev_level;
+        root["trfc_dnst"] = event.density;
+        root["avg_sped"] = event.speed;
+        root["ocpn_rt"] = event.occupancy;
+
+        std::string json_data = writer.write(root);
+        int result = redis_client_->sendData(CHANNEL_LOS, json_data);
+
+        if (result != 0) {
+            logger->error("LOS 이벤트 전송 실패 (결과: {})", result);
+            return false;
+        }
+
+        events_sent_++;
+        logger->info("LOS 등급 변경 - {}: {} -> {} (밀도: {:.1f}대/km, 속도: {:.1f}km/h, 점유율: {:.1f}%)",
+                    event.lane_no == 0 ? std::string("접근로") : "차로 " + std::to_string(event.lane_no),
+                    event.prev_level, event.level, event.density, event.speed, event.occupancy);
+        return true;
+
+    } catch (const std::exception& e) {
+        logger->error("LOS 이벤트 전송 중 예외: {}", e.what());
+        return false;
+    }
+}
+
+std::string LOSMonitor::getLevel(int lane_no) const {
+    std::lock_guard<std::mutex> lock(los_mutex_);
+
+    if (lane_no < 0 || lane_no >= static_cast<int>(states_.size()) || !states_[lane_no].initialized) {
+        return "";
+    }
+    return levelName(states_[lane_no].level);
+}
+
+void LOSMonitor::logStatistics() const {
+    if (!config_.enabled) return;
+
+    std::lock_guard<std::mutex> lock(los_mutex_);
+
+    logger->info("=== LOS 모니터 통계 ===");
+    logger->info("  등급 변경 전송: {}회", events_sent_);
+    for (size_t lane = 0; lane < states_.size(); lane++) {
+        const LaneLOSState& state = states_[lane];
+        if (!state.initialized) continue;
+        logger->info("  [{}] 등급: {}, 밀도: {:.1f}대/km, 속도: {:.1f}km/h, 점유율: {:.1f}%, 변경: {}회",
+                    lane == 0 ? std::string("접근로") : "차로 " + std::to_string(lane),
+                    levelName(state.level), state.ewma_density, state.ewma_speed,
+                    state.ewma_occupancy * 100.0, state.changes);
+    }
+}
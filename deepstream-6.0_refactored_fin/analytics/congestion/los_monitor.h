@@ -0,0 +1,117 @@
+﻿#ifndef LOS_MONITOR_H
+#define LOS_MONITOR_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "los_types.h"
+#include "../../common/common_types.h"
+#include "../../common/lane_array.h"
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+// Forward declarations
+class RedisClient;
+class ROIHandler;
+
+/**
+ * @brief 실시간 차로별/접근로 서비스수준(LOS) 모니터
+ *
+ * 5분 통계를 기다리지 않고 프레임별 차로 차량 수와 속도로
+ * 혼잡 등급을 증분 계산
+ * - 프레임: 차로별 누적값만 갱신 (O(차로))
+ * - 매 초: 밀도/속도/점유율 EWMA 갱신 후 히스테리시스 적용 등급 판정 (O(차로))
+ * - 등급이 바뀔 때만 Redis 전송 (SQL 미사용)
+ */
+class LOSMonitor {
+private:
+    // 설정
+    LOSConfig config_;
+    int total_lanes_ = 0;
+    static constexpr double DEFAULT_LANE_LENGTH_M = 100.0;
+
+    // 외부 의존성
+    RedisClient* redis_client_ = nullptr;
+    ROIHandler* roi_handler_ = nullptr;
+
+    // 차로별 길이 (km, 인덱스 = 차로 번호, 0 미사용)
+    std::vector<double> lane_length_km_;
+
+    // 초당 누적값 (인덱스 = 차로 번호)
+    std::vector<LaneFrameAccumulator> accum_;
+    int frames_in_second_ = 0;
+
+    // 차로별 상태 (인덱스 = 차로 번호, 0 = 접근로 전체)
+    std::vector<LaneLOSState> states_;
+
+    mutable std::mutex los_mutex_;
+
+    // 통계
+    int events_sent_ = 0;
+
+    // 로거
+    std::shared_ptr<spdlog::logger> logger = nullptr;
+
+    // 내부 메서드
+    void loadConfig();
+    void initializeLaneLengths();
+    bool updateState(LaneLOSState& state, double density, double speed,
+                     double occupancy, bool has_speed, int current_time);
+    int classifyWithHysteresis(const LaneLOSState& state) const;
+    bool sendLOSEvent(const LOSChangeEvent& event);
+    std::string levelName(int level) const;
+
+public:
+    LOSMonitor();
+    ~LOSMonitor() = default;
+
+    /**
+     * @brief 초기화
+     * @param redis_client Redis 클라이언트 포인터
+     * @param roi_handler ROI 핸들러 포인터 (차로 길이용)
+     * @param total_lanes 총 차로 수
+     * @return 성공 시 true
+     */
+    bool initialize(RedisClient* redis_client, ROIHandler* roi_handler, int total_lanes);
+
+    /**
+     * @brief 프레임별 차로 데이터 누적 - process_meta에서 매 프레임 호출
+     * @param lane_counts 차로별 차량 수
+     * @param lane_speed_sums 차로별 차량 속도 합계 (km/h)
+     * @param lane_speed_samples 차로별 속도 샘플 수
+     */
+    void updateFrame(const LaneArray<int>& lane_counts,
+                     const LaneArray<double>& lane_speed_sums,
+                     const LaneArray<int>& lane_speed_samples);
+
+    /**
+     * @brief 초 단위 등급 갱신 및 변경 이벤트 전송
+     * @param current_time 현재 시간
+     */
+    void updatePerSecond(int current_time);
+
+    /**
+     * @brief 현재 등급 조회
+     * @param lane_no 차로 번호 (0: 접근로 전체)
+     * @return 등급 이름 (범위 밖이면 빈 문자열)
+     */
+    std::string getLevel(int lane_no) const;
+
+    /**
+     * @brief 통계 정보 로깅
+     */
+    void logStatistics() const;
+
+    /**
+     * @brief 활성화 상태 확인
+     * @return 활성화시 true
+     */
+    bool isEnabled() const { return config_.enabled; }
+};
+
+#endif // LOS_MONITOR_H
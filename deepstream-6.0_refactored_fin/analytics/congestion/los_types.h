@@ -0,0 +1,60 @@
+﻿#ifndef LOS_TYPES_H
+#define LOS_TYPES_H
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief 실시간 서비스수준(LOS) 설정
+ *
+ * density_thresholds는 오름차순이며 크기는 level_names.size() - 1
+ * 예: A~F, 임계값 [7, 11, 16, 22, 28] (대/km/차로)
+ */
+struct LOSConfig {
+    bool enabled = false;
+    double ewma_alpha = 0.2;                // EWMA 평활 계수 (0~1, 클수록 빠른 반응)
+    double hysteresis_ratio = 0.1;          // 진입/이탈 임계값 여유 비율
+    int min_hold_sec = 10;                  // 등급 변경 후 최소 유지 시간 (초)
+    double breakdown_speed_kmh = 10.0;      // 정체 판정 속도 (km/h)
+    double breakdown_occupancy = 0.5;       // 정체 판정 점유율 (0~1)
+    std::vector<std::string> level_names;   // 등급 이름 (좋음 -> 나쁨)
+    std::vector<double> density_thresholds; // 등급 경계 밀도 (대/km/차로)
+};
+
+/**
+ * @brief 차로(또는 접근로) LOS 상태
+ */
+struct LaneLOSState {
+    bool initialized = false;
+    double ewma_density = 0.0;              // 평활 밀도 (대/km)
+    double ewma_speed = -1.0;               // 평활 속도 (km/h, -1: 미측정)
+    double ewma_occupancy = 0.0;            // 평활 점유율 (0~1)
+    int level = 0;                          // 현재 등급 인덱스
+    int level_since = 0;                    // 현재 등급 시작 시각
+    int changes = 0;                        // 등급 변경 횟수
+};
+
+/**
+ * @brief 초당 누적값 (프레임 단위 입력)
+ */
+struct LaneFrameAccumulator {
+    int vehicle_sum = 0;                    // 프레임별 차량 수 합계
+    int occupied_frames = 0;                // 차량이 1대 이상인 프레임 수
+    double speed_sum = 0.0;                 // 차량 속도 합계 (km/h)
+    int speed_samples = 0;                  // 속도 샘플 수
+};
+
+/**
+ * @brief LOS 등급 변경 이벤트 (Redis 전송 단위)
+ */
+struct LOSChangeEvent {
+    int lane_no = 0;                        // 차로 번호 (0: 접근로 전체)
+    int timestamp = 0;
+    std::string level;
+    std::string prev_level;
+    double density = 0.0;                   // 대/km/차로
+    double speed = -1.0;                    // km/h
+    double occupancy = 0.0;                 // %
+};
+
+#endif // LOS_TYPES_H
@@ -0,0 +1,319 @@
+﻿/*
+ * arrival_monitor.cpp
+ *
+ * 신호 주기별/차로별 도착 분석 구현
+ * - 정지선 통과마다 도착 시각(통과 - 지체)이 속한 주기 창의 카운트와 도착 시계열만 갱신
+ * - 녹색 시작마다 한 주기 전 주기 창의 AOG/군집비 계산 후 Redis 전송
+ */
+
+#include "arrival_monitor.h"
+#include "../../data/redis/channel_types.h"
+#include "../../data/redis/redis_client.h"
+#include "../../json/json.h"
+#include "../../utils/config_manager.h"
+#include <algorithm>
+#include <cmath>
+
+ArrivalMonitor::ArrivalMonitor() {
+    logger = getLogger("DS_ArrivalMonitor_log");
+    logger->info("ArrivalMonitor 생성");
+}
+
+bool ArrivalMonitor::initialize(RedisClient* redis_client, int total_lanes) {
+    try {
+        redis_client_ = redis_client;
+        total_lanes_ = total_lanes;
+
+        if (!redis_client_) {
+            logger->error("Redis 클라이언트가 없음 - 도착 분석 초기화 실패");
+            return false;
+        }
+
+        if (total_lanes_ <= 0) {
+            logger->error("차로 수가 유효하지 않음: {}", total_lanes_);
+            return false;
+        }
+
+        loadConfig();
+
+        // 주기 중 할당이 없도록 시계열 용량 미리 확보
+        for (auto& window : windows_) {
+            window.lanes.assign(total_lanes_ + 1, LaneArrivalCounts());
+            for (size_t lane = 0; lane < window.lanes.size(); lane++) {
+                size_t capacity = config_.max_series_per_lane * (lane == 0 ? total_lanes_ : 1);
+                window.lanes[lane].offsets.reserve(capacity);
+            }
+            window.reset(-1);
+        }
+        current_ = 0;
+
+        delay_available_ = ConfigManager::getInstance().isDelayEnabled();
+        if (!delay_available_) {
+            logger->warn("차량 지체 산출 비활성 - 정지선 통과 시각을 도착 시각으로 사용 "
+                        "(적색 대기 후 녹색 출발 차량이 녹색 도착으로 집계됨)");
+        }
+
+        logger->info("도착 분석 초기화 완료 - 차로: {}, 황색: {}초, 유효 주기: {}~{}초, 시계열 최대: {}개/차로, "
+                    "도착 시각: {}",
+                    total_lanes_, config_.yellow_sec, config_.min_cycle_sec,
+                    config_.max_cycle_sec, config_.max_series_per_lane,
+                    delay_available_ ? "정지선 통과 - 지체" : "정지선 통과");
+        return true;
+
+    } catch (const std::exception& e) {
+        logger->error("도착 분석 초기화 실패: {}", e.what());
+        return false;
+    }
+}
+
+void ArrivalMonitor::loadConfig() {
+    auto& config = ConfigManager::getInstance();
+    const std::string base_key = "processing_modules.vehicle_analytics.arrival";
+
+    config_.enabled = config.isArrivalEnabled();
+    config_.yellow_sec = config.getInt(base_key + ".yellow_sec", 3);
+    config_.min_cycle_sec = config.getInt(base_key + ".min_cycle_sec", 20);
+    config_.max_cycle_sec = config.getInt(base_key + ".max_cycle_sec", 300);
+    config_.max_series_per_lane = config.getInt(base_key + ".max_series_per_lane", 200);
+
+    config_.yellow_sec = std::max(0, config_.yellow_sec);
+    if (config_.min_cycle_sec <= 0 || config_.max_cycle_sec <= config_.min_cycle_sec) {
+        logger->warn("잘못된 주기 범위: {}~{}초 - 기본값 20~300초 사용",
+                    config_.min_cycle_sec, config_.max_cycle_sec);
+        config_.min_cycle_sec = 20;
+        config_.max_cycle_sec = 300;
+    }
+    // 시계열 오프셋은 uint16 (주기 길이 상한 내)
+    config_.max_cycle_sec = std::min(config_.max_cycle_sec, 65535);
+    config_.max_series_per_lane = std::clamp(config_.max_series_per_lane, 0, 10000);
+}
+
+void ArrivalMonitor::onSignalChange(bool is_green, int timestamp) {
+    if (!config_.enabled) return;
+
+    std::string json_data;
+    {
+        std::lock_guard<std::mutex> lock(arrival_mutex_);
+
+        ArrivalCycleWindow& cycle = current();
+
+        if (!is_green) {
+            // 첫 녹색 이전의 적색 시작은 무시 (주기 경계는 녹색 시작 기준)
+            if (cycle.active() && cycle.green_end < 0) {
+                cycle.green_end = timestamp;
+            }
+            return;
+        }
+
+        // 한 주기 전 주기 창: 적색 도착 차량이 이번 주기 녹색에 모두 통과했으므로 확정
+        ArrivalCycleWindow& closing = previous();
+        if (closing.active()) {
+            buildCycleJson(closing, json_data);
+        }
+
+        if (cycle.active() && cycle.green_end >= 0) {
+            // 현재 주기는 늦은 도착을 받도록 직전 주기 창으로 넘김
+            cycle.end = timestamp;
+            current_ = 1 - current_;
+            current().reset(timestamp);
+        } else {
+            if (cycle.active()) {
+                logger->warn("녹색 종료 없이 녹색 시작 수신 ({} -> {}) - 주기 폐기", cycle.start, timestamp);
+                cycles_discarded_++;
+            }
+            closing.reset(-1);
+            cycle.reset(timestamp);
+        }
+    }
+
+    // Redis 전송은 잠금 밖에서 (정지선 통과 처리 지연 방지)
+    if (!json_data.empty()) {
+        sendCycle(json_data);
+    }
+}
+
+ArrivalPhase ArrivalMonitor::classify(const ArrivalCycleWindow& window, int timestamp) const {
+    if (window.green_end < 0 || timestamp < window.green_end) {
+        return ArrivalPhase::PHASE_GREEN;
+    }
+    if (timestamp - window.green_end < config_.yellow_sec) {
+        return ArrivalPhase::PHASE_YELLOW;
+    }
+    return ArrivalPhase::PHASE_RED;
+}
+
+void ArrivalMonitor::onStopLineCrossing(int lane_no, int timestamp, double delay_sec,
+                                        int stopped_sec, int stop_count) {
+    if (!config_.enabled) return;
+
+    std::lock_guard<std::mutex> lock(arrival_mutex_);
+
+    // 도착 시각 = 지체 없이 주행했다면 정지선에 닿았을 시각
+    int arrival = timestamp;
+    if (delay_sec >= 0.0) {
+        arrival = timestamp - static_cast<int>(std::lround(delay_sec));
+    }
+
+    ArrivalCycleWindow* window = nullptr;
+    if (current().active() && arrival >= current().start) {
+        window = &current();
+    } else if (previous().active() && arrival >= previous().start) {
+        window = &previous();
+    } else {
+        if (previous().active()) {
+            late_arrivals_++;
+        } else {
+            arrivals_before_first_cycle_++;
+        }
+        return;
+    }
+
+    ArrivalPhase phase = classify(*window, arrival);
+    uint16_t offset = static_cast<uint16_t>(std::min(arrival - window->start, 65535));
+
+    // 접근로 합계(0)와 해당 차로
+    int targets[2] = {0, (lane_no > 0 && lane_no <= total_lanes_) ? lane_no : 0};
+    int target_count = targets[1] > 0 ? 2 : 1;
+
+    for (int i = 0; i < target_count; i++) {
+        LaneArrivalCounts& counts = window->lanes[targets[i]];
+        switch (phase) {
+            case ArrivalPhase::PHASE_GREEN:  counts.green++;  break;
+            case ArrivalPhase::PHASE_YELLOW: counts.yellow++; break;
+            case ArrivalPhase::PHASE_RED:    counts.red++;    break;
+        }
+        if (counts.offsets.size() < counts.offsets.capacity()) {
+            counts.offsets.push_back(offset);
+        } else {
+            counts.series_dropped++;
+        }
+        if (delay_sec >= 0.0) {
+            counts.delay_count++;
+            counts.delay_sum += delay_sec;
+            counts.stopped_sum += stopped_sec;
+            counts.stops_sum += stop_count;
+        }
+    }
+}
+
+ArrivalCycleMetrics ArrivalMonitor::computeMetrics(const LaneArrivalCounts& counts,
+                                                   int cycle_sec, int green_sec) const {
+    ArrivalCycleMetrics metrics;
+    metrics.total = counts.total();
+    if (metrics.total <= 0) {
+        return metrics;
+    }
+
+    metrics.aog_ratio = static_cast<double>(counts.green) / metrics.total;
+    if (green_sec > 0 && cycle_sec > 0) {
+        metrics.platoon_ratio = metrics.aog_ratio * cycle_sec / green_sec;
+    }
+    return metrics;
+}
+
+bool ArrivalMonitor::buildCycleJson(const ArrivalCycleWindow& window, std::string& json_data) {
+    int cycle_sec = window.end - window.start;
+    int green_sec = window.green_end - window.start;
+
+    if (cycle_sec < config_.min_cycle_sec || cycle_sec > config_.max_cycle_sec || green_sec <= 0) {
+        logger->warn("비정상 주기 폐기 - 시작: {}, 주기: {}초, 녹색: {}초", window.start, cycle_sec, green_sec);
+        cycles_discarded_++;
+        return false;
+    }
+
+    try {
+        Json::Value root;
+        Json::Value lanes(Json::arrayValue);
+        Json::FastWriter writer;
+
+        auto round3 = [](double value) { return std::round(value * 1000.0) / 1000.0; };
+        auto fill = [&](Json::Value& item, const LaneArrivalCounts& counts) {
+            ArrivalCycleMetrics metrics = computeMetrics(counts, cycle_sec, green_sec);
+            item["arvl_cnt"] = metrics.total;
+            item["grn_arvl_cnt"] = counts.green;
+            item["ylw_arvl_cnt"] = counts.yellow;
+            item["red_arvl_cnt"] = counts.red;
+            item["aog_rt"] = round3(metrics.aog_ratio);
+            item["pltn_rt"] = round3(metrics.platoon_ratio);
+
+            Json::Value offsets(Json::arrayValue);
+            for (uint16_t offset : counts.offsets) {
+                offsets.append(offset);
+            }
+            item["arvl_ofst"] = offsets;
+            if (counts.series_dropped > 0) {
+                item["ofst_drop_cnt"] = counts.series_dropped;
+            }
+            if (counts.delay_count > 0) {
+                item["avg_dly_sec"] = round3(counts.delay_sum / counts.delay_count);
+                item["avg_stop_sec"] = round3(static_cast<double>(counts.stopped_sum) / counts.delay_count);
+                item["avg_stop_cnt"] = round3(static_cast<double>(counts.stops_sum) / counts.delay_count);
+            }
+            return metrics;
+        };
+
+        for (int lane = 1; lane <= total_lanes_; lane++) {
+            Json::Value item;
+            item["lane_no"] = lane;
+            fill(item, window.lanes[lane]);
+            lanes.append(item);
+        }
+
+        Json::Value approach;
+        const LaneArrivalCounts& approach_counts = window.lanes[0];
+        ArrivalCycleMetrics total = fill(approach, approach_counts);
+
+        root["cycl_bgng_unix_tm"] = window.start;
+        root["cycl_end_unix_tm"] = window.end;
+        root["arvl_tm_bss"] = delay_available_ ? "delay" : "stop_line";
+        root["cycl_sec"] = cycle_sec;
+        root["grn_sec"] = green_sec;
+        root["ylw_sec"] = std::min(config_.yellow_sec, cycle_sec - green_sec);
+        root["lanes"] = lanes;
+        root["approach"] = approach;
+
+        json_data = writer.write(root);
+
+        cycles_analyzed_++;
+        sum_aog_ratio_ += total.aog_ratio;
+        logger->info("주기 도착 분석 - 주기: {}초 (녹색 {}초), 도착: {}대 (녹/황/적 {}/{}/{}), AOG: {:.1f}%, 군집비: {:.2f}",
+                    cycle_sec, green_sec, total.total, approach_counts.green, approach_counts.yellow,
+                    approach_counts.red,
+                    total.aog_ratio * 100.0, total.platoon_ratio);
+        return true;
+
+    } catch (const std::exception& e) {
+        logger->error("주기 도착 분석 JSON 생성 실패: {}", e.what());
+        return false;
+    }
+}
+
+bool ArrivalMonitor::sendCycle(const std::string& json_data) {
+    int result = redis_client_->sendData(CHANNEL_ARRIVAL, json_data);
+    if (result != 0) {
+        logger->error("주기 도착 분석 전송 실패 (결과: {})", result);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(arrival_mutex_);
+    cycles_sent_++;
+    return true;
+}
+
+void ArrivalMonitor::logStatistics() const {
+    if (!config_.enabled) return;
+
+    std::lock_guard<std::mutex> lock(arrival_mutex_);
+
+    logger->info("=== 도착 분석 통계 ===");
+    logger->info("  주기 분석: {}회 (전송 {}회), 폐기: {}회, 첫 주기 이전 도착: {}대, 집계 종료 후 도착: {}대",
+                cycles_analyzed_, cycles_sent_, cycles_discarded_, arrivals_before_first_cycle_,
+                late_arrivals_);
+    if (cycles_analyzed_ > 0) {
+        logger->info("  평균 AOG (접근로): {:.1f}%", sum_aog_ratio_ / cycles_analyzed_ * 100.0);
+    }
+    const ArrivalCycleWindow& cycle = windows_[current_];
+    if (cycle.active()) {
+        logger->info("  현재 주기: 시작 {}, 도착 {}대", cycle.start, cycle.lanes[0].total());
+    }
+}
@@ -0,0 +1,117 @@
+﻿#ifndef ARRIVAL_MONITOR_H
+#define ARRIVAL_MONITOR_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "arrival_types.h"
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+// Forward declaration
+class RedisClient;
+
+/**
+ * @brief 신호 주기별/차로별 도착 분석 (녹색 도착률, 군집비, 도착 시계열)
+ *
+ * 도착 시각 = 정지선 통과 시각 - 접근로 지체 (지체 없이 주행했다면 정지선에 닿았을 시각)
+ * - 적색에 대기 후 녹색에 출발한 차량은 적색 도착으로 분류 (출발 시각 기준이면 녹색 도착)
+ * - 지체 산출 비활성 시 지체 0으로 보고 정지선 통과 시각 사용 (대기 차량 구분 불가)
+ * - 주기: 녹색 시작(GREEN_ON) ~ 다음 녹색 시작
+ * - 상태: 녹색 구간 = GREEN, 녹색 종료 후 yellow_sec 이내 = YELLOW, 이후 = RED
+ * - 정지선 통과: 도착 시각이 속한 주기 창에 카운트 + 시계열 추가 (O(1), 주기 간 재할당 없음)
+ * - 적색 도착 차량은 다음 주기에 정지선을 통과하므로 직전 주기 창을 한 주기 더 열어두고
+ *   그 다음 녹색 시작에 AOG, 군집비 계산 후 도착 시계열과 함께 전송 (한 주기 지연, SQL 미사용)
+ *
+ * 정지선 통과 시각을 직접 측정한 차량만 사용 (회전 ROI에서 추정한 시각은 제외)
+ * 차량 지체 산출이 켜져 있으면 차로별 평균 지체/정지 시간/정지 횟수를 함께 전송
+ */
+class ArrivalMonitor {
+private:
+    // 설정
+    ArrivalConfig config_;
+    int total_lanes_ = 0;
+
+    // 외부 의존성
+    RedisClient* redis_client_ = nullptr;
+
+    // 주기 창 (현재 주기 + 늦은 도착을 받는 직전 주기, 버퍼 교대로 재할당 없음)
+    ArrivalCycleWindow windows_[2];
+    int current_ = 0;
+    bool delay_available_ = false;          // 차량 지체 산출 활성 여부
+
+    mutable std::mutex arrival_mutex_;
+
+    // 통계
+    int cycles_analyzed_ = 0;
+    int cycles_sent_ = 0;
+    int cycles_discarded_ = 0;
+    int arrivals_before_first_cycle_ = 0;
+    int late_arrivals_ = 0;                 // 직전 주기보다 이전 도착 (2주기 이상 대기)
+    double sum_aog_ratio_ = 0.0;            // 전송 주기 평균용 (접근로)
+
+    // 로거
+    std::shared_ptr<spdlog::logger> logger = nullptr;
+
+    // 내부 메서드
+    void loadConfig();
+    ArrivalCycleWindow& current() { return windows_[current_]; }
+    ArrivalCycleWindow& previous() { return windows_[1 - current_]; }
+    ArrivalPhase classify(const ArrivalCycleWindow& window, int timestamp) const;
+    ArrivalCycleMetrics computeMetrics(const LaneArrivalCounts& counts,
+                                       int cycle_sec, int green_sec) const;
+    bool buildCycleJson(const ArrivalCycleWindow& window, std::string& json_data);
+    bool sendCycle(const std::string& json_data);
+
+public:
+    ArrivalMonitor();
+    ~ArrivalMonitor() = default;
+
+    /**
+     * @brief 초기화 - config.json의 vehicle_analytics.arrival 로드
+     * @param redis_client Redis 클라이언트 포인터
+     * @param total_lanes 총 차로 수
+     * @return 성공 시 true
+     */
+    bool initialize(RedisClient* redis_client, int total_lanes);
+
+    /**
+     * @brief 신호 변경 - SystemManager 신호 콜백에서 호출
+     * @param is_green GREEN_ON이면 true
+     * @param timestamp 변경 시각
+     *
+     * GREEN_ON: 직전 주기 창 전송, 현재 주기를 직전 주기 창으로 넘기고 새 주기 시작
+     * GREEN_OFF: 녹색 종료 시각 기록 (이후 도착은 황색/적색)
+     */
+    void onSignalChange(bool is_green, int timestamp);
+
+    /**
+     * @brief 정지선 통과 - process_meta에서 차량별 1회 호출
+     *
+     * 도착 시각(timestamp - delay_sec)이 속한 주기 창에 집계
+     * @param lane_no 차로 번호 (0 이하: 접근로 합계에만 반영)
+     * @param timestamp 정지선 통과 시각
+     * @param delay_sec 접근로 지체 (초, 음수: 미계산 - 정지선 통과 시각을 도착으로 사용)
+     * @param stopped_sec 정지 시간 (초)
+     * @param stop_count 정지 횟수
+     */
+    void onStopLineCrossing(int lane_no, int timestamp, double delay_sec = -1.0,
+                            int stopped_sec = 0, int stop_count = 0);
+
+    /**
+     * @brief 통계 정보 로깅
+     */
+    void logStatistics() const;
+
+    /**
+     * @brief 활성화 상태 확인
+     * @return 활성화시 true
+     */
+    bool isEnabled() const { return config_.enabled; }
+};
+
+#endif // ARRIVAL_MONITOR_H
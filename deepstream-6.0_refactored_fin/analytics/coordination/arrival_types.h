@@ -0,0 +1,92 @@
+﻿#ifndef ARRIVAL_TYPES_H
+#define ARRIVAL_TYPES_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief 신호 주기별 도착 분석 설정
+ */
+struct ArrivalConfig {
+    bool enabled = false;
+    int yellow_sec = 3;                     // 녹색 종료 후 황색으로 보는 시간 (초, 0: 황색 구분 안함)
+    int min_cycle_sec = 20;                 // 유효 주기 최소 길이 (초)
+    int max_cycle_sec = 300;                // 유효 주기 최대 길이 (초)
+    int max_series_per_lane = 200;          // 주기당 차로별 도착 시계열 최대 개수
+};
+
+/**
+ * @brief 도착 시점 신호 상태
+ */
+enum class ArrivalPhase {
+    PHASE_GREEN = 0,
+    PHASE_YELLOW = 1,
+    PHASE_RED = 2
+};
+
+/**
+ * @brief 차로(또는 접근로) 주기 도착 집계
+ *
+ * offsets는 주기 시작(녹색 시작) 기준 도착 시각(초) - 코디네이션 다이어그램용
+ */
+struct LaneArrivalCounts {
+    int green = 0;
+    int yellow = 0;
+    int red = 0;
+    int series_dropped = 0;                 // 최대 개수 초과로 시계열에서 빠진 도착 수
+    std::vector<uint16_t> offsets;          // 주기 시작 기준 도착 시각 (초, 도착 순)
+
+    // 차량 지체 합계 (지체 산출 활성 시에만 누적)
+    int delay_count = 0;                    // 지체가 계산된 도착 수
+    double delay_sum = 0.0;                 // 접근로 지체 합 (초)
+    int stopped_sum = 0;                    // 정지 시간 합 (초)
+    int stops_sum = 0;                      // 정지 횟수 합
+
+    int total() const { return green + yellow + red; }
+
+    void reset() {
+        green = yellow = red = series_dropped = 0;
+        delay_count = stopped_sum = stops_sum = 0;
+        delay_sum = 0.0;
+        offsets.clear();                    // 용량 유지 (주기마다 재할당 없음)
+    }
+};
+
+/**
+ * @brief 신호 주기 1개의 도착 집계 창
+ *
+ * 도착 시각(정지선 통과 - 지체)은 대기 차량이 다음 주기 녹색에 출발할 때 확정되므로
+ * 직전 주기 창을 한 주기 더 열어두고 늦게 확정된 도착을 받음
+ * lanes 인덱스 = 차로 번호, 0 = 접근로 전체
+ */
+struct ArrivalCycleWindow {
+    int start = -1;                         // 녹색 시작 시각 (-1: 비어있음)
+    int green_end = -1;                     // 녹색 종료 시각 (-1: 녹색 진행 중)
+    int end = -1;                           // 다음 녹색 시작 시각 (-1: 진행 중)
+    std::vector<LaneArrivalCounts> lanes;
+
+    bool active() const { return start >= 0; }
+
+    void reset(int cycle_start) {
+        start = cycle_start;
+        green_end = -1;
+        end = -1;
+        for (auto& counts : lanes) {
+            counts.reset();
+        }
+    }
+};
+
+/**
+ * @brief 완료된 주기 지표
+ *
+ * - 녹색 도착률(AOG) = 녹색 도착 / 전체 도착
+ * - 군집비(PR) = AOG / (녹색시간 / 주기) - 1 초과면 녹색에 군집 도착 (연동 양호)
+ */
+struct ArrivalCycleMetrics {
+    int total = 0;
+    double aog_ratio = 0.0;                 // 녹색 도착률 (0~1)
+    double platoon_ratio = 0.0;             // 군집비
+};
+
+#endif // ARRIVAL_TYPES_H
@@ -0,0 +1,93 @@
+﻿/*
+ * split_failure_cycle.cpp
+ *
+ * split failure 주기 관측 상태 구현
+ */
+
+#include "split_failure_cycle.h"
+#include <algorithm>
+
+void SplitFailureCycle::configure(const SplitFailureConfig& config, int total_lanes) {
+    config_ = config;
+    total_lanes_ = total_lanes;
+    lanes_.assign(total_lanes_ + 1, LaneOccupancyCounts());
+    window_ = Window::WAIT_GREEN;
+    green_start_ = green_end_ = red_start_ = -1;
+    green_frames_ = red_frames_ = 0;
+}
+
+void SplitFailureCycle::addFrame(uint32_t occupied_mask, int current_time) {
+    if (window_ == Window::IN_GREEN) {
+        green_frames_++;
+        for (int lane = 1; lane <= total_lanes_; lane++) {
+            if (occupied_mask & (1u << lane)) lanes_[lane].green_occupied++;
+        }
+    } else if (window_ == Window::IN_RED && current_time >= red_start_ &&
+               current_time < red_start_ + config_.red_window_sec) {
+        red_frames_++;
+        for (int lane = 1; lane <= total_lanes_; lane++) {
+            if (occupied_mask & (1u << lane)) lanes_[lane].red_occupied++;
+        }
+    }
+}
+
+SplitFailureCycle::Outcome SplitFailureCycle::onSignalChange(bool is_green, int timestamp,
+                                                             SplitFailureCycleResult& result) {
+    if (!is_green) {
+        if (window_ == Window::IN_GREEN) {
+            green_end_ = timestamp;
+            red_start_ = timestamp + config_.yellow_sec;
+            window_ = Window::IN_RED;
+        }
+        return Outcome::NONE;
+    }
+
+    // 적색이 관측 시간보다 짧으면 관측한 만큼으로 판정
+    Outcome outcome = Outcome::NONE;
+    if (window_ == Window::IN_RED) {
+        outcome = evaluate(result);
+    }
+    resetCounts();
+    green_start_ = timestamp;
+    green_end_ = red_start_ = -1;
+    window_ = Window::IN_GREEN;
+    return outcome;
+}
+
+SplitFailureCycle::Outcome SplitFailureCycle::onSecond(int current_time, SplitFailureCycleResult& result) {
+    if (window_ != Window::IN_RED || current_time < red_start_ + config_.red_window_sec) {
+        return Outcome::NONE;
+    }
+    window_ = Window::WAIT_GREEN;
+    return evaluate(result);
+}
+
+SplitFailureCycle::Outcome SplitFailureCycle::evaluate(SplitFailureCycleResult& result) const {
+    result = SplitFailureCycleResult();
+    result.green_start = green_start_;
+    result.green_end = green_end_;
+    result.red_start = red_start_;
+    result.green_sec = green_end_ - green_start_;
+
+    if (result.green_sec < config_.min_green_sec || green_frames_ == 0 || red_frames_ == 0) {
+        return Outcome::SKIPPED;
+    }
+
+    result.lanes.reserve(total_lanes_);
+    for (int lane = 1; lane <= total_lanes_; lane++) {
+        SplitFailureLaneResult item;
+        item.lane_no = lane;
+        item.gor = static_cast<double>(lanes_[lane].green_occupied) / green_frames_;
+        item.ror = static_cast<double>(lanes_[lane].red_occupied) / red_frames_;
+        item.failed = item.gor >= config_.gor_threshold && item.ror >= config_.ror_threshold;
+        if (item.failed) result.failed_lanes++;
+        result.lanes.push_back(item);
+    }
+    return Outcome::EVALUATED;
+}
+
+void SplitFailureCycle::resetCounts() {
+    green_frames_ = 0;
+    red_frames_ = 0;
+    std::fill(lanes_.begin(), lanes_.end(), LaneOccupancyCounts());
+}
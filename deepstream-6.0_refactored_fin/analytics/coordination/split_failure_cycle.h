@@ -0,0 +1,79 @@
+﻿#ifndef SPLIT_FAILURE_CYCLE_H
+#define SPLIT_FAILURE_CYCLE_H
+
+#include <cstdint>
+#include <vector>
+#include "split_failure_types.h"
+
+/**
+ * @brief split failure 주기 관측 상태 (신호 변경 + 프레임 점유 -> 차로별 GOR/ROR 판정)
+ *
+ * 녹색 종료 신호 후 황색(yellow_sec)을 거쳐 적색으로 봄
+ * - 녹색: 녹색 시작 ~ 녹색 종료 프레임으로 GOR
+ * - 황색: 점유를 세지 않음 (황색 중 정지선을 통과하는 차량이 ROR에 들어가지 않도록)
+ * - 적색: 녹색 종료 + yellow_sec부터 red_window_sec 동안 프레임으로 ROR
+ *
+ * 잠금/전송 없음 - SplitFailureDetector가 잠금과 결과 전송 담당
+ */
+class SplitFailureCycle {
+public:
+    /**
+     * @brief 주기 종료 처리 결과
+     */
+    enum class Outcome {
+        NONE,           // 주기 진행 중 (결과 없음)
+        EVALUATED,      // 판정 완료 (result 유효)
+        SKIPPED         // 관측 부족으로 판정 생략
+    };
+
+private:
+    enum class Window {
+        WAIT_GREEN,     // 첫 녹색 대기 또는 적색 관측 종료 후
+        IN_GREEN,       // 녹색 진행 중
+        IN_RED          // 황색 + 적색 초반 관측 중
+    };
+
+    SplitFailureConfig config_;
+    int total_lanes_ = 0;
+
+    Window window_ = Window::WAIT_GREEN;
+    int green_start_ = -1;
+    int green_end_ = -1;
+    int red_start_ = -1;
+    uint32_t green_frames_ = 0;
+    uint32_t red_frames_ = 0;
+    std::vector<LaneOccupancyCounts> lanes_;    // 인덱스 = 차로 번호 (0 미사용)
+
+    Outcome evaluate(SplitFailureCycleResult& result) const;
+    void resetCounts();
+
+public:
+    /**
+     * @brief 설정/차로 수 지정 (관측 상태 초기화)
+     */
+    void configure(const SplitFailureConfig& config, int total_lanes);
+
+    /**
+     * @brief 프레임 점유 누적
+     * @param occupied_mask 정지선 구역 점유 차로 비트 (bit n = 차로 n)
+     * @param current_time 현재 시간
+     */
+    void addFrame(uint32_t occupied_mask, int current_time);
+
+    /**
+     * @brief 신호 변경
+     * @param is_green GREEN_ON이면 true
+     * @param timestamp 변경 시각
+     * @param result 적색 관측 중 녹색이 시작되면 관측한 만큼으로 판정한 결과
+     */
+    Outcome onSignalChange(bool is_green, int timestamp, SplitFailureCycleResult& result);
+
+    /**
+     * @brief 매 초 호출 - 적색 관측 시간이 끝나면 판정
+     * @param current_time 현재 시간
+     * @param result 판정 결과
+     */
+    Outcome onSecond(int current_time, SplitFailureCycleResult& result);
+};
+
+#endif // SPLIT_FAILURE_CYCLE_H
@@ -0,0 +1,315 @@
+﻿/*
+ * split_failure_detector.cpp
+ *
+ * 차로별/주기별 split failure 감지기 구현
+ * - 초기화 시 정지선 구역 격자 생성, 프레임마다 차로 비트 검사와 카운터 증가만 수행
+ * - 황색 이후 적색 초반 관측이 끝나면 주기 결과 전송
+ */
+
+#include "split_failure_detector.h"
+#include "../../calibration/calibration.h"
+#include "../../data/redis/channel_types.h"
+#include "../../data/redis/redis_client.h"
+#include "../../json/json.h"
+#include "../../roi_module/roi_handler.h"
+#include "../../utils/config_manager.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+// 점과 선분 사이 거리 (좌표 단위 그대로)
+double distanceToSegment(double px, double py, double ax, double ay, double bx, double by) {
+    double vx = bx - ax;
+    double vy = by - ay;
+    double len2 = vx * vx + vy * vy;
+    double t = 0.0;
+    if (len2 > 0.0) {
+        t = std::clamp(((px - ax) * vx + (py - ay) * vy) / len2, 0.0, 1.0);
+    }
+    return std::hypot(px - (ax + t * vx), py - (ay + t * vy));
+}
+
+}  // namespace
+
+SplitFailureDetector::SplitFailureDetector() {
+    logger = getLogger("DS_SplitFailure_log");
+    logger->info("SplitFailureDetector 생성");
+}
+
+bool SplitFailureDetector::initialize(RedisClient* redis_client, ROIHandler* roi_handler, int total_lanes) {
+    try {
+        redis_client_ = redis_client;
+        total_lanes_ = total_lanes;
+
+        if (!redis_client_ || !roi_handler) {
+            logger->error("Redis 클라이언트 또는 ROI 핸들러가 없음 - split failure 감지 초기화 실패");
+            return false;
+        }
+
+        if (total_lanes_ <= 0) {
+            logger->error("차로 수가 유효하지 않음: {}", total_lanes_);
+            return false;
+        }
+        if (total_lanes_ > MAX_LANES) {
+            logger->warn("차로 수 {} 중 {}차로까지만 감지", total_lanes_, MAX_LANES);
+            total_lanes_ = MAX_LANES;
+        }
+
+        loadConfig();
+
+        if (!buildZoneGrid(roi_handler)) {
+            return false;
+        }
+
+        cycle_.configure(config_, total_lanes_);
+        lane_failures_.assign(total_lanes_ + 1, 0);
+
+        logger->info("split failure 감지 초기화 완료 - 차로: {}, GOR/ROR 임계값: {:.2f}/{:.2f}, 황색: {}초, 적색 관측: {}초",
+                    total_lanes_, config_.gor_threshold, config_.ror_threshold,
+                    config_.yellow_sec, config_.red_window_sec);
+        if (metric_zone_) {
+            logger->info("  - 정지선 구역: 정지선 상류 {:.1f}m", config_.zone_length_m);
+        } else {
+            logger->warn("  - 정지선 구역: 정지선 상류 {:.0f}px (Calibration 미적용)", config_.zone_length_px);
+        }
+        return true;
+
+    } catch (const std::exception& e) {
+        logger->error("split failure 감지 초기화 실패: {}", e.what());
+        return false;
+    }
+}
+
+void SplitFailureDetector::loadConfig() {
+    auto& config = ConfigManager::getInstance();
+    const std::string base_key = "processing_modules.vehicle_analytics.split_failure";
+
+    config_.enabled = config.isSplitFailureEnabled();
+    config_.gor_threshold = config.getDouble(base_key + ".gor_threshold", 0.8);
+    config_.ror_threshold = config.getDouble(base_key + ".ror_threshold", 0.8);
+    config_.red_window_sec = config.getInt(base_key + ".red_window_sec", 5);
+    config_.min_green_sec = config.getInt(base_key + ".min_green_sec", 5);
+    config_.zone_length_m = config.getDouble(base_key + ".zone_length_m", 12.0);
+    config_.zone_length_px = config.getDouble(base_key + ".zone_length_px", 150.0);
+    config_.grid_cell_px = config.getInt(base_key + ".grid_cell_px", 8);
+    // 황색 시간은 도착 분석과 같은 값 사용 (주기 구간 정의 일치)
+    config_.yellow_sec = config.getInt("processing_modules.vehicle_analytics.arrival.yellow_sec", 3);
+
+    config_.gor_threshold = std::clamp(config_.gor_threshold, 0.0, 1.0);
+    config_.ror_threshold = std::clamp(config_.ror_threshold, 0.0, 1.0);
+    if (config_.red_window_sec <= 0) {
+        logger->warn("잘못된 red_window_sec 값: {} - 기본값 5 사용", config_.red_window_sec);
+        config_.red_window_sec = 5;
+    }
+    config_.min_green_sec = std::max(1, config_.min_green_sec);
+    config_.yellow_sec = std::max(0, config_.yellow_sec);
+    if (config_.zone_length_m <= 0.0) config_.zone_length_m = 12.0;
+    if (config_.zone_length_px <= 0.0) config_.zone_length_px = 150.0;
+    config_.grid_cell_px = std::clamp(config_.grid_cell_px, 2, 64);
+}
+
+bool SplitFailureDetector::buildZoneGrid(ROIHandler* roi_handler) {
+    if (ROIHandler::lane_roi.empty()) {
+        logger->warn("차로 ROI 없음 - 정지선 구역 생성 불가");
+        return false;
+    }
+    if (ROIHandler::stop_line_roi.size() < 2) {
+        logger->warn("정지선 ROI 없음 - 정지선 구역 생성 불가");
+        return false;
+    }
+
+    auto build_start = std::chrono::steady_clock::now();
+    const ObjPoint& s0 = ROIHandler::stop_line_roi[0];
+    const ObjPoint& s1 = ROIHandler::stop_line_roi[1];
+
+    // 정지선 지면 좌표 (Calibration 미적용이면 픽셀 거리 사용)
+    double g0x = 0, g0y = 0, g1x = 0, g1y = 0;
+    metric_zone_ = groundPosition(0, s0.x, s0.y, g0x, g0y) && groundPosition(0, s1.x, s1.y, g1x, g1y);
+
+    // 차로 ROI 외곽 범위로 격자 한정
+    double min_x = std::numeric_limits<double>::max();
+    double min_y = std::numeric_limits<double>::max();
+    double max_x = std::numeric_limits<double>::lowest();
+    double max_y = std::numeric_limits<double>::lowest();
+    for (const auto& [idx, polygon] : ROIHandler::lane_roi) {
+        for (const auto& pt : polygon) {
+            min_x = std::min(min_x, pt.x);
+            min_y = std::min(min_y, pt.y);
+            max_x = std::max(max_x, pt.x);
+            max_y = std::max(max_y, pt.y);
+        }
+    }
+    if (max_x <= min_x || max_y <= min_y) {
+        logger->warn("유효한 차로 ROI 없음 - 정지선 구역 생성 불가");
+        return false;
+    }
+
+    const int cell = config_.grid_cell_px;
+    grid_origin_x_ = static_cast<int>(std::floor(min_x));
+    grid_origin_y_ = static_cast<int>(std::floor(min_y));
+    grid_cols_ = static_cast<int>(std::ceil(max_x - grid_origin_x_)) / cell + 1;
+    grid_rows_ = static_cast<int>(std::ceil(max_y - grid_origin_y_)) / cell + 1;
+    zone_grid_.assign(static_cast<size_t>(grid_cols_) * grid_rows_, 0);
+
+    std::vector<int> lane_cells(total_lanes_ + 1, 0);
+    for (int row = 0; row < grid_rows_; row++) {
+        for (int col = 0; col < grid_cols_; col++) {
+            ObjPoint center = {grid_origin_x_ + (col + 0.5) * cell, grid_origin_y_ + (row + 0.5) * cell};
+            int lane = roi_handler->getLaneNum(center);
+            if (lane <= 0 || lane > total_lanes_) continue;
+
+            double distance = 0.0;
+            if (metric_zone_) {
+                double wx, wy;
+                if (!groundPosition(0, center.x, center.y, wx, wy)) continue;
+                distance = distanceToSegment(wx, wy, g0x, g0y, g1x, g1y);
+                if (distance > config_.zone_length_m) continue;
+            } else {
+                distance = distanceToSegment(center.x, center.y, s0.x, s0.y, s1.x, s1.y);
+                if (distance > config_.zone_length_px) continue;
+            }
+
+            zone_grid_[static_cast<size_t>(row) * grid_cols_ + col] = static_cast<uint8_t>(lane);
+            lane_cells[lane]++;
+        }
+    }
+
+    int empty_lanes = 0;
+    for (int lane = 1; lane <= total_lanes_; lane++) {
+        logger->debug("  - 차로 {} 정지선 구역: {}칸", lane, lane_cells[lane]);
+        if (lane_cells[lane] == 0) empty_lanes++;
+    }
+    if (empty_lanes == total_lanes_) {
+        logger->warn("정지선 구역이 비어 있음 - 구역 길이/ROI 확인 필요");
+        grid_cols_ = grid_rows_ = 0;
+        zone_grid_.clear();
+        return false;
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>
+                  (std::chrono::steady_clock::now() - build_start);
+    logger->info("정지선 구역 격자 생성: {}x{} ({}px), 구역 없는 차로: {}개 ({}ms)",
+                grid_cols_, grid_rows_, cell, empty_lanes, elapsed.count());
+    return true;
+}
+
+void SplitFailureDetector::updateFrame(uint32_t occupied_mask, int current_time) {
+    if (!config_.enabled) return;
+
+    std::lock_guard<std::mutex> lock(split_mutex_);
+    cycle_.addFrame(occupied_mask, current_time);
+}
+
+void SplitFailureDetector::onSignalChange(bool is_green, int timestamp) {
+    if (!config_.enabled) return;
+
+    std::string json_data;
+    {
+        std::lock_guard<std::mutex> lock(split_mutex_);
+        SplitFailureCycleResult result;
+        finishCycle(cycle_.onSignalChange(is_green, timestamp, result), result, json_data);
+    }
+
+    if (!json_data.empty()) {
+        sendCycle(json_data);
+    }
+}
+
+void SplitFailureDetector::updatePerSecond(int current_time) {
+    if (!config_.enabled) return;
+
+    std::string json_data;
+    {
+        std::lock_guard<std::mutex> lock(split_mutex_);
+        SplitFailureCycleResult result;
+        finishCycle(cycle_.onSecond(current_time, result), result, json_data);
+    }
+
+    if (!json_data.empty()) {
+        sendCycle(json_data);
+    }
+}
+
+bool SplitFailureDetector::finishCycle(SplitFailureCycle::Outcome outcome,
+                                       const SplitFailureCycleResult& result, std::string& json_data) {
+    if (outcome == SplitFailureCycle::Outcome::SKIPPED) {
+        logger->debug("split failure 판정 생략 - 녹색: {}초 (녹색 시작: {}, 적색 시작: {})",
+                     result.green_sec, result.green_start, result.red_start);
+        cycles_skipped_++;
+        return false;
+    }
+    if (outcome != SplitFailureCycle::Outcome::EVALUATED) {
+        return false;
+    }
+    return buildCycleJson(result, json_data);
+}
+
+bool SplitFailureDetector::buildCycleJson(const SplitFailureCycleResult& result, std::string& json_data) {
+    try {
+        Json::Value root;
+        Json::Value lanes(Json::arrayValue);
+        Json::FastWriter writer;
+
+        for (const auto& lane : result.lanes) {
+            Json::Value item;
+            item["lane_no"] = lane.lane_no;
+            item["gor"] = std::round(lane.gor * 1000.0) / 1000.0;
+            item["ror"] = std::round(lane.ror * 1000.0) / 1000.0;
+            item["splt_fail_yn"] = lane.failed ? "Y" : "N";
+            lanes.append(item);
+
+            if (lane.failed) {
+                lane_failures_[lane.lane_no]++;
+            }
+        }
+
+        root["grn_bgng_unix_tm"] = result.green_start;
+        root["red_bgng_unix_tm"] = result.red_start;
+        root["grn_sec"] = result.green_sec;
+        root["ylw_sec"] = result.red_start - result.green_end;
+        root["red_wndw_sec"] = config_.red_window_sec;
+        root["splt_fail_lane_cnt"] = result.failed_lanes;
+        root["lanes"] = lanes;
+
+        json_data = writer.write(root);
+
+        cycles_evaluated_++;
+        if (result.failed_lanes > 0) {
+            failure_cycles_++;
+            logger->info("split failure 감지 - 녹색 시작: {}, 실패 차로: {}/{}",
+                        result.green_start, result.failed_lanes, total_lanes_);
+        }
+        return true;
+
+    } catch (const std::exception& e) {
+        logger->error("split failure JSON 생성 실패: {}", e.what());
+        return false;
+    }
+}
+
+bool SplitFailureDetector::sendCycle(const std::string& json_data) {
+    int result = redis_client_->sendData(CHANNEL_SPLIT_FAILURE, json_data);
+    if (result != 0) {
+        logger->error("split failure 결과 전송 실패 (결과: {})", result);
+        return false;
+    }
+    return true;
+}
+
+void SplitFailureDetector::logStatistics() const {
+    if (!config_.enabled) return;
+
+    std::lock_guard<std::mutex> lock(split_mutex_);
+
+    logger->info("=== split failure 감지 통계 ===");
+    logger->info("  판정 주기: {}회, 실패 주기: {}회, 생략: {}회",
+                cycles_evaluated_, failure_cycles_, cycles_skipped_);
+    for (int lane = 1; lane <= total_lanes_; lane++) {
+        if (lane_failures_[lane] > 0) {
+            logger->info("  [차로 {}] 실패: {}회", lane, lane_failures_[lane]);
+        }
+    }
+}
@@ -0,0 +1,140 @@
+﻿#ifndef SPLIT_FAILURE_DETECTOR_H
+#define SPLIT_FAILURE_DETECTOR_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "split_failure_cycle.h"
+#include "split_failure_types.h"
+#include "../../common/common_types.h"
+#include "../../common/object_data.h"
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+// Forward declarations
+class RedisClient;
+class ROIHandler;
+
+/**
+ * @brief 차로별/주기별 split failure 감지기
+ *
+ * 정지선 상류 zone_length_m 구간(차로 ROI 내부)을 차로별 정지선 구역으로 보고
+ * - 녹색 점유율(GOR) = 녹색 중 구역 점유 프레임 / 녹색 프레임
+ * - 적색 점유율(ROR) = 적색 시작(녹색 종료 + 황색 yellow_sec) 후 red_window_sec 동안 점유 프레임 / 해당 프레임
+ * - GOR >= gor_threshold 이고 ROR >= ror_threshold 이면 해당 차로 주기 실패
+ *
+ * 초기화 시 픽셀 격자마다 정지선 구역 차로 번호를 미리 계산
+ * - 차량: 격자 조회 1회로 차로 비트 설정 (zoneBit)
+ * - 프레임: 차로별 비트 검사 + 카운터 증가 (updateFrame)
+ * - 적색 관측 종료 시 주기 결과 1회 전송 (SQL 미사용)
+ */
+class SplitFailureDetector {
+public:
+    static constexpr int MAX_LANES = 31;    // 프레임 점유 비트마스크 크기
+
+private:
+    // 설정
+    SplitFailureConfig config_;
+    int total_lanes_ = 0;
+
+    // 외부 의존성
+    RedisClient* redis_client_ = nullptr;
+
+    // 정지선 구역 조회 격자 (초기화 후 불변, 0: 구역 밖, n: 차로 n)
+    std::vector<uint8_t> zone_grid_;
+    int grid_origin_x_ = 0;
+    int grid_origin_y_ = 0;
+    int grid_cols_ = 0;
+    int grid_rows_ = 0;
+    bool metric_zone_ = false;              // Calibration 기반 구역 여부
+
+    // 현재 주기 상태
+    SplitFailureCycle cycle_;
+
+    mutable std::mutex split_mutex_;
+
+    // 통계
+    int cycles_evaluated_ = 0;
+    int cycles_skipped_ = 0;
+    int failure_cycles_ = 0;                // 실패 차로가 1개 이상인 주기
+    std::vector<int> lane_failures_;        // 차로별 누적 실패 횟수
+
+    // 로거
+    std::shared_ptr<spdlog::logger> logger = nullptr;
+
+    // 내부 메서드
+    void loadConfig();
+    bool buildZoneGrid(ROIHandler* roi_handler);
+    bool finishCycle(SplitFailureCycle::Outcome outcome, const SplitFailureCycleResult& result,
+                     std::string& json_data);
+    bool buildCycleJson(const SplitFailureCycleResult& result, std::string& json_data);
+    bool sendCycle(const std::string& json_data);
+
+public:
+    SplitFailureDetector();
+    ~SplitFailureDetector() = default;
+
+    /**
+     * @brief 초기화 - config.json의 vehicle_analytics.split_failure 로드 및 구역 격자 생성
+     * @param redis_client Redis 클라이언트 포인터
+     * @param roi_handler ROI 핸들러 포인터 (차로/정지선 ROI)
+     * @param total_lanes 총 차로 수
+     * @return 성공 시 true
+     */
+    bool initialize(RedisClient* redis_client, ROIHandler* roi_handler, int total_lanes);
+
+    /**
+     * @brief 차량 위치의 정지선 구역 차로 비트 (스트리밍 스레드, 잠금 없음)
+     * @param pos 차량 하단 중심 좌표
+     * @return 구역 내부면 (1 << 차로 번호), 외부면 0
+     */
+    uint32_t zoneBit(const ObjPoint& pos) const {
+        if (grid_cols_ <= 0) return 0;
+        int col = (static_cast<int>(pos.x) - grid_origin_x_) / config_.grid_cell_px;
+        int row = (static_cast<int>(pos.y) - grid_origin_y_) / config_.grid_cell_px;
+        if (pos.x < grid_origin_x_ || pos.y < grid_origin_y_ ||
+            col >= grid_cols_ || row >= grid_rows_) {
+            return 0;
+        }
+        uint8_t lane = zone_grid_[static_cast<size_t>(row) * grid_cols_ + col];
+        return lane ? (1u << lane) : 0;
+    }
+
+    /**
+     * @brief 프레임 점유 누적 - process_meta에서 매 프레임 호출
+     * @param occupied_mask 정지선 구역 점유 차로 비트 (zoneBit의 OR)
+     * @param current_time 현재 시간
+     */
+    void updateFrame(uint32_t occupied_mask, int current_time);
+
+    /**
+     * @brief 신호 변경 - SystemManager 신호 콜백에서 호출
+     * @param is_green GREEN_ON이면 true
+     * @param timestamp 변경 시각
+     */
+    void onSignalChange(bool is_green, int timestamp);
+
+    /**
+     * @brief 매 초 호출 - 적색 관측 시간이 끝나면 주기 결과 전송
+     * @param current_time 현재 시간
+     */
+    void updatePerSecond(int current_time);
+
+    /**
+     * @brief 통계 정보 로깅
+     */
+    void logStatistics() const;
+
+    /**
+     * @brief 활성화 상태 확인
+     * @return 활성화시 true
+     */
+    bool isEnabled() const { return config_.enabled; }
+};
+
+#endif // SPLIT_FAILURE_DETECTOR_H
@@ -0,0 +1,55 @@
+﻿#ifndef SPLIT_FAILURE_TYPES_H
+#define SPLIT_FAILURE_TYPES_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief 정지선 구역 점유율 기반 주기 실패(split failure) 판정 설정
+ *
+ * 녹색 점유율(GOR)과 적색 초반 점유율(ROR)이 모두 임계값 이상이면
+ * 녹색 동안 대기행렬이 해소되지 않은 것으로 판정
+ */
+struct SplitFailureConfig {
+    bool enabled = false;
+    double gor_threshold = 0.8;             // 녹색 점유율 임계값 (0~1)
+    double ror_threshold = 0.8;             // 적색 초반 점유율 임계값 (0~1)
+    int red_window_sec = 5;                 // 적색 초반 관측 시간 (초, 황색 종료 후부터)
+    int yellow_sec = 3;                     // 녹색 종료 후 황색 시간 (초, arrival.yellow_sec 공유)
+    int min_green_sec = 5;                  // 판정 최소 녹색 시간 (초)
+    double zone_length_m = 12.0;            // 정지선 구역 길이 (m, 정지선 상류 방향)
+    double zone_length_px = 150.0;          // Calibration 미적용 시 구역 길이 (픽셀)
+    int grid_cell_px = 8;                   // 구역 조회 격자 크기 (픽셀)
+};
+
+/**
+ * @brief 차로별 주기 점유 프레임 수
+ */
+struct LaneOccupancyCounts {
+    uint32_t green_occupied = 0;            // 녹색 중 구역 점유 프레임
+    uint32_t red_occupied = 0;              // 적색 초반 구역 점유 프레임
+};
+
+/**
+ * @brief 차로별 주기 판정 결과
+ */
+struct SplitFailureLaneResult {
+    int lane_no = 0;
+    double gor = 0.0;
+    double ror = 0.0;
+    bool failed = false;
+};
+
+/**
+ * @brief 주기 판정 결과
+ */
+struct SplitFailureCycleResult {
+    int green_start = -1;                   // 녹색 시작 시각
+    int green_end = -1;                     // 녹색 종료(황색 시작) 시각
+    int red_start = -1;                     // 적색 시작 시각 (녹색 종료 + 황색)
+    int green_sec = 0;
+    int failed_lanes = 0;
+    std::vector<SplitFailureLaneResult> lanes;
+};
+
+#endif // SPLIT_FAILURE_TYPES_H
@@ -76,6 +76,21 @@ bool IncidentDetector::initialize(ROIHandler* roi_handler, RedisClient* redis_cl
 
         logger->debug("의존성 설정 완료");
         
+        // 추적 상태 메모리 예산 - 축출되는 상태의 진행 중 이벤트는 종료 메시지 전송
+        vehicle_states_.attachBudget("incident_vehicles", 2048);
+        vehicle_states_.setEvictCallback([this](const int& id, VehicleTrackingState& state) {
+            int current_time = getCurTime();
+            if (state.stop_event_id > 0) endIncident(state.stop_event_id, current_time);
+            if (state.tail_gate_event_id > 0) endIncident(state.tail_gate_event_id, current_time);
+            if (state.accident_event_id > 0) endIncident(state.accident_event_id, current_time);
+            logger->debug("차량 추적 상태 축출 - ID: {}", id);
+        });
+        pedestrian_states_.attachBudget("incident_pedestrians", 1024);
+        pedestrian_states_.setEvictCallback([this](const int& id, PedestrianTrackingState& state) {
+            if (state.jaywalk_event_id > 0) endIncident(state.jaywalk_event_id, getCurTime());
+            logger->debug("보행자 추적 상태 축출 - ID: {}", id);
+        });
+        
         // ConfigManager 인스턴스 가져오기
         auto& config_manager = ConfigManager::getInstance();
         logger->debug("ConfigManager 인스턴스 획득");
@@ -94,6 +109,39 @@ bool IncidentDetector::initialize(ROIHandler* roi_handler, RedisClient* redis_cl
                 reverse_driving_enabled_,
                 pedestrian_jaywalk_enabled_);
         
+        // 연쇄 이벤트: 위치 기반 정지 레지스트리 생성 (교차로 ROI/Calibration 필요)
+        if (abnormal_stop_sequence_enabled_) {
+            double cell_size_m = config_manager.getDouble("processing_modules.incident_event.stationary_params.cell_size_m",
+                                                          IncidentThresholds::STATIONARY_CELL_SIZE_M);
+            int gap_tolerance_sec = config_manager.getInt("processing_modules.incident_event.stationary_params.gap_tolerance_sec",
+                                                          IncidentThresholds::STATIONARY_GAP_TOLERANCE);
+            
+            if (!stationary_registry_.build({ROIHandler::intersection_roi, ROIHandler::intersection_roi2},
+                                            cell_size_m, gap_tolerance_sec)) {
+                logger->warn("정지 레지스트리 생성 실패 - 추적 ID 기준 정지 시간 사용");
+            }
+        }
+        
+        // 역주행: 차로 방향 격자 생성 (정지선/차로 ROI/Calibration 필요)
+        if (reverse_driving_enabled_) {
+            const std::string base = "processing_modules.incident_event.reverse_params.";
+            const ReverseParams defaults;
+            double cell_size_m = config_manager.getDouble(base + "cell_size_m", IncidentThresholds::REVERSE_CELL_SIZE_M);
+            reverse_params_.min_distance_m = config_manager.getDouble(base + "min_distance_m", defaults.min_distance_m);
+            reverse_params_.min_step_m = config_manager.getDouble(base + "min_step_m", defaults.min_step_m);
+            reverse_params_.min_speed_kmh = config_manager.getDouble(base + "min_speed_kmh", defaults.min_speed_kmh);
+            reverse_params_.min_duration_sec = config_manager.getInt(base + "min_duration_sec", defaults.min_duration_sec);
+            
+            if (!direction_field_.build(ROIHandler::lane_roi, ROIHandler::stop_line_roi, cell_size_m)) {
+                logger->warn("차로 방향 격자 생성 실패 - 역주행 감지 비활성");
+                reverse_driving_enabled_ = false;
+            } else {
+                logger->info("역주행 판단 기준 - 누적 거리: {:.1f}m, 최소 이동: {:.2f}m, 최소 속도: {:.1f}km/h, 최소 지속: {}초",
+                            reverse_params_.min_distance_m, reverse_params_.min_step_m,
+                            reverse_params_.min_speed_kmh, reverse_params_.min_duration_sec);
+            }
+        }
+        
         // 하나라도 활성화되어 있으면 전체 활성화
         enabled_ = abnormal_stop_sequence_enabled_ || reverse_driving_enabled_ || pedestrian_jaywalk_enabled_;
         
@@ -148,21 +196,10 @@ void IncidentDetector::processVehicle(int id, const obj_data& obj, const box& bb
     state.last_update_time = current_time;
     state.in_intersection = roi_handler_->isInInterROI(current_pos);
     
-    // 정지선 근처 여부 판단
-    if (!roi_handler_->stop_line_roi.empty()) {
-        double min_distance = 999999.0;
-        for (const auto& point : roi_handler_->stop_line_roi) {
-            double dist = calculateDistance(current_pos, point);
-            if (dist < min_distance) {
-                min_distance = dist;
-            }
-        }
-        state.near_stop_line = (min_distance < IncidentThresholds::REVERSE_NEAR_STOPLINE_DISTANCE);
-    }
-    
     // 연쇄 이벤트 감지 (차량정지 -> 꼬리물기 -> 사고)
     if (abnormal_stop_sequence_enabled_ && state.in_intersection) {
         // 교차로 내부에서만 연쇄 이벤트 감지
+        updateStationary(id, state, current_time);
         checkVehicleStop(id, state, bbox, surface, current_time);
         checkTailGating(id, state, bbox, surface, current_time);
         checkAccident(id, state, bbox, surface, current_time);
@@ -190,6 +227,56 @@ void IncidentDetector::processPedestrian(int id, const obj_data& obj, const box&
     checkPedestrianJaywalk(id, state, position, bbox, surface, current_time);
 }
 
+void IncidentDetector::updateStationary(int id, VehicleTrackingState& state, int current_time) {
+    if (!stationary_registry_.isReady()) return;
+    if (state.last_speed >= IncidentThresholds::STOP_SPEED_THRESHOLD) return;
+    
+    StationaryRegistry::Observation obs = stationary_registry_.observe(id, state.last_position, current_time);
+    if (!obs.valid) return;
+    
+    // 다른 ID가 보유한 정지 위치
+    if (obs.owner_id != id) {
+        auto prev = vehicle_states_.find(obs.owner_id);
+        
+        // 이전 ID가 최근 1초 내 관측되었으면 서로 다른 차량 (옆 차로 정지 차량 등) - 자체 타이머 사용
+        // (초 경계 직후에는 이전 ID가 아직 이번 초에 갱신되지 않았을 수 있음)
+        if (prev != vehicle_states_.end() && prev->second.last_update_time >= current_time - 1) {
+            if (obs.inherited) {
+                stationary_registry_.detach(state.last_position, id,
+                                            state.stop_start_time > 0 ? state.stop_start_time : current_time);
+            }
+            return;
+        }
+        
+        // 트래커 ID 전환: 이전 ID의 연쇄 이벤트 상태 이관
+        if (prev != vehicle_states_.end() && prev->second.is_stopped && !state.is_stopped) {
+            VehicleTrackingState& old_state = prev->second;
+            
+            state.is_stopped = old_state.is_stopped;
+            state.is_tail_gating = old_state.is_tail_gating;
+            state.is_accident = old_state.is_accident;
+            state.stop_event_id = old_state.stop_event_id;
+            state.tail_gate_event_id = old_state.tail_gate_event_id;
+            state.accident_event_id = old_state.accident_event_id;
+            
+            // 이전 ID 정리 시 이벤트가 종료되지 않도록 초기화
+            old_state.is_stopped = false;
+            old_state.is_tail_gating = false;
+            old_state.is_accident = false;
+            old_state.stop_event_id = 0;
+            old_state.tail_gate_event_id = 0;
+            old_state.accident_event_id = 0;
+        }
+        
+        stationary_registry_.claim(state.last_position, id);
+        logger->info("정지 차량 ID 전환 재연결 - {} -> {}, 정지시간: {}초", obs.owner_id, id, obs.dwell_sec);
+    }
+    
+    // 정지 시간은 위치 기준 (ID가 바뀌어도 유지)
+    state.stop_start_time = current_time - obs.dwell_sec;
+    state.stop_duration = obs.dwell_sec;
+}
+
 void IncidentDetector::checkVehicleStop(int id, VehicleTrackingState& state, const box& bbox,
                                        NvBufSurface* surface, int current_time) {
     // 이미 정지 상태면 스킵
@@ -249,11 +336,6 @@ void IncidentDetector::checkVehicleStop(int id, VehicleTrackingState& state, con
         state.stop_event_id = 0;
         state.tail_gate_event_id = 0;
         state.accident_event_id = 0;
-        
-        // 역주행 관련 상태도 리셋
-        state.reverse_start_time = 0;
-        state.reverse_duration = 0;
-        state.reverse_detected = false;
     }
 }
 
@@ -343,73 +425,36 @@ void IncidentDetector::checkAccident(int id, VehicleTrackingState& state, const
     }
 }
 
-void IncidentDetector::checkReverseDriving(int id, const VehicleTrackingState& state, const box& bbox,
+void IncidentDetector::checkReverseDriving(int id, VehicleTrackingState& state, const box& bbox,
                                           NvBufSurface* surface, int current_time) {
-    // 역주행 이미 감지된 경우 스킵
+    // 역주행 이미 감지된 경우 스킵 (추적 객체당 1회)
     if (state.reverse_detected) return;
     
-    // 정지선 근처가 아니면 역주행 카운터 리셋
-    if (!state.near_stop_line) {
-        auto& mutable_state = vehicle_states_[id];
-        mutable_state.reverse_start_time = 0;
-        mutable_state.reverse_duration = 0;
-        mutable_state.initial_y = 0;
-        return;
-    }
+    double wx, wy;
+    if (!LaneDirectionField::toGround(state.last_position, wx, wy)) return;
     
-    // 속도가 최소 속도 이상이어야 함 (확실한 이동만 감지, 박스 흔들림 제외)
-    if (state.last_speed < IncidentThresholds::REVERSE_MIN_SPEED) {
-        auto& mutable_state = vehicle_states_[id];
-        mutable_state.reverse_start_time = 0;
-        mutable_state.reverse_duration = 0;
-        mutable_state.initial_y = 0;
-        return;
+    // 속도/최소 이동/지속 시간 기준은 LaneDirectionField::updateReverse에서 판단
+    int prev_start = state.reverse.start_time;
+    auto step = direction_field_.updateReverse(state.reverse, wx, wy, current_time, reverse_params_);
+    
+    if (prev_start == 0 && state.reverse.start_time != 0) {
+        logger->debug("차량 {} 역방향 이동 시작 - 차로: {}", id, state.lane_id);
     }
     
-    // 역방향 이동 감지 (Y좌표가 지속적으로 감소)
-    auto& mutable_state = vehicle_states_[id];
+    if (step != LaneDirectionField::ReverseStep::DETECTED) return;
     
-    // 역방향 이동 시작 감지
-    if (mutable_state.reverse_start_time == 0) {
-        // 이전 Y좌표보다 현재 Y좌표가 작으면 (카메라 기준 위로 이동)
-        if (state.last_position.y < mutable_state.initial_y - IncidentThresholds::REVERSE_START_THRESHOLD) {
-            mutable_state.reverse_start_time = current_time;
-            mutable_state.initial_y = state.last_position.y;
-            logger->debug("차량 {} 역방향 이동 시작 감지 - 정지선 근처", id);
-        } else {
-            mutable_state.initial_y = state.last_position.y;
-        }
-    } else {
-        // 계속 역방향으로 이동하는지 확인
-        if (state.last_position.y < mutable_state.initial_y) {
-            // 역방향 이동 지속 시간 계산
-            mutable_state.reverse_duration = current_time - mutable_state.reverse_start_time;
-            
-            // 최소 지속 시간 이상 역방향 이동하면 역주행으로 판단
-            if (mutable_state.reverse_duration >= IncidentThresholds::REVERSE_MIN_DURATION) {
-                // 이동 거리도 확인 (최소 거리 이상)
-                double total_reverse_distance = mutable_state.initial_y - state.last_position.y;
-                if (total_reverse_distance > IncidentThresholds::REVERSE_MIN_DISTANCE) {
-                    // 즉시 이미지 저장
-                    saveIncidentImage(surface, id, bbox, current_time, IncidentType::REVERSE);
-                    
-                    // 역주행 이벤트 생성
-                    int event_id = createIncident(IncidentType::REVERSE, id, current_time);
-                    endIncident(event_id, current_time + 1);  // 1초 후 종료
-                    
-                    mutable_state.reverse_detected = true;
-                    
-                    logger->warn("역주행 감지 - 차량 ID: {}, 차로: {}, 역방향 이동시간: {}초, 이동거리: {:.1f}픽셀", 
-                               id, state.lane_id, mutable_state.reverse_duration, total_reverse_distance);
-                }
-            }
-        } else {
-            // 정방향으로 이동하면 카운터 리셋
-            mutable_state.reverse_start_time = 0;
-            mutable_state.reverse_duration = 0;
-            mutable_state.initial_y = state.last_position.y;
-        }
-    }
+    // 즉시 이미지 저장
+    saveIncidentImage(surface, id, bbox, current_time, IncidentType::REVERSE);
+    
+    // 역주행 이벤트 생성
+    int event_id = createIncident(IncidentType::REVERSE, id, current_time);
+    endIncident(event_id, current_time + 1);  // 1초 후 종료
+    
+    state.reverse_detected = true;
+    
+    logger->warn("역주행 감지 - 차량 ID: {}, 차로: {}, 역방향 이동시간: {}초, 이동거리: {:.1f}m, 속도: {:.1f}km/h", 
+               id, state.lane_id, current_time - state.reverse.start_time, state.reverse.score_m,
+               state.reverse.speed_kmh);
 }
 
 void IncidentDetector::checkPedestrianJaywalk(int id, PedestrianTrackingState& state, 
@@ -618,6 +663,111 @@ void IncidentDetector::onSignalChange(const SignalChangeEvent& event) {
                  prev_phase, current_phase_, current_cycle_);
 }
 
+void IncidentDetector::saveCheckpoint(CheckpointWriter& writer) const {
+    std::lock_guard<std::mutex> lock(incident_mutex_);
+    
+    // 신호 정보
+    writer.put<int32_t>(next_event_id_);
+    writer.put<int32_t>(current_phase_);
+    writer.put<int32_t>(current_cycle_);
+    writer.put<uint8_t>(has_signal_info_ ? 1 : 0);
+    
+    // 진행 중 이벤트 (종료 메시지 전송 대상)
+    writer.put<uint32_t>(static_cast<uint32_t>(active_incidents_.size()));
+    for (const auto& [event_id, incident] : active_incidents_) {
+        writer.put<int32_t>(event_id);
+        writer.put<int32_t>(static_cast<int32_t>(incident.type));
+        writer.put<int32_t>(incident.object_id);
+        writer.put<int32_t>(incident.start_time);
+        writer.putString(incident.image_file);
+        writer.put<int32_t>(incident.stop_start_phase);
+        writer.put<int32_t>(incident.tail_gate_start_cycle);
+    }
+    
+    // 정지 중인 차량 상태만 (주행 차량은 재시작 후 새로 추적)
+    uint32_t stopped = 0;
+    for (const auto& [id, state] : vehicle_states_) {
+        if (id >= 0 && state.stop_start_time > 0) stopped++;
+    }
+    writer.put<uint32_t>(stopped);
+    for (const auto& [id, state] : vehicle_states_) {
+        if (id < 0 || state.stop_start_time == 0) continue;
+        writer.put<int32_t>(id);
+        writer.putPoint(state.last_position);
+        writer.put<double>(state.last_speed);
+        writer.put<int32_t>(state.stop_start_time);
+        writer.put<int32_t>(state.lane_id);
+        writer.put<int32_t>(state.direction);
+        writer.put<uint8_t>((state.in_intersection ? 0x01 : 0) | (state.is_stopped ? 0x02 : 0) |
+                            (state.is_tail_gating ? 0x04 : 0) | (state.is_accident ? 0x08 : 0));
+        writer.put<int32_t>(state.stop_event_id);
+        writer.put<int32_t>(state.tail_gate_event_id);
+        writer.put<int32_t>(state.accident_event_id);
+    }
+    
+    stationary_registry_.save(writer);
+}
+
+bool IncidentDetector::restoreCheckpoint(CheckpointReader& reader, const CheckpointContext& context) {
+    if (!enabled_) return false;
+    
+    std::lock_guard<std::mutex> lock(incident_mutex_);
+    
+    next_event_id_ = std::max(next_event_id_, static_cast<int>(reader.get<int32_t>()));
+    current_phase_ = reader.get<int32_t>();
+    current_cycle_ = reader.get<int32_t>();
+    has_signal_info_ = reader.get<uint8_t>() != 0;
+    
+    uint32_t incident_count = reader.get<uint32_t>();
+    for (uint32_t i = 0; i < incident_count; i++) {
+        int event_id = reader.get<int32_t>();
+        
+        ActiveIncident incident;
+        incident.type = static_cast<IncidentType>(reader.get<int32_t>());
+        incident.object_id = reader.get<int32_t>();   // 발생 메시지의 추적 ID 유지
+        incident.start_time = reader.get<int32_t>();
+        incident.end_time = 0;
+        incident.image_file = reader.getString();
+        incident.end_sent = false;
+        incident.stop_start_phase = reader.get<int32_t>();
+        incident.tail_gate_start_cycle = reader.get<int32_t>();
+        
+        active_incidents_[event_id] = incident;
+    }
+    
+    uint32_t vehicle_count = reader.get<uint32_t>();
+    for (uint32_t i = 0; i < vehicle_count; i++) {
+        int id = reader.get<int32_t>();
+        
+        VehicleTrackingState state{};
+        state.last_position = reader.getPoint();
+        state.last_speed = reader.get<double>();
+        state.stop_start_time = reader.get<int32_t>();
+        state.stop_duration = context.current_time - state.stop_start_time;
+        state.lane_id = reader.get<int32_t>();
+        state.direction = reader.get<int32_t>();
+        uint8_t flags = reader.get<uint8_t>();
+        state.in_intersection = flags & 0x01;
+        state.is_stopped = flags & 0x02;
+        state.is_tail_gating = flags & 0x04;
+        state.is_accident = flags & 0x08;
+        state.stop_event_id = reader.get<int32_t>();
+        state.tail_gate_event_id = reader.get<int32_t>();
+        state.accident_event_id = reader.get<int32_t>();
+        
+        // 현재 시각 이전으로 두어 새 ID로 이관 가능한 상태로 표시
+        state.last_update_time = context.current_time - 1;
+        
+        vehicle_states_[checkpointRestoredId(id)] = state;
+    }
+    
+    int cells = stationary_registry_.restore(reader, context);
+    
+    logger->info("돌발 상태 복원 - 진행 중 이벤트: {}개, 정지 차량: {}대, 정지 셀: {}개, 주기: {}",
+                incident_count, vehicle_count, cells, current_cycle_);
+    return true;
+}
+
 void IncidentDetector::updatePerSecond(int current_time) {
     if (!enabled_) return;
     
@@ -626,6 +776,7 @@ void IncidentDetector::updatePerSecond(int current_time) {
     // 10초마다 오래된 상태 정리
     if (++cleanup_counter >= 10) {
         cleanupOldStates(current_time);
+        stationary_registry_.logStatistics(current_time);
         cleanup_counter = 0;
     }
     
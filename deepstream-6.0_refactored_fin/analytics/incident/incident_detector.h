@@ -8,9 +8,14 @@
 #include <queue>
 #include <vector>
 #include "incident_types.h"
+#include "lane_direction_field.h"
+#include "stationary_registry.h"
 #include "../../common/object_data.h"
 #include "../../common/common_types.h"
+#include "../../data/checkpoint/checkpoint_codec.h"
+#include "../../data/checkpoint/checkpoint_types.h"
 #include "../../server/core/signal_types.h"
+#include "../../utils/bounded_map.h"
 #include "../../json/json.h"
 #include "nvbufsurface.h"
 #include "opencv2/opencv.hpp"
@@ -61,11 +66,8 @@ private:
         int direction;
         bool in_intersection;           // 교차로 내부 여부
         
-        // 역주행 감지용 추가 필드
-        bool near_stop_line;            // 정지선 근처 여부
-        int reverse_start_time;         // 역방향 이동 시작 시간
-        int reverse_duration;           // 역방향 이동 지속 시간
-        double initial_y;               // 역방향 이동 시작시 Y좌표
+        // 역주행 감지용 추가 필드 (도로 평면 미터 좌표)
+        ReverseTrack reverse;           // 누적 역방향 이동 거리/지속 시간/지면 속도
         bool reverse_detected;          // 역주행 감지 여부
         
         // 연쇄 이벤트 추적
@@ -91,9 +93,9 @@ private:
     ImageCropper* image_cropper_;
     ImageStorage* image_storage_;
     
-    // 추적 상태
-    std::map<int, VehicleTrackingState> vehicle_states_;
-    std::map<int, PedestrianTrackingState> pedestrian_states_;
+    // 추적 상태 (메모리 예산 초과 시 LRU 축출 - 진행 중 이벤트는 종료 처리)
+    BoundedMap<int, VehicleTrackingState> vehicle_states_;
+    BoundedMap<int, PedestrianTrackingState> pedestrian_states_;
     
     // 활성 돌발 이벤트 (이벤트ID -> 이벤트 정보)
     std::map<int, ActiveIncident> active_incidents_;
@@ -107,6 +109,13 @@ private:
     // 설정
     std::string incident_image_path_;               // 돌발상황 이미지 저장 경로
     
+    // 역주행 감지 (차로 방향 격자)
+    LaneDirectionField direction_field_;
+    ReverseParams reverse_params_;                  // 역주행 판단 기준
+    
+    // 정지 차량 위치 레지스트리 (트래커 ID 전환 대응)
+    StationaryRegistry stationary_registry_;
+    
     // 활성화 플래그
     bool enabled_;
     bool abnormal_stop_sequence_enabled_;           // 차량정지-꼬리물기-사고 연쇄
@@ -120,6 +129,7 @@ private:
     mutable std::mutex incident_mutex_;
     
     // 내부 메서드 - 연쇄 이벤트 (NvBufSurface와 box 파라미터 추가)
+    void updateStationary(int id, VehicleTrackingState& state, int current_time);
     void checkVehicleStop(int id, VehicleTrackingState& state, const box& bbox, 
                          NvBufSurface* surface, int current_time);
     void checkTailGating(int id, VehicleTrackingState& state, const box& bbox, 
@@ -128,7 +138,7 @@ private:
                       NvBufSurface* surface, int current_time);
     
     // 내부 메서드 - 개별 이벤트 (NvBufSurface와 box 파라미터 추가)
-    void checkReverseDriving(int id, const VehicleTrackingState& state, const box& bbox, 
+    void checkReverseDriving(int id, VehicleTrackingState& state, const box& bbox, 
                             NvBufSurface* surface, int current_time);
     void checkPedestrianJaywalk(int id, PedestrianTrackingState& state, const ObjPoint& position, 
                                 const box& bbox, NvBufSurface* surface, int current_time);
@@ -207,6 +217,24 @@ public:
      */
     bool isEnabled() const { return enabled_; }
     
+    /**
+     * @brief 체크포인트 직렬화 (진행 중 이벤트, 정지 차량 상태, 정지 레지스트리)
+     * @param writer 체크포인트 기록기
+     */
+    void saveCheckpoint(CheckpointWriter& writer) const;
+    
+    /**
+     * @brief 체크포인트 복원
+     * 
+     * 차량 상태는 복원용 음수 ID로 보관 - 같은 위치에 새 ID가 정지하면
+     * 정지 레지스트리를 통해 정지 시간과 연쇄 이벤트가 새 ID로 이관됨
+     * 이관되지 않은 상태는 정리 타임아웃 후 이벤트 종료 메시지와 함께 제거
+     * @param reader 체크포인트 판독기
+     * @param context 복원 컨텍스트
+     * @return 복원 적용 시 true
+     */
+    bool restoreCheckpoint(CheckpointReader& reader, const CheckpointContext& context);
+    
     /**
      * @brief 정기적인 상태 업데이트 (매 초 호출)
      * @param current_time 현재 시간
@@ -25,6 +25,10 @@ namespace IncidentThresholds {
     const double STOP_SPEED_THRESHOLD = 5.0;               // 정지 판단 속도 (5 m/s 미만)
     const int STOP_DURATION_THRESHOLD = 4;                 // 정지 판단 시간 (4초 이상)
 
+    // 위치 기반 정지 레지스트리 (트래커 ID 전환 대응)
+    const double STATIONARY_CELL_SIZE_M = 2.0;             // 정지 위치 격자 셀 크기 (2m)
+    const int STATIONARY_GAP_TOLERANCE = 3;                // 관측 공백 허용 시간 (3초, 이후 셀 만료)
+
     // 사고 감지
     const int ACCIDENT_DURATION_WITHOUT_SIGNAL = 300;      // 신호 정보 없을 때 사고 판단 시간 (5분)
     
@@ -32,12 +36,8 @@ namespace IncidentThresholds {
     const int EVENT_END_TIMEOUT = 60;                      // 이벤트 종료 타임아웃 (60초)
     const int EVENT_CLEANUP_TIMEOUT = 30;                  // 상태 정리 타임아웃 (30초)
     
-    // 역주행 감지 (정지선 근처 장시간 역방향 이동)
-    const double REVERSE_NEAR_STOPLINE_DISTANCE = 100.0;   // 정지선 근처 판단 거리 (100픽셀)
-    const double REVERSE_MIN_SPEED = 5.0;                  // 역주행 판단 최소 속도 (5 m/s)
-    const double REVERSE_MIN_DISTANCE = 50.0;              // 역주행 판단 최소 이동 거리 (50픽셀)
-    const int REVERSE_MIN_DURATION = 10;                   // 역주행 판단 최소 지속 시간 (10초)
-    const double REVERSE_START_THRESHOLD = 10.0;           // 역방향 이동 시작 판단 거리 (10픽셀)
+    // 역주행 감지 (도로 평면 미터 좌표, 차로 방향 격자 기준 - 판단 기준은 ReverseParams, config로 재정의 가능)
+    const double REVERSE_CELL_SIZE_M = 1.0;                // 방향 격자 셀 크기 (1m)
 }
 
 // 돌발 이벤트 JSON 키
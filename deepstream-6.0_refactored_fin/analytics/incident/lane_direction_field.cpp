@@ -0,0 +1,307 @@
+﻿#include "lane_direction_field.h"
+#include "../../calibration/calibration.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+// 점과 선분 사이 거리
+double distanceToSegment(const ObjPoint& p, const ObjPoint& a, const ObjPoint& b) {
+    double vx = b.x - a.x;
+    double vy = b.y - a.y;
+    double len2 = vx * vx + vy * vy;
+    double t = 0.0;
+    if (len2 > 0.0) {
+        t = std::clamp(((p.x - a.x) * vx + (p.y - a.y) * vy) / len2, 0.0, 1.0);
+    }
+    return std::hypot(p.x - (a.x + t * vx), p.y - (a.y + t * vy));
+}
+
+// 점이 다각형 내부인지 (ray casting)
+bool insidePolygon(const std::vector<ObjPoint>& polygon, double x, double y) {
+    bool inside = false;
+    size_t n = polygon.size();
+    for (size_t i = 0, j = n - 1; i < n; j = i++) {
+        const ObjPoint& a = polygon[i];
+        const ObjPoint& b = polygon[j];
+        if ((a.y > y) != (b.y > y) &&
+            x < (b.x - a.x) * (y - a.y) / (b.y - a.y) + a.x) {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
+
+}  // namespace
+
+LaneDirectionField::LaneDirectionField() {
+    logger = getLogger("DS_IncidentDetector_log");
+}
+
+bool LaneDirectionField::toGround(const ObjPoint& p, double& wx, double& wy) {
+    return groundPosition(0, p.x, p.y, wx, wy);
+}
+
+bool LaneDirectionField::build(const std::map<int, std::vector<ObjPoint>>& lane_rois,
+                               const std::vector<ObjPoint>& stop_line, double cell_size_m) {
+    ready_ = false;
+    valid_cells_ = 0;
+    cells_.clear();
+
+    if (lane_rois.empty()) {
+        logger->warn("차로 ROI 없음 - 방향 격자 생성 불가");
+        return false;
+    }
+
+    if (stop_line.size() < 2) {
+        logger->warn("정지선 ROI 없음 - 방향 격자 생성 불가");
+        return false;
+    }
+
+    double test_x, test_y;
+    if (!toGround(stop_line[0], test_x, test_y)) {
+        logger->warn("Calibration 미적용 - 방향 격자 생성 불가");
+        return false;
+    }
+
+    const ObjPoint& s0 = stop_line[0];
+    const ObjPoint& s1 = stop_line[1];
+
+    // 차로 다각형과 정지선 쪽 끝점(정지선에 가장 가까운 두 꼭짓점의 중점)을 지면 좌표로 변환
+    // 평면 호모그래피는 직선을 보존하므로 꼭짓점 변환만으로 다각형이 유지됨
+    std::vector<GroundLane> lanes;
+    for (const auto& [idx, polygon] : lane_rois) {
+        if (polygon.size() < 3) continue;
+
+        GroundLane lane;
+        lane.lane = idx + 1;   // 0-based를 1-based로 변환
+
+        bool converted = true;
+        for (const auto& pt : polygon) {
+            ObjPoint g;
+            if (!toGround(pt, g.x, g.y)) {
+                converted = false;
+                break;
+            }
+            lane.polygon.push_back(g);
+        }
+
+        std::vector<ObjPoint> sorted(polygon.begin(), polygon.end());
+        std::sort(sorted.begin(), sorted.end(), [&](const ObjPoint& a, const ObjPoint& b) {
+            return distanceToSegment(a, s0, s1) < distanceToSegment(b, s0, s1);
+        });
+        ObjPoint anchor = {(sorted[0].x + sorted[1].x) / 2.0, (sorted[0].y + sorted[1].y) / 2.0};
+
+        if (!converted || !toGround(anchor, lane.anchor.x, lane.anchor.y)) {
+            logger->warn("차로 {} 지면 좌표 변환 실패 - 방향 격자에서 제외", lane.lane);
+            continue;
+        }
+        lanes.push_back(std::move(lane));
+    }
+
+    return buildGround(lanes, cell_size_m);
+}
+
+bool LaneDirectionField::buildGround(const std::vector<GroundLane>& lanes, double cell_size_m) {
+    ready_ = false;
+    valid_cells_ = 0;
+    cells_.clear();
+
+    if (cell_size_m <= 0.0) {
+        logger->error("방향 격자 생성 실패 - 잘못된 셀 크기: {}m", cell_size_m);
+        return false;
+    }
+
+    auto build_start = std::chrono::steady_clock::now();
+
+    double min_x = std::numeric_limits<double>::max();
+    double min_y = std::numeric_limits<double>::max();
+    double max_x = std::numeric_limits<double>::lowest();
+    double max_y = std::numeric_limits<double>::lowest();
+    for (const auto& lane : lanes) {
+        for (const auto& pt : lane.polygon) {
+            min_x = std::min(min_x, pt.x);
+            min_y = std::min(min_y, pt.y);
+            max_x = std::max(max_x, pt.x);
+            max_y = std::max(max_y, pt.y);
+        }
+    }
+
+    if (lanes.empty() || max_x <= min_x || max_y <= min_y) {
+        logger->warn("유효한 차로 ROI 없음 - 방향 격자 생성 불가");
+        return false;
+    }
+
+    // 셀 수가 너무 많으면 셀 크기 확대 (잘못된 Calibration으로 범위가 과대한 경우)
+    double cell = cell_size_m;
+    while (std::ceil((max_x - min_x) / cell) * std::ceil((max_y - min_y) / cell) > MAX_CELLS) {
+        cell *= 2.0;
+    }
+    if (cell != cell_size_m) {
+        logger->warn("방향 격자 범위 과대 ({:.0f}x{:.0f}m) - 셀 크기 {:.2f}m -> {:.2f}m",
+                    max_x - min_x, max_y - min_y, cell_size_m, cell);
+    }
+
+    cell_size_m_ = cell;
+    origin_x_ = min_x;
+    origin_y_ = min_y;
+    cols_ = std::max(1, static_cast<int>(std::ceil((max_x - min_x) / cell)));
+    rows_ = std::max(1, static_cast<int>(std::ceil((max_y - min_y) / cell)));
+    cells_.assign(static_cast<size_t>(cols_) * rows_, Cell{});
+
+    // 1차: 셀 중심 -> 차로 끝점 방향
+    std::map<int, std::pair<double, double>> lane_sum;
+    std::vector<size_t> pending;
+
+    for (int r = 0; r < rows_; r++) {
+        for (int c = 0; c < cols_; c++) {
+            double wx = origin_x_ + (c + 0.5) * cell;
+            double wy = origin_y_ + (r + 0.5) * cell;
+
+            const GroundLane* owner = nullptr;
+            for (const auto& lane : lanes) {
+                if (insidePolygon(lane.polygon, wx, wy)) {
+                    owner = &lane;
+                    break;
+                }
+            }
+            if (!owner) continue;
+
+            size_t i = static_cast<size_t>(r) * cols_ + c;
+            cells_[i].lane = owner->lane;
+
+            double dx = owner->anchor.x - wx;
+            double dy = owner->anchor.y - wy;
+            double len = std::hypot(dx, dy);
+            if (len < MIN_ANCHOR_DISTANCE_M) {
+                pending.push_back(i);
+                continue;
+            }
+
+            cells_[i].ex = static_cast<float>(dx / len);
+            cells_[i].ey = static_cast<float>(dy / len);
+            lane_sum[owner->lane].first += dx / len;
+            lane_sum[owner->lane].second += dy / len;
+        }
+    }
+
+    // 2차: 끝점에 너무 가까운 셀은 차로 평균 방향 사용
+    for (size_t i : pending) {
+        auto it = lane_sum.find(cells_[i].lane);
+        double len = (it != lane_sum.end()) ? std::hypot(it->second.first, it->second.second) : 0.0;
+        if (len <= 0.0) {
+            cells_[i].lane = 0;
+            continue;
+        }
+        cells_[i].ex = static_cast<float>(it->second.first / len);
+        cells_[i].ey = static_cast<float>(it->second.second / len);
+    }
+
+    for (const auto& c : cells_) {
+        if (c.lane > 0) valid_cells_++;
+    }
+
+    ready_ = valid_cells_ > 0;
+
+    auto build_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - build_start).count();
+    logger->info("차로 방향 격자 생성 - {}x{} (셀 {:.2f}m, 범위 {:.1f}x{:.1f}m), 유효 셀: {}, 차로: {}개, 소요: {}ms",
+                cols_, rows_, cell_size_m_, max_x - min_x, max_y - min_y,
+                valid_cells_, lanes.size(), build_ms);
+
+    return ready_;
+}
+
+const LaneDirectionField::Cell* LaneDirectionField::lookupGround(double wx, double wy) const {
+    if (!ready_) return nullptr;
+    if (wx < origin_x_ || wy < origin_y_) return nullptr;
+
+    int c = static_cast<int>((wx - origin_x_) / cell_size_m_);
+    int r = static_cast<int>((wy - origin_y_) / cell_size_m_);
+    if (c >= cols_ || r >= rows_) return nullptr;
+
+    const Cell& cell = cells_[static_cast<size_t>(r) * cols_ + c];
+    return cell.lane > 0 ? &cell : nullptr;
+}
+
+const LaneDirectionField::Cell* LaneDirectionField::lookup(const ObjPoint& p) const {
+    double wx, wy;
+    if (!ready_ || !toGround(p, wx, wy)) return nullptr;
+    return lookupGround(wx, wy);
+}
+
+LaneDirectionField::ReverseStep LaneDirectionField::updateReverse(ReverseTrack& track, double wx, double wy,
+                                                                  int current_time,
+                                                                  const ReverseParams& params) const {
+    // 초 단위 지면 속도 (박스 흔들림/정지 차량 제외용)
+    if (!track.has_speed_ref) {
+        track.speed_ref_x = wx;
+        track.speed_ref_y = wy;
+        track.speed_ref_time = current_time;
+        track.has_speed_ref = true;
+    } else if (current_time > track.speed_ref_time) {
+        double dist = std::hypot(wx - track.speed_ref_x, wy - track.speed_ref_y);
+        track.speed_kmh = dist / (current_time - track.speed_ref_time) * 3.6;
+        track.speed_ref_x = wx;
+        track.speed_ref_y = wy;
+        track.speed_ref_time = current_time;
+    }
+
+    if (!track.has_ground_pos) {
+        track.ground_x = wx;
+        track.ground_y = wy;
+        track.has_ground_pos = true;
+        return ReverseStep::NONE;
+    }
+
+    // 최소 속도 미만 (정지/서행 중 흔들림) - 점수 초기화, 기준 위치 갱신
+    if (track.speed_kmh < params.min_speed_kmh) {
+        track.ground_x = wx;
+        track.ground_y = wy;
+        if (track.score_m > 0.0 || track.start_time != 0) {
+            track.score_m = 0.0;
+            track.start_time = 0;
+            return ReverseStep::RESET;
+        }
+        return ReverseStep::NONE;
+    }
+
+    // 최소 이동 거리 미만이면 기준 위치를 유지해 느린 이동도 누적
+    double dx = wx - track.ground_x;
+    double dy = wy - track.ground_y;
+    if (std::hypot(dx, dy) < params.min_step_m) return ReverseStep::NONE;
+
+    track.ground_x = wx;
+    track.ground_y = wy;
+
+    // 차로 외부(교차로 등)에서는 기대 방향이 없으므로 점수 초기화
+    const Cell* cell = lookupGround(wx, wy);
+    if (!cell) {
+        track.score_m = 0.0;
+        track.start_time = 0;
+        return ReverseStep::RESET;
+    }
+
+    // 기대 진행방향과의 내적: 음수면 역방향 이동 거리만큼 누적, 양수면 감소
+    double along = dx * cell->ex + dy * cell->ey;
+    if (along < 0) {
+        if (track.score_m <= 0.0) {
+            track.start_time = current_time;
+        }
+        track.score_m -= along;
+    } else {
+        track.score_m = std::max(0.0, track.score_m - along);
+        if (track.score_m <= 0.0) {
+            track.start_time = 0;
+            return ReverseStep::RESET;
+        }
+    }
+
+    if (track.score_m >= params.min_distance_m &&
+        current_time - track.start_time >= params.min_duration_sec) {
+        return ReverseStep::DETECTED;
+    }
+    return ReverseStep::ACCUMULATING;
+}
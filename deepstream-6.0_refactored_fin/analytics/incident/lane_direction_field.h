@@ -0,0 +1,158 @@
+﻿#ifndef LANE_DIRECTION_FIELD_H
+#define LANE_DIRECTION_FIELD_H
+
+#include <map>
+#include <memory>
+#include <vector>
+#include "../../common/object_data.h"
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+/**
+ * @brief 역주행 판단 기준 (도로 평면 미터 좌표)
+ */
+struct ReverseParams {
+    double min_distance_m = 8.0;    // 누적 역방향 이동 거리 (m)
+    double min_step_m = 0.3;        // 점수 갱신 최소 이동 거리 (박스 흔들림 제외, m)
+    double min_speed_kmh = 5.0;     // 역방향 이동 인정 최소 속도 (km/h, 미만이면 점수 초기화)
+    int min_duration_sec = 10;      // 역방향 이동 최소 지속 시간 (초)
+};
+
+/**
+ * @brief 추적 객체별 역주행 판단 상태
+ */
+struct ReverseTrack {
+    bool has_ground_pos = false;    // 기준 위치 유효 여부
+    double ground_x = 0.0;          // 마지막 점수 갱신 위치 (종방향, m)
+    double ground_y = 0.0;          // 마지막 점수 갱신 위치 (횡방향, m)
+    double score_m = 0.0;           // 누적 역방향 이동 거리 (m)
+    int start_time = 0;             // 역방향 이동 시작 시간 (0: 없음)
+
+    // 초 단위 지면 속도
+    bool has_speed_ref = false;
+    double speed_ref_x = 0.0;
+    double speed_ref_y = 0.0;
+    int speed_ref_time = 0;
+    double speed_kmh = 0.0;
+};
+
+/**
+ * @brief 차로별 기대 진행방향 격자 (도로 평면 미터 좌표)
+ *
+ * 차로 ROI와 정지선, Calibration으로 초기화 시 한 번 계산
+ * - 차로 ROI 꼭짓점을 도로 평면으로 변환한 다각형 외곽을 cell_size_m 정사각 셀로 분할
+ *   (원근에 관계없이 가까운 차로와 먼 차로의 셀 크기가 같음)
+ * - 차로 내부 셀마다 정지선 방향 단위벡터 저장
+ * - 조회는 지면 좌표 -> 셀 인덱스 계산만 수행 (O(1))
+ */
+class LaneDirectionField {
+public:
+    /**
+     * @brief 격자 셀 (lane == 0 이면 차로 외부)
+     */
+    struct Cell {
+        float ex = 0.0f;            // 기대 진행방향 단위벡터 (종방향 성분)
+        float ey = 0.0f;            // 기대 진행방향 단위벡터 (횡방향 성분)
+        int lane = 0;               // 차로 번호 (1부터)
+    };
+
+    /**
+     * @brief 지면 좌표로 변환된 차로
+     */
+    struct GroundLane {
+        int lane = 0;                       // 차로 번호 (1부터)
+        std::vector<ObjPoint> polygon;      // 차로 다각형 (m)
+        ObjPoint anchor = {0.0, 0.0};       // 정지선 쪽 끝점 (m)
+    };
+
+    /**
+     * @brief updateReverse 결과
+     */
+    enum class ReverseStep {
+        NONE,               // 점수 변화 없음 (이동 부족/차로 외부)
+        RESET,              // 속도 미달/정방향 복귀로 점수 초기화
+        ACCUMULATING,       // 역방향 누적 중 (판단 기준 미달)
+        DETECTED            // 거리/지속 시간 기준 충족
+    };
+
+private:
+    int cols_ = 0;
+    int rows_ = 0;
+    double origin_x_ = 0.0;         // 격자 원점 (m)
+    double origin_y_ = 0.0;
+    double cell_size_m_ = 0.0;      // 셀 크기 (m)
+    std::vector<Cell> cells_;
+    int valid_cells_ = 0;
+    bool ready_ = false;
+
+    // 셀 방향 계산 시 차로 끝점과 이 거리(m) 이내면 차로 평균 방향 사용
+    static constexpr double MIN_ANCHOR_DISTANCE_M = 1.0;
+
+    // 격자 최대 셀 수 (초과 시 셀 크기 확대)
+    static constexpr int MAX_CELLS = 1 << 16;
+
+    std::shared_ptr<spdlog::logger> logger = nullptr;
+
+public:
+    LaneDirectionField();
+    ~LaneDirectionField() = default;
+
+    /**
+     * @brief 영상 좌표 차로 ROI로 방향 격자 생성 (Calibration으로 지면 변환)
+     * @param lane_rois 차로 ROI (0-based 인덱스 -> 영상 좌표 다각형)
+     * @param stop_line 정지선 ROI (영상 좌표, 2점 이상)
+     * @param cell_size_m 셀 크기 (m)
+     * @return 유효 셀이 1개 이상이면 true
+     */
+    bool build(const std::map<int, std::vector<ObjPoint>>& lane_rois,
+               const std::vector<ObjPoint>& stop_line, double cell_size_m);
+
+    /**
+     * @brief 지면 좌표 차로로 방향 격자 생성
+     * @param lanes 차로 목록 (다각형/끝점 모두 m)
+     * @param cell_size_m 셀 크기 (m)
+     * @return 유효 셀이 1개 이상이면 true
+     */
+    bool buildGround(const std::vector<GroundLane>& lanes, double cell_size_m);
+
+    /**
+     * @brief 지면 좌표의 셀 조회
+     * @return 차로 내부 셀이면 셀 포인터, 아니면 nullptr
+     */
+    const Cell* lookupGround(double wx, double wy) const;
+
+    /**
+     * @brief 영상 좌표의 셀 조회 (지면 변환 후 lookupGround)
+     */
+    const Cell* lookup(const ObjPoint& p) const;
+
+    /**
+     * @brief 새 지면 위치로 역주행 판단 상태 갱신
+     * @param track 추적 객체 상태
+     * @param wx 종방향 좌표 (m)
+     * @param wy 횡방향 좌표 (m)
+     * @param current_time 현재 시간 (초)
+     * @param params 판단 기준
+     * @return 갱신 결과 (DETECTED면 호출측이 이벤트 생성)
+     */
+    ReverseStep updateReverse(ReverseTrack& track, double wx, double wy, int current_time,
+                              const ReverseParams& params) const;
+
+    /**
+     * @brief 영상 좌표를 도로 평면 미터 좌표로 변환
+     * @param p 영상 좌표
+     * @param wx 종방향 좌표 (m)
+     * @param wy 횡방향 좌표 (m)
+     * @return Calibration 미적용 등으로 변환 불가 시 false
+     */
+    static bool toGround(const ObjPoint& p, double& wx, double& wy);
+
+    bool isReady() const { return ready_; }
+    int getValidCellCount() const { return valid_cells_; }
+    double getCellSize() const { return cell_size_m_; }
+};
+
+#endif // LANE_DIRECTION_FIELD_H
@@ -0,0 +1,313 @@
+﻿/*
+ * pet_monitor.cpp
+ *
+ * 횡단보도 상충 구역 PET 감시 구현
+ * - 횡단보도 안 객체만 투영 1회 + 셀 비교
+ * - 셀 이탈 시 반대 종류 링(PET_RING_SIZE개)만 조회
+ */
+
+#include "pet_monitor.h"
+#include "../../calibration/calibration.h"
+#include "../../common/common_types.h"
+#include "../../data/redis/channel_types.h"
+#include "../../data/redis/redis_client.h"
+#include "../../json/json.h"
+#include "../../roi_module/roi_handler.h"
+#include "../../utils/config_manager.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+bool isTurning(int turn_type) {
+    return turn_type == DIR_LEFT_TURN || turn_type == DIR_LEFT_TURN_2 ||
+           turn_type == DIR_RIGHT_TURN || turn_type == DIR_RIGHT_TURN_2 ||
+           turn_type == DIR_U_TURN;
+}
+
+}  // namespace
+
+PETMonitor::PETMonitor() {
+    logger = getLogger("DS_PETMonitor_log");
+    logger->info("PETMonitor 생성");
+}
+
+bool PETMonitor::initialize(RedisClient* redis_client, ROIHandler* roi_handler) {
+    try {
+        redis_client_ = redis_client;
+        roi_handler_ = roi_handler;
+
+        if (!redis_client_ || !roi_handler_) {
+            logger->error("Redis 클라이언트 또는 ROI 핸들러가 없음 - PET 감시 초기화 실패");
+            return false;
+        }
+
+        loadConfig();
+        if (!buildGrid()) {
+            return false;
+        }
+
+        tracks_.reserve(64);
+        pending_.reserve(8);
+
+        logger->info("PET 감시 초기화 완료 - 임계값: {:.1f}초, 회전 차량만: {}, 미관측 이탈: {}ms",
+                    config_.threshold_sec, config_.turning_only ? "예" : "아니오",
+                    config_.track_timeout_ms);
+        return true;
+
+    } catch (const std::exception& e) {
+        logger->error("PET 감시 초기화 실패: {}", e.what());
+        return false;
+    }
+}
+
+void PETMonitor::loadConfig() {
+    auto& config = ConfigManager::getInstance();
+    const std::string base_key = "processing_modules.incident_event.pet";
+
+    config_.enabled = config.isPETEnabled();
+    config_.cell_size_m = config.getDouble(base_key + ".cell_size_m", 1.0);
+    config_.threshold_sec = config.getDouble(base_key + ".threshold_sec", 1.5);
+    config_.turning_only = config.getBool(base_key + ".turning_only", true);
+    config_.track_timeout_ms = config.getInt(base_key + ".track_timeout_ms", 1000);
+
+    if (config_.cell_size_m <= 0.0) {
+        logger->warn("잘못된 cell_size_m 값: {} - 기본값 1.0m 사용", config_.cell_size_m);
+        config_.cell_size_m = 1.0;
+    }
+    if (config_.threshold_sec <= 0.0) {
+        logger->warn("잘못된 threshold_sec 값: {} - 기본값 1.5초 사용", config_.threshold_sec);
+        config_.threshold_sec = 1.5;
+    }
+    config_.track_timeout_ms = std::max(100, config_.track_timeout_ms);
+}
+
+bool PETMonitor::buildGrid() {
+    const auto& crosswalk = ROIHandler::crosswalk_roi;
+
+    double min_x = std::numeric_limits<double>::max();
+    double min_y = std::numeric_limits<double>::max();
+    double max_x = std::numeric_limits<double>::lowest();
+    double max_y = std::numeric_limits<double>::lowest();
+    int projected = 0;
+
+    for (const auto& pt : crosswalk) {
+        double wx, wy;
+        if (!groundPosition(0, pt.x, pt.y, wx, wy)) continue;
+        min_x = std::min(min_x, wx);
+        min_y = std::min(min_y, wy);
+        max_x = std::max(max_x, wx);
+        max_y = std::max(max_y, wy);
+        projected++;
+    }
+
+    if (projected < 3 || max_x <= min_x || max_y <= min_y) {
+        logger->warn("PET 상충 구역 생성 불가 - 횡단보도 ROI 없음 또는 Calibration 미적용");
+        return false;
+    }
+
+    // 셀 수 상한을 넘으면 셀 크기 확대
+    double width = max_x - min_x;
+    double height = max_y - min_y;
+    double min_cell = std::sqrt(width * height / MAX_CELLS);
+    if (config_.cell_size_m < min_cell) {
+        logger->warn("PET 셀 크기 조정: {:.2f}m -> {:.2f}m (최대 {}셀)",
+                    config_.cell_size_m, min_cell, MAX_CELLS);
+        config_.cell_size_m = min_cell;
+    }
+
+    origin_x_ = min_x;
+    origin_y_ = min_y;
+    cols_ = std::max(1, static_cast<int>(std::ceil(width / config_.cell_size_m)));
+    rows_ = std::max(1, static_cast<int>(std::ceil(height / config_.cell_size_m)));
+    cells_.assign(static_cast<size_t>(cols_) * rows_, CellRing());
+
+    logger->info("PET 상충 구역 생성 - {}x{} 셀 ({:.2f}m), 영역: {:.1f}x{:.1f}m",
+                cols_, rows_, config_.cell_size_m, width, height);
+    return true;
+}
+
+int PETMonitor::cellIndex(const ObjPoint& pos) const {
+    double wx, wy;
+    if (!groundPosition(0, pos.x, pos.y, wx, wy)) return -1;
+
+    int c = static_cast<int>(std::floor((wx - origin_x_) / config_.cell_size_m));
+    int r = static_cast<int>(std::floor((wy - origin_y_) / config_.cell_size_m));
+    if (c < 0 || r < 0 || c >= cols_ || r >= rows_) return -1;
+
+    return r * cols_ + c;
+}
+
+void PETMonitor::observe(int id, bool is_vehicle, int turn_type, const ObjPoint& pos, int64_t now_ms) {
+    if (!config_.enabled) return;
+
+    // 폴리곤 검사 먼저 (횡단보도 밖 객체는 투영하지 않음)
+    int cell = roi_handler_->isInCrossWalk(pos) ? cellIndex(pos) : -1;
+
+    std::lock_guard<std::mutex> lock(pet_mutex_);
+
+    auto it = tracks_.find(id);
+    if (it == tracks_.end()) {
+        if (cell < 0) return;
+        TrackCell track;
+        track.cell = cell;
+        track.is_vehicle = is_vehicle;
+        track.turn_type = turn_type;
+        track.enter_ms = now_ms;
+        track.last_seen_ms = now_ms;
+        tracks_.emplace(id, track);
+        return;
+    }
+
+    TrackCell& track = it->second;
+    track.turn_type = turn_type;
+
+    if (cell == track.cell) {
+        track.last_seen_ms = now_ms;
+        return;
+    }
+
+    // 셀 이탈 (다른 셀 진입 또는 횡단보도 이탈)
+    recordExit(id, track, now_ms);
+    if (cell < 0) {
+        tracks_.erase(it);
+        return;
+    }
+    track.cell = cell;
+    track.enter_ms = now_ms;
+    track.last_seen_ms = now_ms;
+}
+
+void PETMonitor::recordExit(int track_id, const TrackCell& track, int64_t exit_ms) {
+    CellRing& ring = cells_[track.cell];
+
+    Passage passage;
+    passage.track_id = track_id;
+    passage.turn_type = track.turn_type;
+    passage.enter_ms = track.enter_ms;
+    passage.exit_ms = std::max(exit_ms, track.enter_ms + 1);
+    passages_++;
+
+    auto& own = track.is_vehicle ? ring.vehicles : ring.pedestrians;
+    uint8_t& next = track.is_vehicle ? ring.vehicle_next : ring.pedestrian_next;
+    own[next] = passage;
+    next = static_cast<uint8_t>((next + 1) % PET_RING_SIZE);
+
+    // 반대 종류 통과 기록 중 가장 짧은 PET
+    const auto& other = track.is_vehicle ? ring.pedestrians : ring.vehicles;
+    const int64_t threshold_ms = static_cast<int64_t>(config_.threshold_sec * 1000.0);
+    const Passage* partner = nullptr;
+    int64_t best_pet = threshold_ms;
+
+    for (const Passage& candidate : other) {
+        if (candidate.exit_ms == 0) continue;
+        // 상대가 먼저 이탈: 이탈 ~ 이번 진입 간격, 점유 구간 겹침: 0
+        int64_t pet = std::max<int64_t>(0, passage.enter_ms - candidate.exit_ms);
+        if (pet < best_pet) {
+            best_pet = pet;
+            partner = &candidate;
+        }
+    }
+    if (!partner) return;
+
+    PETEvent event;
+    event.vehicle_id = track.is_vehicle ? track_id : partner->track_id;
+    event.pedestrian_id = track.is_vehicle ? partner->track_id : track_id;
+    event.turn_type = track.is_vehicle ? passage.turn_type : partner->turn_type;
+    event.pet_ms = best_pet;
+    event.vehicle_first = !track.is_vehicle;
+    event.cell = track.cell;
+
+    if (config_.turning_only && !isTurning(event.turn_type)) return;
+    if (alreadyReported(event.vehicle_id, event.pedestrian_id)) return;
+
+    reported_[reported_next_] = {event.vehicle_id, event.pedestrian_id};
+    reported_next_ = (reported_next_ + 1) % REPORTED_PAIR_SIZE;
+    pending_.push_back(event);
+}
+
+bool PETMonitor::alreadyReported(int vehicle_id, int pedestrian_id) const {
+    for (const auto& pair : reported_) {
+        if (pair.first == vehicle_id && pair.second == pedestrian_id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PETMonitor::flush(int64_t now_ms, int current_time) {
+    if (!config_.enabled) return;
+
+    std::vector<PETEvent> events;
+    {
+        std::lock_guard<std::mutex> lock(pet_mutex_);
+
+        // 트래커에서 사라진 객체는 마지막 관측 시각에 이탈 처리
+        for (auto it = tracks_.begin(); it != tracks_.end();) {
+            if (now_ms - it->second.last_seen_ms > config_.track_timeout_ms) {
+                recordExit(it->first, it->second, it->second.last_seen_ms);
+                it = tracks_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        if (pending_.empty()) return;
+        events.swap(pending_);
+        pending_.reserve(8);
+    }
+
+    // Redis 전송은 잠금 밖에서
+    for (const auto& event : events) {
+        sendEvent(event, current_time);
+    }
+}
+
+bool PETMonitor::sendEvent(const PETEvent& event, int current_time) {
+    try {
+        Json::Value root;
+        Json::FastWriter writer;
+
+        root["ocrn_unix_tm"] = current_time;
+        root["pet_sec"] = event.pet_ms / 1000.0;
+        root["vhcl_trce_id"] = event.vehicle_id;
+        root["ped_trce_id"] = event.pedestrian_id;
+        root["turn_type_cd"] = event.turn_type;
+        root["frst_pasg_obj"] = event.vehicle_first ? "VHCL" : "PED";
+        root["cell_no"] = event.cell;
+
+        std::string json_data = writer.write(root);
+        int result = redis_client_->sendData(CHANNEL_PET, json_data);
+        if (result != 0) {
+            logger->error("PET 이벤트 전송 실패 (결과: {})", result);
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(pet_mutex_);
+        events_sent_++;
+        if (min_pet_ms_ < 0 || event.pet_ms < min_pet_ms_) {
+            min_pet_ms_ = event.pet_ms;
+        }
+        logger->info("PET 이벤트 - 차량 {} (방향 {}) / 보행자 {}, PET: {:.2f}초, 선통과: {}",
+                    event.vehicle_id, event.turn_type, event.pedestrian_id,
+                    event.pet_ms / 1000.0, event.vehicle_first ? "차량" : "보행자");
+        return true;
+
+    } catch (const std::exception& e) {
+        logger->error("PET 이벤트 JSON 생성 실패: {}", e.what());
+        return false;
+    }
+}
+
+void PETMonitor::logStatistics() const {
+    if (!config_.enabled) return;
+
+    std::lock_guard<std::mutex> lock(pet_mutex_);
+
+    logger->info("=== PET 감시 통계 ===");
+    logger->info("  셀 통과: {}회, 이벤트: {}회, 최소 PET: {}",
+                passages_, events_sent_,
+                min_pet_ms_ >= 0 ? std::to_string(min_pet_ms_) + "ms" : "-");
+    logger->info("  현재 횡단보도 안 객체: {}개", tracks_.size());
+}
@@ -0,0 +1,167 @@
+﻿#ifndef PET_MONITOR_H
+#define PET_MONITOR_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../../common/object_data.h"
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+// Forward declarations
+class RedisClient;
+class ROIHandler;
+
+/**
+ * @brief PET(Post-Encroachment Time) 감시 설정 (incident_event.pet)
+ */
+struct PETConfig {
+    bool enabled = false;
+    double cell_size_m = 1.0;               // 상충 구역 격자 셀 크기 (m)
+    double threshold_sec = 1.5;             // 이벤트 전송 PET 상한 (초)
+    bool turning_only = true;               // 회전(좌/우/유턴) 확정 차량만 대상
+    int track_timeout_ms = 1000;            // 미관측 객체 셀 이탈 처리 시간 (ms)
+};
+
+/**
+ * @brief PET 이벤트 (차량-보행자 1쌍)
+ */
+struct PETEvent {
+    int vehicle_id = 0;
+    int pedestrian_id = 0;
+    int turn_type = -1;                     // 차량 회전 방향 (-1: 미확정)
+    int64_t pet_ms = 0;                     // 앞 객체 이탈 ~ 뒤 객체 진입 (0: 동시 점유)
+    bool vehicle_first = false;             // 차량이 먼저 통과했으면 true
+    int cell = -1;                          // 상충 셀 번호
+};
+
+/**
+ * @brief 횡단보도 상충 구역 PET 감시
+ *
+ * 횡단보도 폴리곤의 도로 평면 외곽 사각형을 cell_size_m 격자로 나누고
+ * 셀마다 차량/보행자 통과 기록(진입~이탈 시각)을 고정 크기 링(PET_RING_SIZE)에 보관
+ * - 객체가 셀을 이탈할 때 같은 셀의 반대 종류 링만 조회해 PET 계산
+ * - PET = 뒤 객체 진입 시각 - 앞 객체 이탈 시각 (점유 구간이 겹치면 0)
+ * - threshold_sec 미만이면 차량/보행자 추적 ID와 함께 전송 (같은 쌍은 1회)
+ *
+ * 비용은 횡단보도 안 객체 수와 셀 링 크기로 제한 (객체 쌍 전수 비교 없음)
+ * 셀은 객체의 하단 중심 1점으로 판정 (셀 크기로 차체 폭을 흡수)
+ */
+class PETMonitor {
+public:
+    static constexpr int PET_RING_SIZE = 4;         // 셀별/종류별 통과 기록 수
+    static constexpr int MAX_CELLS = 4096;
+    static constexpr int REPORTED_PAIR_SIZE = 32;   // 중복 전송 방지 최근 쌍 수
+
+private:
+    struct Passage {
+        int track_id = 0;
+        int turn_type = -1;
+        int64_t enter_ms = 0;
+        int64_t exit_ms = 0;                // 0: 빈 기록
+    };
+
+    struct CellRing {
+        std::array<Passage, PET_RING_SIZE> vehicles;
+        std::array<Passage, PET_RING_SIZE> pedestrians;
+        uint8_t vehicle_next = 0;
+        uint8_t pedestrian_next = 0;
+    };
+
+    struct TrackCell {
+        int cell = -1;
+        bool is_vehicle = true;
+        int turn_type = -1;
+        int64_t enter_ms = 0;
+        int64_t last_seen_ms = 0;
+    };
+
+    // 설정
+    PETConfig config_;
+
+    // 외부 의존성
+    RedisClient* redis_client_ = nullptr;
+    ROIHandler* roi_handler_ = nullptr;
+
+    // 상충 구역 격자 (도로 평면 m)
+    int cols_ = 0;
+    int rows_ = 0;
+    double origin_x_ = 0.0;
+    double origin_y_ = 0.0;
+    std::vector<CellRing> cells_;
+
+    // 횡단보도 안 객체의 현재 셀
+    std::unordered_map<int, TrackCell> tracks_;
+
+    // 최근 전송 쌍 (차량 ID, 보행자 ID)
+    std::array<std::pair<int, int>, REPORTED_PAIR_SIZE> reported_{};
+    size_t reported_next_ = 0;
+
+    // 전송 대기 이벤트 (잠금 밖에서 전송)
+    std::vector<PETEvent> pending_;
+
+    mutable std::mutex pet_mutex_;
+
+    // 통계
+    uint64_t passages_ = 0;
+    uint64_t events_sent_ = 0;
+    int64_t min_pet_ms_ = -1;
+
+    // 로거
+    std::shared_ptr<spdlog::logger> logger = nullptr;
+
+    // 내부 메서드
+    void loadConfig();
+    bool buildGrid();
+    int cellIndex(const ObjPoint& pos) const;
+    void recordExit(int track_id, const TrackCell& track, int64_t exit_ms);
+    bool alreadyReported(int vehicle_id, int pedestrian_id) const;
+    bool sendEvent(const PETEvent& event, int current_time);
+
+public:
+    PETMonitor();
+    ~PETMonitor() = default;
+
+    /**
+     * @brief 초기화 - 횡단보도 ROI로 상충 구역 격자 생성
+     * @param redis_client Redis 클라이언트 포인터
+     * @param roi_handler ROI 핸들러 (crosswalk_roi)
+     * @return 성공 시 true (횡단보도 ROI 없음 또는 Calibration 미적용 시 false)
+     */
+    bool initialize(RedisClient* redis_client, ROIHandler* roi_handler);
+
+    /**
+     * @brief 객체 위치 관측 - process_meta에서 차량/보행자마다 호출
+     * @param id 추적 ID
+     * @param is_vehicle 차량이면 true, 보행자면 false
+     * @param turn_type 차량 회전 방향 (obj.dir_out, 보행자는 -1)
+     * @param pos 하단 중심 (영상 좌표)
+     * @param now_ms 단조 시각 (ms)
+     *
+     * 횡단보도 밖 객체는 폴리곤 검사만 수행 (투영 없음)
+     */
+    void observe(int id, bool is_vehicle, int turn_type, const ObjPoint& pos, int64_t now_ms);
+
+    /**
+     * @brief 배치 종료 처리 - 미관측 객체 셀 이탈 처리 후 대기 이벤트 전송
+     * @param now_ms 단조 시각 (ms)
+     * @param current_time 현재 Unix 시각 (이벤트 발생 시각)
+     */
+    void flush(int64_t now_ms, int current_time);
+
+    /**
+     * @brief 통계 정보 로깅
+     */
+    void logStatistics() const;
+
+    bool isEnabled() const { return config_.enabled; }
+};
+
+#endif // PET_MONITOR_H
@@ -0,0 +1,206 @@
+﻿#include "stationary_registry.h"
+#include "../../calibration/calibration.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+StationaryRegistry::StationaryRegistry() {
+    logger = getLogger("DS_IncidentDetector_log");
+}
+
+bool StationaryRegistry::build(const std::vector<std::vector<ObjPoint>>& areas,
+                               double cell_size_m, int gap_tolerance_sec) {
+    ready_ = false;
+    cells_.clear();
+
+    if (cell_size_m <= 0.0 || gap_tolerance_sec < 0) {
+        logger->error("정지 레지스트리 생성 실패 - 잘못된 인자 (셀: {:.2f}m, 공백 허용: {}초)",
+                     cell_size_m, gap_tolerance_sec);
+        return false;
+    }
+
+    double min_x = std::numeric_limits<double>::max();
+    double min_y = std::numeric_limits<double>::max();
+    double max_x = std::numeric_limits<double>::lowest();
+    double max_y = std::numeric_limits<double>::lowest();
+    int projected = 0;
+
+    for (const auto& area : areas) {
+        for (const auto& pt : area) {
+            double wx, wy;
+            if (!groundPosition(0, pt.x, pt.y, wx, wy)) continue;
+            min_x = std::min(min_x, wx);
+            min_y = std::min(min_y, wy);
+            max_x = std::max(max_x, wx);
+            max_y = std::max(max_y, wy);
+            projected++;
+        }
+    }
+
+    if (projected < 3 || max_x <= min_x || max_y <= min_y) {
+        logger->warn("정지 레지스트리 생성 불가 - 감시 영역 없음 또는 Calibration 미적용");
+        return false;
+    }
+
+    // 셀 수 상한을 넘으면 셀 크기 확대
+    double width = max_x - min_x;
+    double height = max_y - min_y;
+    double min_cell = std::sqrt(width * height / MAX_CELLS);
+    if (cell_size_m < min_cell) {
+        logger->warn("정지 레지스트리 셀 크기 조정: {:.2f}m -> {:.2f}m (최대 {}셀)",
+                    cell_size_m, min_cell, MAX_CELLS);
+        cell_size_m = min_cell;
+    }
+
+    cell_size_m_ = cell_size_m;
+    gap_tolerance_sec_ = gap_tolerance_sec;
+    origin_x_ = min_x;
+    origin_y_ = min_y;
+    cols_ = std::max(1, static_cast<int>(std::ceil(width / cell_size_m_)));
+    rows_ = std::max(1, static_cast<int>(std::ceil(height / cell_size_m_)));
+    cells_.assign(static_cast<size_t>(cols_) * rows_, Cell{});
+    ready_ = true;
+
+    logger->info("정지 레지스트리 생성 - {}x{} 셀 ({:.2f}m), 영역: {:.1f}x{:.1f}m, 공백 허용: {}초",
+                cols_, rows_, cell_size_m_, width, height, gap_tolerance_sec_);
+    return true;
+}
+
+int StationaryRegistry::cellIndex(const ObjPoint& p) const {
+    double wx, wy;
+    if (!groundPosition(0, p.x, p.y, wx, wy)) return -1;
+
+    int c = static_cast<int>(std::floor((wx - origin_x_) / cell_size_m_));
+    int r = static_cast<int>(std::floor((wy - origin_y_) / cell_size_m_));
+    if (c < 0 || r < 0 || c >= cols_ || r >= rows_) return -1;
+
+    return r * cols_ + c;
+}
+
+StationaryRegistry::Observation StationaryRegistry::observe(int id, const ObjPoint& p, int current_time) {
+    Observation result;
+    if (!ready_) return result;
+
+    int index = cellIndex(p);
+    if (index < 0) return result;
+
+    Cell& cell = cells_[index];
+
+    if (!isActive(cell, current_time)) {
+        // 빈 셀: 주변 셀의 활성 정지 중 가장 오래된 것을 이어받음 (셀 경계 흔들림 대응)
+        cell.dwell_start = current_time;
+        cell.owner_id = id;
+
+        int r = index / cols_;
+        int c = index % cols_;
+        for (int dr = -1; dr <= 1; dr++) {
+            for (int dc = -1; dc <= 1; dc++) {
+                int nr = r + dr;
+                int nc = c + dc;
+                if ((dr == 0 && dc == 0) || nr < 0 || nc < 0 || nr >= rows_ || nc >= cols_) continue;
+
+                const Cell& neighbor = cells_[nr * cols_ + nc];
+                if (isActive(neighbor, current_time) && neighbor.dwell_start < cell.dwell_start) {
+                    cell.dwell_start = neighbor.dwell_start;
+                    cell.owner_id = neighbor.owner_id;
+                    result.inherited = true;
+                }
+            }
+        }
+    }
+
+    cell.last_seen = current_time;
+
+    result.valid = true;
+    result.dwell_sec = current_time - cell.dwell_start;
+    result.owner_id = cell.owner_id;
+    return result;
+}
+
+void StationaryRegistry::claim(const ObjPoint& p, int id) {
+    if (!ready_) return;
+
+    int index = cellIndex(p);
+    if (index < 0) return;
+
+    if (cells_[index].owner_id != id) {
+        cells_[index].owner_id = id;
+        reassociations_++;
+    }
+}
+
+void StationaryRegistry::detach(const ObjPoint& p, int id, int dwell_start) {
+    if (!ready_) return;
+
+    int index = cellIndex(p);
+    if (index < 0) return;
+
+    cells_[index].owner_id = id;
+    cells_[index].dwell_start = dwell_start;
+}
+
+void StationaryRegistry::save(CheckpointWriter& writer) const {
+    writer.put<int32_t>(cols_);
+    writer.put<int32_t>(rows_);
+
+    uint32_t count = 0;
+    for (const auto& cell : cells_) {
+        if (cell.dwell_start > 0) count++;
+    }
+    writer.put<uint32_t>(count);
+
+    for (size_t i = 0; i < cells_.size(); i++) {
+        const Cell& cell = cells_[i];
+        if (cell.dwell_start == 0) continue;
+        writer.put<int32_t>(static_cast<int32_t>(i));
+        writer.put<int32_t>(cell.dwell_start);
+        writer.put<int32_t>(cell.last_seen);
+        writer.put<int32_t>(cell.owner_id);
+    }
+}
+
+int StationaryRegistry::restore(CheckpointReader& reader, const CheckpointContext& context) {
+    int cols = reader.get<int32_t>();
+    int rows = reader.get<int32_t>();
+    uint32_t count = reader.get<uint32_t>();
+
+    if (!ready_ || cols != cols_ || rows != rows_) {
+        logger->warn("정지 레지스트리 격자 불일치 ({}x{} != {}x{}) - 복원 안함", cols, rows, cols_, rows_);
+        return 0;
+    }
+
+    int restored = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        int index = reader.get<int32_t>();
+        int dwell_start = reader.get<int32_t>();
+        int last_seen = reader.get<int32_t>();
+        int owner_id = reader.get<int32_t>();
+
+        if (index < 0 || index >= static_cast<int>(cells_.size())) continue;
+        if (context.saved_time - last_seen > gap_tolerance_sec_) continue;
+
+        Cell& cell = cells_[index];
+        cell.dwell_start = dwell_start;
+        cell.last_seen = context.current_time;
+        cell.owner_id = owner_id >= 0 ? checkpointRestoredId(owner_id) : owner_id;
+        restored++;
+    }
+
+    return restored;
+}
+
+void StationaryRegistry::logStatistics(int current_time) const {
+    if (!ready_) return;
+
+    int active = 0;
+    int longest = 0;
+    for (const auto& cell : cells_) {
+        if (isActive(cell, current_time)) {
+            active++;
+            longest = std::max(longest, current_time - cell.dwell_start);
+        }
+    }
+
+    logger->debug("정지 레지스트리 - 활성 셀: {}/{}, 최장 정지: {}초, ID 재연결: {}회",
+                active, cells_.size(), longest, reassociations_);
+}
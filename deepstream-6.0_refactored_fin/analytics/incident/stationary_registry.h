@@ -0,0 +1,132 @@
+﻿#ifndef STATIONARY_REGISTRY_H
+#define STATIONARY_REGISTRY_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "../../common/object_data.h"
+#include "../../data/checkpoint/checkpoint_codec.h"
+#include "../../data/checkpoint/checkpoint_types.h"
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+/**
+ * @brief 위치 기반 정지 객체 레지스트리
+ *
+ * 추적 ID와 무관하게 도로 평면(미터 좌표) 격자 셀마다 정지 지속 시간을 관리
+ * - 장시간 정지 차량이 트래커에서 새 ID를 받아도 같은 위치면 정지 시간 유지
+ * - 셀에는 이벤트를 보유한 ID(owner)를 기록해 새 ID로 연쇄 이벤트 이관 가능
+ * - 격자 크기는 초기화 시 고정 (메모리 상한), 갱신은 객체당 최대 9셀 조회 (O(1))
+ */
+class StationaryRegistry {
+public:
+    /**
+     * @brief 관측 결과
+     */
+    struct Observation {
+        bool valid = false;         // 격자 내부 관측 여부
+        int dwell_sec = 0;          // 해당 위치 정지 지속 시간 (초)
+        int owner_id = 0;           // 해당 위치 정지 이벤트 보유 ID
+        bool inherited = false;     // 이번 관측에서 주변 셀 정지를 이어받음
+    };
+
+private:
+    struct Cell {
+        int dwell_start = 0;        // 정지 시작 시각 (0: 비어있음)
+        int last_seen = 0;          // 마지막 정지 관측 시각
+        int owner_id = 0;
+    };
+
+    int cols_ = 0;
+    int rows_ = 0;
+    double origin_x_ = 0.0;         // 격자 원점 (미터 좌표)
+    double origin_y_ = 0.0;
+    double cell_size_m_ = 2.0;
+    int gap_tolerance_sec_ = 3;     // 관측 공백 허용 시간 (이후 셀 만료)
+    std::vector<Cell> cells_;
+    bool ready_ = false;
+
+    // 통계
+    uint64_t reassociations_ = 0;   // 새 ID 재연결 횟수
+
+    static constexpr int MAX_CELLS = 4096;
+
+    std::shared_ptr<spdlog::logger> logger = nullptr;
+
+    bool isActive(const Cell& cell, int current_time) const {
+        return cell.dwell_start > 0 && current_time - cell.last_seen <= gap_tolerance_sec_;
+    }
+    int cellIndex(const ObjPoint& p) const;
+
+public:
+    StationaryRegistry();
+    ~StationaryRegistry() = default;
+
+    /**
+     * @brief 격자 생성 - 감시 영역 폴리곤들의 도로 평면 외곽 사각형 기준
+     * @param areas 감시 영역 폴리곤 목록 (영상 좌표)
+     * @param cell_size_m 셀 크기 (m)
+     * @param gap_tolerance_sec 관측 공백 허용 시간 (초)
+     * @return 성공 시 true (Calibration 미적용 시 false)
+     */
+    bool build(const std::vector<std::vector<ObjPoint>>& areas,
+               double cell_size_m, int gap_tolerance_sec);
+
+    /**
+     * @brief 정지 객체 관측 - 셀 정지 시간 갱신
+     *
+     * 셀이 비었거나 만료되었으면 주변 8셀의 활성 정지 시간을 이어받음
+     * @param id 추적 ID
+     * @param p 영상 좌표
+     * @param current_time 현재 시간
+     * @return 관측 결과 (격자 밖이면 valid = false)
+     */
+    Observation observe(int id, const ObjPoint& p, int current_time);
+
+    /**
+     * @brief 위치의 이벤트 보유 ID 변경 (연쇄 이벤트 이관 후 호출)
+     * @param p 영상 좌표
+     * @param id 새 보유 ID
+     */
+    void claim(const ObjPoint& p, int id);
+
+    /**
+     * @brief 주변 셀에서 이어받은 정지를 자체 정지로 교체
+     *
+     * 이어받은 보유 ID가 아직 관측 중(옆 차로 정지 차량 등)이면 호출
+     * @param p 영상 좌표
+     * @param id 추적 ID
+     * @param dwell_start 자체 정지 시작 시각
+     */
+    void detach(const ObjPoint& p, int id, int dwell_start);
+
+    /**
+     * @brief 체크포인트 직렬화 (정지 중인 셀만)
+     * @param writer 체크포인트 기록기
+     */
+    void save(CheckpointWriter& writer) const;
+
+    /**
+     * @brief 체크포인트 복원
+     *
+     * 격자 크기가 같을 때만 복원, 보유 ID는 복원용 음수 ID로 변환
+     * 마지막 관측 시각은 복원 시각으로 갱신 (재시작 공백은 관측 공백으로 보지 않음)
+     * @param reader 체크포인트 판독기
+     * @param context 복원 컨텍스트
+     * @return 복원된 셀 수
+     */
+    int restore(CheckpointReader& reader, const CheckpointContext& context);
+
+    /**
+     * @brief 통계 정보 로깅
+     * @param current_time 현재 시간
+     */
+    void logStatistics(int current_time) const;
+
+    bool isReady() const { return ready_; }
+};
+
+#endif // STATIONARY_REGISTRY_H
@@ -0,0 +1,441 @@
+﻿/*
+ * intersection_aggregator.cpp
+ *
+ * 교차로 단위 주기별 이동류 집계 구현
+ * - member: 신호현시 통계 -> 접근로 레코드 전송 (노드 로컬 Redis)
+ * - leader: 접근로 레코드 수집 -> 주기별 이동류 행렬 전송
+ */
+
+#include "intersection_aggregator.h"
+#include "../../common/common_types.h"
+#include "../../data/redis/channel_types.h"
+#include "../../data/redis/redis_client.h"
+#include "../../json/json.h"
+#include "../../utils/config_manager.h"
+#include "../../utils/heartbeat_registry.h"
+#include "../../utils/thread_role.h"
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <poll.h>
+
+IntersectionAggregator::IntersectionAggregator() {
+    logger = getLogger("DS_IntersectionAggregator_log");
+    logger->info("IntersectionAggregator 생성");
+}
+
+IntersectionAggregator::~IntersectionAggregator() {
+    stop();
+}
+
+bool IntersectionAggregator::initialize(RedisClient* redis_client, const std::string& ints_id) {
+    if (!redis_client) {
+        logger->error("Redis 클라이언트가 없음 - 교차로 집계 초기화 실패");
+        return false;
+    }
+
+    try {
+        auto& config = ConfigManager::getInstance();
+        const std::string base_key = "processing_modules.vehicle_analytics.intersection";
+
+        redis_client_ = redis_client;
+        redis_host_ = config.getRedisHost();
+        redis_port_ = config.getRedisPort();
+
+        config_.enabled = config.isIntersectionEnabled();
+        config_.is_leader = (config.getString(base_key + ".role", "member") == "leader");
+        config_.approach_no = config.getInt(base_key + ".approach_no", 1);
+        config_.approach_count = config.getInt(base_key + ".approach_count", 4);
+        config_.grace_sec = std::max(0, config.getInt(base_key + ".grace_sec", 10));
+        config_.replace_approach_stats = config.getBool(base_key + ".replace_approach_stats", true);
+        config_.ints_id = ints_id;
+
+        if (config_.approach_count <= 0 ||
+            config_.approach_no <= 0 || config_.approach_no > config_.approach_count) {
+            logger->error("잘못된 접근로 설정 - approach_no: {}, approach_count: {}",
+                         config_.approach_no, config_.approach_count);
+            return false;
+        }
+
+        logger->info("교차로 집계 초기화 완료 - 역할: {}, 접근로: {}/{}, 대기: {}초, 교차로: {}, "
+                    "접근로 통계 대체: {}",
+                    config_.is_leader ? "leader" : "member", config_.approach_no,
+                    config_.approach_count, config_.grace_sec, config_.ints_id,
+                    config_.replace_approach_stats ? "ON" : "OFF");
+        return true;
+
+    } catch (const std::exception& e) {
+        logger->error("교차로 집계 초기화 실패: {}", e.what());
+        return false;
+    }
+}
+
+void IntersectionAggregator::start() {
+    if (!config_.is_leader) {
+        logger->info("교차로 집계 member 모드 - 접근로 레코드 전송만 수행");
+        return;
+    }
+
+    if (running_.load()) {
+        logger->warn("교차로 집계 구독 스레드 이미 실행 중");
+        return;
+    }
+
+    running_ = true;
+
+    try {
+        subscriber_thread_ = std::thread(&IntersectionAggregator::subscriberThread, this);
+        logger->info("교차로 집계 구독 스레드 시작됨");
+    } catch (const std::exception& e) {
+        running_ = false;
+        logger->error("교차로 집계 스레드 시작 실패: {}", e.what());
+    }
+}
+
+void IntersectionAggregator::stop() {
+    if (!running_.load()) {
+        return;
+    }
+
+    logger->info("교차로 집계 중지 시작");
+    running_ = false;
+
+    try {
+        if (subscriber_thread_.joinable()) {
+            subscriber_thread_.join();
+        }
+    } catch (const std::exception& e) {
+        logger->error("스레드 종료 중 오류: {}", e.what());
+    }
+
+    logStatistics();
+    logger->info("교차로 집계 중지 완료");
+}
+
+void IntersectionAggregator::onSignalStats(const StatsDataPacket& packet) {
+    if (!config_.enabled || !packet.is_valid) return;
+
+    try {
+        ApproachCycleRecord record = buildRecord(packet);
+
+        if (!config_.is_leader) {
+            // member: 노드 로컬 Redis로 접근로 레코드 전송
+            int result = redis_client_->sendData(CHANNEL_INTERSECTION_APPROACH, createApproachJson(record));
+            if (result != 0) {
+                logger->error("접근로 레코드 전송 실패 - 결과: {}", result);
+            }
+            return;
+        }
+
+        // leader: 자기 레코드 추가 후 이 주기를 집계 대기열에 등록
+        std::lock_guard<std::mutex> lock(aggregate_mutex_);
+        records_local_++;
+        addRecord(record);
+
+        PendingIntersectionCycle cycle;
+        cycle.start_time = record.start_time;
+        cycle.end_time = record.end_time;
+        cycle.close_time = record.end_time + config_.grace_sec;
+        pending_cycles_.push_back(cycle);
+
+        if (static_cast<int>(pending_cycles_.size()) > MAX_PENDING_CYCLES) {
+            logger->warn("집계 대기 주기 초과 - 가장 오래된 주기 폐기 ({} ~ {})",
+                        pending_cycles_.front().start_time, pending_cycles_.front().end_time);
+            pending_cycles_.pop_front();
+        }
+
+    } catch (const std::exception& e) {
+        logger->error("신호현시 통계 처리 중 예외: {}", e.what());
+    }
+}
+
+ApproachCycleRecord IntersectionAggregator::buildRecord(const StatsDataPacket& packet) const {
+    ApproachCycleRecord record;
+    record.approach_no = config_.approach_no;
+    record.start_time = packet.approach.stats_bgng_unix_tm;
+    record.end_time = packet.approach.stats_end_unix_tm;
+    record.movement_counts.assign(STATS_TURN_TYPES.size(), 0);
+
+    for (const auto& turn : packet.turn_types) {
+        auto it = std::find(STATS_TURN_TYPES.begin(), STATS_TURN_TYPES.end(), turn.turn_type_cd);
+        if (it != STATS_TURN_TYPES.end()) {
+            record.movement_counts[it - STATS_TURN_TYPES.begin()] += turn.totl_trvl;
+        }
+    }
+
+    return record;
+}
+
+void IntersectionAggregator::addRecord(ApproachCycleRecord record) {
+    // aggregate_mutex_ 보유 상태에서 호출
+    pending_records_.push_back(std::move(record));
+
+    size_t max_records = static_cast<size_t>(config_.approach_count) * RECORDS_PER_APPROACH;
+    while (pending_records_.size() > max_records) {
+        pending_records_.pop_front();
+        records_dropped_++;
+    }
+}
+
+void IntersectionAggregator::publishDueCycles(int current_time) {
+    std::vector<std::string> outgoing;
+
+    {
+        std::lock_guard<std::mutex> lock(aggregate_mutex_);
+
+        while (!pending_cycles_.empty() && pending_cycles_.front().close_time <= current_time) {
+            auto aggregate_start = std::chrono::steady_clock::now();
+            PendingIntersectionCycle cycle = pending_cycles_.front();
+            pending_cycles_.pop_front();
+
+            std::vector<std::vector<int>> matrix(config_.approach_count,
+                                                 std::vector<int>(STATS_TURN_TYPES.size(), 0));
+            std::vector<bool> reported(config_.approach_count, false);
+
+            // 종료 시각이 (start, end]인 레코드를 이 주기에 배정, 그 이전 레코드는 폐기
+            for (auto it = pending_records_.begin(); it != pending_records_.end();) {
+                if (it->end_time > cycle.end_time) {
+                    ++it;
+                    continue;
+                }
+
+                if (it->end_time > cycle.start_time) {
+                    int row = it->approach_no - 1;
+                    for (size_t m = 0; m < it->movement_counts.size() && m < STATS_TURN_TYPES.size(); m++) {
+                        matrix[row][m] += it->movement_counts[m];
+                    }
+                    reported[row] = true;
+                } else {
+                    records_dropped_++;
+                }
+                it = pending_records_.erase(it);
+            }
+
+            outgoing.push_back(createIntersectionJson(cycle, matrix, reported));
+            cycles_published_++;
+
+            last_aggregate_us_ = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - aggregate_start).count();
+
+            int reported_count = static_cast<int>(std::count(reported.begin(), reported.end(), true));
+            logger->info("교차로 주기 집계 - {} ~ {}, 보고 접근로: {}/{}, 집계 시간: {}us",
+                        cycle.start_time, cycle.end_time, reported_count,
+                        config_.approach_count, last_aggregate_us_);
+        }
+    }
+
+    for (const auto& data : outgoing) {
+        int result = redis_client_->sendData(CHANNEL_INTERSECTION, data);
+        if (result != 0) {
+            logger->error("교차로 주기 레코드 전송 실패 - 결과: {}", result);
+        }
+    }
+}
+
+std::string IntersectionAggregator::createApproachJson(const ApproachCycleRecord& record) const {
+    Json::Value root;
+    root[IntersectionJsonKeys::APPROACH_NO] = record.approach_no;
+    root[IntersectionJsonKeys::BEGIN_TIME] = record.start_time;
+    root[IntersectionJsonKeys::END_TIME] = record.end_time;
+
+    Json::Value movements(Json::arrayValue);
+    for (int count : record.movement_counts) {
+        movements.append(count);
+    }
+    root[IntersectionJsonKeys::MOVEMENTS] = movements;
+
+    Json::FastWriter writer;
+    std::string result = writer.write(root);
+    if (!result.empty() && result.back() == '\n') {
+        result.pop_back();
+    }
+    return result;
+}
+
+bool IntersectionAggregator::parseApproachJson(const std::string& data, ApproachCycleRecord& record) const {
+    Json::Value root;
+    Json::Reader reader;
+    if (!reader.parse(data, root) || !root.isObject()) {
+        return false;
+    }
+
+    const Json::Value& movements = root[IntersectionJsonKeys::MOVEMENTS];
+    if (!movements.isArray() || movements.size() != STATS_TURN_TYPES.size()) {
+        return false;
+    }
+
+    record.approach_no = root.get(IntersectionJsonKeys::APPROACH_NO, 0).asInt();
+    record.start_time = root.get(IntersectionJsonKeys::BEGIN_TIME, 0).asInt();
+    record.end_time = root.get(IntersectionJsonKeys::END_TIME, 0).asInt();
+    if (record.approach_no <= 0 || record.approach_no > config_.approach_count || record.end_time <= 0) {
+        return false;
+    }
+
+    record.movement_counts.clear();
+    for (const auto& count : movements) {
+        record.movement_counts.push_back(count.asInt());
+    }
+    return true;
+}
+
+std::string IntersectionAggregator::createIntersectionJson(const PendingIntersectionCycle& cycle,
+                                                           const std::vector<std::vector<int>>& matrix,
+                                                           const std::vector<bool>& reported) const {
+    Json::Value body;
+    body[IntersectionJsonKeys::INTS_ID] = config_.ints_id;
+    body[IntersectionJsonKeys::CYCLE_BEGIN] = cycle.start_time;
+    body[IntersectionJsonKeys::CYCLE_END] = cycle.end_time;
+
+    Json::Value turn_types(Json::arrayValue);
+    for (int turn : STATS_TURN_TYPES) {
+        turn_types.append(turn);
+    }
+    body[IntersectionJsonKeys::TURN_TYPES] = turn_types;
+
+    // 행 = 접근로 (1번부터), 미보고 접근로는 null
+    Json::Value rows(Json::arrayValue);
+    int reported_count = 0;
+    for (size_t a = 0; a < matrix.size(); a++) {
+        if (!reported[a]) {
+            rows.append(Json::Value(Json::nullValue));
+            continue;
+        }
+        Json::Value row(Json::arrayValue);
+        for (int count : matrix[a]) {
+            row.append(count);
+        }
+        rows.append(row);
+        reported_count++;
+    }
+    body[IntersectionJsonKeys::REPORTED] = reported_count;
+    body[IntersectionJsonKeys::MATRIX] = rows;
+
+    Json::Value root;
+    root[IntersectionJsonKeys::ROOT_KEY] = body;
+
+    Json::FastWriter writer;
+    std::string result = writer.write(root);
+    if (!result.empty() && result.back() == '\n') {
+        result.pop_back();
+    }
+    return result;
+}
+
+bool IntersectionAggregator::connectSubscriber() {
+    disconnectSubscriber();
+
+    struct timeval timeout = {5, 0};
+    sub_ctx_ = redisConnectWithTimeout(redis_host_.c_str(), redis_port_, timeout);
+    if (!sub_ctx_ || sub_ctx_->err) {
+        logger->error("구독 연결 실패: {}", sub_ctx_ ? sub_ctx_->errstr : "할당 실패");
+        disconnectSubscriber();
+        return false;
+    }
+
+    std::string channel = getChannelName(CHANNEL_INTERSECTION_APPROACH);
+    redisReply* reply = (redisReply*)redisCommand(sub_ctx_, "SUBSCRIBE %b",
+                                                  channel.c_str(), channel.length());
+    if (!reply) {
+        logger->error("SUBSCRIBE 실패 - 채널: {}", channel);
+        disconnectSubscriber();
+        return false;
+    }
+    freeReplyObject(reply);
+
+    logger->info("접근로 레코드 구독 시작 - {}:{}, 채널: {}", redis_host_, redis_port_, channel);
+    return true;
+}
+
+void IntersectionAggregator::disconnectSubscriber() {
+    if (sub_ctx_) {
+        redisFree(sub_ctx_);
+        sub_ctx_ = nullptr;
+    }
+}
+
+void IntersectionAggregator::subscriberThread() {
+    enterThreadRole("ds-intersect");
+    HeartbeatHandle heartbeat = HeartbeatRegistry::getInstance().registerThread("ds-intersect", 10000);
+    logger->info("교차로 집계 구독 스레드 시작");
+
+    auto last_connect_attempt = std::chrono::steady_clock::now() - std::chrono::seconds(RECONNECT_INTERVAL_SEC);
+
+    while (running_.load()) {
+        heartbeat.beat(HB_STAGE_REDIS);
+        
+        // 연결이 없으면 재연결 간격마다 시도 (대기 중에도 주기 집계는 계속)
+        if (!sub_ctx_) {
+            auto now = std::chrono::steady_clock::now();
+            if (now - last_connect_attempt >= std::chrono::seconds(RECONNECT_INTERVAL_SEC)) {
+                last_connect_attempt = now;
+                connectSubscriber();
+            }
+            if (!sub_ctx_) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(POLL_TIMEOUT_MS));
+                publishDueCycles(static_cast<int>(std::time(nullptr)));
+                continue;
+            }
+        }
+
+        // 버퍼에 남은 응답부터 처리, 없으면 소켓 대기 (종료 확인을 위해 타임아웃 사용)
+        void* raw = nullptr;
+        if (redisGetReplyFromReader(sub_ctx_, &raw) != REDIS_OK) {
+            logger->error("구독 응답 파싱 실패 - 재연결");
+            disconnectSubscriber();
+            continue;
+        }
+
+        if (!raw) {
+            struct pollfd pfd;
+            pfd.fd = sub_ctx_->fd;
+            pfd.events = POLLIN;
+            pfd.revents = 0;
+
+            int ready = poll(&pfd, 1, POLL_TIMEOUT_MS);
+            if (ready > 0 && redisBufferRead(sub_ctx_) != REDIS_OK) {
+                logger->error("구독 연결 끊김 - 재연결");
+                disconnectSubscriber();
+            }
+            publishDueCycles(static_cast<int>(std::time(nullptr)));
+            continue;
+        }
+
+        redisReply* reply = static_cast<redisReply*>(raw);
+        if (reply->type == REDIS_REPLY_ARRAY && reply->elements == 3 &&
+            reply->element[2]->type == REDIS_REPLY_STRING) {
+            std::string data(reply->element[2]->str, reply->element[2]->len);
+
+            ApproachCycleRecord record;
+            if (parseApproachJson(data, record)) {
+                if (record.approach_no == config_.approach_no) {
+                    logger->warn("leader와 같은 접근로 번호 레코드 수신 - 무시 (appr_no: {})", record.approach_no);
+                } else {
+                    std::lock_guard<std::mutex> lock(aggregate_mutex_);
+                    records_received_++;
+                    addRecord(std::move(record));
+                }
+            } else {
+                logger->warn("잘못된 접근로 레코드: {}", data);
+            }
+        }
+        freeReplyObject(reply);
+    }
+
+    disconnectSubscriber();
+    logger->info("교차로 집계 구독 스레드 종료");
+}
+
+void IntersectionAggregator::logStatistics() const {
+    std::lock_guard<std::mutex> lock(aggregate_mutex_);
+
+    if (!config_.is_leader) {
+        logger->info("=== 교차로 집계 통계 (member, 접근로 {}) ===", config_.approach_no);
+        return;
+    }
+
+    logger->info("=== 교차로 집계 통계 (leader) ===");
+    logger->info("  전송 주기: {}, 자기 레코드: {}, 수신 레코드: {}, 폐기: {}",
+                cycles_published_, records_local_, records_received_, records_dropped_);
+    logger->info("  대기 레코드: {}, 대기 주기: {}, 최근 집계 시간: {}us",
+                pending_records_.size(), pending_cycles_.size(), last_aggregate_us_);
+}
@@ -0,0 +1,119 @@
+﻿#ifndef INTERSECTION_AGGREGATOR_H
+#define INTERSECTION_AGGREGATOR_H
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "intersection_types.h"
+#include "../statistics/stats_types.h"
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+// Forward declarations
+class RedisClient;
+struct redisContext;
+
+/**
+ * @brief 교차로 단위 주기별 이동류 집계
+ *
+ * 한 엣지 노드가 같은 교차로의 여러 접근로를 처리할 때
+ * 접근로별 신호현시 통계(회전별 교통량)를 교차로 주기 단위 행렬로 합쳐
+ * 주기당 1개의 교차로 레코드를 전송
+ *
+ * - 카메라별로 프로세스가 분리되어 있으므로 member는 노드 로컬 Redis로 접근로 레코드 전송
+ * - leader는 자기 접근로 레코드를 직접 넣고 member 레코드는 구독 스레드로 수집
+ * - 주기 경계는 leader의 녹색 시작 시각, 접근로 레코드는 종료 시각(녹색 시작)으로 정렬
+ * - 주기 종료 + grace_sec 후 행렬 구성 (O(접근로 x 회전), 대기 레코드 수 상한)
+ */
+class IntersectionAggregator {
+private:
+    IntersectionConfig config_;
+    RedisClient* redis_client_ = nullptr;
+
+    // leader: 수집 대기 레코드 및 주기
+    std::deque<ApproachCycleRecord> pending_records_;
+    std::deque<PendingIntersectionCycle> pending_cycles_;
+    mutable std::mutex aggregate_mutex_;
+
+    // leader: 구독 스레드
+    std::thread subscriber_thread_;
+    std::atomic<bool> running_{false};
+    redisContext* sub_ctx_ = nullptr;
+    std::string redis_host_;
+    int redis_port_ = 6379;
+
+    static constexpr int RECORDS_PER_APPROACH = 4;      // 접근로당 대기 레코드 상한
+    static constexpr int MAX_PENDING_CYCLES = 4;
+    static constexpr int POLL_TIMEOUT_MS = 500;
+    static constexpr int RECONNECT_INTERVAL_SEC = 5;
+
+    // 통계
+    uint64_t records_local_ = 0;
+    uint64_t records_received_ = 0;
+    uint64_t records_dropped_ = 0;
+    uint64_t cycles_published_ = 0;
+    int64_t last_aggregate_us_ = 0;
+
+    // 로거
+    std::shared_ptr<spdlog::logger> logger = nullptr;
+
+    // 내부 메서드
+    ApproachCycleRecord buildRecord(const StatsDataPacket& packet) const;
+    std::string createApproachJson(const ApproachCycleRecord& record) const;
+    bool parseApproachJson(const std::string& data, ApproachCycleRecord& record) const;
+    void addRecord(ApproachCycleRecord record);
+    void publishDueCycles(int current_time);
+    std::string createIntersectionJson(const PendingIntersectionCycle& cycle,
+                                       const std::vector<std::vector<int>>& matrix,
+                                       const std::vector<bool>& reported) const;
+
+    // 구독 (leader)
+    bool connectSubscriber();
+    void disconnectSubscriber();
+    void subscriberThread();
+
+public:
+    IntersectionAggregator();
+    ~IntersectionAggregator();
+
+    /**
+     * @brief 초기화 - config.json의 processing_modules.vehicle_analytics.intersection 로드
+     * @param redis_client Redis 클라이언트 포인터 (전송용)
+     * @param ints_id 교차로 ID
+     * @return 성공 시 true
+     */
+    bool initialize(RedisClient* redis_client, const std::string& ints_id);
+
+    /**
+     * @brief leader 구독 스레드 시작 (member는 동작 없음)
+     */
+    void start();
+
+    /**
+     * @brief 구독 스레드 중지
+     */
+    void stop();
+
+    /**
+     * @brief 신호현시 통계 생성 시 호출 (StatsGenerator 콜백)
+     * @param packet 신호현시 통계
+     */
+    void onSignalStats(const StatsDataPacket& packet);
+
+    /**
+     * @brief 통계 정보 로깅
+     */
+    void logStatistics() const;
+
+    bool isLeader() const { return config_.is_leader; }
+    bool replacesApproachStats() const { return config_.enabled && config_.replace_approach_stats; }
+};
+
+#endif // INTERSECTION_AGGREGATOR_H
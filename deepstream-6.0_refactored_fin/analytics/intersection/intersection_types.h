@@ -0,0 +1,63 @@
+﻿#ifndef INTERSECTION_TYPES_H
+#define INTERSECTION_TYPES_H
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief 교차로 주기 집계 설정
+ *
+ * 같은 엣지 노드에서 한 교차로의 여러 접근로(카메라별 프로세스)를 처리할 때 사용
+ * - leader: 접근로 레코드를 수집해 주기별 이동류 행렬 전송 (노드당 1개)
+ * - member: 자기 접근로 레코드만 노드 로컬 Redis로 전송
+ */
+struct IntersectionConfig {
+    bool enabled = false;
+    bool is_leader = false;
+    int approach_no = 1;                    // 이 카메라의 접근로 번호 (1부터)
+    int approach_count = 4;                 // 교차로 접근로 수 (행렬 행 수)
+    int grace_sec = 10;                     // 주기 종료 후 레코드 수집 대기 시간 (초)
+    bool replace_approach_stats = true;     // 접근로별 신호현시 통계 전송 생략 (교차로 레코드로 대체)
+    std::string ints_id;                    // 교차로 ID
+};
+
+/**
+ * @brief 접근로 신호 주기 레코드 (신호현시 통계 1회분)
+ *
+ * movement_counts는 STATS_TURN_TYPES 순서의 회전별 교통량
+ */
+struct ApproachCycleRecord {
+    int approach_no = 0;
+    int start_time = 0;                     // 접근로 주기 시작 (이전 녹색 시작)
+    int end_time = 0;                       // 접근로 주기 종료 (녹색 시작)
+    std::vector<int> movement_counts;
+};
+
+/**
+ * @brief 집계 대기 중인 교차로 주기 (leader 신호 주기 기준)
+ */
+struct PendingIntersectionCycle {
+    int start_time = 0;
+    int end_time = 0;
+    int close_time = 0;                     // 집계/전송 시각 (end_time + grace_sec)
+};
+
+// 교차로 주기 JSON 키
+namespace IntersectionJsonKeys {
+    // 접근로 레코드 (노드 내부)
+    const std::string APPROACH_NO = "appr_no";
+    const std::string BEGIN_TIME = "bgng_unix_tm";
+    const std::string END_TIME = "end_unix_tm";
+    const std::string MOVEMENTS = "mvmt";
+
+    // 교차로 주기 레코드
+    const std::string ROOT_KEY = "intersection";
+    const std::string INTS_ID = "spot_ints_id";
+    const std::string CYCLE_BEGIN = "cycle_bgng_unix_tm";
+    const std::string CYCLE_END = "cycle_end_unix_tm";
+    const std::string TURN_TYPES = "turn_type_cds";
+    const std::string REPORTED = "rpt_appr_cnt";
+    const std::string MATRIX = "trvl_mtrx";
+}
+
+#endif // INTERSECTION_TYPES_H
@@ -14,7 +14,7 @@ QueueAnalyzer::QueueAnalyzer() {
     config_.capture_image = true;
 }
 
-bool QueueAnalyzer::initialize(RedisClient* redis_client) {
+bool QueueAnalyzer::initialize(RedisClient* redis_client, int total_lanes) {
     auto& config = ConfigManager::getInstance();
     
     // 차량 4K 전용 모드 체크
@@ -36,10 +36,17 @@ bool QueueAnalyzer::initialize(RedisClient* redis_client) {
     
     redis_client_ = redis_client;
     
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        max_vehicles_per_lane_.reset(total_lanes);
+        residual_vehicles_per_lane_.reset(total_lanes);
+    }
+    
     // 이미지 저장 경로 가져오기
     config_.image_save_path = config.getFullImagePath("wait_queue");
     
-    logger->info("QueueAnalyzer 초기화 완료 - 이미지 경로: {}", config_.image_save_path);
+    logger->info("QueueAnalyzer 초기화 완료 - 차로: {}, 이미지 경로: {}",
+                max_vehicles_per_lane_.lanes(), config_.image_save_path);
     return true;
 }
 
@@ -47,7 +54,7 @@ void QueueAnalyzer::onRedSignal(int timestamp) {
     std::lock_guard<std::mutex> lock(queue_mutex_);
     
     last_red_start_time_ = timestamp;
-    max_vehicles_per_lane_.clear();
+    max_vehicles_per_lane_.fill(0);
     
     // 적색 신호 시 이미지 캡처 트리거
     triggerImageCapture(true);
@@ -56,7 +63,7 @@ void QueueAnalyzer::onRedSignal(int timestamp) {
 }
 
 QueueDataPacket QueueAnalyzer::onGreenSignal(int timestamp, 
-                                            const std::map<int, int>& residual_cars) {
+                                            const LaneArray<int>& residual_cars) {
     std::lock_guard<std::mutex> lock(queue_mutex_);
     
     logger->info("녹색 신호 시작: {} (주기: {})", timestamp, current_cycle_);
@@ -90,16 +97,17 @@ QueueDataPacket QueueAnalyzer::onGreenSignal(int timestamp,
     return packet;
 }
 
-void QueueAnalyzer::updateLaneCounts(const std::map<int, int>& lane_counts) {
+void QueueAnalyzer::updateLaneCounts(const LaneArray<int>& lane_counts) {
     std::lock_guard<std::mutex> lock(queue_mutex_);
     
     // 각 차로별 최대값 업데이트
-    for (const auto& [lane, count] : lane_counts) {
-        max_vehicles_per_lane_[lane] = std::max(max_vehicles_per_lane_[lane], count);
+    int lanes = std::min(lane_counts.lanes(), max_vehicles_per_lane_.lanes());
+    for (int lane = 1; lane <= lanes; lane++) {
+        max_vehicles_per_lane_[lane] = std::max(max_vehicles_per_lane_[lane], lane_counts[lane]);
     }
 }
 
-QueueDataPacket QueueAnalyzer::analyzeQueue(const std::map<int, int>& residual_cars) {
+QueueDataPacket QueueAnalyzer::analyzeQueue(const LaneArray<int>& residual_cars) {
     QueueDataPacket packet;
     packet.timestamp = getCurTime();
     packet.signal_cycle = current_cycle_;
@@ -125,8 +133,11 @@ QueueDataPacket QueueAnalyzer::analyzeQueue(const std::map<int, int>& residual_c
         double total_residual = 0;
         double total_max = 0;
         
-        // 차로별 대기행렬 계산
-        for (const auto& [lane, residual_count] : residual_cars) {
+        // 차로별 대기행렬 계산 (잔여 차량이 있는 차로만)
+        for (int lane = 1; lane <= residual_cars.lanes(); lane++) {
+            int residual_count = residual_cars[lane];
+            if (residual_count <= 0) continue;
+            
             LaneQueue lane_queue;
             lane_queue.lane_no = lane;
             lane_queue.stats_bgng_unix_tm = last_green_start_time_;   // 이전 녹색 시작
@@ -137,7 +148,7 @@ QueueDataPacket QueueAnalyzer::analyzeQueue(const std::map<int, int>& residual_c
             total_residual += lane_queue.rmnn_queu_lngt;
             
             // 최대 대기행렬
-            if (max_vehicles_per_lane_.find(lane) != max_vehicles_per_lane_.end()) {
+            if (max_vehicles_per_lane_[lane] > 0) {
                 lane_queue.max_queu_lngt = calculateQueueLength(max_vehicles_per_lane_[lane]);
                 total_max += lane_queue.max_queu_lngt;
             } else {
@@ -230,6 +241,13 @@ bool QueueAnalyzer::sendQueueData(const QueueDataPacket& packet) {
         // JSON 변환
         std::string json_data = queueDataToJson(packet);
         
+        // 스케줄러가 있으면 전송률 정책에 따라 비동기 전송
+        if (publish_scheduler_ && publish_scheduler_->submit(CHANNEL_QUEUE, json_data)) {
+            logger->info("대기행렬 데이터 전송 예약 (크기: {} bytes)", json_data.size());
+            logger->info("전송 데이터: {}", json_data);
+            return true;
+        }
+        
         // Redis 전송
         int result = redis_client_->sendData(CHANNEL_QUEUE, json_data);
         
@@ -248,6 +266,70 @@ bool QueueAnalyzer::sendQueueData(const QueueDataPacket& packet) {
     }
 }
 
+void QueueAnalyzer::saveCheckpoint(CheckpointWriter& writer) const {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    
+    writer.put<int32_t>(last_green_start_time_);
+    writer.put<int32_t>(last_red_start_time_);
+    writer.put<int32_t>(current_cycle_);
+    writer.put<int32_t>(residual_timestamp_.load());
+    
+    // 값이 있는 차로만 기록 (차로 수가 바뀌어도 복원 가능)
+    for (const auto* lanes : {&max_vehicles_per_lane_, &residual_vehicles_per_lane_}) {
+        uint32_t count = 0;
+        for (int lane = 1; lane <= lanes->lanes(); lane++) {
+            if ((*lanes)[lane] != 0) count++;
+        }
+        writer.put<uint32_t>(count);
+        for (int lane = 1; lane <= lanes->lanes(); lane++) {
+            if ((*lanes)[lane] == 0) continue;
+            writer.put<int32_t>(lane);
+            writer.put<int32_t>((*lanes)[lane]);
+        }
+    }
+}
+
+bool QueueAnalyzer::restoreCheckpoint(CheckpointReader& reader, const CheckpointContext& context) {
+    int last_green = reader.get<int32_t>();
+    int last_red = reader.get<int32_t>();
+    int cycle = reader.get<int32_t>();
+    int residual_timestamp = reader.get<int32_t>();
+    
+    std::map<int, int> lane_maps[2];
+    for (auto& lanes : lane_maps) {
+        uint32_t count = reader.get<uint32_t>();
+        for (uint32_t i = 0; i < count; i++) {
+            int lane = reader.get<int32_t>();
+            lanes[lane] = reader.get<int32_t>();
+        }
+    }
+    
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    
+    // 재시작 전에 이미 신호 이벤트가 처리된 경우 덮어쓰지 않음
+    if (last_green_start_time_ != 0 || last_red_start_time_ != 0) {
+        return false;
+    }
+    
+    last_green_start_time_ = last_green;
+    last_red_start_time_ = last_red;
+    current_cycle_ = cycle;
+    LaneArray<int>* targets[2] = {&max_vehicles_per_lane_, &residual_vehicles_per_lane_};
+    for (int i = 0; i < 2; i++) {
+        targets[i]->fill(0);
+        for (const auto& [lane, count] : lane_maps[i]) {
+            if (targets[i]->contains(lane)) {
+                (*targets[i])[lane] = count;
+            }
+        }
+    }
+    residual_timestamp_.store(residual_timestamp);
+    
+    logger->info("대기행렬 상태 복원 - 주기: {}, 이전 녹색: {}, 적색: {} ({}초 전 저장)",
+                cycle, last_green, last_red, context.current_time - context.saved_time);
+    return true;
+}
+
 void QueueAnalyzer::logQueueData(const QueueDataPacket& data) const {
     logger->info("=== 대기행렬 데이터 ===");
     logger->info("신호 주기: {}, 이전 녹색: {} → 현재 녹색: {}", 
@@ -8,6 +8,10 @@
 #include <vector>
 #include "queue_types.h"
 #include "../../common/common_types.h"
+#include "../../common/lane_array.h"
+#include "../../data/checkpoint/checkpoint_codec.h"
+#include "../../data/checkpoint/checkpoint_types.h"
+#include "../../data/redis/publish_scheduler.h"
 #include "../../data/redis/redis_client.h"
 #include "../../utils/config_manager.h"
 
@@ -31,15 +35,16 @@ private:
     
     // 외부 모듈 참조
     RedisClient* redis_client_ = nullptr;
+    PublishScheduler* publish_scheduler_ = nullptr;
     
     // 신호 상태
     int last_green_start_time_ = 0;    // 이전 녹색 신호 시작 시간
     int last_red_start_time_ = 0;      // 마지막 적색 신호 시작 시간
     int current_cycle_ = 0;            // 현재 신호 주기
     
-    // 대기행렬 추적
-    std::map<int, int> max_vehicles_per_lane_;      // 차로별 최대 차량 수
-    std::map<int, int> residual_vehicles_per_lane_; // 차로별 잔여 차량 수
+    // 대기행렬 추적 (initialize에서 차로 수로 크기 결정)
+    LaneArray<int> max_vehicles_per_lane_;          // 차로별 최대 차량 수
+    LaneArray<int> residual_vehicles_per_lane_;     // 차로별 잔여 차량 수
     mutable std::mutex queue_mutex_;
     
     // 이미지 캡처 관련
@@ -62,9 +67,16 @@ public:
     /**
      * @brief 초기화
      * @param redis_client Redis 클라이언트 포인터
+     * @param total_lanes 차로 수 (차로 ROI 개수)
      * @return 성공 시 true
      */
-    bool initialize(RedisClient* redis_client);
+    bool initialize(RedisClient* redis_client, int total_lanes);
+    
+    /**
+     * @brief 전송 스케줄러 연결 (nullptr이면 Redis 직접 전송)
+     * @param scheduler 전송 스케줄러 포인터
+     */
+    void setPublishScheduler(PublishScheduler* scheduler) { publish_scheduler_ = scheduler; }
     
     /**
      * @brief 신호가 적색으로 변경됨
@@ -79,20 +91,20 @@ public:
      * @return 대기행렬 데이터 패킷
      */
     QueueDataPacket onGreenSignal(int timestamp, 
-                                 const std::map<int, int>& residual_cars);
+                                 const LaneArray<int>& residual_cars);
     
     /**
      * @brief 차로별 차량 수 업데이트
      * @param lane_counts 현재 차로별 차량 수
      */
-    void updateLaneCounts(const std::map<int, int>& lane_counts);
+    void updateLaneCounts(const LaneArray<int>& lane_counts);
     
     /**
      * @brief 대기행렬 분석
      * @param residual_cars 차로별 잔여 차량 수
      * @return 대기행렬 데이터 패킷
      */
-    QueueDataPacket analyzeQueue(const std::map<int, int>& residual_cars);
+    QueueDataPacket analyzeQueue(const LaneArray<int>& residual_cars);
     
     /**
      * @brief 대기행렬 데이터 로깅
@@ -100,6 +112,20 @@ public:
      */
     void logQueueData(const QueueDataPacket& data) const;
     
+    /**
+     * @brief 체크포인트 직렬화 (신호 주기, 차로별 최대/잔여 차량 수)
+     * @param writer 체크포인트 기록기
+     */
+    void saveCheckpoint(CheckpointWriter& writer) const;
+    
+    /**
+     * @brief 체크포인트 복원 (재시작 후 첫 녹색 신호에서 이전 주기 대기행렬 전송)
+     * @param reader 체크포인트 판독기
+     * @param context 복원 컨텍스트
+     * @return 복원 적용 시 true
+     */
+    bool restoreCheckpoint(CheckpointReader& reader, const CheckpointContext& context);
+    
     /**
      * @brief 이미지 캡처 트리거
      * @param need_capture true일 경우 이미지 캡처 필요
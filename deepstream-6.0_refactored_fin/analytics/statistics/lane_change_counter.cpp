@@ -0,0 +1,166 @@
+﻿/*
+ * lane_change_counter.cpp
+ *
+ * 정지선 전 차로 변경 집계 구현
+ */
+
+#include "lane_change_counter.h"
+#include "../../calibration/calibration.h"
+#include "../../roi_module/roi_handler.h"
+#include "../../utils/config_manager.h"
+#include <algorithm>
+#include <cmath>
+
+LaneChangeCounter::LaneChangeCounter() {
+    logger = getLogger("DS_LaneChange_log");
+    logger->info("LaneChangeCounter 생성");
+}
+
+bool LaneChangeCounter::initialize(int total_lanes) {
+    try {
+        loadConfig();
+
+        if (total_lanes <= 0) {
+            logger->error("차로 수가 유효하지 않음: {}", total_lanes);
+            return false;
+        }
+        total_lanes_ = total_lanes;
+
+        // 정지선 중점 투영 (거리 구간 기준)
+        const auto& stop_line = ROIHandler::stop_line_roi;
+        if (stop_line.size() >= 2) {
+            double lon_a, lat_a, lon_b, lat_b;
+            if (groundPosition(0, stop_line[0].x, stop_line[0].y, lon_a, lat_a) &&
+                groundPosition(0, stop_line[1].x, stop_line[1].y, lon_b, lat_b)) {
+                stop_line_lon_m_ = (lon_a + lon_b) / 2.0;
+                stop_line_valid_ = true;
+            }
+        }
+        if (!stop_line_valid_) {
+            logger->warn("정지선 투영 불가 (Calibration 미적용) - 거리 구간 없이 집계");
+            config_.band_edges_m.clear();
+        }
+
+        band_count_ = static_cast<int>(config_.band_edges_m.size()) + 1;
+        matrix_.assign(static_cast<size_t>(band_count_) * total_lanes_ * total_lanes_, 0);
+
+        logger->info("차로 변경 집계 초기화 완료 - 차로: {}, 유지 프레임: {}, 거리 구간: {}개",
+                    total_lanes_, config_.persist_frames, band_count_);
+        return true;
+
+    } catch (const std::exception& e) {
+        logger->error("차로 변경 집계 초기화 실패: {}", e.what());
+        return false;
+    }
+}
+
+void LaneChangeCounter::loadConfig() {
+    auto& config = ConfigManager::getInstance();
+    const std::string base_key = "processing_modules.vehicle_analytics.lane_change";
+
+    config_.enabled = config.isLaneChangeEnabled();
+    config_.persist_frames = config.getInt(base_key + ".persist_frames", 8);
+    std::vector<double> band_edges = config.getDoubleArray(base_key + ".band_edges_m");
+    if (!band_edges.empty()) {
+        config_.band_edges_m = band_edges;
+    }
+
+    // 후보 프레임 수는 uint8_t로 보관
+    if (config_.persist_frames < 1 || config_.persist_frames > 255) {
+        logger->warn("잘못된 persist_frames 값: {} - 기본값 8 사용", config_.persist_frames);
+        config_.persist_frames = 8;
+    }
+
+    config_.band_edges_m.erase(
+        std::remove_if(config_.band_edges_m.begin(), config_.band_edges_m.end(),
+                       [](double edge) { return edge <= 0.0; }),
+        config_.band_edges_m.end());
+    std::sort(config_.band_edges_m.begin(), config_.band_edges_m.end());
+    config_.band_edges_m.erase(
+        std::unique(config_.band_edges_m.begin(), config_.band_edges_m.end()),
+        config_.band_edges_m.end());
+}
+
+int LaneChangeCounter::bandOf(const ObjPoint& pos) const {
+    if (!stop_line_valid_ || config_.band_edges_m.empty()) return 0;
+
+    double lon, lat;
+    if (!groundPosition(0, pos.x, pos.y, lon, lat)) {
+        return band_count_ - 1;
+    }
+
+    double distance = std::fabs(lon - stop_line_lon_m_);
+    return static_cast<int>(std::upper_bound(config_.band_edges_m.begin(),
+                                             config_.band_edges_m.end(), distance)
+                            - config_.band_edges_m.begin());
+}
+
+void LaneChangeCounter::onLaneCandidate(obj_data& obj, int lane, const ObjPoint& pos) {
+    // 첫 차로 할당
+    if (obj.stable_lane <= 0) {
+        obj.stable_lane = static_cast<int8_t>(lane);
+        obj.lane_candidate_frames = 0;
+        return;
+    }
+
+    // 정지선 통과 후는 교차로 내부 (집계 대상 아님)
+    if (obj.stop_line_pass) return;
+
+    if (lane == obj.lane_candidate) {
+        obj.lane_candidate_frames++;
+    } else {
+        obj.lane_candidate = static_cast<int8_t>(lane);
+        obj.lane_candidate_frames = 1;
+    }
+    if (obj.lane_candidate_frames < config_.persist_frames) return;
+
+    int from_lane = obj.stable_lane;
+    obj.stable_lane = static_cast<int8_t>(lane);
+    obj.lane_candidate_frames = 0;
+    if (obj.lane_change_count < UINT8_MAX) {
+        obj.lane_change_count++;
+    }
+
+    if (from_lane > total_lanes_ || lane > total_lanes_) return;
+
+    int band = bandOf(pos);
+    size_t index = (static_cast<size_t>(band) * total_lanes_ + (from_lane - 1)) * total_lanes_ + (lane - 1);
+    {
+        std::lock_guard<std::mutex> lock(matrix_mutex_);
+        matrix_[index]++;
+        total_changes_++;
+    }
+
+    logger->debug("[LANE-CHANGE] ID={} {} -> {} 차로, 구간: {}", obj.object_id, from_lane, lane, band);
+}
+
+std::vector<LaneChangeStats> LaneChangeCounter::drain() {
+    std::vector<LaneChangeStats> result;
+
+    std::lock_guard<std::mutex> lock(matrix_mutex_);
+    for (int band = 0; band < band_count_; band++) {
+        for (int from = 1; from <= total_lanes_; from++) {
+            for (int to = 1; to <= total_lanes_; to++) {
+                uint32_t& cell = matrix_[(static_cast<size_t>(band) * total_lanes_ + (from - 1)) * total_lanes_ + (to - 1)];
+                if (cell == 0) continue;
+
+                LaneChangeStats item;
+                item.from_lane = from;
+                item.to_lane = to;
+                item.band = band;
+                item.band_from_m = band > 0 ? config_.band_edges_m[band - 1] : 0.0;
+                item.band_to_m = band < static_cast<int>(config_.band_edges_m.size())
+                                 ? config_.band_edges_m[band] : -1.0;
+                item.count = static_cast<int>(cell);
+                result.push_back(item);
+                cell = 0;
+            }
+        }
+    }
+    return result;
+}
+
+void LaneChangeCounter::logStatistics() const {
+    std::lock_guard<std::mutex> lock(matrix_mutex_);
+    logger->info("차로 변경 집계 - 누적 변경: {}회", total_changes_);
+}
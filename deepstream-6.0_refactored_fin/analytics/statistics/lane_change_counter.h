@@ -0,0 +1,96 @@
+﻿#ifndef LANE_CHANGE_COUNTER_H
+#define LANE_CHANGE_COUNTER_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "stats_types.h"
+#include "../../common/object_data.h"
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+/**
+ * @brief 차로 변경 집계 설정 (vehicle_analytics.lane_change)
+ */
+struct LaneChangeConfig {
+    bool enabled = false;
+    int persist_frames = 8;                 // 새 차로가 연속 유지되어야 하는 프레임 수
+    std::vector<double> band_edges_m = {15.0, 30.0, 60.0};   // 정지선까지 거리 구간 경계 (m, 오름차순)
+};
+
+/**
+ * @brief 정지선 전 차로 변경 집계 (출발 차로 x 도착 차로 x 거리 구간)
+ *
+ * obj.lane은 매 프레임 getLaneNum으로 덮어쓰므로 별도의 안정 차로(stable_lane)를 두고
+ * 다른 차로가 persist_frames 동안 유지될 때만 변경으로 확정 (차로 경계 흔들림 제거)
+ * - 추적 객체당 4바이트 (stable_lane, lane_candidate, 후보 프레임 수, 변경 횟수)
+ * - 차로가 그대로면 비교 1회로 종료 (observe 인라인)
+ * - 확정 시에만 도로 평면 투영 1회로 정지선까지 거리 구간 결정
+ *
+ * 집계 행렬은 초기화 시 고정 크기로 할당, 인터벌 통계 생성 시 drain으로 비움
+ */
+class LaneChangeCounter {
+private:
+    LaneChangeConfig config_;
+    int total_lanes_ = 0;
+    int band_count_ = 1;
+
+    // 정지선 중점의 도로 평면 종방향 좌표 (Calibration 미적용 시 거리 구간 없음)
+    bool stop_line_valid_ = false;
+    double stop_line_lon_m_ = 0.0;
+
+    // [band][from-1][to-1] 평탄화
+    std::vector<uint32_t> matrix_;
+    uint64_t total_changes_ = 0;
+    mutable std::mutex matrix_mutex_;
+
+    std::shared_ptr<spdlog::logger> logger = nullptr;
+
+    void loadConfig();
+    int bandOf(const ObjPoint& pos) const;
+    void onLaneCandidate(obj_data& obj, int lane, const ObjPoint& pos);
+
+public:
+    LaneChangeCounter();
+    ~LaneChangeCounter() = default;
+
+    /**
+     * @brief 초기화 - 정지선 위치 투영 및 집계 행렬 할당
+     * @param total_lanes 총 차로 수
+     * @return 성공 시 true
+     */
+    bool initialize(int total_lanes);
+
+    /**
+     * @brief 차량 차로 관측 - process_meta에서 차량마다 호출
+     * @param obj 차량 데이터 (stable_lane 등 갱신)
+     * @param lane 현재 프레임 getLaneNum 결과 (0: 차로 밖)
+     * @param pos 하단 중심 (영상 좌표)
+     */
+    void observe(obj_data& obj, int lane, const ObjPoint& pos) {
+        if (lane == obj.stable_lane) {
+            obj.lane_candidate_frames = 0;
+            return;
+        }
+        if (lane > 0) {
+            onLaneCandidate(obj, lane, pos);
+        }
+    }
+
+    /**
+     * @brief 누적 집계 반환 후 초기화 (인터벌 통계 생성 시)
+     * @return 0이 아닌 (출발, 도착, 구간) 항목
+     */
+    std::vector<LaneChangeStats> drain();
+
+    /**
+     * @brief 통계 정보 로깅
+     */
+    void logStatistics() const;
+};
+
+#endif // LANE_CHANGE_COUNTER_H
@@ -13,6 +13,9 @@
 #include "stats_generator.h"
 #include "../../calibration/calibration.h"
 #include "../../utils/config_manager.h"
+#include "../../utils/heartbeat_registry.h"
+#include "../../utils/thread_role.h"
+#include <algorithm>
 #include <climits>
 #include <cmath>
 #include <ctime>
@@ -127,7 +130,14 @@ void StatsGenerator::initialize(RedisClient* redis_client, SQLiteHandler* sqlite
     // ROI 거리 초기화 (24/7 안정성)
     initializeROIDistance();
     
-    // 프레임 데이터 초기화
+    // 프레임 데이터 초기화 (차로 배열 크기는 여기서만 결정)
+    {
+        std::lock_guard<std::mutex> lock(frame_mutex_);
+        per_lane_count_.reset(total_lanes_);
+        per_lane_total_.reset(total_lanes_);
+        per_lane_max_.reset(total_lanes_);
+        per_lane_min_.reset(total_lanes_);
+    }
     resetFrameData();
     
     // StatsQueryHelper 생성
@@ -141,6 +151,15 @@ void StatsGenerator::initialize(RedisClient* redis_client, SQLiteHandler* sqlite
     } else {
         logger->error("SQLiteHandler가 null이므로 StatsQueryHelper를 생성할 수 없음");
     }
+    
+    // 차로 변경 집계 (인터벌 통계에 포함)
+    if (ConfigManager::getInstance().isLaneChangeEnabled()) {
+        lane_change_counter_ = std::make_unique<LaneChangeCounter>();
+        if (!lane_change_counter_->initialize(total_lanes_)) {
+            logger->warn("차로 변경 집계 초기화 실패 - 비활성화");
+            lane_change_counter_.reset();
+        }
+    }
 }
 
 void StatsGenerator::start() {
@@ -183,17 +202,13 @@ void StatsGenerator::stop() {
     logger->info("통계 생성기 중지 완료");
 }
 
-void StatsGenerator::updateFrameData(const std::map<int, int>& lane_counts) {
+void StatsGenerator::updateFrameData(const LaneArray<int>& lane_counts) {
     try {
         std::lock_guard<std::mutex> lock(frame_mutex_);
         
         // 각 차로별 데이터 업데이트
         for (int lane = 1; lane <= total_lanes_; lane++) {
-            int count = 0;
-            auto it = lane_counts.find(lane);
-            if (it != lane_counts.end()) {
-                count = it->second;
-            }
+            int count = lane_counts.contains(lane) ? lane_counts[lane] : 0;
             
             // 현재 프레임 데이터 저장
             per_lane_count_[lane] = count;
@@ -224,23 +239,66 @@ void StatsGenerator::resetFrameData() {
         std::lock_guard<std::mutex> lock(frame_mutex_);
         
         frame_count_ = 0;
-        per_lane_count_.clear();
-        per_lane_total_.clear();
-        per_lane_max_.clear();
-        per_lane_min_.clear();
-        
-        // 초기화
-        for (int lane = 1; lane <= total_lanes_; lane++) {
-            per_lane_count_[lane] = 0;
-            per_lane_total_[lane] = 0;
-            per_lane_max_[lane] = 0;
-            per_lane_min_[lane] = INT_MAX;
-        }
+        per_lane_count_.fill(0);
+        per_lane_total_.fill(0);
+        per_lane_max_.fill(0);
+        per_lane_min_.fill(INT_MAX);
     } catch (const std::exception& e) {
         logger->error("프레임 데이터 리셋 중 오류: {}", e.what());
     }
 }
 
+void StatsGenerator::saveCheckpoint(CheckpointWriter& writer) const {
+    writer.put<int32_t>(last_signal_stats_time_.load());
+    
+    std::lock_guard<std::mutex> lock(frame_mutex_);
+    writer.put<int32_t>(frame_count_);
+    writer.put<uint32_t>(static_cast<uint32_t>(per_lane_total_.lanes()));
+    for (int lane = 1; lane <= per_lane_total_.lanes(); lane++) {
+        writer.put<int32_t>(lane);
+        writer.put<int32_t>(per_lane_total_[lane]);
+        writer.put<int32_t>(per_lane_max_[lane]);
+        writer.put<int32_t>(per_lane_min_[lane]);
+    }
+}
+
+bool StatsGenerator::restoreCheckpoint(CheckpointReader& reader, const CheckpointContext& context) {
+    int last_signal_time = reader.get<int32_t>();
+    int frame_count = reader.get<int32_t>();
+    uint32_t lane_count = reader.get<uint32_t>();
+    
+    std::map<int, int> totals, maxs, mins;
+    for (uint32_t i = 0; i < lane_count; i++) {
+        int lane = reader.get<int32_t>();
+        totals[lane] = reader.get<int32_t>();
+        maxs[lane] = reader.get<int32_t>();
+        mins[lane] = reader.get<int32_t>();
+    }
+    
+    // 신호현시 통계 시작 시각은 항상 복원 (재시작 구간 포함 집계)
+    if (last_signal_time > 0) {
+        last_signal_stats_time_ = last_signal_time;
+    }
+    
+    // 인터벌 경계를 넘었으면 이전 구간 누적값은 버림
+    if (calculateNextIntervalTime(context.saved_time) != calculateNextIntervalTime(context.current_time)) {
+        logger->info("체크포인트 인터벌 구간 변경 - 프레임 누적값 복원 안함");
+        return last_signal_time > 0;
+    }
+    
+    std::lock_guard<std::mutex> lock(frame_mutex_);
+    for (int lane = 1; lane <= total_lanes_; lane++) {
+        if (totals.count(lane) == 0) continue;
+        per_lane_total_[lane] = totals[lane];
+        per_lane_max_[lane] = maxs[lane];
+        per_lane_min_[lane] = mins[lane];
+    }
+    frame_count_ = frame_count;
+    
+    logger->info("프레임 누적값 복원 - {}프레임, {}개 차로", frame_count, lane_count);
+    return true;
+}
+
 int StatsGenerator::calculateNextIntervalTime(int current_time) const {
     // 현재 시간을 tm 구조체로 변환
     std::time_t time_t_current = static_cast<std::time_t>(current_time);
@@ -273,6 +331,8 @@ int StatsGenerator::calculateNextIntervalTime(int current_time) const {
 }
 
 void StatsGenerator::intervalTimerThread() {
+    enterThreadRole("ds-stats");
+    HeartbeatHandle heartbeat = HeartbeatRegistry::getInstance().registerThread("ds-stats", 60000);
     logger->info("인터벌 타이머 스레드 시작 ({}분 주기)", interval_minutes_);
     
     // 첫 실행: 다음 인터벌까지 대기
@@ -288,6 +348,7 @@ void StatsGenerator::intervalTimerThread() {
                     tm_next->tm_hour, tm_next->tm_min, wait_seconds);
         
         // 첫 인터벌까지 대기
+        heartbeat.beat(HB_STAGE_IDLE);
         std::unique_lock<std::mutex> lock(cv_mutex_);
         if (cv_.wait_for(lock, std::chrono::seconds(wait_seconds), 
                         [this]() { return !running_.load(); })) {
@@ -299,6 +360,7 @@ void StatsGenerator::intervalTimerThread() {
         // 첫 통계 생성
         if (running_.load()) {
             logger->info("첫 인터벌 통계 생성 시작 (인터벌 정렬 완료)");
+            heartbeat.beat(HB_STAGE_SQLITE);
             generateIntervalStats();
         }
     }
@@ -306,6 +368,7 @@ void StatsGenerator::intervalTimerThread() {
     while (running_.load()) {
         try {
             // 정확한 인터벌만큼 대기 (이미 정각에 맞춰져 있음)
+            heartbeat.beat(HB_STAGE_IDLE);
             std::unique_lock<std::mutex> lock(cv_mutex_);
             auto wait_result = cv_.wait_for(lock, std::chrono::minutes(interval_minutes_), 
                                            [this]() { return !running_.load(); });
@@ -317,6 +380,7 @@ void StatsGenerator::intervalTimerThread() {
             // 시간이 만료되면 인터벌 통계 생성
             if (!wait_result) {
                 logger->info("인터벌 타이머 트리거 - 통계 생성 시작");
+                heartbeat.beat(HB_STAGE_SQLITE);
                 generateIntervalStats();
             }
         } catch (const std::exception& e) {
@@ -337,6 +401,9 @@ bool StatsGenerator::generateIntervalStats() {
         logger->info("인터벌 통계 생성 시작 - 기간: {} ~ {}", start_time, current_time);
         
         StatsDataPacket stats = generateStatistics(StatsType::STATS_INTERVAL, start_time, current_time);
+        if (lane_change_counter_) {
+            stats.lane_changes = lane_change_counter_->drain();
+        }
         
         if (validateStats(stats)) {
             logStats(stats);
@@ -364,8 +431,8 @@ void StatsGenerator::onSignalChange(const SignalChangeEvent& event) {
     if (event.type == SignalChangeEvent::Type::GREEN_ON) {
         try {
             int current_time = std::time(nullptr);
-            int start_time = last_signal_stats_time_ > 0 ? 
-                            last_signal_stats_time_ : current_time - 300;
+            int last_time = last_signal_stats_time_.load();
+            int start_time = last_time > 0 ? last_time : current_time - 300;
             
             logger->info("신호현시 통계 생성 시작 - 기간: {} ~ {}", start_time, current_time);
             
@@ -373,7 +440,13 @@ void StatsGenerator::onSignalChange(const SignalChangeEvent& event) {
             
             if (validateStats(stats)) {
                 logStats(stats);
-                sendToRedis(stats);
+                if (publish_signal_stats_) {
+                    sendToRedis(stats);
+                }
+                
+                if (signal_stats_callback_) {
+                    signal_stats_callback_(stats);
+                }
                 
                 // 통계 생성 후 프레임 데이터 리셋
                 resetFrameData();
@@ -397,7 +470,13 @@ StatsDataPacket StatsGenerator::generateStatistics(StatsType type, int start_tim
     
     try {
         // 프레임 기반 밀도 계산 (차선별 거리 반영)
-        std::map<int, DensityInfo> density = calculateDensity(end_time - start_time);
+        LaneArray<DensityInfo> density = calculateDensity(end_time - start_time);
+        
+        // 아래 DB 통계는 모두 같은 읽기 스냅샷에서 조회 (삽입과 독립, 항목 간 합계 일치)
+        std::unique_ptr<StatsQueryHelper::Snapshot> snapshot;
+        if (query_helper_) {
+            snapshot = std::make_unique<StatsQueryHelper::Snapshot>(*query_helper_);
+        }
         
         // 각 통계 생성
         packet.approach = generateApproachStats(type, start_time, end_time, density);
@@ -415,8 +494,8 @@ StatsDataPacket StatsGenerator::generateStatistics(StatsType type, int start_tim
     return packet;
 }
 
-std::map<int, DensityInfo> StatsGenerator::calculateDensity(int time_window_sec) const {
-    std::map<int, DensityInfo> densities;
+LaneArray<DensityInfo> StatsGenerator::calculateDensity(int time_window_sec) const {
+    LaneArray<DensityInfo> densities(total_lanes_);
     
     try {
         std::lock_guard<std::mutex> lock(frame_mutex_);
@@ -431,7 +510,7 @@ std::map<int, DensityInfo> StatsGenerator::calculateDensity(int time_window_sec)
         // 전체 차로의 총 차량 수 계산
         int total_vehicles_all_lanes = 0;
         for (int lane = 1; lane <= total_lanes_; lane++) {
-            total_vehicles_all_lanes += per_lane_total_.at(lane);
+            total_vehicles_all_lanes += per_lane_total_[lane];
         }
         
         logger->debug("밀도 계산 - 시간창: {}초, FPS: {}, 실제프레임: {}", 
@@ -457,7 +536,7 @@ std::map<int, DensityInfo> StatsGenerator::calculateDensity(int time_window_sec)
             if (actual_frames > 0) {
                 // 프레임당 평균 차량 수
                 double avg_vehicles_per_frame = 
-                    static_cast<double>(per_lane_total_.at(lane)) / actual_frames;
+                    static_cast<double>(per_lane_total_[lane]) / actual_frames;
                 
                 // km당 밀도로 변환
                 info.avg_density = static_cast<int>(
@@ -468,22 +547,22 @@ std::map<int, DensityInfo> StatsGenerator::calculateDensity(int time_window_sec)
             }
             
             // 최소 밀도 - km당 변환
-            if (per_lane_min_.at(lane) == INT_MAX) {
+            if (per_lane_min_[lane] == INT_MAX) {
                 info.min_density = 0;  // 차량이 한 번도 없었던 경우
             } else {
                 info.min_density = static_cast<int>(
-                    std::round(per_lane_min_.at(lane) * distance_factor)
+                    std::round(per_lane_min_[lane] * distance_factor)
                 );
             }
             
             // 최대 밀도 - km당 변환
             info.max_density = static_cast<int>(
-                std::round(per_lane_max_.at(lane) * distance_factor)
+                std::round(per_lane_max_[lane] * distance_factor)
             );
             
             // 차로별 교통량 점유율
             if (total_vehicles_all_lanes > 0) {
-                info.occupancy_rate = (static_cast<double>(per_lane_total_.at(lane)) / 
+                info.occupancy_rate = (static_cast<double>(per_lane_total_[lane]) / 
                                       total_vehicles_all_lanes) * 100.0;
             } else {
                 info.occupancy_rate = 0.0;
@@ -500,16 +579,14 @@ std::map<int, DensityInfo> StatsGenerator::calculateDensity(int time_window_sec)
     } catch (const std::exception& e) {
         logger->error("밀도 계산 중 오류: {}", e.what());
         // 오류 시 빈 밀도 정보 반환
-        for (int lane = 1; lane <= total_lanes_; lane++) {
-            densities[lane] = DensityInfo();
-        }
+        densities.fill(DensityInfo());
     }
     
     return densities;
 }
 
 ApproachStats StatsGenerator::generateApproachStats(StatsType type, int start_time, int end_time,
-                                                   const std::map<int, DensityInfo>& density) const {
+                                                   const LaneArray<DensityInfo>& density) const {
     ApproachStats stats;
     
     if (!query_helper_) {
@@ -536,14 +613,13 @@ ApproachStats StatsGenerator::generateApproachStats(StatsType type, int start_ti
         double total_occupancy = 0.0;
         int valid_lanes = 0;
         
-        for (const auto& [lane, info] : density) {
-            if (lane >= 1 && lane <= total_lanes_) {
-                total_avg_density += info.avg_density;
-                total_min_density += info.min_density;
-                total_max_density += info.max_density;
-                total_occupancy += info.occupancy_rate;
-                valid_lanes++;
-            }
+        for (int lane = 1; lane <= std::min(density.lanes(), total_lanes_); lane++) {
+            const DensityInfo& info = density[lane];
+            total_avg_density += info.avg_density;
+            total_min_density += info.min_density;
+            total_max_density += info.max_density;
+            total_occupancy += info.occupancy_rate;
+            valid_lanes++;
         }
         
         if (valid_lanes > 0) {
@@ -651,7 +727,7 @@ std::vector<VehicleTypeStats> StatsGenerator::generateVehicleTypeStats(StatsType
 }
 
 std::vector<LaneStats> StatsGenerator::generateLaneStats(StatsType type, int start_time, int end_time,
-                                                        const std::map<int, DensityInfo>& density) const {
+                                                        const LaneArray<DensityInfo>& density) const {
     std::vector<LaneStats> results;
     
     if (!query_helper_) {
@@ -674,12 +750,12 @@ std::vector<LaneStats> StatsGenerator::generateLaneStats(StatsType type, int sta
             stats.avg_sect_sped = query_helper_->getAverageIntervalSpeedByLane(start_time, end_time, lane);
             
             // 거리 기반 밀도 정보 (대/km)
-            auto it = density.find(lane);
-            if (it != density.end()) {
-                stats.avg_trfc_dnst = it->second.avg_density;
-                stats.min_trfc_dnst = it->second.min_density;
-                stats.max_trfc_dnst = it->second.max_density;
-                stats.ocpn_rt = it->second.occupancy_rate;  // 차로별 교통량 점유율
+            if (density.contains(lane)) {
+                const DensityInfo& info = density[lane];
+                stats.avg_trfc_dnst = info.avg_density;
+                stats.min_trfc_dnst = info.min_density;
+                stats.max_trfc_dnst = info.max_density;
+                stats.ocpn_rt = info.occupancy_rate;  // 차로별 교통량 점유율
             } else {
                 stats.avg_trfc_dnst = 0;
                 stats.min_trfc_dnst = 0;
@@ -788,6 +864,24 @@ bool StatsGenerator::sendToRedis(const StatsDataPacket& stats) const {
         }
         json_data << "]";
         
+        // 차로 변경 집계 (인터벌 통계, 집계기 활성 시에만)
+        if (lane_change_counter_ && stats.type == StatsType::STATS_INTERVAL) {
+            json_data << ",\"lane_changes\":[";
+            for (size_t i = 0; i < stats.lane_changes.size(); i++) {
+                const auto& change = stats.lane_changes[i];
+                json_data << "{";
+                json_data << "\"frm_lane_no\":" << change.from_lane << ",";
+                json_data << "\"to_lane_no\":" << change.to_lane << ",";
+                json_data << "\"dstn_band_no\":" << change.band << ",";
+                json_data << "\"dstn_bgng_m\":" << std::setprecision(1) << change.band_from_m << ",";
+                json_data << "\"dstn_end_m\":" << change.band_to_m << ",";
+                json_data << "\"chng_cnt\":" << change.count;
+                json_data << "}";
+                if (i < stats.lane_changes.size() - 1) json_data << ",";
+            }
+            json_data << "]";
+        }
+        
         json_data << "}";
         
         // Redis로 전송
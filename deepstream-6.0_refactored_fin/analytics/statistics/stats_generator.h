@@ -9,9 +9,13 @@
 #include <mutex>
 #include <thread>
 #include <vector>
+#include "lane_change_counter.h"
 #include "stats_query_helper.h"
 #include "stats_types.h"
 #include "../../common/common_types.h"
+#include "../../common/lane_array.h"
+#include "../../data/checkpoint/checkpoint_codec.h"
+#include "../../data/checkpoint/checkpoint_types.h"
 #include "../../data/redis/channel_types.h"
 #include "../../data/redis/redis_client.h"
 #include "../../data/sqlite/sqlite_handler.h"
@@ -59,6 +63,9 @@ private:
     // 통계 쿼리 헬퍼
     std::unique_ptr<StatsQueryHelper> query_helper_;
     
+    // 차로 변경 집계 (비활성 시 nullptr)
+    std::unique_ptr<LaneChangeCounter> lane_change_counter_;
+    
     // 스레드 관련
     std::thread interval_thread_;
     std::atomic<bool> running_{false};
@@ -72,14 +79,18 @@ private:
     std::mutex cv_mutex_;
     
     // 신호현시 통계용 시간 추적
-    int last_signal_stats_time_ = 0;  // 이전 신호현시 통계 생성 시각
+    std::atomic<int> last_signal_stats_time_{0};  // 이전 신호현시 통계 생성 시각 (체크포인트 캡처와 공유)
+    
+    // 신호현시 통계 생성 콜백 (교차로 주기 집계용)
+    std::function<void(const StatsDataPacket&)> signal_stats_callback_;
+    bool publish_signal_stats_ = true;  // false: 신호현시 통계는 콜백으로만 전달 (교차로 레코드로 대체)
     
-    // 프레임 기반 밀도 계산용 데이터
+    // 프레임 기반 밀도 계산용 데이터 (initialize에서 차로 수로 크기 결정)
     int frame_count_ = 0;                           // 총 프레임 수
-    std::map<int, int> per_lane_count_;             // 현재 프레임의 차로별 차량 수
-    std::map<int, int> per_lane_total_;             // 차로별 누적 차량 수
-    std::map<int, int> per_lane_max_;               // 차로별 최대 차량 수
-    std::map<int, int> per_lane_min_;               // 차로별 최소 차량 수
+    LaneArray<int> per_lane_count_;                 // 현재 프레임의 차로별 차량 수
+    LaneArray<int> per_lane_total_;                 // 차로별 누적 차량 수
+    LaneArray<int> per_lane_max_;                   // 차로별 최대 차량 수
+    LaneArray<int> per_lane_min_;                   // 차로별 최소 차량 수
     
     // 로거
     std::shared_ptr<spdlog::logger> logger = nullptr;
@@ -87,11 +98,11 @@ private:
     // 내부 메서드
     // 통계 생성 헬퍼 메서드들
     ApproachStats generateApproachStats(StatsType type, int start_time, int end_time,
-                                       const std::map<int, DensityInfo>& density) const;
+                                       const LaneArray<DensityInfo>& density) const;
     std::vector<TurnTypeStats> generateTurnTypeStats(StatsType type, int start_time, int end_time) const;
     std::vector<VehicleTypeStats> generateVehicleTypeStats(StatsType type, int start_time, int end_time) const;
     std::vector<LaneStats> generateLaneStats(StatsType type, int start_time, int end_time,
-                                           const std::map<int, DensityInfo>& density) const;
+                                           const LaneArray<DensityInfo>& density) const;
     
     /**
      * @brief 거리 기반 교통밀도 계산
@@ -102,7 +113,7 @@ private:
      * @param time_window_sec 통계 시간 창 (초)
      * @return 차로별 밀도 정보 (대/km)
      */
-    std::map<int, DensityInfo> calculateDensity(int time_window_sec) const;
+    LaneArray<DensityInfo> calculateDensity(int time_window_sec) const;
     
     // 인터벌 타이머 스레드
     void intervalTimerThread();
@@ -180,9 +191,9 @@ public:
     /**
      * @brief 프레임별 차로 데이터 업데이트
      * process_meta에서 매 프레임마다 호출
-     * @param lane_counts 차로별 차량 수 맵
+     * @param lane_counts 차로별 차량 수
      */
-    void updateFrameData(const std::map<int, int>& lane_counts);
+    void updateFrameData(const LaneArray<int>& lane_counts);
     
     // === 외부 이벤트 핸들러 ===
     
@@ -193,6 +204,45 @@ public:
      */
     void onSignalChange(const SignalChangeEvent& event);
     
+    /**
+     * @brief 신호현시 통계 생성 콜백 등록
+     * 신호현시 통계가 검증된 후 호출됨 (신호 계산기 스레드)
+     * @param callback 콜백 함수
+     */
+    void setSignalStatsCallback(std::function<void(const StatsDataPacket&)> callback) {
+        signal_stats_callback_ = std::move(callback);
+    }
+    
+    /**
+     * @brief 신호현시 통계 Redis 전송 여부 설정
+     * 교차로 주기 집계가 접근로 통계를 대체할 때 false (콜백은 계속 호출)
+     * @param enabled 전송 여부
+     */
+    void setSignalStatsPublish(bool enabled) { publish_signal_stats_ = enabled; }
+    
+    /**
+     * @brief 차로 변경 집계기 조회 (process_meta에서 차량마다 observe 호출)
+     * @return 비활성 시 nullptr
+     */
+    LaneChangeCounter* getLaneChangeCounter() { return lane_change_counter_.get(); }
+    
+    // === 체크포인트 ===
+    
+    /**
+     * @brief 체크포인트 직렬화 (프레임 누적값, 신호현시 시작 시각)
+     * @param writer 체크포인트 기록기
+     */
+    void saveCheckpoint(CheckpointWriter& writer) const;
+    
+    /**
+     * @brief 체크포인트 복원
+     * 저장 시점과 같은 인터벌 구간일 때만 프레임 누적값 복원 (구간이 바뀌었으면 새로 시작)
+     * @param reader 체크포인트 판독기
+     * @param context 복원 컨텍스트
+     * @return 복원 적용 시 true
+     */
+    bool restoreCheckpoint(CheckpointReader& reader, const CheckpointContext& context);
+    
     // === 상태 조회 ===
     
     /**
@@ -2,7 +2,7 @@
  * stats_query_helper.cpp
  * 
  * 통계 쿼리 헬퍼 클래스 구현
- * SQLiteHandler의 DB 연결을 사용하여 통계 관련 쿼리 수행
+ * SQLiteHandler의 읽기 전용 연결을 임대하여 통계 관련 쿼리 수행
  */
 
 #include "stats_query_helper.h"
@@ -15,6 +15,50 @@ StatsQueryHelper::StatsQueryHelper(SQLiteHandler* handler)
     logger->info("StatsQueryHelper 생성");
 }
 
+StatsQueryHelper::Snapshot::Snapshot(const StatsQueryHelper& helper)
+    : helper_(helper), lock_(helper.snapshot_mutex_) {
+    if (!helper_.sqlite_handler_ || !helper_.sqlite_handler_->isHealthy()) {
+        return;
+    }
+    
+    // 쓰기 연결 대체 임대로 스냅샷을 유지하면 통계 생성 내내 삽입이 막히므로 풀 연결만 사용
+    lease_ = helper_.sqlite_handler_->acquireReader();
+    if (!lease_.isPooled()) {
+        lease_.release();
+        return;
+    }
+    if (!lease_.beginSnapshot()) {
+        helper_.logger->warn("통계 스냅샷 시작 실패 - 쿼리별 조회로 진행");
+        lease_.release();
+        return;
+    }
+    
+    std::lock_guard<std::mutex> state_lock(helper_.state_mutex_);
+    helper_.snapshot_lease_ = &lease_;
+    helper_.snapshot_owner_ = std::this_thread::get_id();
+}
+
+StatsQueryHelper::Snapshot::~Snapshot() {
+    std::lock_guard<std::mutex> state_lock(helper_.state_mutex_);
+    if (helper_.snapshot_lease_ == &lease_) {
+        helper_.snapshot_lease_ = nullptr;
+        helper_.snapshot_owner_ = std::thread::id();
+    }
+}
+
+int StatsQueryHelper::vehicleClassId(const std::string& vehicle_type) const {
+    // 미등록 차종(-1)은 어떤 행과도 일치하지 않음
+    return sqlite_handler_ ? sqlite_handler_->getVehicleClassId(vehicle_type) : -1;
+}
+
+SQLiteReadLease* StatsQueryHelper::currentSnapshot() const {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    if (snapshot_lease_ && snapshot_owner_ == std::this_thread::get_id()) {
+        return snapshot_lease_;
+    }
+    return nullptr;
+}
+
 bool StatsQueryHelper::executeQuery(const std::string& query, 
                                   std::function<void(sqlite3_stmt*)> callback) const {
     if (!sqlite_handler_ || !sqlite_handler_->isHealthy()) {
@@ -22,7 +66,15 @@ bool StatsQueryHelper::executeQuery(const std::string& query,
         return false;
     }
     
-    sqlite3* db = sqlite_handler_->getDatabase();
+    // 스냅샷이 열려 있으면 같은 읽기 트랜잭션, 없으면 이 쿼리만 임대
+    SQLiteReadLease local_lease;
+    SQLiteReadLease* lease = currentSnapshot();
+    if (!lease) {
+        local_lease = sqlite_handler_->acquireReader();
+        lease = &local_lease;
+    }
+    
+    sqlite3* db = lease->get();
     if (!db) {
         logger->error("데이터베이스 연결을 가져올 수 없음");
         return false;
@@ -52,7 +104,7 @@ int StatsQueryHelper::getVehicleCountByTurn(int start_time, int end_time, int tu
     int count = 0;
     
     std::stringstream query;
-    query << "SELECT COUNT(*) FROM main_table WHERE turn_type_cd = " << turn_type
+    query << "SELECT COUNT(*) FROM vehicle_record WHERE turn_type_cd = " << turn_type
           << " AND stln_pasg_unix_tm >= " << start_time 
           << " AND stln_pasg_unix_tm < " << end_time;
     
@@ -67,7 +119,7 @@ double StatsQueryHelper::getAverageStopLineSpeedByTurn(int start_time, int end_t
     double avg_speed = 0.0;
     
     std::stringstream query;
-    query << "SELECT AVG(stln_dttn_sped) FROM main_table WHERE turn_type_cd = " << turn_type
+    query << "SELECT AVG(stln_dttn_sped) FROM vehicle_record WHERE turn_type_cd = " << turn_type
           << " AND stln_pasg_unix_tm >= " << start_time 
           << " AND stln_pasg_unix_tm < " << end_time;
     
@@ -84,7 +136,7 @@ double StatsQueryHelper::getAverageIntervalSpeedByTurn(int start_time, int end_t
     double avg_speed = 0.0;
     
     std::stringstream query;
-    query << "SELECT AVG(vhcl_sect_sped) FROM main_table WHERE turn_type_cd = " << turn_type
+    query << "SELECT AVG(vhcl_sect_sped) FROM vehicle_record WHERE turn_type_cd = " << turn_type
           << " AND stln_pasg_unix_tm >= " << start_time 
           << " AND stln_pasg_unix_tm < " << end_time;
     
@@ -102,8 +154,8 @@ int StatsQueryHelper::getVehicleCountByTurnAndType(int start_time, int end_time,
     int count = 0;
     
     std::stringstream query;
-    query << "SELECT COUNT(*) FROM main_table WHERE turn_type_cd = " << turn_type
-          << " AND kncr_cd = '" << vehicle_type << "'"
+    query << "SELECT COUNT(*) FROM vehicle_record WHERE turn_type_cd = " << turn_type
+          << " AND kncr_id = " << vehicleClassId(vehicle_type)
           << " AND stln_pasg_unix_tm >= " << start_time 
           << " AND stln_pasg_unix_tm < " << end_time;
     
@@ -119,7 +171,7 @@ int StatsQueryHelper::getVehicleCountByType(int start_time, int end_time, const
     int count = 0;
     
     std::stringstream query;
-    query << "SELECT COUNT(*) FROM main_table WHERE kncr_cd = '" << vehicle_type << "'"
+    query << "SELECT COUNT(*) FROM vehicle_record WHERE kncr_id = " << vehicleClassId(vehicle_type)
           << " AND stln_pasg_unix_tm >= " << start_time 
           << " AND stln_pasg_unix_tm < " << end_time;
     
@@ -134,7 +186,7 @@ double StatsQueryHelper::getAverageStopLineSpeedByType(int start_time, int end_t
     double avg_speed = 0.0;
     
     std::stringstream query;
-    query << "SELECT AVG(stln_dttn_sped) FROM main_table WHERE kncr_cd = '" << vehicle_type << "'"
+    query << "SELECT AVG(stln_dttn_sped) FROM vehicle_record WHERE kncr_id = " << vehicleClassId(vehicle_type)
           << " AND stln_pasg_unix_tm >= " << start_time 
           << " AND stln_pasg_unix_tm < " << end_time;
     
@@ -151,7 +203,7 @@ double StatsQueryHelper::getAverageIntervalSpeedByType(int start_time, int end_t
     double avg_speed = 0.0;
     
     std::stringstream query;
-    query << "SELECT AVG(vhcl_sect_sped) FROM main_table WHERE kncr_cd = '" << vehicle_type << "'"
+    query << "SELECT AVG(vhcl_sect_sped) FROM vehicle_record WHERE kncr_id = " << vehicleClassId(vehicle_type)
           << " AND stln_pasg_unix_tm >= " << start_time 
           << " AND stln_pasg_unix_tm < " << end_time;
     
@@ -169,7 +221,7 @@ int StatsQueryHelper::getVehicleCountByLane(int start_time, int end_time, int la
     int count = 0;
     
     std::stringstream query;
-    query << "SELECT COUNT(*) FROM main_table WHERE lane_no = " << lane
+    query << "SELECT COUNT(*) FROM vehicle_record WHERE lane_no = " << lane
           << " AND stln_pasg_unix_tm >= " << start_time 
           << " AND stln_pasg_unix_tm < " << end_time;
     
@@ -184,7 +236,7 @@ double StatsQueryHelper::getAverageStopLineSpeedByLane(int start_time, int end_t
     double avg_speed = 0.0;
     
     std::stringstream query;
-    query << "SELECT AVG(stln_dttn_sped) FROM main_table WHERE lane_no = " << lane
+    query << "SELECT AVG(stln_dttn_sped) FROM vehicle_record WHERE lane_no = " << lane
           << " AND stln_pasg_unix_tm >= " << start_time 
           << " AND stln_pasg_unix_tm < " << end_time;
     
@@ -201,7 +253,7 @@ double StatsQueryHelper::getAverageIntervalSpeedByLane(int start_time, int end_t
     double avg_speed = 0.0;
     
     std::stringstream query;
-    query << "SELECT AVG(vhcl_sect_sped) FROM main_table WHERE lane_no = " << lane
+    query << "SELECT AVG(vhcl_sect_sped) FROM vehicle_record WHERE lane_no = " << lane
           << " AND stln_pasg_unix_tm >= " << start_time 
           << " AND stln_pasg_unix_tm < " << end_time;
     
@@ -219,7 +271,7 @@ int StatsQueryHelper::getTotalVehicleCount(int start_time, int end_time) const {
     int count = 0;
     
     std::stringstream query;
-    query << "SELECT COUNT(*) FROM main_table WHERE stln_pasg_unix_tm >= " << start_time 
+    query << "SELECT COUNT(*) FROM vehicle_record WHERE stln_pasg_unix_tm >= " << start_time 
           << " AND stln_pasg_unix_tm < " << end_time;
     
     executeQuery(query.str(), [&count](sqlite3_stmt* stmt) {
@@ -233,7 +285,7 @@ double StatsQueryHelper::getTotalAverageStopLineSpeed(int start_time, int end_ti
     double avg_speed = 0.0;
     
     std::stringstream query;
-    query << "SELECT AVG(stln_dttn_sped) FROM main_table WHERE stln_pasg_unix_tm >= " << start_time 
+    query << "SELECT AVG(stln_dttn_sped) FROM vehicle_record WHERE stln_pasg_unix_tm >= " << start_time 
           << " AND stln_pasg_unix_tm < " << end_time;
     
     executeQuery(query.str(), [&avg_speed](sqlite3_stmt* stmt) {
@@ -249,7 +301,7 @@ double StatsQueryHelper::getTotalAverageIntervalSpeed(int start_time, int end_ti
     double avg_speed = 0.0;
     
     std::stringstream query;
-    query << "SELECT AVG(vhcl_sect_sped) FROM main_table WHERE stln_pasg_unix_tm >= " << start_time 
+    query << "SELECT AVG(vhcl_sect_sped) FROM vehicle_record WHERE stln_pasg_unix_tm >= " << start_time 
           << " AND stln_pasg_unix_tm < " << end_time;
     
     executeQuery(query.str(), [&avg_speed](sqlite3_stmt* stmt) {
@@ -4,7 +4,9 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 #include "stats_types.h"
 #include "../../data/sqlite/sqlite_handler.h"
@@ -17,15 +19,58 @@
 /**
  * @brief 통계 쿼리 헬퍼 클래스
  * 
- * SQLiteHandler의 friend 클래스로 동작하며,
- * 통계 관련 복잡한 쿼리를 처리
+ * SQLiteHandler의 읽기 전용 연결 풀을 임대하여
+ * 통계 관련 복잡한 쿼리를 처리 (쓰기 연결의 삽입을 막지 않음)
  * SQLiteHandler의 비대화를 방지하고 책임을 분리
+ * 
+ * 스냅샷이 열린 스레드의 쿼리는 같은 읽기 트랜잭션을 사용하고,
+ * 그 외 쿼리는 쿼리마다 연결을 임대
  */
 class StatsQueryHelper {
+public:
+    /**
+     * @brief 통계 한 묶음을 같은 DB 스냅샷에서 조회 (RAII)
+     * 
+     * 생성한 스레드에서 소멸 전까지 실행되는 쿼리는 모두 같은 시점의 데이터를 읽음
+     * 스냅샷은 한 번에 하나만 열림 (다른 스레드의 스냅샷 생성은 대기)
+     */
+    class Snapshot {
+    private:
+        const StatsQueryHelper& helper_;
+        std::unique_lock<std::mutex> lock_;
+        SQLiteReadLease lease_;
+        
+    public:
+        explicit Snapshot(const StatsQueryHelper& helper);
+        ~Snapshot();
+        Snapshot(const Snapshot&) = delete;
+        Snapshot& operator=(const Snapshot&) = delete;
+        
+        bool isValid() const { return static_cast<bool>(lease_); }
+    };
+    
 private:
     SQLiteHandler* sqlite_handler_;
     std::shared_ptr<spdlog::logger> logger;
     
+    // 현재 열린 스냅샷 (소유 스레드에서만 사용)
+    mutable std::mutex snapshot_mutex_;         // 스냅샷 직렬화
+    mutable std::mutex state_mutex_;            // snapshot_lease_/snapshot_owner_ 보호
+    mutable SQLiteReadLease* snapshot_lease_ = nullptr;
+    mutable std::thread::id snapshot_owner_;
+    
+    /**
+     * @brief 현재 스레드가 연 스냅샷 임대 반환
+     * @return 없으면 nullptr
+     */
+    SQLiteReadLease* currentSnapshot() const;
+    
+    /**
+     * @brief 차종 코드를 vehicle_record.kncr_id로 변환
+     * @return 미등록 코드면 -1
+     */
+    int vehicleClassId(const std::string& vehicle_type) const;
+    
     /**
      * @brief 쿼리 실행 헬퍼 메서드
      * @param query SQL 쿼리
@@ -128,6 +128,20 @@ struct LaneStats {
     LaneStats() {}
 };
 
+/**
+ * @brief 정지선 전 차로 변경 집계 (출발 차로 x 도착 차로 x 거리 구간)
+ * 
+ * 인터벌 통계에만 포함 (신호현시 통계는 빈 목록)
+ */
+struct LaneChangeStats {
+    int from_lane = 0;
+    int to_lane = 0;
+    int band = 0;                     // 거리 구간 번호 (0: 정지선에 가장 가까운 구간)
+    double band_from_m = 0.0;         // 구간 시작 거리 (m)
+    double band_to_m = -1.0;          // 구간 끝 거리 (m, -1: 상한 없음)
+    int count = 0;
+};
+
 /**
  * @brief 통계 데이터 패킷
  * 
@@ -139,6 +153,7 @@ struct StatsDataPacket {
     std::vector<TurnTypeStats> turn_types;
     std::vector<VehicleTypeStats> vehicle_types;
     std::vector<LaneStats> lanes;
+    std::vector<LaneChangeStats> lane_changes;
     
     bool is_valid = false;
 };
@@ -240,4 +240,22 @@ double calculateSpeed(double stx, double sty, double edx, double edy, int second
 	catch (exception& err) {
         return 0;
     }
-}
\ No newline at end of file
+}
+
+// 영상 좌표를 도로 평면의 미터 좌표(종방향, 횡방향)로 변환 - calculateSpeed와 같은 축/스케일 사용
+bool groundPosition(int index, double x, double y, double& longitude_m, double& latitude_m) {
+    if (scale_longitude[index] <= 0 || scale_latitude[index] <= 0) {
+        return false;
+    }
+    try {
+        std::vector<double> p = projector(index, x, y);
+
+        longitude_m = dot(p, {u_longitude[index][0], u_longitude[index][1], u_longitude[index][2]}) * scale_longitude[index];
+        latitude_m  = dot(p, {u_latitude [index][0], u_latitude [index][1], u_latitude [index][2]}) * scale_latitude[index];
+
+        return std::isfinite(longitude_m) && std::isfinite(latitude_m);
+    }
+    catch (exception& err) {
+        return false;
+    }
+}
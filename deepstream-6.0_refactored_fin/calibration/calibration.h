@@ -34,5 +34,6 @@ void calculateVanishingPoint(int index);
 void computeCameraCalibration(int index);
 double calculateSpeed(double stx, double sty, double edx, double edy, int seconds);
 std::vector<double> normalised(const std::vector<double>& v);
+bool groundPosition(int index, double x, double y, double& longitude_m, double& latitude_m);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,67 @@
+﻿/*
+ * lane_array.h
+ *
+ * 차로 번호로 인덱싱하는 고정 크기 배열
+ * - 시작 시 차로 ROI 개수로 한 번 크기를 정하고 이후 프레임 처리 중에는 할당하지 않음
+ * - 차로 번호는 1부터 시작, 0번 슬롯은 차로 밖/범위 밖 값을 흡수 (분기 없이 기록 가능)
+ */
+
+#ifndef LANE_ARRAY_H
+#define LANE_ARRAY_H
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * @brief 차로별 값 배열 (std::map<int, T> 대체)
+ *
+ * - lanes(): 차로 수 (유효 인덱스 1..lanes())
+ * - operator[]: 범위 밖 차로(0, 음수, lanes() 초과)는 0번 슬롯으로 모임
+ * - reset(): 크기 변경 (초기화 시에만 호출), fill(): 값만 초기화 (할당 없음)
+ *
+ * 같은 크기 배열끼리의 복사 대입은 기존 버퍼를 재사용하므로 할당이 발생하지 않음
+ */
+template <typename T>
+class LaneArray {
+private:
+    std::vector<T> values_;     // [0]: 차로 밖, [1..N]: 차로별 값
+
+public:
+    LaneArray() : values_(1) {}
+
+    explicit LaneArray(int lanes, const T& value = T()) {
+        reset(lanes, value);
+    }
+
+    /**
+     * @brief 차로 수 재설정 (초기화 시에만 호출)
+     * @param lanes 차로 수 (음수는 0으로 처리)
+     * @param value 초기값
+     */
+    void reset(int lanes, const T& value = T()) {
+        values_.assign(static_cast<size_t>(std::max(0, lanes)) + 1, value);
+    }
+
+    /**
+     * @brief 모든 슬롯을 같은 값으로 초기화 (크기 유지)
+     */
+    void fill(const T& value) {
+        std::fill(values_.begin(), values_.end(), value);
+    }
+
+    int lanes() const { return static_cast<int>(values_.size()) - 1; }
+
+    bool contains(int lane) const {
+        return lane >= 1 && lane < static_cast<int>(values_.size());
+    }
+
+    T& operator[](int lane) {
+        return values_[contains(lane) ? lane : 0];
+    }
+
+    const T& operator[](int lane) const {
+        return values_[contains(lane) ? lane : 0];
+    }
+};
+
+#endif // LANE_ARRAY_H
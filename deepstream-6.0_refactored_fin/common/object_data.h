@@ -8,10 +8,15 @@
 #ifndef OBJECT_DATA_H
 #define OBJECT_DATA_H
 
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <deque>
 #include <string>
 
+// 차량별 크기 추정 표본 수 (중앙값 계산용)
+const int VEHICLE_SIZE_SAMPLES = 9;
+
 /**
  * @brief 2D 좌표 구조체
  */
@@ -74,10 +79,16 @@ struct obj_data {
     ObjPoint last_pos = {-1, -1};   // [W:VP] 이전 프레임에서의 위치 (매 프레임 업데이트, -1: 무효)
     ObjPoint prev_pos = {-1, -1};   // [W:VP] 1초 전 위치 (속도 계산용, -1: 무효)
     int prev_pos_time = -1;         // [W:VP] prev_pos 시점의 시간 (-1: 미설정)
+    ObjPoint prev_ground = {0, 0};  // [W:VP] prev_pos의 도로 평면 좌표 (종방향, 횡방향 m - 속도 계산 재사용)
+    bool prev_ground_valid = false; // [W:VP] prev_ground 유효 여부 (prev_pos와 함께 갱신 - 단방향 플래그 아님)
     
     // ========== 차로 및 방향 (-1: 미설정) =============
     int lane = 0;                   // [W:VP] 차로 번호 (0: 차로 밖 또는 미확인, 1~N: 차로 번호)
     int dir_out = -1;               // [W:VP] 회전 방향 (-1: 미확정, 11:직진, 21:좌회전, 31:우회전, 41:유턴)
+    int8_t stable_lane = 0;         // [W:PM] 유지 필터를 통과한 차로 (0: 미할당, 차로 변경 집계용)
+    int8_t lane_candidate = 0;      // [W:PM] 변경 후보 차로
+    uint8_t lane_candidate_frames = 0;  // [W:PM] 후보 차로 연속 프레임 수
+    uint8_t lane_change_count = 0;  // [W:PM] 정지선 전 차로 변경 횟수
     
     // ========== 속도 데이터 (차량 전용, -1.0: 미계산) ==============
     double speed = -1.0;            // [W:VP] 현재 속도 (-1.0: 아직 계산 안됨)
@@ -87,6 +98,19 @@ struct obj_data {
     double interval_speed = -1.0;   // [W:VP] 구간 속도 (-1.0: 미계산)
     int num_speed = 0;              // [W:VP] 속도 계산 횟수 (0부터 시작)
     
+    // ========== 지체 지표 (차량 전용, 정지선 통과/회전 확정 전 접근로 구간) ==============
+    double approach_delay = -1.0;   // [W:VP] 접근로 지체 (초, -1.0: 미계산)
+    int stopped_sec = 0;            // [W:VP] 정지 누적 시간 (초)
+    int stop_count = 0;             // [W:VP] 정지 횟수 (히스테리시스 판정)
+    bool is_stopped = false;        // [W:VP] 현재 정지 상태 (정지/출발마다 변경 - 단방향 플래그 아님)
+    
+    // ========== 차체 크기 추정 (차량 전용, 도로 평면 m, -1.0: 미추정) ==============
+    std::array<float, VEHICLE_SIZE_SAMPLES> length_samples{};  // [W:VP] 차장 추정값 (순환)
+    std::array<float, VEHICLE_SIZE_SAMPLES> width_samples{};   // [W:VP] 차폭 추정값 (순환)
+    int size_sample_count = 0;      // [W:VP] 누적 추정 횟수
+    double est_length = -1.0;       // [W:VP] 차장 중앙값 (m)
+    double est_width = -1.0;        // [W:VP] 차폭 중앙값 (m)
+    
     // ========== 상태 플래그 ==========
     bool stop_line_pass = false;    // [W:VP] 정지선 통과 여부 (한번만 true로)
     bool turn_pass = false;         // [W:VP] 회전 ROI 진입 여부 (한번만 true로)
@@ -0,0 +1,118 @@
+﻿#include "checkpoint_codec.h"
+
+void writeObjData(CheckpointWriter& writer, const obj_data& obj) {
+    writer.put<int32_t>(obj.object_id);
+    writer.put<int32_t>(obj.class_id);
+    writer.putString(obj.label);
+
+    writer.put<int32_t>(obj.first_detected_time);
+    writer.put<int32_t>(obj.stop_pass_time);
+    writer.put<int32_t>(obj.turn_time);
+
+    writer.putPoint(obj.last_pos);
+    writer.putPoint(obj.prev_pos);
+    writer.put<int32_t>(obj.prev_pos_time);
+
+    writer.put<int32_t>(obj.lane);
+    writer.put<int32_t>(obj.dir_out);
+    writer.put<int8_t>(obj.stable_lane);
+    writer.put<int8_t>(obj.lane_candidate);
+    writer.put<uint8_t>(obj.lane_candidate_frames);
+    writer.put<uint8_t>(obj.lane_change_count);
+
+    writer.put<double>(obj.speed);
+    writer.put<double>(obj.avg_speed);
+    writer.put<double>(obj.stop_pass_speed);
+    writer.put<double>(obj.turn_pass_speed);
+    writer.put<double>(obj.interval_speed);
+    writer.put<int32_t>(obj.num_speed);
+
+    writer.put<double>(obj.approach_delay);
+    writer.put<int32_t>(obj.stopped_sec);
+    writer.put<int32_t>(obj.stop_count);
+    writer.put<uint8_t>(obj.is_stopped ? 1 : 0);
+
+    for (int i = 0; i < VEHICLE_SIZE_SAMPLES; i++) {
+        writer.put<float>(obj.length_samples[i]);
+        writer.put<float>(obj.width_samples[i]);
+    }
+    writer.put<int32_t>(obj.size_sample_count);
+    writer.put<double>(obj.est_length);
+    writer.put<double>(obj.est_width);
+
+    uint8_t flags = (obj.stop_line_pass ? 0x01 : 0) | (obj.turn_pass ? 0x02 : 0) |
+                    (obj.data_sent_2k ? 0x04 : 0) | (obj.data_sent_4k ? 0x08 : 0) |
+                    (obj.data_processed ? 0x10 : 0) | (obj.image_saved ? 0x20 : 0) |
+                    (obj.cross_out ? 0x40 : 0) | (obj.ped_pass ? 0x80 : 0);
+    writer.put<uint8_t>(flags);
+
+    writer.put<uint32_t>(static_cast<uint32_t>(obj.prev_ped.size()));
+    for (const auto& p : obj.prev_ped) {
+        writer.putPoint(p);
+    }
+    writer.put<int32_t>(obj.ped_dir);
+
+    writer.putString(obj.image_name);
+}
+
+obj_data readObjData(CheckpointReader& reader) {
+    obj_data obj;
+
+    obj.object_id = reader.get<int32_t>();
+    obj.class_id = reader.get<int32_t>();
+    obj.label = reader.getString();
+
+    obj.first_detected_time = reader.get<int32_t>();
+    obj.stop_pass_time = reader.get<int32_t>();
+    obj.turn_time = reader.get<int32_t>();
+
+    obj.last_pos = reader.getPoint();
+    obj.prev_pos = reader.getPoint();
+    obj.prev_pos_time = reader.get<int32_t>();
+
+    obj.lane = reader.get<int32_t>();
+    obj.dir_out = reader.get<int32_t>();
+    obj.stable_lane = reader.get<int8_t>();
+    obj.lane_candidate = reader.get<int8_t>();
+    obj.lane_candidate_frames = reader.get<uint8_t>();
+    obj.lane_change_count = reader.get<uint8_t>();
+
+    obj.speed = reader.get<double>();
+    obj.avg_speed = reader.get<double>();
+    obj.stop_pass_speed = reader.get<double>();
+    obj.turn_pass_speed = reader.get<double>();
+    obj.interval_speed = reader.get<double>();
+    obj.num_speed = reader.get<int32_t>();
+
+    obj.approach_delay = reader.get<double>();
+    obj.stopped_sec = reader.get<int32_t>();
+    obj.stop_count = reader.get<int32_t>();
+    obj.is_stopped = reader.get<uint8_t>() != 0;
+
+    for (int i = 0; i < VEHICLE_SIZE_SAMPLES; i++) {
+        obj.length_samples[i] = reader.get<float>();
+        obj.width_samples[i] = reader.get<float>();
+    }
+    obj.size_sample_count = reader.get<int32_t>();
+    obj.est_length = reader.get<double>();
+    obj.est_width = reader.get<double>();
+
+    uint8_t flags = reader.get<uint8_t>();
+    obj.stop_line_pass = flags & 0x01;
+    obj.turn_pass = flags & 0x02;
+    obj.data_sent_2k = flags & 0x04;
+    obj.data_sent_4k = flags & 0x08;
+    obj.data_processed = flags & 0x10;
+    obj.image_saved = flags & 0x20;
+    obj.cross_out = flags & 0x40;
+    obj.ped_pass = flags & 0x80;
+
+    uint32_t trail = reader.get<uint32_t>();
+    for (uint32_t i = 0; i < trail; i++) {
+        obj.prev_ped.push_back(reader.getPoint());
+    }
+    obj.ped_dir = reader.get<int32_t>();
+
+    obj.image_name = reader.getString();
+    return obj;
+}
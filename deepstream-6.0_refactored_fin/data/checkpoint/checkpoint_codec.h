@@ -0,0 +1,108 @@
+﻿#ifndef CHECKPOINT_CODEC_H
+#define CHECKPOINT_CODEC_H
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include "../../common/object_data.h"
+
+/**
+ * @brief 체크포인트 바이너리 기록기
+ *
+ * 호스트 바이트 순서로 고정 크기 값을 버퍼 뒤에 추가 (같은 장비에서만 복원)
+ */
+class CheckpointWriter {
+private:
+    std::string& buffer_;
+
+public:
+    explicit CheckpointWriter(std::string& buffer) : buffer_(buffer) {}
+
+    template <typename T>
+    void put(T value) {
+        static_assert(std::is_arithmetic<T>::value, "arithmetic type only");
+        buffer_.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void putString(const std::string& value) {
+        put<uint32_t>(static_cast<uint32_t>(value.size()));
+        buffer_.append(value);
+    }
+
+    void putPoint(const ObjPoint& p) {
+        put<double>(p.x);
+        put<double>(p.y);
+    }
+
+    size_t size() const { return buffer_.size(); }
+    std::string& buffer() { return buffer_; }
+};
+
+/**
+ * @brief 체크포인트 바이너리 판독기
+ *
+ * 범위를 벗어나는 읽기는 std::runtime_error (섹션 복원 실패로 처리)
+ */
+class CheckpointReader {
+private:
+    const char* data_;
+    size_t size_;
+    size_t pos_ = 0;
+
+    void require(size_t bytes) const {
+        if (pos_ + bytes > size_) {
+            throw std::runtime_error("체크포인트 데이터 부족");
+        }
+    }
+
+public:
+    CheckpointReader(const char* data, size_t size) : data_(data), size_(size) {}
+
+    template <typename T>
+    T get() {
+        static_assert(std::is_arithmetic<T>::value, "arithmetic type only");
+        require(sizeof(T));
+        T value;
+        std::memcpy(&value, data_ + pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return value;
+    }
+
+    std::string getString() {
+        uint32_t length = get<uint32_t>();
+        require(length);
+        std::string value(data_ + pos_, length);
+        pos_ += length;
+        return value;
+    }
+
+    ObjPoint getPoint() {
+        ObjPoint p;
+        p.x = get<double>();
+        p.y = get<double>();
+        return p;
+    }
+
+    /**
+     * @brief 하위 판독기 생성 (섹션 단위)
+     * @param length 섹션 길이
+     */
+    CheckpointReader sub(size_t length) {
+        require(length);
+        CheckpointReader reader(data_ + pos_, length);
+        pos_ += length;
+        return reader;
+    }
+
+    size_t remaining() const { return size_ - pos_; }
+};
+
+/**
+ * @brief 추적 객체 데이터 기록/판독 (det_obj 섹션)
+ */
+void writeObjData(CheckpointWriter& writer, const obj_data& obj);
+obj_data readObjData(CheckpointReader& reader);
+
+#endif // CHECKPOINT_CODEC_H
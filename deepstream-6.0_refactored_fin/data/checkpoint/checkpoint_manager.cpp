@@ -0,0 +1,330 @@
+﻿/*
+ * checkpoint_manager.cpp
+ *
+ * 분석 상태 주기 체크포인트 구현
+ * - 스트리밍 스레드: 섹션 직렬화 후 버퍼 교체만 수행
+ * - 백그라운드 스레드: 임시 파일 기록 + fsync + rename
+ * - 시작 시: 신선도/지문/체크섬 검증 후 섹션별 복원
+ */
+
+#include "checkpoint_manager.h"
+#include "../../utils/config_manager.h"
+#include "../../utils/heartbeat_registry.h"
+#include "../../utils/thread_role.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <unistd.h>
+
+CheckpointManager::CheckpointManager() {
+    logger = getLogger("DS_Checkpoint_log");
+    logger->info("CheckpointManager 생성");
+}
+
+CheckpointManager::~CheckpointManager() {
+    stop();
+}
+
+bool CheckpointManager::initialize(uint64_t fingerprint) {
+    try {
+        auto& config = ConfigManager::getInstance();
+
+        path_ = config.getFullPath(config.getString("checkpoint.path", "data/checkpoint.bin"));
+        interval_sec_ = config.getInt("checkpoint.interval_sec", 5);
+        max_age_sec_ = config.getInt("checkpoint.max_age_sec", 120);
+        fingerprint_ = fingerprint;
+
+        if (path_.empty()) {
+            logger->error("체크포인트 경로 없음");
+            return false;
+        }
+        if (interval_sec_ <= 0) {
+            logger->warn("잘못된 checkpoint.interval_sec 값: {} - 기본값 5초 사용", interval_sec_);
+            interval_sec_ = 5;
+        }
+        if (max_age_sec_ < interval_sec_) {
+            logger->warn("checkpoint.max_age_sec({})가 저장 주기보다 짧음 - {}초로 조정",
+                        max_age_sec_, interval_sec_ * 2);
+            max_age_sec_ = interval_sec_ * 2;
+        }
+
+        logger->info("체크포인트 초기화 완료 - 경로: {}, 주기: {}초, 최대 경과: {}초, 지문: {:016x}",
+                    path_, interval_sec_, max_age_sec_, fingerprint_);
+        return true;
+
+    } catch (const std::exception& e) {
+        logger->error("체크포인트 초기화 실패: {}", e.what());
+        return false;
+    }
+}
+
+void CheckpointManager::registerSection(CheckpointSection tag, const std::string& name,
+                                        SaveFunction save, RestoreFunction restore) {
+    std::lock_guard<std::mutex> lock(sections_mutex_);
+
+    for (auto& section : sections_) {
+        if (section.tag == tag) {
+            section.name = name;
+            section.save = std::move(save);
+            section.restore = std::move(restore);
+            logger->warn("체크포인트 섹션 재등록: {}", name);
+            return;
+        }
+    }
+
+    sections_.push_back({tag, name, std::move(save), std::move(restore)});
+    logger->debug("체크포인트 섹션 등록: {} (태그 {})", name, static_cast<uint32_t>(tag));
+}
+
+bool CheckpointManager::restore(int current_time) {
+    std::string data;
+    {
+        std::ifstream file(path_, std::ios::binary);
+        if (!file.is_open()) {
+            logger->info("체크포인트 파일 없음 - 새 상태로 시작 ({})", path_);
+            return false;
+        }
+        data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    try {
+        if (data.size() < sizeof(uint64_t)) {
+            logger->warn("체크포인트 파일 손상 (크기 {}B) - 복원 안함", data.size());
+            return false;
+        }
+
+        size_t body_size = data.size() - sizeof(uint64_t);
+        uint64_t stored_checksum;
+        std::memcpy(&stored_checksum, data.data() + body_size, sizeof(uint64_t));
+        if (stored_checksum != checksum(data.data(), body_size)) {
+            logger->warn("체크포인트 체크섬 불일치 - 복원 안함");
+            return false;
+        }
+
+        CheckpointReader reader(data.data(), body_size);
+        uint32_t magic = reader.get<uint32_t>();
+        uint32_t version = reader.get<uint32_t>();
+        int64_t saved_time = reader.get<int64_t>();
+        uint64_t fingerprint = reader.get<uint64_t>();
+        uint32_t section_count = reader.get<uint32_t>();
+
+        if (magic != CheckpointFormat::MAGIC || version != CheckpointFormat::VERSION) {
+            logger->warn("체크포인트 형식 불일치 (magic {:08x}, version {}) - 복원 안함", magic, version);
+            return false;
+        }
+
+        int age = current_time - static_cast<int>(saved_time);
+        if (age < 0 || age > max_age_sec_) {
+            logger->info("체크포인트가 오래됨 ({}초 경과, 최대 {}초) - 새 상태로 시작", age, max_age_sec_);
+            return false;
+        }
+
+        if (fingerprint != fingerprint_) {
+            logger->warn("ROI/Calibration 지문 불일치 ({:016x} != {:016x}) - 복원 안함",
+                        fingerprint, fingerprint_);
+            return false;
+        }
+
+        CheckpointContext context;
+        context.saved_time = static_cast<int>(saved_time);
+        context.current_time = current_time;
+
+        int restored = 0;
+        std::lock_guard<std::mutex> lock(sections_mutex_);
+        for (uint32_t i = 0; i < section_count; i++) {
+            CheckpointSection tag = static_cast<CheckpointSection>(reader.get<uint32_t>());
+            uint32_t length = reader.get<uint32_t>();
+            CheckpointReader section_reader = reader.sub(length);
+
+            auto it = std::find_if(sections_.begin(), sections_.end(),
+                                   [tag](const Section& s) { return s.tag == tag; });
+            if (it == sections_.end() || !it->restore) {
+                logger->debug("등록되지 않은 체크포인트 섹션 건너뜀 (태그 {})", static_cast<uint32_t>(tag));
+                continue;
+            }
+
+            try {
+                if (it->restore(section_reader, context)) {
+                    restored++;
+                    logger->info("체크포인트 섹션 복원: {} ({}B)", it->name, length);
+                } else {
+                    logger->info("체크포인트 섹션 미적용: {}", it->name);
+                }
+            } catch (const std::exception& e) {
+                logger->warn("체크포인트 섹션 복원 실패: {} - {}", it->name, e.what());
+            }
+        }
+
+        logger->info("체크포인트 복원 완료 - {}/{}개 섹션, {}초 전 저장", restored, section_count, age);
+        return restored > 0;
+
+    } catch (const std::exception& e) {
+        logger->warn("체크포인트 복원 실패: {}", e.what());
+        return false;
+    }
+}
+
+void CheckpointManager::start() {
+    if (running_.load()) return;
+
+    running_ = true;
+    writer_thread_ = std::thread(&CheckpointManager::writerThread, this);
+    logger->info("체크포인트 기록 스레드 시작");
+}
+
+void CheckpointManager::stop() {
+    if (!running_.exchange(false)) return;
+
+    pending_cv_.notify_all();
+    if (writer_thread_.joinable()) {
+        writer_thread_.join();
+    }
+    logStatistics();
+    logger->info("체크포인트 기록 스레드 중지");
+}
+
+void CheckpointManager::capture(int current_time) {
+    if (!running_.load()) return;
+    if (current_time - last_capture_time_ < interval_sec_) return;
+    last_capture_time_ = current_time;
+
+    auto start = std::chrono::steady_clock::now();
+
+    capture_buffer_.clear();
+    CheckpointWriter writer(capture_buffer_);
+    writer.put<uint32_t>(CheckpointFormat::MAGIC);
+    writer.put<uint32_t>(CheckpointFormat::VERSION);
+    writer.put<int64_t>(current_time);
+    writer.put<uint64_t>(fingerprint_);
+    size_t count_offset = writer.size();
+    writer.put<uint32_t>(0);
+
+    uint32_t section_count = 0;
+    {
+        std::lock_guard<std::mutex> lock(sections_mutex_);
+        for (const auto& section : sections_) {
+            if (!section.save) continue;
+
+            size_t section_start = writer.size();
+            writer.put<uint32_t>(static_cast<uint32_t>(section.tag));
+            writer.put<uint32_t>(0);
+
+            try {
+                section.save(writer);
+            } catch (const std::exception& e) {
+                // 실패한 섹션은 제외 (다른 섹션은 정상 기록)
+                capture_buffer_.resize(section_start);
+                logger->warn("체크포인트 섹션 직렬화 실패: {} - {}", section.name, e.what());
+                continue;
+            }
+
+            uint32_t length = static_cast<uint32_t>(writer.size() - section_start - 2 * sizeof(uint32_t));
+            std::memcpy(&capture_buffer_[section_start + sizeof(uint32_t)], &length, sizeof(uint32_t));
+            section_count++;
+        }
+    }
+    std::memcpy(&capture_buffer_[count_offset], &section_count, sizeof(uint32_t));
+    writer.put<uint64_t>(checksum(capture_buffer_.data(), capture_buffer_.size()));
+
+    // 기록 스레드에 전달 (버퍼 교환 - 이전 대기 버퍼는 덮어씀)
+    {
+        std::lock_guard<std::mutex> lock(pending_mutex_);
+        pending_buffer_.swap(capture_buffer_);
+        has_pending_ = true;
+    }
+    pending_cv_.notify_one();
+
+    int64_t elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    captures_++;
+    capture_us_total_ += elapsed_us;
+    if (elapsed_us > capture_us_max_.load()) {
+        capture_us_max_ = elapsed_us;
+    }
+    if (elapsed_us > 1000) {
+        logger->warn("체크포인트 캡처 지연: {}us ({} 섹션)", elapsed_us, section_count);
+    }
+}
+
+void CheckpointManager::writerThread() {
+    enterThreadRole("ds-checkpoint");
+    HeartbeatHandle heartbeat = HeartbeatRegistry::getInstance().registerThread("ds-checkpoint", 10000);
+    std::string data;
+
+    while (true) {
+        {
+            heartbeat.beat(HB_STAGE_IDLE);
+            std::unique_lock<std::mutex> lock(pending_mutex_);
+            pending_cv_.wait(lock, [this]() { return has_pending_ || !running_.load(); });
+
+            if (!has_pending_) break;   // 중지 요청 + 대기 버퍼 없음
+
+            data.swap(pending_buffer_);
+            has_pending_ = false;
+        }
+
+        heartbeat.beat(HB_STAGE_FILE_WRITE);
+        if (writeFile(data)) {
+            writes_++;
+            last_size_bytes_ = data.size();
+        } else {
+            write_failures_++;
+        }
+
+        if (!running_.load()) {
+            std::lock_guard<std::mutex> lock(pending_mutex_);
+            if (!has_pending_) break;
+        }
+    }
+}
+
+bool CheckpointManager::writeFile(const std::string& data) {
+    std::string tmp_path = path_ + ".tmp";
+
+    FILE* file = std::fopen(tmp_path.c_str(), "wb");
+    if (!file) {
+        if (write_failures_.load() % 100 == 0) {
+            logger->error("체크포인트 임시 파일 열기 실패: {}", tmp_path);
+        }
+        return false;
+    }
+
+    bool ok = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    ok = ok && std::fflush(file) == 0;
+    ok = ok && fsync(fileno(file)) == 0;
+    ok = (std::fclose(file) == 0) && ok;
+
+    if (!ok || std::rename(tmp_path.c_str(), path_.c_str()) != 0) {
+        if (write_failures_.load() % 100 == 0) {
+            logger->error("체크포인트 기록 실패: {}", path_);
+        }
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+uint64_t CheckpointManager::hashBytes(uint64_t hash, const void* data, size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+uint64_t CheckpointManager::checksum(const char* data, size_t size) {
+    return hashBytes(HASH_SEED, data, size);
+}
+
+void CheckpointManager::logStatistics() const {
+    uint64_t captures = captures_.load();
+    logger->info("체크포인트 통계 - 캡처: {}회 (평균 {}us, 최대 {}us), 기록: {}회, 실패: {}회, 크기: {}B",
+                captures,
+                captures > 0 ? capture_us_total_.load() / static_cast<int64_t>(captures) : 0,
+                capture_us_max_.load(), writes_.load(), write_failures_.load(),
+                last_size_bytes_.load());
+}
@@ -0,0 +1,142 @@
+﻿#ifndef CHECKPOINT_MANAGER_H
+#define CHECKPOINT_MANAGER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "checkpoint_codec.h"
+#include "checkpoint_types.h"
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+/**
+ * @brief 분석 상태 주기 체크포인트 및 재시작 시 복원
+ *
+ * 파이프라인/프로세스 재시작 시 진행 중인 인터벌, 신호 주기, 추적 객체 상태 유지
+ * - 캡처: 스트리밍 스레드에서 interval_sec마다 각 섹션을 재사용 버퍼에 직렬화 (모듈 락은 섹션별로 짧게)
+ * - 기록: 직렬화된 버퍼를 교체(swap)로 넘겨 백그라운드 스레드가 임시 파일 기록 후 rename (원자적 교체)
+ * - 복원: 시작 시 저장 시각이 max_age_sec 이내이고 ROI/Calibration 지문이 일치할 때만 섹션별 복원
+ * - 파일 형식: 헤더(magic, version, 저장 시각, 지문, 섹션 수) + [태그, 길이, 내용] 반복 + 체크섬
+ */
+class CheckpointManager {
+public:
+    using SaveFunction = std::function<void(CheckpointWriter&)>;
+    using RestoreFunction = std::function<bool(CheckpointReader&, const CheckpointContext&)>;
+
+private:
+    struct Section {
+        CheckpointSection tag;
+        std::string name;
+        SaveFunction save;
+        RestoreFunction restore;
+    };
+
+    // 설정
+    std::string path_;
+    int interval_sec_ = 5;
+    int max_age_sec_ = 120;
+    uint64_t fingerprint_ = 0;
+
+    std::vector<Section> sections_;
+    std::mutex sections_mutex_;
+
+    // 캡처 (스트리밍 스레드)
+    std::string capture_buffer_;
+    int last_capture_time_ = 0;
+
+    // 기록 대기 버퍼 (백그라운드 스레드와 교환)
+    std::string pending_buffer_;
+    bool has_pending_ = false;
+    std::mutex pending_mutex_;
+    std::condition_variable pending_cv_;
+
+    // 기록 스레드
+    std::thread writer_thread_;
+    std::atomic<bool> running_{false};
+
+    // 통계
+    std::atomic<uint64_t> captures_{0};
+    std::atomic<uint64_t> writes_{0};
+    std::atomic<uint64_t> write_failures_{0};
+    std::atomic<uint64_t> last_size_bytes_{0};
+    std::atomic<int64_t> capture_us_total_{0};
+    std::atomic<int64_t> capture_us_max_{0};
+
+    // 로거
+    std::shared_ptr<spdlog::logger> logger = nullptr;
+
+    // 내부 메서드
+    void writerThread();
+    bool writeFile(const std::string& data);
+    static uint64_t checksum(const char* data, size_t size);
+
+public:
+    CheckpointManager();
+    ~CheckpointManager();
+
+    /**
+     * @brief 초기화 - config.json의 checkpoint 설정 로드
+     * @param fingerprint ROI/Calibration 지문 (불일치 시 복원 안함)
+     * @return 성공 시 true
+     */
+    bool initialize(uint64_t fingerprint);
+
+    /**
+     * @brief 섹션 등록 (복원 전에 등록, 태그당 1개)
+     * @param tag 섹션 태그
+     * @param name 로그용 이름
+     * @param save 직렬화 함수 (캡처 스레드에서 호출)
+     * @param restore 복원 함수
+     */
+    void registerSection(CheckpointSection tag, const std::string& name,
+                         SaveFunction save, RestoreFunction restore);
+
+    /**
+     * @brief 체크포인트 파일 복원 (시작 시 1회)
+     * @param current_time 현재 시간
+     * @return 1개 이상 섹션 복원 시 true
+     */
+    bool restore(int current_time);
+
+    /**
+     * @brief 기록 스레드 시작
+     */
+    void start();
+
+    /**
+     * @brief 기록 스레드 중지 (대기 버퍼 기록 후 종료)
+     */
+    void stop();
+
+    /**
+     * @brief 주기 캡처 - 스트리밍 스레드에서 매 초 호출, interval_sec마다 직렬화
+     * @param current_time 현재 시간
+     */
+    void capture(int current_time);
+
+    /**
+     * @brief 통계 정보 로깅 (캡처 소요 시간, 기록 횟수)
+     */
+    void logStatistics() const;
+
+    /**
+     * @brief 지문 누적 (FNV-1a 64bit)
+     * @param hash 현재 해시
+     * @param data 데이터
+     * @param size 크기
+     * @return 갱신된 해시
+     */
+    static uint64_t hashBytes(uint64_t hash, const void* data, size_t size);
+    static constexpr uint64_t HASH_SEED = 1469598103934665603ULL;
+};
+
+#endif // CHECKPOINT_MANAGER_H
@@ -0,0 +1,46 @@
+﻿#ifndef CHECKPOINT_TYPES_H
+#define CHECKPOINT_TYPES_H
+
+#include <cstdint>
+
+/**
+ * @brief 체크포인트 섹션 태그 (파일 내 섹션 식별자, 값 변경 금지)
+ */
+enum class CheckpointSection : uint32_t {
+    OBJECTS = 1,            // det_obj (deepstream_app)
+    STATS = 2,              // StatsGenerator 프레임 누적값
+    QUEUE = 3,              // QueueAnalyzer 신호/대기행렬 상태
+    INCIDENT = 4,           // IncidentDetector 이벤트/정지 상태
+    CAPTURE_4K = 5          // VehicleProcessor4K 이미지 캡처 상태
+};
+
+/**
+ * @brief 복원 컨텍스트
+ */
+struct CheckpointContext {
+    int saved_time = 0;     // 체크포인트 저장 시각
+    int current_time = 0;   // 복원 시각
+};
+
+namespace CheckpointFormat {
+    constexpr uint32_t MAGIC = 0x50435344;      // "DSCP"
+    // 섹션 내용 구조 변경 시 증가 (다른 버전 파일은 복원 안함)
+    // - 2: obj_data 지체 지표 (approach_delay, stopped_sec, stop_count, is_stopped)
+    // - 3: obj_data 차체 크기 추정 (length/width_samples, size_sample_count, est_length/width)
+    // - 4: obj_data 차로 변경 필터 (stable_lane, lane_candidate, lane_candidate_frames, lane_change_count)
+    constexpr uint32_t VERSION = 4;
+}
+
+/**
+ * @brief 복원된 추적 ID 변환
+ *
+ * 재시작 후 트래커 ID는 처음부터 다시 발급되므로
+ * 복원 상태는 음수 ID로 보관해 새 ID와 충돌하지 않게 하고 위치 기반으로 새 ID에 이관
+ * @param id 체크포인트 저장 시점의 추적 ID (0 이상)
+ * @return 복원용 ID (음수)
+ */
+inline int checkpointRestoredId(int id) {
+    return -1 - id;
+}
+
+#endif // CHECKPOINT_TYPES_H
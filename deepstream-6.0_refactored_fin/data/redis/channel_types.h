@@ -7,7 +7,7 @@
 /**
  * @brief Redis 채널 타입 열거형
  * 
- * 로컬 Redis의 8개 채널을 정의
+ * 로컬 Redis의 18개 채널을 정의
  */
 enum ChannelType {
     CHANNEL_VEHICLE_2K = 0,         // detection:vehicle:2k
@@ -18,7 +18,16 @@ enum ChannelType {
     CHANNEL_INCIDENT = 5,           // incident_event
     CHANNEL_VEHICLE_PRESENCE = 6,   // presence:vehicle
     CHANNEL_PED_WAITING = 7,        // presence:person:waiting_area
-    CHANNEL_PED_CROSSING = 8        // presence:person:crosswalk
+    CHANNEL_PED_CROSSING = 8,       // presence:person:crosswalk
+    CHANNEL_LOS = 9,                // congestion:los
+    CHANNEL_INTERSECTION_APPROACH = 10, // intersection:approach (노드 내부 접근로 주기 레코드)
+    CHANNEL_INTERSECTION = 11,      // intersection:cycle
+    CHANNEL_TELEMETRY = 12,         // telemetry:process
+    CHANNEL_FRAME_GAP = 13,         // pipeline:frame_gap
+    CHANNEL_ARRIVAL = 14,           // coordination:arrival
+    CHANNEL_SPLIT_FAILURE = 15,     // coordination:split_failure
+    CHANNEL_PET = 16,               // safety:pet
+    CHANNEL_PED_WAIT = 17           // presence:person:wait_cycle
 };
 
 /**
@@ -48,6 +57,24 @@ inline std::string getChannelName(int type) {
             return config.getRedisChannel("ped_waiting");
         case CHANNEL_PED_CROSSING:   
             return config.getRedisChannel("ped_crossing");
+        case CHANNEL_LOS:
+            return config.getRedisChannel("los");
+        case CHANNEL_INTERSECTION_APPROACH:
+            return config.getRedisChannel("intersection_approach");
+        case CHANNEL_INTERSECTION:
+            return config.getRedisChannel("intersection");
+        case CHANNEL_TELEMETRY:
+            return config.getRedisChannel("telemetry");
+        case CHANNEL_FRAME_GAP:
+            return config.getRedisChannel("frame_gap");
+        case CHANNEL_ARRIVAL:
+            return config.getRedisChannel("arrival");
+        case CHANNEL_SPLIT_FAILURE:
+            return config.getRedisChannel("split_failure");
+        case CHANNEL_PET:
+            return config.getRedisChannel("pet");
+        case CHANNEL_PED_WAIT:
+            return config.getRedisChannel("ped_wait");
         default:                     
             return "unknown_channel";
     }
@@ -70,6 +97,15 @@ inline int getChannelType(const std::string& name) {
     if (name == config.getRedisChannel("vehicle_presence")) return CHANNEL_VEHICLE_PRESENCE;
     if (name == config.getRedisChannel("ped_waiting")) return CHANNEL_PED_WAITING;
     if (name == config.getRedisChannel("ped_crossing")) return CHANNEL_PED_CROSSING;
+    if (name == config.getRedisChannel("los")) return CHANNEL_LOS;
+    if (name == config.getRedisChannel("intersection_approach")) return CHANNEL_INTERSECTION_APPROACH;
+    if (name == config.getRedisChannel("intersection")) return CHANNEL_INTERSECTION;
+    if (name == config.getRedisChannel("telemetry")) return CHANNEL_TELEMETRY;
+    if (name == config.getRedisChannel("frame_gap")) return CHANNEL_FRAME_GAP;
+    if (name == config.getRedisChannel("arrival")) return CHANNEL_ARRIVAL;
+    if (name == config.getRedisChannel("split_failure")) return CHANNEL_SPLIT_FAILURE;
+    if (name == config.getRedisChannel("pet")) return CHANNEL_PET;
+    if (name == config.getRedisChannel("ped_wait")) return CHANNEL_PED_WAIT;
     return -1;
 }
 
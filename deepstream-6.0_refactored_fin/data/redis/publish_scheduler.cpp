@@ -0,0 +1,361 @@
+﻿/*
+ * publish_scheduler.cpp
+ *
+ * Redis 전송 스케줄러 구현
+ * - 채널별 변경 전송 / 히스테리시스 / keepalive / 최대 전송률
+ * - 단일 스케줄러 스레드에서 Redis PUBLISH 수행
+ */
+
+#include "publish_scheduler.h"
+#include "channel_types.h"
+#include "../../utils/config_manager.h"
+#include "../../utils/heartbeat_registry.h"
+#include "../../utils/thread_role.h"
+#include <algorithm>
+#include <ctime>
+
+PublishScheduler::PublishScheduler(SendFunction send)
+    : send_(std::move(send)) {
+    logger = getLogger("DS_PublishScheduler_log");
+    logger->info("PublishScheduler 생성");
+}
+
+PublishScheduler::~PublishScheduler() {
+    stop();
+}
+
+bool PublishScheduler::initialize() {
+    if (!send_) {
+        logger->error("전송 함수가 없음 - 전송 스케줄러 초기화 실패");
+        return false;
+    }
+
+    try {
+        auto& config = ConfigManager::getInstance();
+        tick_ms_ = config.getInt("redis.publish_policy.tick_ms", 50);
+        if (tick_ms_ <= 0) {
+            logger->warn("잘못된 tick_ms 값: {} - 기본값 50ms 사용", tick_ms_);
+            tick_ms_ = 50;
+        }
+
+        // Presence 채널 기본 정책: 변경 전송 + 30초 keepalive + 초당 2회
+        PublishPolicy presence_defaults;
+        presence_defaults.on_change = true;
+        presence_defaults.hysteresis_ms = 0;
+        presence_defaults.keepalive_sec = 30;
+        presence_defaults.max_rate_per_sec = 2;
+
+        // 대기행렬 채널 기본 정책: 신호 주기별 패킷이므로 병합 없이 모두 순서대로 전송
+        PublishPolicy queue_defaults;
+        queue_defaults.on_change = false;
+        queue_defaults.hysteresis_ms = 0;
+        queue_defaults.keepalive_sec = 0;
+        queue_defaults.max_rate_per_sec = 0;
+        queue_defaults.coalesce = false;
+
+        registerChannel(CHANNEL_VEHICLE_PRESENCE, "vehicle_presence",
+                        loadPolicy("vehicle_presence", presence_defaults));
+        registerChannel(CHANNEL_PED_CROSSING, "ped_crossing",
+                        loadPolicy("ped_crossing", presence_defaults));
+        registerChannel(CHANNEL_PED_WAITING, "ped_waiting",
+                        loadPolicy("ped_waiting", presence_defaults));
+        registerChannel(CHANNEL_QUEUE, "queue",
+                        loadPolicy("queue", queue_defaults));
+
+        logger->info("전송 스케줄러 초기화 완료 - 채널: {}개, tick: {}ms",
+                    channels_.size(), tick_ms_);
+        return true;
+
+    } catch (const std::exception& e) {
+        logger->error("전송 스케줄러 초기화 실패: {}", e.what());
+        return false;
+    }
+}
+
+PublishPolicy PublishScheduler::loadPolicy(const std::string& channel_key,
+                                           const PublishPolicy& defaults) const {
+    auto& config = ConfigManager::getInstance();
+    std::string base_key = "redis.publish_policy.channels." + channel_key;
+
+    PublishPolicy policy;
+    policy.on_change = config.getBool(base_key + ".on_change", defaults.on_change);
+    policy.hysteresis_ms = std::max(0, config.getInt(base_key + ".hysteresis_ms", defaults.hysteresis_ms));
+    policy.keepalive_sec = std::max(0, config.getInt(base_key + ".keepalive_sec", defaults.keepalive_sec));
+    policy.max_rate_per_sec = std::max(0, config.getInt(base_key + ".max_rate_per_sec", defaults.max_rate_per_sec));
+    policy.coalesce = config.getBool(base_key + ".coalesce", defaults.coalesce);
+    policy.max_queued = std::max(1, config.getInt(base_key + ".max_queued", defaults.max_queued));
+    return policy;
+}
+
+void PublishScheduler::registerChannel(int channel_type, const std::string& channel_key,
+                                       const PublishPolicy& policy) {
+    std::lock_guard<std::mutex> lock(channels_mutex_);
+
+    ChannelSlot& slot = channels_[channel_type];
+    slot.key = channel_key;
+    slot.policy = policy;
+
+    if (!policy.coalesce) {
+        logger->info("  - {}: 비병합 FIFO 전송 (max_queued={})", channel_key, policy.max_queued);
+        return;
+    }
+
+    logger->info("  - {}: on_change={}, hysteresis={}ms, keepalive={}초, max_rate={}/초",
+                channel_key, policy.on_change, policy.hysteresis_ms,
+                policy.keepalive_sec, policy.max_rate_per_sec);
+}
+
+bool PublishScheduler::submit(int channel_type, const std::string& data) {
+    if (!running_.load()) {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(channels_mutex_);
+
+        auto it = channels_.find(channel_type);
+        if (it == channels_.end()) {
+            return false;
+        }
+
+        ChannelSlot& slot = it->second;
+        slot.submitted++;
+
+        if (!slot.policy.coalesce) {
+            // 비병합 채널 - 큐 초과 시 가장 오래된 값 폐기
+            if (static_cast<int>(slot.queued.size()) >= slot.policy.max_queued) {
+                slot.queued.pop_front();
+                slot.dropped++;
+            }
+            slot.queued.push_back(data);
+        } else if (slot.policy.on_change) {
+            // 대기값과 동일 - 히스테리시스 타이머 유지
+            if (slot.has_pending && slot.pending == data) {
+                return true;
+            }
+
+            // 마지막 전송값으로 복귀 - 대기값 폐기 (히스테리시스 구간 내 플리커)
+            if (slot.has_sent && slot.last_sent == data) {
+                if (slot.has_pending) {
+                    slot.has_pending = false;
+                    slot.pending.clear();
+                }
+                slot.suppressed++;
+                return true;
+            }
+        }
+
+        if (slot.policy.coalesce) {
+            if (slot.has_pending) {
+                slot.coalesced++;
+            }
+
+            slot.pending = data;
+            slot.has_pending = true;
+            slot.pending_since = std::chrono::steady_clock::now();
+        }
+    }
+
+    // 스케줄러 스레드 깨우기 (히스테리시스 0인 경우 즉시 전송)
+    {
+        std::lock_guard<std::mutex> lock(cv_mutex_);
+        wakeup_ = true;
+    }
+    cv_.notify_one();
+
+    return true;
+}
+
+void PublishScheduler::start() {
+    if (running_.load()) {
+        logger->warn("전송 스케줄러 이미 실행 중");
+        return;
+    }
+
+    running_ = true;
+    last_stats_log_time_ = std::chrono::steady_clock::now();
+
+    try {
+        scheduler_thread_ = std::thread(&PublishScheduler::schedulerThread, this);
+        logger->info("전송 스케줄러 시작됨");
+    } catch (const std::exception& e) {
+        running_ = false;
+        logger->error("전송 스케줄러 스레드 시작 실패: {}", e.what());
+    }
+}
+
+void PublishScheduler::stop() {
+    if (!running_.load()) {
+        return;
+    }
+
+    logger->info("전송 스케줄러 중지 시작");
+
+    running_ = false;
+    cv_.notify_all();
+
+    try {
+        if (scheduler_thread_.joinable()) {
+            scheduler_thread_.join();
+        }
+    } catch (const std::exception& e) {
+        logger->error("스레드 종료 중 오류: {}", e.what());
+    }
+
+    logStatistics();
+    logger->info("전송 스케줄러 중지 완료");
+}
+
+void PublishScheduler::schedulerThread() {
+    enterThreadRole("ds-publish");
+    HeartbeatHandle heartbeat = HeartbeatRegistry::getInstance().registerThread("ds-publish", 5000);
+    logger->info("전송 스케줄러 스레드 시작 (tick: {}ms)", tick_ms_);
+
+    std::vector<OutgoingMessage> out;
+    out.reserve(channels_.size());
+
+    while (running_.load()) {
+        {
+            heartbeat.beat(HB_STAGE_IDLE);
+            std::unique_lock<std::mutex> lock(cv_mutex_);
+            cv_.wait_for(lock, std::chrono::milliseconds(tick_ms_),
+                        [this]() { return wakeup_ || !running_.load(); });
+            wakeup_ = false;
+        }
+
+        heartbeat.beat(HB_STAGE_REDIS);
+        out.clear();
+        collectDue(std::chrono::steady_clock::now(), out);
+        publish(out);
+
+        thread_cpu_ns_.store(currentThreadCpuNs());
+    }
+
+    // 종료 직전 전송 가능한 대기값 처리
+    out.clear();
+    collectDue(std::chrono::steady_clock::now(), out);
+    publish(out);
+
+    logger->info("전송 스케줄러 스레드 종료");
+}
+
+void PublishScheduler::collectDue(std::chrono::steady_clock::time_point now,
+                                  std::vector<OutgoingMessage>& out) {
+    std::lock_guard<std::mutex> lock(channels_mutex_);
+
+    for (auto& [channel_type, slot] : channels_) {
+        const PublishPolicy& policy = slot.policy;
+
+        // 비병합 채널: 대기 큐 전체를 제출 순서대로 전송
+        if (!policy.coalesce) {
+            if (!slot.queued.empty()) {
+                for (auto& data : slot.queued) {
+                    out.push_back({channel_type, std::move(data), false});
+                }
+                slot.queued.clear();
+                slot.last_sent = out.back().data;
+                slot.has_sent = true;
+                slot.last_sent_time = now;
+            }
+            continue;
+        }
+
+        if (slot.has_pending) {
+            // 히스테리시스: 변경값이 충분히 유지되었는지
+            auto stable_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                now - slot.pending_since).count();
+            if (stable_ms < policy.hysteresis_ms) {
+                continue;
+            }
+
+            // 최대 전송률: 간격 미달이면 대기 (이후 제출값이 덮어씀)
+            if (policy.max_rate_per_sec > 0 && slot.has_sent) {
+                auto since_last_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    now - slot.last_sent_time).count();
+                if (since_last_ms < 1000 / policy.max_rate_per_sec) {
+                    continue;
+                }
+            }
+
+            out.push_back({channel_type, slot.pending, false});
+            slot.last_sent = std::move(slot.pending);
+            slot.pending.clear();
+            slot.has_pending = false;
+            slot.has_sent = true;
+            slot.last_sent_time = now;
+            continue;
+        }
+
+        // Keepalive: 변화가 없어도 마지막 값 재전송
+        if (policy.keepalive_sec > 0 && slot.has_sent) {
+            auto since_last_sec = std::chrono::duration_cast<std::chrono::seconds>(
+                now - slot.last_sent_time).count();
+            if (since_last_sec >= policy.keepalive_sec) {
+                out.push_back({channel_type, slot.last_sent, true});
+                slot.last_sent_time = now;
+            }
+        }
+    }
+}
+
+void PublishScheduler::publish(const std::vector<OutgoingMessage>& out) {
+    for (const auto& msg : out) {
+        int result = send_(msg.channel_type, msg.data);
+
+        std::lock_guard<std::mutex> lock(channels_mutex_);
+        ChannelSlot& slot = channels_[msg.channel_type];
+
+        if (result != 0) {
+            slot.failed++;
+            logger->error("Redis 전송 실패 - 채널: {}, 결과: {}", slot.key, result);
+            continue;
+        }
+
+        if (msg.keepalive) {
+            slot.keepalives++;
+            logger->trace("Keepalive 전송 - 채널: {}, 값: {}", slot.key, msg.data);
+        } else {
+            slot.published++;
+            logger->debug("상태 전송 - 채널: {}, 크기: {} bytes", slot.key, msg.data.size());
+        }
+    }
+}
+
+int64_t PublishScheduler::currentThreadCpuNs() {
+    struct timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+        return 0;
+    }
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+void PublishScheduler::logStatistics() {
+    std::lock_guard<std::mutex> lock(channels_mutex_);
+
+    auto now = std::chrono::steady_clock::now();
+    double elapsed_sec = std::chrono::duration_cast<std::chrono::milliseconds>(
+        now - last_stats_log_time_).count() / 1000.0;
+    if (elapsed_sec <= 0.0) {
+        return;
+    }
+
+    int64_t cpu_ns = thread_cpu_ns_.load();
+    double cpu_pct = (cpu_ns - cpu_ns_at_last_log_) / (elapsed_sec * 1e9) * 100.0;
+
+    logger->info("=== 전송 스케줄러 통계 ({:.0f}초 구간) ===", elapsed_sec);
+    logger->info("  스케줄러 스레드 CPU: {:.3f}% (누적 {:.1f}ms)", cpu_pct, cpu_ns / 1e6);
+
+    for (auto& [channel_type, slot] : channels_) {
+        uint64_t sent = slot.published + slot.keepalives;
+        double rate = (sent - slot.sent_at_last_log) / elapsed_sec;
+
+        logger->info("  [{}] {:.3f} msgs/sec - 제출: {}, 전송: {}, keepalive: {}, 병합: {}, 억제: {}, 폐기: {}, 실패: {}",
+                    slot.key, rate, slot.submitted, slot.published, slot.keepalives,
+                    slot.coalesced, slot.suppressed, slot.dropped, slot.failed);
+
+        slot.sent_at_last_log = sent;
+    }
+
+    last_stats_log_time_ = now;
+    cpu_ns_at_last_log_ = cpu_ns;
+}
@@ -0,0 +1,188 @@
+﻿#ifndef PUBLISH_SCHEDULER_H
+#define PUBLISH_SCHEDULER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+/**
+ * @brief 채널별 전송 정책
+ */
+struct PublishPolicy {
+    bool on_change = true;          // true: 마지막 전송값과 다를 때만 전송
+    int hysteresis_ms = 0;          // 변경값이 유지되어야 하는 최소 시간 (ms, 0: 즉시)
+    int keepalive_sec = 0;          // 마지막 값 재전송 주기 (초, 0: 비활성)
+    int max_rate_per_sec = 0;       // 초당 최대 전송 횟수 (0: 무제한)
+    bool coalesce = true;           // false: 제출값을 덮어쓰지 않고 순서대로 모두 전송 (주기 패킷용)
+    int max_queued = 64;            // coalesce=false일 때 대기 큐 최대 길이 (초과 시 가장 오래된 값 폐기)
+};
+
+/**
+ * @brief Redis 전송 스케줄러
+ *
+ * Presence/대기행렬 채널처럼 상태 전이만 의미 있는 채널의 전송을
+ * 단일 스레드에서 정책 기반으로 처리
+ * - 변경 전송: 마지막 전송값과 같으면 전송 안함
+ * - 히스테리시스: 변경값이 hysteresis_ms 동안 유지될 때만 전송
+ * - 최대 전송률: 초과분은 병합 (최신값 우선)
+ * - 비병합 채널 (coalesce=false): 대기행렬처럼 주기별 패킷이 모두 의미 있는 채널은
+ *   덮어쓰지 않고 FIFO로 쌓아 순서대로 전송 (on_change/히스테리시스/전송률 미적용)
+ * - Keepalive: 변화가 없어도 주기적으로 마지막 값 재전송
+ *
+ * 호출 스레드(process_meta)는 submit()으로 값만 기록하고 반환하므로
+ * 동기식 Redis PUBLISH가 프레임 처리 경로에서 제거됨
+ * 등록되지 않은 채널은 submit()이 false를 반환하며 호출측이 직접 전송
+ */
+class PublishScheduler {
+public:
+    /**
+     * @brief 실제 전송 함수 (RedisClient::sendData와 동일한 반환 규약, 0: 성공)
+     */
+    using SendFunction = std::function<int(int channel_type, const std::string& data)>;
+
+private:
+    /**
+     * @brief 채널별 전송 상태
+     */
+    struct ChannelSlot {
+        std::string key;                                    // config 키 (로깅용)
+        PublishPolicy policy;
+
+        // 대기 중인 값 (최신값 우선)
+        std::string pending;
+        bool has_pending = false;
+        std::chrono::steady_clock::time_point pending_since;
+
+        // 비병합 채널 대기 큐
+        std::deque<std::string> queued;
+
+        // 마지막 전송 값
+        std::string last_sent;
+        bool has_sent = false;
+        std::chrono::steady_clock::time_point last_sent_time;
+
+        // 통계
+        uint64_t submitted = 0;         // submit 호출 횟수
+        uint64_t published = 0;         // 변경 전송 횟수
+        uint64_t keepalives = 0;        // keepalive 전송 횟수
+        uint64_t coalesced = 0;         // 전송 전 덮어쓴 값 수
+        uint64_t suppressed = 0;        // 변경 없음/히스테리시스로 제거된 값 수
+        uint64_t dropped = 0;           // 비병합 채널 큐 초과로 폐기된 값 수
+        uint64_t failed = 0;            // Redis 전송 실패 횟수
+        uint64_t sent_at_last_log = 0;  // 마지막 통계 출력 시점의 전송 수
+    };
+
+    /**
+     * @brief 스레드에서 전송할 항목
+     */
+    struct OutgoingMessage {
+        int channel_type;
+        std::string data;
+        bool keepalive;
+    };
+
+    // 전송 함수 (channel_type, data) -> 0: 성공
+    SendFunction send_;
+
+    // 채널 상태 (channel_type -> slot)
+    std::map<int, ChannelSlot> channels_;
+    mutable std::mutex channels_mutex_;
+
+    // 스케줄러 스레드
+    std::thread scheduler_thread_;
+    std::atomic<bool> running_{false};
+    std::condition_variable cv_;
+    std::mutex cv_mutex_;
+    bool wakeup_ = false;
+    int tick_ms_ = 50;
+
+    // 스케줄러 스레드 CPU 사용 시간 (ns)
+    std::atomic<int64_t> thread_cpu_ns_{0};
+
+    // 통계 출력 구간
+    std::chrono::steady_clock::time_point last_stats_log_time_;
+    int64_t cpu_ns_at_last_log_ = 0;
+
+    // 로거
+    std::shared_ptr<spdlog::logger> logger = nullptr;
+
+    // 내부 메서드
+    void schedulerThread();
+    void collectDue(std::chrono::steady_clock::time_point now,
+                    std::vector<OutgoingMessage>& out);
+    void publish(const std::vector<OutgoingMessage>& out);
+    PublishPolicy loadPolicy(const std::string& channel_key, const PublishPolicy& defaults) const;
+    static int64_t currentThreadCpuNs();
+
+public:
+    /**
+     * @brief 생성자
+     * @param send 전송 함수 (보통 RedisClient::sendData 래퍼)
+     */
+    explicit PublishScheduler(SendFunction send);
+
+    /**
+     * @brief 소멸자
+     */
+    ~PublishScheduler();
+
+    /**
+     * @brief 초기화 - config.json의 redis.publish_policy에서 채널별 정책 로드
+     * @return 성공 시 true
+     */
+    bool initialize();
+
+    /**
+     * @brief 채널 정책 등록
+     * @param channel_type 채널 타입 (channel_types.h)
+     * @param channel_key config 키 (로깅용)
+     * @param policy 전송 정책
+     */
+    void registerChannel(int channel_type, const std::string& channel_key,
+                         const PublishPolicy& policy);
+
+    /**
+     * @brief 전송할 값 제출 (논블로킹)
+     * @param channel_type 채널 타입
+     * @param data 전송할 데이터
+     * @return 스케줄러가 관리하는 채널이면 true, 아니면 false (호출측 직접 전송)
+     */
+    bool submit(int channel_type, const std::string& data);
+
+    /**
+     * @brief 스케줄러 스레드 시작
+     */
+    void start();
+
+    /**
+     * @brief 스케줄러 스레드 중지 (전송 가능한 대기값은 마지막으로 전송)
+     */
+    void stop();
+
+    /**
+     * @brief 채널별 전송률(msgs/sec) 및 스레드 CPU 사용량 로깅
+     */
+    void logStatistics();
+
+    /**
+     * @brief 실행 상태 확인
+     * @return 실행 중이면 true
+     */
+    bool isRunning() const { return running_.load(); }
+};
+
+#endif // PUBLISH_SCHEDULER_H
@@ -7,6 +7,7 @@
 
 #include "channel_types.h"
 #include "redis_client.h"
+#include "shm_publisher.h"
 #include "../../utils/config_manager.h"
 #include <sstream>
 #include <thread>
@@ -21,6 +22,15 @@ RedisClient::RedisClient() {
     
     logger->info("RedisClient 초기화 - {}:{}", redis_server_ip, redis_server_port);
     
+    // 공유메모리 링 (같은 호스트 소비자용)
+    if (config.isShmRingEnabled()) {
+        shm_publisher = std::make_unique<ShmPublisher>();
+        if (!shm_publisher->initialize()) {
+            logger->warn("공유메모리 링 초기화 실패 - Redis로만 전송");
+            shm_publisher.reset();
+        }
+    }
+    
     // 초기 연결 시도
     connect();
 }
@@ -172,6 +182,50 @@ int RedisClient::sendData(int channel_type, const std::string& data) {
             logger->debug("Presence 데이터 전송 - 채널: {}, 크기: {} bytes", 
                         channel_name, data.length());
             break;
+        case CHANNEL_LOS:
+            logger->debug("LOS 데이터 전송 - 채널: {}, 크기: {} bytes", 
+                        channel_name, data.length());
+            break;
+        case CHANNEL_INTERSECTION_APPROACH:
+            logger->debug("접근로 주기 레코드 전송 - 채널: {}, 크기: {} bytes", 
+                        channel_name, data.length());
+            break;
+        case CHANNEL_INTERSECTION:
+            logger->info("교차로 주기 통계 전송 - 채널: {}, 크기: {} bytes", 
+                        channel_name, data.length());
+            break;
+        case CHANNEL_TELEMETRY:
+            logger->debug("텔레메트리 전송 - 채널: {}, 크기: {} bytes", 
+                        channel_name, data.length());
+            break;
+        case CHANNEL_FRAME_GAP:
+            logger->debug("프레임 누락률 전송 - 채널: {}, 크기: {} bytes", 
+                        channel_name, data.length());
+            break;
+        case CHANNEL_ARRIVAL:
+            logger->debug("주기 도착 분석 전송 - 채널: {}, 크기: {} bytes", 
+                        channel_name, data.length());
+            break;
+        case CHANNEL_SPLIT_FAILURE:
+            logger->debug("split failure 결과 전송 - 채널: {}, 크기: {} bytes", 
+                        channel_name, data.length());
+            break;
+        case CHANNEL_PET:
+            logger->debug("PET 이벤트 전송 - 채널: {}, 크기: {} bytes", 
+                        channel_name, data.length());
+            break;
+        case CHANNEL_PED_WAIT:
+            logger->debug("보행자 대기 분포 전송 - 채널: {}, 크기: {} bytes", 
+                        channel_name, data.length());
+            break;
+    }
+    
+    // 공유메모리 링 기록 (exclusive 설정 시 Redis PUBLISH 생략)
+    if (shm_publisher && shm_publisher->handles(channel_type)) {
+        int shm_result = shm_publisher->publish(channel_type, data);
+        if (shm_publisher->isExclusive()) {
+            return shm_result;
+        }
     }
     
     // 실제 전송
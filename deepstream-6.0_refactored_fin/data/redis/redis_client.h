@@ -13,6 +13,9 @@
 #include "logger.hpp"
 #endif
 
+// Forward declarations
+class ShmPublisher;
+
 /**
  * @brief Redis 통신을 담당하는 클래스
  * 
@@ -32,6 +35,9 @@ private:
     std::chrono::steady_clock::time_point last_reconnect_attempt;
     const std::chrono::seconds reconnect_interval{5};  // 5초마다 재연결 시도
     
+    // 같은 호스트 소비자용 공유메모리 링 (비활성 시 nullptr)
+    std::unique_ptr<ShmPublisher> shm_publisher;
+    
     // 로거
     std::shared_ptr<spdlog::logger> logger;
     
@@ -90,6 +96,7 @@ public:
      *         -2: PUBLISH 실패
      *         -3: 잘못된 채널 타입
      *         -4: 빈 데이터
+     *         -5: 공유메모리 링 레코드 크기 초과 (shm_ring.exclusive 채널)
      */
     int sendData(int channel_type, const std::string& data);
     
@@ -0,0 +1,252 @@
+﻿/*
+ * shm_publisher.cpp
+ *
+ * 공유메모리 링 전송기 구현
+ * - 기록 순서: reserve_pos 예약 -> 데이터 기록 -> commit_pos 공개 -> futex 깨우기 (대기 리더 있을 때만)
+ */
+
+#include "shm_publisher.h"
+#include "channel_types.h"
+#include "../../utils/config_manager.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+
+const int MIN_CAPACITY_KB = 64;
+const int MAX_CAPACITY_KB = 64 * 1024;
+
+uint64_t roundUpPow2(uint64_t value) {
+    uint64_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+}  // namespace
+
+ShmPublisher::ShmPublisher() {
+    logger = getLogger("DS_ShmPublisher_log");
+    logger->info("ShmPublisher 생성");
+}
+
+ShmPublisher::~ShmPublisher() {
+    logStatistics();
+    for (auto& ring : rings_) {
+        if (ring) {
+            closeRing(*ring);
+        }
+    }
+}
+
+void ShmPublisher::loadConfig() {
+    auto& config = ConfigManager::getInstance();
+    const std::string base_key = "redis.shm_ring";
+
+    config_.exclusive = config.getBool(base_key + ".exclusive", false);
+    config_.capacity_kb = config.getInt(base_key + ".capacity_kb", 1024);
+    config_.name_prefix = config.getString(base_key + ".name_prefix", "ds_");
+    config_.channels = config.getStringArray(base_key + ".channels");
+}
+
+bool ShmPublisher::initialize() {
+    try {
+        loadConfig();
+
+        if (config_.capacity_kb < MIN_CAPACITY_KB || config_.capacity_kb > MAX_CAPACITY_KB) {
+            logger->warn("잘못된 capacity_kb 값: {} - 기본값 1024 사용", config_.capacity_kb);
+            config_.capacity_kb = 1024;
+        }
+        if (config_.channels.empty()) {
+            logger->warn("공유메모리 링 대상 채널 없음 - 비활성화");
+            return false;
+        }
+
+        for (const auto& channel : config_.channels) {
+            int channel_type = getChannelType(channel);
+            if (channel_type < 0) {
+                logger->warn("알 수 없는 채널 무시: {}", channel);
+                continue;
+            }
+            if (findRing(channel_type)) continue;
+
+            auto ring = std::make_unique<Ring>();
+            ring->channel_type = channel_type;
+            ring->channel = channel;
+            ring->name = shmRingName(config_.name_prefix, channel);
+            ring->capacity = roundUpPow2(static_cast<uint64_t>(config_.capacity_kb) * 1024);
+            ring->mask = ring->capacity - 1;
+
+            if (!openRing(*ring)) continue;
+
+            if (channel_type >= static_cast<int>(rings_.size())) {
+                rings_.resize(channel_type + 1);
+            }
+            rings_[channel_type] = std::move(ring);
+        }
+
+        int opened = static_cast<int>(std::count_if(rings_.begin(), rings_.end(),
+                                                    [](const std::unique_ptr<Ring>& r) { return r != nullptr; }));
+        logger->info("공유메모리 링 초기화 완료 - {}개 채널, 링 크기: {}KB, Redis 전송: {}",
+                    opened, roundUpPow2(static_cast<uint64_t>(config_.capacity_kb) * 1024) / 1024,
+                    config_.exclusive ? "생략" : "병행");
+        return opened > 0;
+
+    } catch (const std::exception& e) {
+        logger->error("공유메모리 링 초기화 실패: {}", e.what());
+        return false;
+    }
+}
+
+bool ShmPublisher::openRing(Ring& ring) {
+    size_t map_size = sizeof(ShmRingHeader) + ring.capacity;
+
+    int fd = shm_open(ring.name.c_str(), O_CREAT | O_RDWR, 0660);
+    if (fd < 0) {
+        logger->error("공유메모리 열기 실패 ({}): {}", ring.name, std::strerror(errno));
+        return false;
+    }
+
+    // 같은 크기의 기존 링은 위치/순번을 이어서 사용 (재시작 시 리더가 다시 연결할 필요 없음)
+    struct stat st;
+    bool reuse = fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) == map_size;
+    if (!reuse) {
+        // 크기가 다르면 새 세그먼트로 교체 (기존 리더의 매핑은 유지되어 SIGBUS 없음)
+        close(fd);
+        shm_unlink(ring.name.c_str());
+        fd = shm_open(ring.name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0660);
+        if (fd < 0 || ftruncate(fd, static_cast<off_t>(map_size)) != 0) {
+            logger->error("공유메모리 생성 실패 ({}): {}", ring.name, std::strerror(errno));
+            if (fd >= 0) close(fd);
+            return false;
+        }
+    }
+
+    void* address = mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (address == MAP_FAILED) {
+        logger->error("공유메모리 매핑 실패 ({}): {}", ring.name, std::strerror(errno));
+        return false;
+    }
+
+    ring.header = static_cast<ShmRingHeader*>(address);
+    ring.data = static_cast<uint8_t*>(address) + sizeof(ShmRingHeader);
+    ring.map_size = map_size;
+
+    ShmRingHeader* header = ring.header;
+    reuse = reuse && header->magic == SHM_RING_MAGIC && header->version == SHM_RING_VERSION &&
+            header->capacity == ring.capacity &&
+            header->reserve_pos.load() == header->commit_pos.load();
+    if (!reuse) {
+        std::memset(address, 0, sizeof(ShmRingHeader));
+        new (header) ShmRingHeader();
+        header->magic = SHM_RING_MAGIC;
+        header->version = SHM_RING_VERSION;
+        header->capacity = ring.capacity;
+        header->header_size = sizeof(ShmRingHeader);
+        header->reserve_pos.store(0);
+        header->commit_pos.store(0);
+        header->next_seq.store(0);
+        header->notify.store(0);
+        header->waiters.store(0);
+    }
+    header->writer_pid = static_cast<int32_t>(getpid());
+
+    logger->info("공유메모리 링 {} - {} ({}, {}KB, 순번 {}부터)",
+                reuse ? "재사용" : "생성", ring.name, ring.channel,
+                ring.capacity / 1024, header->next_seq.load());
+    return true;
+}
+
+void ShmPublisher::closeRing(Ring& ring) {
+    if (ring.header) {
+        munmap(ring.header, ring.map_size);
+        ring.header = nullptr;
+        ring.data = nullptr;
+    }
+}
+
+int ShmPublisher::publish(int channel_type, const std::string& data) {
+    Ring* ring = findRing(channel_type);
+    if (!ring) return -3;
+
+    size_t record_size = shmRecordSize(data.size());
+    std::lock_guard<std::mutex> lock(ring->write_mutex);
+
+    if (record_size > ring->capacity / 2) {
+        ring->rejected++;
+        if (ring->rejected % 100 == 1) {
+            logger->warn("공유메모리 레코드 크기 초과 - {}: {} bytes (링 {}KB, 누적 {}회)",
+                        ring->channel, data.size(), ring->capacity / 1024, ring->rejected);
+        }
+        return -5;
+    }
+
+    ShmRingHeader* header = ring->header;
+    uint64_t pos = header->commit_pos.load(std::memory_order_relaxed);
+    uint64_t offset = pos & ring->mask;
+
+    // 레코드는 링 끝에서 나누지 않음
+    uint64_t skip = 0;
+    if (ring->capacity - offset < record_size) {
+        skip = ring->capacity - offset;
+    }
+    uint64_t end = pos + skip + record_size;
+
+    // 덮어쓸 구간을 먼저 예약 (리더는 복사 후 reserve_pos로 덮어쓰기 여부 확인)
+    header->reserve_pos.store(end, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    if (skip > 0) {
+        if (skip >= sizeof(ShmRecordHeader)) {
+            ShmRecordHeader pad{SHM_RECORD_PAD, 0, 0, 0};
+            std::memcpy(ring->data + offset, &pad, sizeof(pad));
+        }
+        offset = 0;
+    }
+
+    ShmRecordHeader record;
+    record.length = static_cast<uint32_t>(data.size());
+    record.channel = static_cast<uint32_t>(channel_type);
+    record.seq = header->next_seq.load(std::memory_order_relaxed);
+    record.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    std::memcpy(ring->data + offset, &record, sizeof(record));
+    std::memcpy(ring->data + offset + sizeof(record), data.data(), data.size());
+
+    header->next_seq.store(record.seq + 1, std::memory_order_relaxed);
+    header->commit_pos.store(end, std::memory_order_release);
+
+    // notify 증가와 waiters 확인은 리더의 waiters 증가/notify 확인과 순서 보장 (seq_cst)
+    header->notify.fetch_add(1);
+    if (header->waiters.load() > 0) {
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&header->notify), FUTEX_WAKE, INT_MAX,
+                nullptr, nullptr, 0);
+        ring->wakeups++;
+    }
+
+    ring->published++;
+    return 0;
+}
+
+void ShmPublisher::logStatistics() const {
+    logger->info("공유메모리 링 통계");
+    for (const auto& ring : rings_) {
+        if (!ring || !ring->header) continue;
+        logger->info("  [{}] 기록: {}건, 크기 초과: {}건, 깨우기: {}회, 누적 위치: {}",
+                    ring->channel, ring->published, ring->rejected, ring->wakeups,
+                    ring->header->commit_pos.load());
+    }
+}
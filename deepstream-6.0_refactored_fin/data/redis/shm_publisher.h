@@ -0,0 +1,104 @@
+﻿#ifndef SHM_PUBLISHER_H
+#define SHM_PUBLISHER_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "shm_ring.h"
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+/**
+ * @brief 공유메모리 링 설정 (config.json redis.shm_ring)
+ */
+struct ShmRingConfig {
+    bool exclusive = false;                 // true: 대상 채널은 Redis PUBLISH 생략
+    int capacity_kb = 1024;                 // 채널별 데이터 영역 크기 (2의 거듭제곱으로 올림)
+    std::string name_prefix = "ds_";        // /dev/shm 이름 접두사
+    std::vector<std::string> channels;      // 대상 Redis 채널명
+};
+
+/**
+ * @brief 같은 호스트 소비자용 공유메모리 링 전송기
+ *
+ * RedisClient::sendData와 같은 문자열 레코드를 채널별 POSIX 공유메모리 링에 기록
+ * - 로컬 Redis 경유 시의 소켓 송수신/복사/RESP 파싱 없이 리더가 직접 읽음
+ * - 리더는 잠금 없이 읽고 기록자를 막지 않음 (느린 리더는 overrun으로 손실 감지)
+ * - 리더 대기/깨우기는 헤더의 futex 워드 사용, 대기 리더가 없으면 시스템 호출 없음
+ * - 같은 채널의 기록은 채널별 뮤텍스로 직렬화 (여러 분석 스레드가 같은 채널에 전송)
+ *
+ * 레이아웃과 리더 규칙은 shm_ring.h 참조
+ */
+class ShmPublisher {
+private:
+    /**
+     * @brief 채널별 링 (초기화 후 주소 고정)
+     */
+    struct Ring {
+        int channel_type = -1;
+        std::string channel;                // Redis 채널명
+        std::string name;                   // 공유메모리 이름
+        ShmRingHeader* header = nullptr;
+        uint8_t* data = nullptr;
+        size_t map_size = 0;
+        uint64_t capacity = 0;
+        uint64_t mask = 0;
+
+        std::mutex write_mutex;
+        uint64_t published = 0;
+        uint64_t rejected = 0;
+        uint64_t wakeups = 0;
+    };
+
+    ShmRingConfig config_;
+    std::vector<std::unique_ptr<Ring>> rings_;      // 채널 타입으로 인덱싱 (대상 아니면 nullptr)
+
+    std::shared_ptr<spdlog::logger> logger = nullptr;
+
+    void loadConfig();
+    bool openRing(Ring& ring);
+    void closeRing(Ring& ring);
+
+    Ring* findRing(int channel_type) const {
+        if (channel_type < 0 || channel_type >= static_cast<int>(rings_.size())) return nullptr;
+        return rings_[channel_type].get();
+    }
+
+public:
+    ShmPublisher();
+    ~ShmPublisher();
+
+    ShmPublisher(const ShmPublisher&) = delete;
+    ShmPublisher& operator=(const ShmPublisher&) = delete;
+
+    /**
+     * @brief 초기화 - 대상 채널별 공유메모리 링 생성/연결
+     * @return 하나 이상의 링이 열리면 true
+     */
+    bool initialize();
+
+    /**
+     * @brief 공유메모리 링 대상 채널인지 확인
+     */
+    bool handles(int channel_type) const { return findRing(channel_type) != nullptr; }
+
+    bool isExclusive() const { return config_.exclusive; }
+
+    /**
+     * @brief 레코드 기록
+     * @param channel_type 채널 타입
+     * @param data 레코드 (sendData와 같은 문자열)
+     * @return 성공 시 0, -3: 대상 채널 아님, -5: 레코드가 링 크기의 절반 초과
+     */
+    int publish(int channel_type, const std::string& data);
+
+    void logStatistics() const;
+};
+
+#endif // SHM_PUBLISHER_H
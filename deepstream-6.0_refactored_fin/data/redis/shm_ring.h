@@ -0,0 +1,93 @@
+﻿#ifndef SHM_RING_H
+#define SHM_RING_H
+
+#include <atomic>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*
+ * 공유메모리 링 레이아웃 (ShmPublisher 기록, 같은 호스트의 리더가 읽음)
+ *
+ * 세그먼트: /dev/shm/<prefix><채널명 - 영숫자 외 문자는 '_'>
+ *   [0, 128)                  ShmRingHeader
+ *   [128, 128 + capacity)     데이터 영역 (capacity는 2의 거듭제곱)
+ *
+ * 레코드: ShmRecordHeader(24바이트) + payload, 8바이트 정렬
+ * - 위치(reserve_pos/commit_pos)는 누적 바이트 수, 데이터 오프셋 = 위치 & (capacity - 1)
+ * - 레코드는 링 끝에서 나뉘지 않음: 남은 공간이 부족하면 끝까지 건너뜀
+ *   (남은 공간이 헤더 크기 이상이면 length=SHM_RECORD_PAD 채움 레코드 기록)
+ *
+ * 리더 규칙 (잠금 없음, 기록자를 막지 않음):
+ * 1. commit_pos(acquire)까지 읽기 - commit_pos - read_pos > capacity이면 덮어쓰기(overrun),
+ *    commit_pos로 이동하고 seq 차이만큼 손실 처리
+ * 2. 레코드 복사 후 reserve_pos를 다시 읽어 reserve_pos - 레코드 시작 > capacity이면
+ *    복사 중 덮어쓰인 것이므로 버림
+ * 3. seq는 레코드마다 1씩 증가 - 건너뛴 값은 손실 레코드 수
+ * 4. 대기: waiters 증가 -> notify 값 확인 -> commit_pos 재확인 -> FUTEX_WAIT(notify, 값)
+ *    -> waiters 감소 (기록자는 waiters > 0일 때만 FUTEX_WAKE 호출)
+ * 5. commit_pos < read_pos이면 기록자가 링을 다시 초기화한 것 - commit_pos로 이동
+ */
+
+const uint32_t SHM_RING_MAGIC = 0x52525344;       // "DSRR"
+const uint32_t SHM_RING_VERSION = 1;
+const uint32_t SHM_RECORD_PAD = 0xFFFFFFFFu;      // 링 끝 채움 레코드
+const size_t SHM_RECORD_ALIGN = 8;
+
+/**
+ * @brief 링 헤더 (128바이트, 기록 위치 필드는 별도 캐시 라인)
+ */
+struct ShmRingHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t capacity;                      // 데이터 영역 크기 (바이트)
+    uint32_t header_size;                   // 데이터 영역 시작 오프셋
+    int32_t writer_pid;                     // 마지막 기록 프로세스
+    uint64_t reserved0[5];
+
+    std::atomic<uint64_t> reserve_pos;      // 64: 기록 예약 위치 (덮어쓰기 전에 증가)
+    std::atomic<uint64_t> commit_pos;       // 72: 기록 완료 위치 (리더 읽기 한계)
+    std::atomic<uint64_t> next_seq;         // 80: 다음 레코드 순번
+    std::atomic<uint32_t> notify;           // 88: futex 대기 워드 (레코드마다 증가)
+    std::atomic<uint32_t> waiters;          // 92: futex 대기 중인 리더 수
+    uint64_t reserved1[4];
+};
+
+/**
+ * @brief 레코드 헤더
+ */
+struct ShmRecordHeader {
+    uint32_t length;                        // payload 길이 (SHM_RECORD_PAD: 채움)
+    uint32_t channel;                       // ChannelType
+    uint64_t seq;                           // 레코드 순번
+    int64_t timestamp_ns;                   // 기록 시각 (CLOCK_REALTIME, 지연 측정용)
+};
+
+static_assert(sizeof(ShmRingHeader) == 128, "ShmRingHeader 크기는 128바이트");
+static_assert(offsetof(ShmRingHeader, reserve_pos) == 64, "reserve_pos 오프셋 64");
+static_assert(offsetof(ShmRingHeader, notify) == 88, "notify 오프셋 88");
+static_assert(sizeof(ShmRecordHeader) == 24, "ShmRecordHeader 크기는 24바이트");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "공유메모리에는 잠금 없는 64비트 원자 연산 필요");
+
+/**
+ * @brief 레코드 전체 크기 (헤더 + payload, 8바이트 정렬)
+ */
+inline size_t shmRecordSize(size_t payload_length) {
+    return (sizeof(ShmRecordHeader) + payload_length + SHM_RECORD_ALIGN - 1) & ~(SHM_RECORD_ALIGN - 1);
+}
+
+/**
+ * @brief 채널명 -> 공유메모리 이름 (shm_open용, '/' 접두사 포함)
+ * @param prefix 이름 접두사 (예: "ds_")
+ * @param channel Redis 채널명 (예: "detection:vehicle:2k" -> "/ds_detection_vehicle_2k")
+ */
+inline std::string shmRingName(const std::string& prefix, const std::string& channel) {
+    std::string name = "/" + prefix;
+    for (char c : channel) {
+        name += std::isalnum(static_cast<unsigned char>(c)) ? c : '_';
+    }
+    return name;
+}
+
+#endif // SHM_RING_H
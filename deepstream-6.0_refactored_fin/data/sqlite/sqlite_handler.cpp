@@ -3,10 +3,15 @@
  * 
  * SQLite 데이터베이스 핸들러 구현
  * main_table만 사용 (24시간 자동 삭제)
+ * 쓰기 연결 / 읽기 풀 / 체크포인트 연결 분리
  */
 
 #include "sqlite_handler.h"
+#include "sqlite_schema.h"
 #include "../../utils/config_manager.h"
+#include "../../utils/heartbeat_registry.h"
+#include "../../utils/thread_role.h"
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <sstream>
@@ -23,8 +28,16 @@ SQLiteHandler::SQLiteHandler() {
     auto& config = ConfigManager::getInstance();
     db_path = config.getSQLitePath();  // 디렉토리 경로
     main_db_name = config.getString("paths.sqlite_db.filename", "test.db");
+    read_pool_size = std::max(0, config.getInt("paths.sqlite_db.read_pool_size", 2));
+    busy_timeout_ms = std::max(0, config.getInt("paths.sqlite_db.busy_timeout_ms", 2000));
+    read_timeout_ms = std::max(0, config.getInt("paths.sqlite_db.read_timeout_ms", 5000));
+    checkpoint_interval_sec = std::max(0, config.getInt("paths.sqlite_db.checkpoint_interval_sec", 30));
+    journal_size_limit_mb = std::max(0, config.getInt("paths.sqlite_db.journal_size_limit_mb", 64));
     
     logger->info("Database configuration - Path: {}, DB: {}", db_path, main_db_name);
+    logger->info("Connection model - read pool: {}, busy_timeout: {}ms, passive checkpoint: {}",
+                read_pool_size, busy_timeout_ms,
+                checkpoint_interval_sec > 0 ? std::to_string(checkpoint_interval_sec) + "s" : "auto");
     
     // 디렉토리 생성 확인
     struct stat st = {0};
@@ -39,50 +52,35 @@ SQLiteHandler::SQLiteHandler() {
     // 단일 DB 초기화
     main_db = openDatabase(main_db_name);
     if (main_db) {
-        // main_table 생성
-        const char* main_table_sql = R"SQL(
-            CREATE TABLE IF NOT EXISTS main_table(
-                row_id INTEGER PRIMARY KEY AUTOINCREMENT,
-                kncr_cd TEXT,
-                lane_no INTEGER,
-                turn_type_cd INTEGER,
-                turn_dttn_unix_tm INTEGER,
-                turn_dttn_sped REAL,
-                stln_pasg_unix_tm INTEGER,
-                stln_dttn_sped REAL,
-                vhcl_sect_sped REAL,
-                frst_obsrvn_unix_tm INTEGER,
-                vhcl_obsrvn_hr INTEGER,
-                vhcl_dttn_2k_id INTEGER,
-                timestamp INTEGER DEFAULT (strftime('%s', 'now'))
-            );
-            CREATE INDEX IF NOT EXISTS idx_timestamp ON main_table(timestamp);
-            CREATE INDEX IF NOT EXISTS idx_vhcl_dttn_2k_id ON main_table(vhcl_dttn_2k_id);
-            CREATE INDEX IF NOT EXISTS idx_turn_type_cd ON main_table(turn_type_cd);
-            CREATE INDEX IF NOT EXISTS idx_lane_no ON main_table(lane_no);
-            CREATE INDEX IF NOT EXISTS idx_kncr_cd ON main_table(kncr_cd);
-        )SQL";
-        
-        // Create main_table with indexes
-        char* error_msg = nullptr;
-        if (sqlite3_exec(main_db, main_table_sql, nullptr, nullptr, &error_msg) != SQLITE_OK) {
-            logger->error("Failed to create main_table: {}", error_msg);
-            sqlite3_free(error_msg);
+        // 스키마 생성/변환 (v1 main_table은 vehicle_record로 이전 후 호환 뷰로 교체)
+        SQLiteSchema schema(logger);
+        if (!schema.migrate(main_db)) {
+            logger->error("Failed to prepare database schema - database disabled");
+            sqlite3_close(main_db);
+            main_db = nullptr;
+            return;
         }
+        loadVehicleClasses();
         
-        // main_table 자동 삭제 트리거 생성 (24시간)
-        const char* main_trigger_sql = R"SQL(
-            CREATE TRIGGER IF NOT EXISTS cleanup_main_table AFTER INSERT ON main_table
-            BEGIN 
-                DELETE FROM main_table WHERE timestamp < (strftime('%s', 'now') - 86400);
-            END;
+        // 삽입 문은 한 번만 준비 (매 차량마다 파싱하지 않음)
+        const char* insert_sql = R"SQL(
+            INSERT INTO vehicle_record (kncr_id, lane_no, turn_type_cd, 
+                                      turn_dttn_unix_tm, turn_dttn_sped, 
+                                      stln_pasg_unix_tm, stln_dttn_sped, 
+                                      vhcl_sect_sped, frst_obsrvn_unix_tm, 
+                                      vhcl_obsrvn_hr, vhcl_dttn_2k_id,
+                                      aprch_dly_sec, stop_sec, stop_cnt)
+            VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)
         )SQL";
         
-        if (sqlite3_exec(main_db, main_trigger_sql, nullptr, nullptr, &error_msg) != SQLITE_OK) {
-            logger->error("Failed to create main trigger: {}", error_msg);
-            sqlite3_free(error_msg);
+        if (sqlite3_prepare_v2(main_db, insert_sql, -1, &insert_stmt, nullptr) != SQLITE_OK) {
+            logger->error("Failed to prepare insert: {}", sqlite3_errmsg(main_db));
+            insert_stmt = nullptr;
         }
         
+        // 스키마 생성 후 읽기/체크포인트 연결
+        openAuxiliaryConnections();
+        
         logger->info("SQLite database initialized successfully");
     } else {
         logger->error("Failed to initialize database");
@@ -92,38 +90,319 @@ SQLiteHandler::SQLiteHandler() {
 SQLiteHandler::~SQLiteHandler() {
     logger->info("SQLiteHandler 종료");
     
+    stopMaintenance();
+    
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        for (size_t i = 0; i < read_pool.size(); i++) {
+            if (read_in_use[i]) {
+                logger->warn("반납되지 않은 읽기 연결 {} 종료", i);
+            }
+            sqlite3_close(read_pool[i]);
+        }
+        read_pool.clear();
+        read_in_use.clear();
+    }
+    
+    if (checkpoint_db) {
+        sqlite3_close(checkpoint_db);
+        checkpoint_db = nullptr;
+    }
+    
+    if (insert_stmt) {
+        sqlite3_finalize(insert_stmt);
+        insert_stmt = nullptr;
+    }
+    
+    // 쓰기 연결은 마지막에 종료 (마지막 연결 종료 시 WAL 정리)
     if (main_db) {
         sqlite3_close(main_db);
         main_db = nullptr;
     }
 }
 
-sqlite3* SQLiteHandler::openDatabase(const std::string& db_name) {
+sqlite3* SQLiteHandler::openDatabase(const std::string& db_name, bool read_only) {
     std::string full_path = db_path + "/" + db_name;
     sqlite3* db = nullptr;
     
-    int rc = sqlite3_open(full_path.c_str(), &db);
+    int flags = read_only ? SQLITE_OPEN_READONLY : (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
+    int rc = sqlite3_open_v2(full_path.c_str(), &db, flags, nullptr);
     if (rc != SQLITE_OK) {
         logger->error("Cannot open database {}: {}", full_path, sqlite3_errmsg(db));
         sqlite3_close(db);
         return nullptr;
     }
     
+    // 잠금 충돌 시 즉시 실패하지 않고 대기
+    sqlite3_busy_timeout(db, busy_timeout_ms);
+    
     // 성능 최적화를 위한 PRAGMA 설정
-    char* error_msg = nullptr;
-    sqlite3_exec(db, "PRAGMA journal_mode=WAL", nullptr, nullptr, &error_msg);
-    sqlite3_exec(db, "PRAGMA synchronous=NORMAL", nullptr, nullptr, &error_msg);
-    sqlite3_exec(db, "PRAGMA cache_size=10000", nullptr, nullptr, &error_msg);
-    sqlite3_exec(db, "PRAGMA temp_store=MEMORY", nullptr, nullptr, &error_msg);
+    std::vector<std::string> pragmas;
+    if (read_only) {
+        // WAL 모드는 DB 파일에 유지되므로 읽기 연결은 캐시 설정만
+        pragmas = {"PRAGMA query_only=1",
+                   "PRAGMA cache_size=10000",
+                   "PRAGMA temp_store=MEMORY"};
+    } else {
+        pragmas = {"PRAGMA journal_mode=WAL",
+                   "PRAGMA synchronous=NORMAL",
+                   "PRAGMA cache_size=10000",
+                   "PRAGMA temp_store=MEMORY",
+                   "PRAGMA journal_size_limit=" + std::to_string(journal_size_limit_mb * 1024LL * 1024LL)};
+    }
     
-    if (error_msg) {
-        logger->warn("PRAGMA warning: {}", error_msg);
-        sqlite3_free(error_msg);
+    for (const auto& pragma : pragmas) {
+        char* error_msg = nullptr;
+        if (sqlite3_exec(db, pragma.c_str(), nullptr, nullptr, &error_msg) != SQLITE_OK) {
+            logger->warn("PRAGMA warning ({}): {}", pragma, error_msg ? error_msg : "Unknown error");
+            sqlite3_free(error_msg);
+        }
     }
     
     return db;
 }
 
+void SQLiteHandler::loadVehicleClasses() {
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(main_db, "SELECT kncr_id, kncr_cd FROM vehicle_class", -1,
+                           &stmt, nullptr) != SQLITE_OK) {
+        logger->error("Failed to load vehicle_class: {}", sqlite3_errmsg(main_db));
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(class_mutex);
+    vehicle_class_ids.clear();
+    while (sqlite3_step(stmt) == SQLITE_ROW) {
+        const unsigned char* code = sqlite3_column_text(stmt, 1);
+        if (code) {
+            vehicle_class_ids[reinterpret_cast<const char*>(code)] = sqlite3_column_int(stmt, 0);
+        }
+    }
+    sqlite3_finalize(stmt);
+    
+    logger->info("차종 조회 테이블 로드: {}개", vehicle_class_ids.size());
+}
+
+int SQLiteHandler::resolveVehicleClassId(const std::string& kncr_cd) {
+    {
+        std::lock_guard<std::mutex> lock(class_mutex);
+        auto it = vehicle_class_ids.find(kncr_cd);
+        if (it != vehicle_class_ids.end()) return it->second;
+    }
+    
+    // 매핑에 없는 새 차종 코드 (모델 라벨 추가 등) - 조회 테이블에 등록
+    // (dataHandler main_table 삽입 트리거가 먼저 등록했을 수 있으므로 OR IGNORE 후 조회)
+    sqlite3_stmt* stmt = nullptr;
+    const char* select_sql = "SELECT kncr_id FROM vehicle_class WHERE kncr_cd = ?";
+    if (sqlite3_prepare_v2(main_db, "INSERT OR IGNORE INTO vehicle_class(kncr_cd) VALUES (?)", -1,
+                           &stmt, nullptr) != SQLITE_OK) {
+        return VEHICLE_CLASS_UNKNOWN_ID;
+    }
+    sqlite3_bind_text(stmt, 1, kncr_cd.c_str(), -1, SQLITE_TRANSIENT);
+    int rc = sqlite3_step(stmt);
+    sqlite3_finalize(stmt);
+    
+    int kncr_id = -1;
+    if (rc == SQLITE_DONE && sqlite3_prepare_v2(main_db, select_sql, -1, &stmt, nullptr) == SQLITE_OK) {
+        sqlite3_bind_text(stmt, 1, kncr_cd.c_str(), -1, SQLITE_TRANSIENT);
+        if (sqlite3_step(stmt) == SQLITE_ROW) {
+            kncr_id = sqlite3_column_int(stmt, 0);
+        }
+        sqlite3_finalize(stmt);
+    }
+    if (kncr_id < 0) {
+        logger->warn("차종 코드 등록 실패: {} - {}", kncr_cd, sqlite3_errmsg(main_db));
+        return VEHICLE_CLASS_UNKNOWN_ID;
+    }
+    {
+        std::lock_guard<std::mutex> lock(class_mutex);
+        vehicle_class_ids[kncr_cd] = kncr_id;
+    }
+    logger->info("새 차종 코드 등록: {} -> {}", kncr_cd, kncr_id);
+    return kncr_id;
+}
+
+int SQLiteHandler::getVehicleClassId(const std::string& kncr_cd) const {
+    std::lock_guard<std::mutex> lock(class_mutex);
+    auto it = vehicle_class_ids.find(kncr_cd);
+    return it != vehicle_class_ids.end() ? it->second : -1;
+}
+
+void SQLiteHandler::openAuxiliaryConnections() {
+    // 주기 체크포인트 사용 시 쓰기 연결의 커밋 중 자동 체크포인트 비활성 (삽입 지연 방지)
+    if (checkpoint_interval_sec > 0) {
+        checkpoint_db = openDatabase(main_db_name);
+        if (checkpoint_db) {
+            sqlite3_wal_autocheckpoint(main_db, 0);
+            sqlite3_wal_autocheckpoint(checkpoint_db, 0);
+        } else {
+            logger->warn("체크포인트 연결 실패 - 쓰기 연결 자동 체크포인트 유지");
+        }
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        for (int i = 0; i < read_pool_size; i++) {
+            sqlite3* db = openDatabase(main_db_name, true);
+            if (!db) {
+                logger->warn("읽기 연결 {}/{} 열기 실패", i + 1, read_pool_size);
+                break;
+            }
+            read_pool.push_back(db);
+            read_in_use.push_back(false);
+        }
+    }
+    
+    if (read_pool.empty()) {
+        logger->warn("읽기 풀 없음 - 통계 쿼리는 쓰기 연결 공유 (삽입과 직렬화)");
+    } else {
+        logger->info("읽기 전용 연결 {}개 준비", read_pool.size());
+    }
+}
+
+SQLiteReadLease SQLiteHandler::acquireReader(int timeout_ms) {
+    if (timeout_ms < 0) {
+        timeout_ms = read_timeout_ms;
+    }
+    
+    {
+        std::unique_lock<std::mutex> lock(pool_mutex);
+        if (!read_pool.empty()) {
+            auto find_free = [this]() {
+                auto it = std::find(read_in_use.begin(), read_in_use.end(), false);
+                return it == read_in_use.end() ? -1 : static_cast<int>(it - read_in_use.begin());
+            };
+            
+            int slot = -1;
+            pool_cv.wait_for(lock, std::chrono::milliseconds(timeout_ms),
+                             [&]() { return (slot = find_free()) >= 0; });
+            if (slot < 0) {
+                reader_timeouts++;
+                logger->warn("읽기 연결 대기 시간 초과 ({}ms)", timeout_ms);
+                return SQLiteReadLease();
+            }
+            
+            read_in_use[slot] = true;
+            reader_leases++;
+            return SQLiteReadLease(this, read_pool[slot], slot, std::unique_lock<std::mutex>());
+        }
+    }
+    
+    // 읽기 풀이 없으면 쓰기 연결 공유 (기존 단일 연결 동작)
+    std::unique_lock<std::mutex> writer_lock(db_mutex);
+    if (!main_db) return SQLiteReadLease();
+    return SQLiteReadLease(this, main_db, -1, std::move(writer_lock));
+}
+
+void SQLiteHandler::releaseReader(int slot) {
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        if (slot < 0 || slot >= static_cast<int>(read_in_use.size())) return;
+        read_in_use[slot] = false;
+    }
+    pool_cv.notify_one();
+}
+
+int SQLiteHandler::checkpointPassive() {
+    std::lock_guard<std::mutex> lock(checkpoint_mutex);
+    
+    if (!checkpoint_db) return -1;
+    
+    auto start = std::chrono::steady_clock::now();
+    int wal_frames = 0;
+    int checkpointed_frames = 0;
+    int rc = sqlite3_wal_checkpoint_v2(checkpoint_db, nullptr, SQLITE_CHECKPOINT_PASSIVE,
+                                       &wal_frames, &checkpointed_frames);
+    int64_t elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>
+                        (std::chrono::steady_clock::now() - start).count();
+    
+    if (rc != SQLITE_OK) {
+        logger->warn("PASSIVE 체크포인트 실패: {}", sqlite3_errmsg(checkpoint_db));
+        return -1;
+    }
+    
+    checkpoint_count++;
+    last_wal_frames = wal_frames;
+    last_checkpointed_frames = checkpointed_frames;
+    checkpoint_max_ms = std::max(checkpoint_max_ms, elapsed_ms);
+    if (checkpointed_frames < wal_frames) {
+        checkpoint_partial_count++;
+    }
+    
+    logger->debug("PASSIVE 체크포인트 - WAL: {}프레임, 반영: {}프레임, {}ms",
+                 wal_frames, checkpointed_frames, elapsed_ms);
+    return 0;
+}
+
+void SQLiteHandler::startMaintenance() {
+    if (!checkpoint_db || maintenance_running.load()) return;
+    
+    maintenance_running = true;
+    maintenance_thread = std::thread(&SQLiteHandler::maintenanceThread, this);
+    logger->info("SQLite 체크포인트 스레드 시작 (주기: {}초)", checkpoint_interval_sec);
+}
+
+void SQLiteHandler::stopMaintenance() {
+    if (!maintenance_running.exchange(false)) return;
+    
+    maintenance_cv.notify_all();
+    if (maintenance_thread.joinable()) {
+        maintenance_thread.join();
+    }
+    
+    // 종료 전 마지막 체크포인트
+    checkpointPassive();
+    logger->info("SQLite 체크포인트 스레드 중지");
+}
+
+void SQLiteHandler::maintenanceThread() {
+    enterThreadRole("ds-sqlite");
+    HeartbeatHandle heartbeat = HeartbeatRegistry::getInstance().registerThread(
+        "ds-sqlite", checkpoint_interval_sec * 1000 + 30000);
+    
+    while (maintenance_running.load()) {
+        heartbeat.beat(HB_STAGE_IDLE);
+        {
+            std::unique_lock<std::mutex> lock(maintenance_wait_mutex);
+            maintenance_cv.wait_for(lock, std::chrono::seconds(checkpoint_interval_sec),
+                                    [this]() { return !maintenance_running.load(); });
+        }
+        if (!maintenance_running.load()) break;
+        
+        heartbeat.beat(HB_STAGE_SQLITE);
+        try {
+            checkpointPassive();
+        } catch (const std::exception& e) {
+            logger->error("체크포인트 중 오류: {}", e.what());
+        }
+    }
+}
+
+void SQLiteHandler::logStatistics() {
+    {
+        std::lock_guard<std::mutex> lock(db_mutex);
+        logger->info("SQLite 통계 - 삽입: {}건, 평균: {:.2f}ms, 최대: {:.2f}ms (최근 주기)",
+                    insert_count,
+                    insert_count > 0 ? insert_total_us / 1000.0 / insert_count : 0.0,
+                    insert_max_us / 1000.0);
+        insert_max_us = 0;
+    }
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        size_t busy = std::count(read_in_use.begin(), read_in_use.end(), true);
+        logger->info("  읽기 풀: {}/{} 사용 중, 임대: {}회, 대기 초과: {}회",
+                    busy, read_pool.size(), reader_leases, reader_timeouts);
+    }
+    {
+        std::lock_guard<std::mutex> lock(checkpoint_mutex);
+        if (checkpoint_db) {
+            logger->info("  체크포인트: {}회 (일부 반영: {}회), 최근 WAL: {}/{}프레임, 최대: {}ms",
+                        checkpoint_count, checkpoint_partial_count,
+                        last_checkpointed_frames, last_wal_frames, checkpoint_max_ms);
+        }
+    }
+}
+
 int SQLiteHandler::executeSQL(const std::string& sql) {
     if (!main_db) return -1;
     
@@ -143,26 +422,17 @@ int SQLiteHandler::insertVehicleData(int vehicle_id, const obj_data& obj,
                                    const std::string& vehicle_type) {
     std::lock_guard<std::mutex> lock(db_mutex);
     
-    if (!main_db) return -1;
+    if (!main_db || !insert_stmt) return -1;
     
-    // main_table에 차량 데이터 삽입
-    const char* sql = R"SQL(
-        INSERT INTO main_table (kncr_cd, lane_no, turn_type_cd, 
-                              turn_dttn_unix_tm, turn_dttn_sped, 
-                              stln_pasg_unix_tm, stln_dttn_sped, 
-                              vhcl_sect_sped, frst_obsrvn_unix_tm, 
-                              vhcl_obsrvn_hr, vhcl_dttn_2k_id)
-        VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)
-    )SQL";
+    auto start = std::chrono::steady_clock::now();
     
-    sqlite3_stmt* stmt;
-    if (sqlite3_prepare_v2(main_db, sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        logger->error("Failed to prepare insert: {}", sqlite3_errmsg(main_db));
-        return -1;
-    }
+    // main_table에 차량 데이터 삽입 (준비된 문 재사용)
+    sqlite3_stmt* stmt = insert_stmt;
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
     
-    // 파라미터 바인딩 - SQLITE_TRANSIENT 사용 (메모리 안전성)
-    sqlite3_bind_text(stmt, 1, vehicle_type.c_str(), -1, SQLITE_TRANSIENT);  // kncr_cd
+    // 파라미터 바인딩 (차종은 정수 번호로 저장)
+    sqlite3_bind_int(stmt, 1, resolveVehicleClassId(vehicle_type));         // kncr_id
     sqlite3_bind_int(stmt, 2, obj.lane);                                     // lane_no
     sqlite3_bind_int(stmt, 3, obj.dir_out);                                  // turn_type_cd
     sqlite3_bind_int(stmt, 4, obj.turn_time);                                // turn_dttn_unix_tm
@@ -178,14 +448,31 @@ int SQLiteHandler::insertVehicleData(int vehicle_id, const obj_data& obj,
     sqlite3_bind_int(stmt, 10, sensing_time);                                // vhcl_obsrvn_hr
     sqlite3_bind_int(stmt, 11, vehicle_id);                                  // vhcl_dttn_2k_id
     
+    // 지체 지표 (미계산이면 NULL - clear_bindings 상태 유지)
+    if (obj.approach_delay >= 0.0) {
+        sqlite3_bind_double(stmt, 12, obj.approach_delay);                   // aprch_dly_sec
+        sqlite3_bind_int(stmt, 13, obj.stopped_sec);                         // stop_sec
+        sqlite3_bind_int(stmt, 14, obj.stop_count);                          // stop_cnt
+    }
+    
     int rc = sqlite3_step(stmt);
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
+    
+    int64_t elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>
+                        (std::chrono::steady_clock::now() - start).count();
     
     if (rc != SQLITE_DONE) {
         logger->error("Failed to insert vehicle data: {}", sqlite3_errmsg(main_db));
         return -1;
     }
     
+    insert_count++;
+    insert_total_us += elapsed_us;
+    insert_max_us = std::max(insert_max_us, elapsed_us);
+    if (elapsed_us > 100000) {
+        logger->warn("느린 삽입: {:.1f}ms (ID={})", elapsed_us / 1000.0, vehicle_id);
+    }
+    
     logger->debug("Vehicle data inserted successfully: ID={}", vehicle_id);
     return 0;
 }
@@ -199,8 +486,19 @@ int SQLiteHandler::cleanupOldData(int retention_hours) {
 int SQLiteHandler::optimize() {
     if (!main_db) return -1;
     
-    std::lock_guard<std::mutex> lock(db_mutex);
-    return executeSQL("VACUUM");
+    // VACUUM은 DB 전체를 다시 쓰며 쓰기 잠금을 잡으므로 사용하지 않음
+    int result = checkpointPassive();
+    
+    std::lock_guard<std::mutex> lock(checkpoint_mutex);
+    if (!checkpoint_db) return result;
+    
+    char* error_msg = nullptr;
+    if (sqlite3_exec(checkpoint_db, "PRAGMA optimize", nullptr, nullptr, &error_msg) != SQLITE_OK) {
+        logger->warn("PRAGMA optimize 실패: {}", error_msg ? error_msg : "Unknown error");
+        sqlite3_free(error_msg);
+        return -1;
+    }
+    return result;
 }
 
 bool SQLiteHandler::isHealthy() const {
@@ -224,4 +522,67 @@ bool SQLiteHandler::tableExists(const std::string& table_name) const {
     sqlite3_finalize(stmt);
     
     return exists;
-}
\ No newline at end of file
+}
+
+// ========== SQLiteReadLease ==========
+
+SQLiteReadLease::SQLiteReadLease(SQLiteHandler* handler, sqlite3* db, int slot,
+                                 std::unique_lock<std::mutex> writer_lock)
+    : handler_(handler), db_(db), slot_(slot), writer_lock_(std::move(writer_lock)) {
+}
+
+SQLiteReadLease::SQLiteReadLease(SQLiteReadLease&& other) noexcept
+    : handler_(other.handler_), db_(other.db_), slot_(other.slot_),
+      writer_lock_(std::move(other.writer_lock_)), in_snapshot_(other.in_snapshot_) {
+    other.handler_ = nullptr;
+    other.db_ = nullptr;
+    other.slot_ = -1;
+    other.in_snapshot_ = false;
+}
+
+SQLiteReadLease& SQLiteReadLease::operator=(SQLiteReadLease&& other) noexcept {
+    if (this != &other) {
+        release();
+        handler_ = other.handler_;
+        db_ = other.db_;
+        slot_ = other.slot_;
+        writer_lock_ = std::move(other.writer_lock_);
+        in_snapshot_ = other.in_snapshot_;
+        other.handler_ = nullptr;
+        other.db_ = nullptr;
+        other.slot_ = -1;
+        other.in_snapshot_ = false;
+    }
+    return *this;
+}
+
+bool SQLiteReadLease::beginSnapshot() {
+    if (!db_ || in_snapshot_) return in_snapshot_;
+    
+    // DEFERRED 트랜잭션 - 첫 SELECT 시점의 WAL 스냅샷을 종료 시까지 유지
+    if (sqlite3_exec(db_, "BEGIN", nullptr, nullptr, nullptr) != SQLITE_OK) {
+        return false;
+    }
+    in_snapshot_ = true;
+    return true;
+}
+
+void SQLiteReadLease::release() {
+    if (!db_) return;
+    
+    if (in_snapshot_) {
+        sqlite3_exec(db_, "COMMIT", nullptr, nullptr, nullptr);
+        in_snapshot_ = false;
+    }
+    
+    if (slot_ >= 0 && handler_) {
+        handler_->releaseReader(slot_);
+    }
+    if (writer_lock_.owns_lock()) {
+        writer_lock_.unlock();
+    }
+    
+    handler_ = nullptr;
+    db_ = nullptr;
+    slot_ = -1;
+}
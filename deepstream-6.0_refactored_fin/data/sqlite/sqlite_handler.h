@@ -2,18 +2,21 @@
  * sqlite_handler.h
  * 
  * SQLite 데이터베이스 핸들러
- * 24시간 자동 삭제 기능을 가진 main_table만 사용
- * StatsQueryHelper를 friend class로 지정
+ * 24시간 자동 삭제 기능을 가진 vehicle_record 사용 (스키마는 sqlite_schema.h)
+ * 쓰기 전용 연결 1개 + 읽기 전용 WAL 연결 풀 (통계 쿼리가 삽입을 막지 않음)
  */
 
 #ifndef SQLITE_HANDLER_H
 #define SQLITE_HANDLER_H
 
+#include <atomic>
+#include <condition_variable>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <sqlite3.h>
 #include <string>
+#include <thread>
 #include <vector>
 #include "../../common/object_data.h"
 
@@ -23,20 +26,71 @@
 #endif
 
 // Forward declaration
-class StatsQueryHelper;
+class SQLiteHandler;
+
+/**
+ * @brief 읽기 연결 임대 (RAII)
+ *
+ * 소멸 시 스냅샷 트랜잭션을 종료하고 풀에 반납
+ * 읽기 풀이 없으면 쓰기 연결을 db_mutex로 잠가 대신 사용 (삽입과 직렬화)
+ */
+class SQLiteReadLease {
+    friend class SQLiteHandler;
+
+private:
+    SQLiteHandler* handler_ = nullptr;
+    sqlite3* db_ = nullptr;
+    int slot_ = -1;                                 // 읽기 풀 인덱스 (-1: 쓰기 연결 대체)
+    std::unique_lock<std::mutex> writer_lock_;      // 쓰기 연결 대체 시에만 보유
+    bool in_snapshot_ = false;
+
+    SQLiteReadLease(SQLiteHandler* handler, sqlite3* db, int slot,
+                    std::unique_lock<std::mutex> writer_lock);
+
+public:
+    SQLiteReadLease() = default;
+    ~SQLiteReadLease() { release(); }
+
+    SQLiteReadLease(SQLiteReadLease&& other) noexcept;
+    SQLiteReadLease& operator=(SQLiteReadLease&& other) noexcept;
+    SQLiteReadLease(const SQLiteReadLease&) = delete;
+    SQLiteReadLease& operator=(const SQLiteReadLease&) = delete;
+
+    /**
+     * @brief 읽기 트랜잭션 시작 - 이후 쿼리는 첫 SELECT 시점의 동일 스냅샷을 읽음
+     * @return 성공 시 true
+     */
+    bool beginSnapshot();
+
+    /**
+     * @brief 스냅샷 종료 및 연결 반납 (소멸자에서 자동 호출)
+     */
+    void release();
+
+    sqlite3* get() const { return db_; }
+    bool isPooled() const { return slot_ >= 0; }
+    explicit operator bool() const { return db_ != nullptr; }
+};
 
 /**
  * @brief SQLite 데이터베이스 핸들러
  * 
  * 실시간 차량 데이터 저장을 위한 SQLite 관리 클래스
- * - main_table: 차량 데이터 저장 (24시간 자동 삭제)
+ * - vehicle_record: 차량 데이터 저장 (24시간 자동 삭제)
+ * - main_table: 기존 컬럼 형식의 호환 뷰 (외부 조회용)
  * 
  * 단일 DB 파일에 모든 테이블을 관리
  * cam_id와 이미지 정보는 저장하지 않음
  * 
- * main_table 스키마:
- * - row_id: PRIMARY KEY AUTOINCREMENT
- * - kncr_cd: 차종코드
+ * 연결 구성 (WAL):
+ * - 쓰기 연결: 스트리밍 스레드 삽입 전용 (INSERT 문 재사용, 자동 체크포인트 비활성)
+ * - 읽기 풀: read_pool_size개 읽기 전용 연결 (acquireReader로 임대, 스냅샷 읽기 지원)
+ * - 체크포인트 연결: ds-sqlite 스레드가 checkpoint_interval_sec마다 PASSIVE 체크포인트
+ *   (쓰기/읽기를 기다리지 않으므로 삽입 지연 없음, 읽기 스냅샷이 남은 프레임은 다음 주기에 처리)
+ * 
+ * vehicle_record 스키마 (v2):
+ * - row_id: INTEGER PRIMARY KEY
+ * - kncr_id: 차종 번호 (vehicle_class 조회, 1~6 = KNCR_MAPPING 순서)
  * - lane_no: 차로번호
  * - turn_type_cd: 회전유형코드
  * - turn_dttn_unix_tm: 회전검지유닉스시각
@@ -50,19 +104,55 @@ class StatsQueryHelper;
  * - timestamp: DB 저장 시각 (자동)
  */
 class SQLiteHandler {
-    // StatsQueryHelper가 내부 DB에 접근할 수 있도록 friend 지정
-    friend class StatsQueryHelper;
+    // 임대 반납용
+    friend class SQLiteReadLease;
     
 private:
     // 데이터베이스 연결
-    sqlite3* main_db = nullptr;
+    sqlite3* main_db = nullptr;             // 쓰기 전용 연결
+    sqlite3_stmt* insert_stmt = nullptr;    // 재사용 INSERT 문 (쓰기 연결)
+    std::vector<sqlite3*> read_pool;        // 읽기 전용 연결 풀
+    std::vector<bool> read_in_use;
+    sqlite3* checkpoint_db = nullptr;       // 체크포인트 전용 연결
+    
+    // 차종 코드 -> vehicle_class.kncr_id (쓰기: 삽입 시 신규 코드 등록)
+    std::map<std::string, int> vehicle_class_ids;
+    mutable std::mutex class_mutex;
     
     // 데이터베이스 경로 및 파일명
     std::string db_path;
     std::string main_db_name;
     
+    // 연결 설정 (paths.sqlite_db)
+    int read_pool_size = 2;
+    int busy_timeout_ms = 2000;
+    int read_timeout_ms = 5000;
+    int checkpoint_interval_sec = 30;
+    int journal_size_limit_mb = 64;
+    
     // 뮤텍스
-    mutable std::mutex db_mutex;
+    mutable std::mutex db_mutex;            // 쓰기 연결
+    mutable std::mutex pool_mutex;          // 읽기 풀
+    std::condition_variable pool_cv;
+    mutable std::mutex checkpoint_mutex;    // 체크포인트 연결
+    
+    // 체크포인트 스레드
+    std::thread maintenance_thread;
+    std::atomic<bool> maintenance_running{false};
+    std::mutex maintenance_wait_mutex;
+    std::condition_variable maintenance_cv;
+    
+    // 통계 (삽입: db_mutex, 체크포인트: checkpoint_mutex, 읽기: pool_mutex)
+    uint64_t insert_count = 0;
+    uint64_t insert_total_us = 0;
+    int64_t insert_max_us = 0;              // 통계 출력 주기 내 최대
+    uint64_t checkpoint_count = 0;
+    uint64_t checkpoint_partial_count = 0;  // 읽기 스냅샷으로 일부만 반영된 횟수
+    int last_wal_frames = 0;
+    int last_checkpointed_frames = 0;
+    int64_t checkpoint_max_ms = 0;
+    uint64_t reader_leases = 0;
+    uint64_t reader_timeouts = 0;
     
     // 로거
     std::shared_ptr<spdlog::logger> logger;
@@ -70,9 +160,38 @@ private:
     /**
      * @brief 데이터베이스 열기
      * @param db_name 데이터베이스 파일명
+     * @param read_only 읽기 전용 연결 여부
      * @return 성공 시 데이터베이스 포인터, 실패 시 nullptr
      */
-    sqlite3* openDatabase(const std::string& db_name);
+    sqlite3* openDatabase(const std::string& db_name, bool read_only = false);
+    
+    /**
+     * @brief vehicle_class 조회 테이블 로드
+     */
+    void loadVehicleClasses();
+    
+    /**
+     * @brief 차종 번호 조회 - 없으면 vehicle_class에 등록 (쓰기 연결, db_mutex 보유 상태)
+     * @param kncr_cd 차종 코드
+     * @return 차종 번호 (등록 실패 시 VEHICLE_CLASS_UNKNOWN_ID)
+     */
+    int resolveVehicleClassId(const std::string& kncr_cd);
+    
+    /**
+     * @brief 읽기 풀 및 체크포인트 연결 열기 (스키마 생성 후)
+     */
+    void openAuxiliaryConnections();
+    
+    /**
+     * @brief 읽기 연결 반납
+     * @param slot 읽기 풀 인덱스
+     */
+    void releaseReader(int slot);
+    
+    /**
+     * @brief 체크포인트 스레드 루프
+     */
+    void maintenanceThread();
     
     /**
      * @brief SQL 실행 (범용)
@@ -81,16 +200,6 @@ private:
      */
     int executeSQL(const std::string& sql);
 
-protected:
-    /**
-     * @brief 데이터베이스 포인터 반환 (StatsQueryHelper용)
-     * @return sqlite3 포인터
-     */
-    sqlite3* getDatabase() const { 
-        std::lock_guard<std::mutex> lock(db_mutex);
-        return main_db; 
-    }
-
 public:
     /**
      * @brief 생성자
@@ -121,11 +230,44 @@ public:
     int cleanupOldData(int retention_hours = 24);
     
     /**
-     * @brief 데이터베이스 최적화 (VACUUM)
+     * @brief 차종 번호 조회 (통계 쿼리용)
+     * @param kncr_cd 차종 코드 (예: "PCAR")
+     * @return 차종 번호, 미등록 코드면 -1
+     */
+    int getVehicleClassId(const std::string& kncr_cd) const;
+    
+    /**
+     * @brief 읽기 연결 임대 (통계 쿼리용)
+     * 풀이 모두 사용 중이면 반납될 때까지 대기
+     * @param timeout_ms 대기 시간 (음수: read_timeout_ms 사용)
+     * @return 임대 객체 (실패 시 빈 객체)
+     */
+    SQLiteReadLease acquireReader(int timeout_ms = -1);
+    
+    /**
+     * @brief PASSIVE WAL 체크포인트 (쓰기/읽기 연결을 기다리지 않음)
+     * @return 성공 시 0, 실패 시 음수
+     */
+    int checkpointPassive();
+    
+    /**
+     * @brief 데이터베이스 최적화 (PASSIVE 체크포인트 + PRAGMA optimize)
+     * 삽입을 막는 VACUUM 대신 사용
      * @return 성공 시 0, 실패 시 음수
      */
     int optimize();
     
+    /**
+     * @brief 체크포인트 스레드 시작/중지
+     */
+    void startMaintenance();
+    void stopMaintenance();
+    
+    /**
+     * @brief 통계 정보 로깅 (삽입 지연, 읽기 대기, 체크포인트)
+     */
+    void logStatistics();
+    
     /**
      * @brief 데이터베이스 상태 확인
      * @return 정상이면 true
@@ -0,0 +1,285 @@
+﻿/*
+ * sqlite_schema.cpp
+ *
+ * 엣지 DB 스키마 버전 관리 및 마이그레이션 구현
+ */
+
+#include "sqlite_schema.h"
+#include "../../common/common_types.h"
+#include <chrono>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// 회전유형 조회 테이블 초기값 (DirectionType)
+const std::vector<std::pair<int, const char*>> TURN_TYPE_NAMES = {
+    {DIR_STRAIGHT, "직진"},
+    {DIR_LEFT_TURN, "좌회전"},
+    {DIR_LEFT_TURN_2, "좌회전2"},
+    {DIR_RIGHT_TURN, "우회전"},
+    {DIR_RIGHT_TURN_2, "우회전2"},
+    {DIR_U_TURN, "유턴"},
+    {DIR_REVERSE_STRAIGHT, "역방향 직진"},
+    {DIR_REVERSE_LEFT, "역방향 좌회전"},
+    {DIR_REVERSE_LEFT_2, "역방향 좌회전2"},
+    {DIR_REVERSE_RIGHT, "역방향 우회전"},
+    {DIR_REVERSE_RIGHT_2, "역방향 우회전2"},
+    {DIR_REVERSE_U_TURN, "역방향 유턴"},
+    {-1, "미확정"}
+};
+
+// 호환 뷰 - v1 main_table과 같은 컬럼/순서 (+ dataHandler 이미지 경로)
+// dataHandler MainTable이 같은 DB에 main_table로 삽입하므로 INSTEAD OF 트리거로 vehicle_record에 기록
+const char* MAIN_TABLE_VIEW_SQL = R"SQL(
+    CREATE VIEW IF NOT EXISTS main_table AS
+    SELECT r.row_id, c.kncr_cd, r.lane_no, r.turn_type_cd,
+           r.turn_dttn_unix_tm, r.turn_dttn_sped,
+           r.stln_pasg_unix_tm, r.stln_dttn_sped,
+           r.vhcl_sect_sped, r.frst_obsrvn_unix_tm,
+           r.vhcl_obsrvn_hr, r.vhcl_dttn_2k_id, r.timestamp,
+           r.img_path_nm
+    FROM vehicle_record r
+    LEFT JOIN vehicle_class c ON c.kncr_id = r.kncr_id;
+    CREATE TRIGGER IF NOT EXISTS insert_main_table INSTEAD OF INSERT ON main_table
+    BEGIN
+        INSERT OR IGNORE INTO vehicle_class(kncr_cd)
+            SELECT NEW.kncr_cd WHERE NEW.kncr_cd IS NOT NULL;
+        INSERT INTO vehicle_record(row_id, kncr_id, lane_no, turn_type_cd,
+                                   turn_dttn_unix_tm, turn_dttn_sped,
+                                   stln_pasg_unix_tm, stln_dttn_sped,
+                                   vhcl_sect_sped, frst_obsrvn_unix_tm,
+                                   vhcl_obsrvn_hr, vhcl_dttn_2k_id, timestamp,
+                                   img_path_nm)
+            VALUES (NEW.row_id,
+                    COALESCE((SELECT kncr_id FROM vehicle_class WHERE kncr_cd = NEW.kncr_cd), 0),
+                    NEW.lane_no, NEW.turn_type_cd,
+                    NEW.turn_dttn_unix_tm, NEW.turn_dttn_sped,
+                    NEW.stln_pasg_unix_tm, NEW.stln_dttn_sped,
+                    NEW.vhcl_sect_sped, NEW.frst_obsrvn_unix_tm,
+                    NEW.vhcl_obsrvn_hr, NEW.vhcl_dttn_2k_id,
+                    COALESCE(NEW.timestamp, strftime('%s', 'now')),
+                    NEW.img_path_nm);
+    END;
+)SQL";
+
+}  // namespace
+
+SQLiteSchema::SQLiteSchema(std::shared_ptr<spdlog::logger> logger)
+    : logger(std::move(logger)) {
+}
+
+int SQLiteSchema::getVersion(sqlite3* db) {
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db, "PRAGMA user_version", -1, &stmt, nullptr) != SQLITE_OK) {
+        return -1;
+    }
+    int version = (sqlite3_step(stmt) == SQLITE_ROW) ? sqlite3_column_int(stmt, 0) : -1;
+    sqlite3_finalize(stmt);
+    return version;
+}
+
+bool SQLiteSchema::exec(sqlite3* db, const std::string& sql, const char* what) const {
+    char* error_msg = nullptr;
+    if (sqlite3_exec(db, sql.c_str(), nullptr, nullptr, &error_msg) != SQLITE_OK) {
+        logger->error("스키마 작업 실패 ({}): {}", what, error_msg ? error_msg : "Unknown error");
+        sqlite3_free(error_msg);
+        return false;
+    }
+    return true;
+}
+
+bool SQLiteSchema::objectExists(sqlite3* db, const char* type, const char* name) const {
+    sqlite3_stmt* stmt = nullptr;
+    const char* sql = "SELECT 1 FROM sqlite_master WHERE type = ? AND name = ?";
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) != SQLITE_OK) {
+        return false;
+    }
+    sqlite3_bind_text(stmt, 1, type, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 2, name, -1, SQLITE_STATIC);
+    bool exists = (sqlite3_step(stmt) == SQLITE_ROW);
+    sqlite3_finalize(stmt);
+    return exists;
+}
+
+bool SQLiteSchema::columnExists(sqlite3* db, const char* table, const char* column) const {
+    sqlite3_stmt* stmt = nullptr;
+    std::string sql = std::string("PRAGMA table_info(") + table + ")";
+    if (sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+        return false;
+    }
+    bool exists = false;
+    while (!exists && sqlite3_step(stmt) == SQLITE_ROW) {
+        const unsigned char* name = sqlite3_column_text(stmt, 1);
+        exists = name && std::string(reinterpret_cast<const char*>(name)) == column;
+    }
+    sqlite3_finalize(stmt);
+    return exists;
+}
+
+bool SQLiteSchema::createObjects(sqlite3* db) const {
+    const char* tables_sql = R"SQL(
+        CREATE TABLE IF NOT EXISTS vehicle_class(
+            kncr_id INTEGER PRIMARY KEY,
+            kncr_cd TEXT NOT NULL UNIQUE
+        );
+        CREATE TABLE IF NOT EXISTS turn_type(
+            turn_type_cd INTEGER PRIMARY KEY,
+            turn_type_nm TEXT NOT NULL
+        );
+        CREATE TABLE IF NOT EXISTS vehicle_record(
+            row_id INTEGER PRIMARY KEY,
+            kncr_id INTEGER NOT NULL,
+            lane_no INTEGER,
+            turn_type_cd INTEGER,
+            turn_dttn_unix_tm INTEGER,
+            turn_dttn_sped REAL,
+            stln_pasg_unix_tm INTEGER,
+            stln_dttn_sped REAL,
+            vhcl_sect_sped REAL,
+            frst_obsrvn_unix_tm INTEGER,
+            vhcl_obsrvn_hr INTEGER,
+            vhcl_dttn_2k_id INTEGER,
+            timestamp INTEGER NOT NULL DEFAULT (strftime('%s', 'now')),
+            aprch_dly_sec REAL,
+            stop_sec INTEGER,
+            stop_cnt INTEGER,
+            img_path_nm TEXT
+        );
+        CREATE INDEX IF NOT EXISTS idx_vehicle_record_stln ON vehicle_record(stln_pasg_unix_tm);
+        CREATE INDEX IF NOT EXISTS idx_vehicle_record_timestamp ON vehicle_record(timestamp);
+        CREATE TRIGGER IF NOT EXISTS cleanup_vehicle_record AFTER INSERT ON vehicle_record
+        BEGIN
+            DELETE FROM vehicle_record WHERE timestamp < (strftime('%s', 'now') - 86400);
+        END;
+    )SQL";
+
+    if (!exec(db, tables_sql, "테이블 생성")) return false;
+
+    // 조회 테이블 초기값 (kncr_id 1~6 = 서버 kncr1~6 순서)
+    std::stringstream seed;
+    seed << "INSERT OR IGNORE INTO vehicle_class(kncr_id, kncr_cd) VALUES ("
+         << VEHICLE_CLASS_UNKNOWN_ID << ", 'UNKNOWN');";
+    for (size_t i = 0; i < KNCR_MAPPING.size(); i++) {
+        seed << "INSERT OR IGNORE INTO vehicle_class(kncr_id, kncr_cd) VALUES ("
+             << (i + 1) << ", '" << KNCR_MAPPING[i] << "');";
+    }
+    for (const auto& [code, name] : TURN_TYPE_NAMES) {
+        seed << "INSERT OR IGNORE INTO turn_type(turn_type_cd, turn_type_nm) VALUES ("
+             << code << ", '" << name << "');";
+    }
+
+    return exec(db, seed.str(), "조회 테이블 초기화");
+}
+
+bool SQLiteSchema::migrateV1ToV2(sqlite3* db) const {
+    // DeepStream이 만든 main_table에는 이미지 경로가 없고, dataHandler가 만든 것에는 있음
+    bool has_image_path = columnExists(db, "main_table", "img_path_nm");
+
+    // 매핑에 없는 과거 차종 코드는 새 번호로 등록
+    std::string copy_sql = std::string(R"SQL(
+        INSERT OR IGNORE INTO vehicle_class(kncr_cd)
+            SELECT DISTINCT kncr_cd FROM main_table WHERE kncr_cd IS NOT NULL;
+        INSERT INTO vehicle_record(row_id, kncr_id, lane_no, turn_type_cd,
+                                   turn_dttn_unix_tm, turn_dttn_sped,
+                                   stln_pasg_unix_tm, stln_dttn_sped,
+                                   vhcl_sect_sped, frst_obsrvn_unix_tm,
+                                   vhcl_obsrvn_hr, vhcl_dttn_2k_id, timestamp,
+                                   img_path_nm)
+            SELECT m.row_id, COALESCE(c.kncr_id, 0), m.lane_no, m.turn_type_cd,
+                   m.turn_dttn_unix_tm, m.turn_dttn_sped,
+                   m.stln_pasg_unix_tm, m.stln_dttn_sped,
+                   m.vhcl_sect_sped, m.frst_obsrvn_unix_tm,
+                   m.vhcl_obsrvn_hr, m.vhcl_dttn_2k_id,
+                   COALESCE(m.timestamp, strftime('%s', 'now')),
+                   )SQL") + (has_image_path ? "m.img_path_nm" : "NULL") + R"SQL(
+            FROM main_table m
+            LEFT JOIN vehicle_class c ON c.kncr_cd = m.kncr_cd;
+        DROP TRIGGER IF EXISTS cleanup_main_table;
+        DROP TABLE main_table;
+    )SQL";
+
+    return exec(db, copy_sql, "main_table 이전");
+}
+
+bool SQLiteSchema::migrateV2ToV3(sqlite3* db) const {
+    // 컬럼 추가만 수행 (기존 행은 NULL - 테이블 재작성 없음)
+    const char* alter_sql = R"SQL(
+        ALTER TABLE vehicle_record ADD COLUMN aprch_dly_sec REAL;
+        ALTER TABLE vehicle_record ADD COLUMN stop_sec INTEGER;
+        ALTER TABLE vehicle_record ADD COLUMN stop_cnt INTEGER;
+    )SQL";
+
+    return exec(db, alter_sql, "지체 컬럼 추가");
+}
+
+bool SQLiteSchema::migrateV3ToV4(sqlite3* db) const {
+    // 뷰는 컬럼이 바뀌므로 삭제 후 재생성 (뷰의 INSTEAD OF 트리거도 함께 재생성)
+    const char* alter_sql = R"SQL(
+        ALTER TABLE vehicle_record ADD COLUMN img_path_nm TEXT;
+        DROP VIEW IF EXISTS main_table;
+    )SQL";
+
+    return exec(db, alter_sql, "이미지 경로 컬럼 추가");
+}
+
+bool SQLiteSchema::migrate(sqlite3* db) {
+    if (!db) return false;
+
+    int version = getVersion(db);
+    if (version > SQLITE_SCHEMA_VERSION) {
+        logger->error("DB 스키마 버전({})이 프로그램 버전({})보다 높음 - 이전 버전 실행 불가",
+                     version, SQLITE_SCHEMA_VERSION);
+        return false;
+    }
+
+    // 버전 기록 이전 DB: main_table이 실제 테이블이면 v1
+    bool legacy_table = version < 2 && objectExists(db, "table", "main_table");
+    if (version == SQLITE_SCHEMA_VERSION && !legacy_table) {
+        // 최신 버전 - 누락 객체만 보완
+        return createObjects(db) && exec(db, MAIN_TABLE_VIEW_SQL, "호환 뷰 생성");
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    logger->info("DB 스키마 변환 시작: v{} -> v{}{}", legacy_table ? 1 : version,
+                SQLITE_SCHEMA_VERSION, legacy_table ? " (main_table 데이터 이전)" : "");
+
+    if (!exec(db, "BEGIN IMMEDIATE", "트랜잭션 시작")) return false;
+
+    // v2 테이블은 생성(IF NOT EXISTS)으로 바뀌지 않으므로 컬럼 먼저 추가
+    bool ok = true;
+    if (!legacy_table && version == 2) {
+        ok = migrateV2ToV3(db);
+    }
+    if (ok && !legacy_table && version >= 2 && version < 4) {
+        ok = migrateV3ToV4(db);
+    }
+    ok = ok && createObjects(db);
+    if (ok && legacy_table) {
+        ok = migrateV1ToV2(db);
+    }
+    ok = ok && exec(db, MAIN_TABLE_VIEW_SQL, "호환 뷰 생성");
+    ok = ok && exec(db, "PRAGMA user_version = " + std::to_string(SQLITE_SCHEMA_VERSION),
+                    "버전 기록");
+
+    if (!ok) {
+        exec(db, "ROLLBACK", "롤백");
+        logger->error("DB 스키마 변환 실패 - 기존 스키마 유지");
+        return false;
+    }
+    if (!exec(db, "COMMIT", "커밋")) {
+        exec(db, "ROLLBACK", "롤백");
+        return false;
+    }
+
+    // 기존 테이블/인덱스가 남긴 빈 페이지 회수 (1회, 파이프라인 시작 전)
+    if (legacy_table) {
+        exec(db, "VACUUM", "빈 페이지 회수");
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>
+                  (std::chrono::steady_clock::now() - start);
+    logger->info("DB 스키마 변환 완료: v{} ({}ms)", SQLITE_SCHEMA_VERSION, elapsed.count());
+    return true;
+}
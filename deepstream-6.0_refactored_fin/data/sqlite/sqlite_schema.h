@@ -0,0 +1,106 @@
+﻿/*
+ * sqlite_schema.h
+ *
+ * 엣지 DB 스키마 버전 관리 및 마이그레이션
+ * PRAGMA user_version으로 버전을 기록하고 시작 시 최신 버전으로 변환
+ */
+
+#ifndef SQLITE_SCHEMA_H
+#define SQLITE_SCHEMA_H
+
+#include <memory>
+#include <sqlite3.h>
+#include <string>
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+// 현재 스키마 버전 (PRAGMA user_version)
+// - 1: main_table (kncr_cd TEXT, 보조 인덱스 5개) - 버전 기록 이전 DB는 0으로 읽힘
+// - 2: vehicle_record (차종 정수 코드) + vehicle_class/turn_type 조회 테이블 + main_table 호환 뷰
+// - 3: vehicle_record 지체 컬럼 추가 (aprch_dly_sec, stop_sec, stop_cnt)
+// - 4: vehicle_record 이미지 경로 컬럼(img_path_nm) + main_table 뷰 INSTEAD OF INSERT 트리거
+const int SQLITE_SCHEMA_VERSION = 4;
+
+// 차종 미확인 코드 (getVehicleTypeCode의 "UNKNOWN")
+const int VEHICLE_CLASS_UNKNOWN_ID = 0;
+
+/**
+ * @brief SQLite 스키마 생성/마이그레이션
+ *
+ * 스키마 v4:
+ * - vehicle_class(kncr_id, kncr_cd): 차종 조회 테이블 (1~6은 KNCR_MAPPING 순서 = 서버 kncr1~6)
+ * - turn_type(turn_type_cd, turn_type_nm): 회전유형 조회 테이블 (DirectionType)
+ * - vehicle_record: 차량 데이터 (차종/회전/차로 모두 정수, 24시간 자동 삭제)
+ *   인덱스는 통계 범위 조회용 stln_pasg_unix_tm, 자동 삭제용 timestamp 두 개만 유지
+ *   지체 컬럼은 지체 산출 비활성 시 NULL
+ * - main_table: 기존 컬럼 그대로 보여주는 호환 뷰 (외부 조회 도구용)
+ *   dataHandler MainTable의 삽입은 INSTEAD OF 트리거가 차종 코드를 kncr_id로 바꿔 vehicle_record에 기록
+ *
+ * 마이그레이션은 한 트랜잭션으로 수행되어 실패 시 기존 테이블이 그대로 남음
+ */
+class SQLiteSchema {
+private:
+    std::shared_ptr<spdlog::logger> logger;
+
+    /**
+     * @brief SQL 실행
+     * @param db 데이터베이스 연결
+     * @param sql SQL 문 (여러 문 가능)
+     * @param what 로그용 작업 이름
+     * @return 성공 시 true
+     */
+    bool exec(sqlite3* db, const std::string& sql, const char* what) const;
+
+    /**
+     * @brief 테이블/뷰 존재 확인
+     * @param type "table" 또는 "view"
+     */
+    bool objectExists(sqlite3* db, const char* type, const char* name) const;
+
+    /**
+     * @brief 테이블 컬럼 존재 확인 (PRAGMA table_info)
+     */
+    bool columnExists(sqlite3* db, const char* table, const char* column) const;
+
+    /**
+     * @brief 최신 버전 객체 생성 (IF NOT EXISTS - 반복 호출 가능)
+     */
+    bool createObjects(sqlite3* db) const;
+
+    /**
+     * @brief main_table(v1) 데이터를 vehicle_record로 이전 후 호환 뷰로 교체
+     * dataHandler MainTable이 만든 main_table은 img_path_nm 컬럼이 있으므로 함께 이전
+     */
+    bool migrateV1ToV2(sqlite3* db) const;
+
+    /**
+     * @brief vehicle_record에 지체 컬럼 추가
+     */
+    bool migrateV2ToV3(sqlite3* db) const;
+
+    /**
+     * @brief vehicle_record에 이미지 경로 컬럼 추가 및 호환 뷰 재생성
+     */
+    bool migrateV3ToV4(sqlite3* db) const;
+
+public:
+    explicit SQLiteSchema(std::shared_ptr<spdlog::logger> logger);
+
+    /**
+     * @brief 스키마를 최신 버전으로 생성/변환 (쓰기 연결에서 호출)
+     * @param db 데이터베이스 연결
+     * @return 성공 시 true
+     */
+    bool migrate(sqlite3* db);
+
+    /**
+     * @brief 스키마 버전 조회
+     * @return PRAGMA user_version 값 (실패 시 -1)
+     */
+    static int getVersion(sqlite3* db);
+};
+
+#endif // SQLITE_SCHEMA_H
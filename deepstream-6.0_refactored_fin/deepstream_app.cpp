@@ -65,7 +65,9 @@
 // 프로젝트 모듈 헤더
 #include "analytics/statistics/stats_generator.h"         // 교통 통계 생성 및 집계 모듈
 #include "common/common_types.h"                          // 공통 타입 정의
+#include "common/lane_array.h"                            // 차로 인덱스 고정 배열
 #include "common/object_data.h"                           // 객체 데이터 구조체 정의
+#include "data/checkpoint/checkpoint_manager.h"          // 분석 상태 체크포인트
 #include "data/redis/channel_types.h"                     // Redis 채널 타입 정의
 #include "data/redis/redis_client.h"                      // Redis 클라이언트 클래스
 #include "data/sqlite/sqlite_handler.h"                   // SQLite 데이터베이스 핸들러
@@ -77,9 +79,14 @@
 #include "image/image_storage.h"                          // 이미지 저장 모듈
 #include "monitoring/car_presence.h"                      // 차량 Presence 모듈
 #include "monitoring/pedestrian_presence.h"               // 보행자 Presence 모듈
+#include "roi_module/inference_region.h"                  // ROI 기반 추론 영역 계산
 #include "roi_module/roi_handler.h"                       // ROI 처리 모듈
 #include "server/manager/system_manager.h"                // 시스템 전체 관리 및 조정
+#include "server/pipeline/nvinfer_interval_sink.h"         // nvinfer 추론 간격 적용
+#include "utils/bounded_map.h"                            // 용량 제한 추적 상태 맵
 #include "utils/config_manager.h"                         // 설정 관리자
+#include "utils/heartbeat_registry.h"                     // 스레드 하트비트/정지 감시
+#include "utils/thread_role.h"                            // 스레드 이름/역할 설정 (CPU 고정, 스케줄링)
 
 // NVIDIA 라이브러리
 #include "nvbufsurface.h"                                 // NVIDIA 버퍼 서피스 API
@@ -101,10 +108,25 @@
 
 // Global variables
 static std::shared_ptr<spdlog::logger> logger;
-static std::map<int, obj_data> det_obj;
+static BoundedMap<int, obj_data> det_obj;
 static std::mutex global_mutex;
 static int previous_time = -1;
 
+// 체크포인트 복원 객체 (복원용 음수 ID - 새 추적 ID가 위치 기반으로 이어받음)
+static std::map<int, obj_data> restored_objects;
+static int restored_expire_time = 0;
+static double restored_adopt_radius_px = 80.0;
+static bool checkpoint_restored = false;
+static const int RESTORED_OBJECT_TTL = 10;      // 첫 버퍼 이후 이관 대기 시간 (초)
+
+// 차로별 프레임 집계 (ROIHandler 생성 시 차로 수로 크기 결정, 프레임마다 값만 초기화)
+static LaneArray<int> lane_vehicle_counts;
+static LaneArray<double> lane_speed_sums;
+static LaneArray<int> lane_speed_samples;
+
+// 스트리밍 스레드 하트비트 (첫 버퍼에서 등록, cleanupModules에서 해제)
+static HeartbeatHandle stream_heartbeat;
+
 // ConfigManager 캐시 변수
 static bool cached_vehicle_2k_enabled = false;
 static bool cached_vehicle_4k_enabled = false;
@@ -135,6 +157,7 @@ static bool initializeModules(AppCtx *appCtx);
 static void cleanupModules();
 static void cacheProcessMetaConfigs();
 static void discardDeletedId();
+static void registerCheckpointSections(CheckpointManager* checkpoint_mgr);
 
 /**
  * @brief    Add the (nvmsgconv->nvmsgbroker) sink-bin to the
@@ -638,6 +661,133 @@ done:
     return ret;
 }
 
+/**
+ * Function to create nvdspreprocess element that restricts primary inference
+ * to the bounding rectangle(s) of all loaded ROI polygons.
+ * nvinfer (input-tensor-meta) maps detections back to frame coordinates,
+ * so downstream processing is unchanged. Model input parameters are taken
+ * from the primary GIE config file. Returns NULL to keep full-frame
+ * inference when disabled, when there is no area gain, or when the setup is
+ * rejected at startup (batch-size mismatch, missing custom library, config
+ * errors). There is no runtime fallback: once the element is linked, its
+ * errors stop the pipeline like any other element error.
+ */
+static GstElement *
+create_roi_preprocess(NvDsConfig *config, GstElement *primary_gie)
+{
+    auto& cfg = ConfigManager::getInstance();
+    if (!cfg.isInferenceRegionEnabled() || !roi_handler)
+    {
+        return NULL;
+    }
+
+    try
+    {
+        const std::string base_key = "processing_modules.inference_region";
+
+        InferenceRegionParams region_params;
+        region_params.margin_px = cfg.getInt(base_key + ".margin_px", 32);
+        region_params.top_margin_px = cfg.getInt(base_key + ".top_margin_px", 160);
+        region_params.max_rects = cfg.getInt(base_key + ".max_rects", 1);
+        region_params.max_coverage = cfg.getDouble(base_key + ".max_coverage", 0.85);
+
+        int frame_width = config->streammux_config.pipeline_width;
+        int frame_height = config->streammux_config.pipeline_height;
+        std::vector<RegionRect> regions = computeInferenceRegions(roi_handler->getAllROIs(),
+                                                                  frame_width, frame_height,
+                                                                  region_params);
+        if (regions.empty())
+        {
+            logger->info("ROI 영역 추론 미적용 - ROI 없음 또는 면적 이득 없음 (전체 프레임 추론)");
+            return NULL;
+        }
+
+        // 모델 입력 규격은 pgie 설정 파일 기준
+        PreprocessParams preprocess_params;
+        preprocess_params.gie_unique_id = config->primary_gie_config.unique_id;
+        preprocess_params.custom_lib_path = cfg.getString(base_key + ".preprocess.custom_lib_path");
+
+        const char *pgie_config_path = config->primary_gie_config.config_file_path;
+        std::ifstream pgie_in(pgie_config_path ? pgie_config_path : "");
+        if (!pgie_in.is_open())
+        {
+            logger->error("pgie 설정 파일 열기 실패: {} - 전체 프레임 추론",
+                          pgie_config_path ? pgie_config_path : "(없음)");
+            return NULL;
+        }
+        std::stringstream pgie_content;
+        pgie_content << pgie_in.rdbuf();
+
+        std::string error;
+        if (!parseNvInferConfig(pgie_content.str(), preprocess_params.model, error))
+        {
+            logger->error("pgie 설정 파싱 실패: {} - 전체 프레임 추론", error);
+            return NULL;
+        }
+        if (preprocess_params.model.tensor_name.empty())
+        {
+            // ONNX/엔진 모델은 pgie 설정에 입력 이름이 없음
+            preprocess_params.model.tensor_name = cfg.getString(base_key + ".preprocess.tensor_name", "input_1");
+        }
+
+        // nvinfer 배치 = 영역 수 x 소스 수 (불일치 시 nvinfer 텐서 입력 실패)
+        guint pgie_batch = 0;
+        g_object_get(G_OBJECT(primary_gie), "batch-size", &pgie_batch, NULL);
+        int required_batch = static_cast<int>(regions.size()) * std::max(1, config->num_source_sub_bins);
+        if (static_cast<int>(pgie_batch) != required_batch)
+        {
+            logger->error("ROI 영역 추론 배치 불일치 - 필요: {} (영역 {} x 소스 {}), pgie batch-size: {} - 전체 프레임 추론",
+                          required_batch, regions.size(), std::max(1, config->num_source_sub_bins), pgie_batch);
+            return NULL;
+        }
+
+        if (!checkPreprocessLibrary(preprocess_params.custom_lib_path, error))
+        {
+            logger->error("nvdspreprocess 커스텀 라이브러리 확인 실패: {} - 전체 프레임 추론", error);
+            return NULL;
+        }
+
+        long long region_area = 0;
+        for (const auto& r : regions)
+        {
+            region_area += r.area();
+            RegionTransform t = computeRegionTransform(r, preprocess_params.model.width,
+                                                       preprocess_params.model.height);
+            logger->info("추론 영역: ({}, {}) {}x{}, 스케일: {:.3f}", r.left, r.top, r.width, r.height, t.scale);
+        }
+
+        std::string config_file = cfg.getFullPath(cfg.getString(base_key + ".preprocess.config_file"));
+        std::ofstream out(config_file);
+        if (!out.is_open())
+        {
+            logger->error("nvdspreprocess 설정 파일 생성 실패: {} - 전체 프레임 추론", config_file);
+            return NULL;
+        }
+        out << buildPreprocessConfig(regions, config->num_source_sub_bins, preprocess_params);
+        out.close();
+
+        GstElement *preprocess = gst_element_factory_make("nvdspreprocess", "roi_preprocess");
+        if (!preprocess)
+        {
+            logger->error("nvdspreprocess 엘리먼트 생성 실패 - 전체 프레임 추론");
+            return NULL;
+        }
+        g_object_set(G_OBJECT(preprocess), "config-file", config_file.c_str(), NULL);
+
+        logger->info("ROI 영역 추론 적용 - 영역: {}개, 프레임 대비 면적: {:.1f}%, 입력: {}x{}x{}, 설정: {}",
+                     regions.size(),
+                     100.0 * region_area / (static_cast<double>(frame_width) * frame_height),
+                     preprocess_params.model.channels, preprocess_params.model.height,
+                     preprocess_params.model.width, config_file);
+        return preprocess;
+    }
+    catch (const std::exception& e)
+    {
+        logger->error("ROI 영역 추론 설정 실패: {} - 전체 프레임 추론", e.what());
+        return NULL;
+    }
+}
+
 /**
  * Function to create common elements(Primary infer, tracker, secondary infer)
  * of the pipeline. These components operate on muxed data from all the
@@ -718,6 +868,18 @@ create_common_elements(NvDsConfig *config, NvDsPipeline *pipeline,
         {
             *src_elem = pipeline->common_elements.primary_gie_bin.bin;
         }
+
+        // ROI 영역 추론 (nvdspreprocess -> nvinfer 텐서 입력)
+        GstElement *roi_preprocess = create_roi_preprocess(
+            config, pipeline->common_elements.primary_gie_bin.primary_gie);
+        if (roi_preprocess)
+        {
+            gst_bin_add(GST_BIN(pipeline->pipeline), roi_preprocess);
+            NVGSTDS_LINK_ELEMENT(roi_preprocess, *sink_elem);
+            g_object_set(G_OBJECT(pipeline->common_elements.primary_gie_bin.primary_gie),
+                         "input-tensor-meta", TRUE, NULL);
+            *sink_elem = roi_preprocess;
+        }
         NVGSTDS_ELEM_ADD_PROBE(pipeline->common_elements.primary_bbox_buffer_probe_id,
                                pipeline->common_elements.primary_gie_bin.bin, "src",
                                gie_primary_processing_done_buf_prob, GST_PAD_PROBE_TYPE_BUFFER,
@@ -823,11 +985,19 @@ static bool initializeModules(AppCtx *appCtx) {
         logger->info("ConfigManager initialized successfully from: {}", config_path);
 
         cacheProcessMetaConfigs();
+
+        // 1-1. 추적 객체 메모리 예산 (트래커 ID 누수/혼잡 장면에서 LRU 축출)
+        det_obj.attachBudget("tracked_objects", 4096);
         
         // 2. Create ROIHandler (DeepStream 의존성)
         roi_handler = std::make_unique<ROIHandler>(*appCtx);  
         logger->info("ROIHandler created successfully");
 
+        int lane_count = static_cast<int>(roi_handler->lane_roi.size());
+        lane_vehicle_counts.reset(lane_count);
+        lane_speed_sums.reset(lane_count);
+        lane_speed_samples.reset(lane_count);
+
         // 3. Create image processing modules (SystemManager보다 먼저 생성)
         image_cropper = std::make_unique<ImageCropper>();
         logger->info("ImageCropper created successfully");
@@ -896,6 +1066,13 @@ static bool initializeModules(AppCtx *appCtx) {
             }
         }
 
+        // 8-1. 체크포인트 섹션 등록 (det_obj, 4K 캡처 상태 - 복원은 첫 버퍼 처리 시)
+        if (system_manager && system_manager->getCheckpointManager()) {
+            registerCheckpointSections(system_manager->getCheckpointManager());
+            restored_adopt_radius_px = config_manager.getDouble("checkpoint.adopt_radius_px", 80.0);
+            logger->info("Checkpoint sections registered - adopt radius: {:.0f}px", restored_adopt_radius_px);
+        }
+
         // 9. Start SystemManager (통계 타이머 등 시작)
         if (system_manager) {
             system_manager->start();
@@ -916,9 +1093,7 @@ static bool initializeModules(AppCtx *appCtx) {
         if (system_manager->getSpecialSiteAdapter() && 
             system_manager->getSpecialSiteAdapter()->isActive()) {
             auto adapter = system_manager->getSpecialSiteAdapter();
-            auto config = adapter->getConfig();
-            logger->info("  Special Site: 활성 ({})", 
-                        config.straight_left ? "직진/좌회전" : "우회전");
+            logger->info("  Special Site: 활성 ({})", adapter->getModeDescription());
         }
         logger->info("=== All modules initialized successfully ===");
         return true;
@@ -944,6 +1119,9 @@ static void cleanupModules() {
             start = end;
         };
         
+        // 0. 스트리밍 스레드 하트비트 해제 (파이프라인 정지 후 정지 오탐 방지)
+        stream_heartbeat.release();
+        
         // 1. Vehicle Processor 먼저 정리 (Redis/SQLite 사용 중지)
         vehicle_processor_2k.reset();
         log_time("VehicleProcessor2K");
@@ -1061,6 +1239,82 @@ static void setBboxTextColor(AppCtx *appCtx, NvDsObjectMeta *obj, int object_id)
     }
 }
 
+// 체크포인트 섹션 등록 (det_obj, VehicleProcessor4K 캡처 상태)
+static void registerCheckpointSections(CheckpointManager* checkpoint_mgr) {
+    checkpoint_mgr->registerSection(CheckpointSection::OBJECTS, "추적 객체",
+        [](CheckpointWriter& writer) {
+            std::lock_guard<std::mutex> lock(global_mutex);
+            writer.put<uint32_t>(static_cast<uint32_t>(det_obj.size()));
+            for (const auto& [id, obj] : det_obj) {
+                writeObjData(writer, obj);
+            }
+        },
+        [](CheckpointReader& reader, const CheckpointContext&) {
+            std::lock_guard<std::mutex> lock(global_mutex);
+            uint32_t count = reader.get<uint32_t>();
+            for (uint32_t i = 0; i < count; i++) {
+                obj_data obj = readObjData(reader);
+                restored_objects[checkpointRestoredId(obj.object_id)] = std::move(obj);
+            }
+            restored_expire_time = 0;   // 첫 이관 시도 시각부터 TTL 적용
+            return count > 0;
+        });
+
+    if (vehicle_processor_4k) {
+        checkpoint_mgr->registerSection(CheckpointSection::CAPTURE_4K, "4K 캡처 상태",
+            [](CheckpointWriter& writer) {
+                std::lock_guard<std::mutex> lock(global_mutex);
+                vehicle_processor_4k->saveCheckpoint(writer);
+            },
+            [](CheckpointReader& reader, const CheckpointContext& context) {
+                std::lock_guard<std::mutex> lock(global_mutex);
+                return vehicle_processor_4k->restoreCheckpoint(reader, context);
+            });
+    }
+}
+
+// 새 추적 ID에 가장 가까운 같은 클래스의 복원 객체 이관 (global_mutex 보유 상태에서 호출)
+static void adoptRestoredObject(int id, int class_id, const ObjPoint& current_pos, int current_time) {
+    if (restored_expire_time == 0) {
+        restored_expire_time = current_time + RESTORED_OBJECT_TTL;
+    }
+    if (current_time > restored_expire_time) {
+        logger->info("체크포인트 복원 객체 만료 - 미이관 {}개 폐기", restored_objects.size());
+        restored_objects.clear();
+        return;
+    }
+
+    auto best = restored_objects.end();
+    double best_dist = restored_adopt_radius_px;
+    for (auto it = restored_objects.begin(); it != restored_objects.end(); ++it) {
+        if (it->second.class_id != class_id) continue;
+        double dist = std::hypot(it->second.last_pos.x - current_pos.x,
+                                 it->second.last_pos.y - current_pos.y);
+        if (dist <= best_dist) {
+            best_dist = dist;
+            best = it;
+        }
+    }
+    if (best == restored_objects.end()) return;
+
+    int restored_id = best->first;
+    obj_data adopted = std::move(best->second);
+    restored_objects.erase(best);
+
+    // 재시작 공백 구간은 속도 계산에서 제외
+    adopted.object_id = id;
+    adopted.last_pos = current_pos;
+    adopted.prev_pos = current_pos;
+    adopted.prev_pos_time = current_time;
+    det_obj[id] = std::move(adopted);
+
+    if (vehicle_processor_4k) {
+        vehicle_processor_4k->adoptCaptureState(restored_id, id);
+    }
+
+    logger->debug("복원 객체 이관 - ID {} -> {} ({:.0f}px)", -1 - restored_id, id, best_dist);
+}
+
 // Main processing function
 static void process_meta(AppCtx *appCtx, NvDsBatchMeta *batch_meta, guint index, GstBuffer *buf) {
     try {
@@ -1070,6 +1324,7 @@ static void process_meta(AppCtx *appCtx, NvDsBatchMeta *batch_meta, guint index,
         
         if (!gst_buffer_map(buf, &in_map_info, GST_MAP_READ)) {
             logger->error("Failed to map gst buffer!");
+            stream_heartbeat.beat(HB_STAGE_WAIT_BUFFER);
             return;
         }
 
@@ -1082,6 +1337,9 @@ static void process_meta(AppCtx *appCtx, NvDsBatchMeta *batch_meta, guint index,
             previous_time = current_time;
         }
 
+        // 추적 상태 LRU 갱신 기준 프레임
+        MemoryBudget::advanceFrame();
+
         // Process deleted tracker IDs
         discardDeletedId();
 
@@ -1090,6 +1348,19 @@ static void process_meta(AppCtx *appCtx, NvDsBatchMeta *batch_meta, guint index,
             cacheProcessMetaConfigs();
         }
 
+        // 첫 버퍼 1회 처리
+        // - 스트리밍 스레드 이름/역할 설정 (텔레메트리 식별, CPU 고정) 및 하트비트 등록
+        // - 체크포인트 복원 (엔진 로딩 후 실제 처리 재개 시각 기준)
+        if (!checkpoint_restored) {
+            enterThreadRole("ds-stream");
+            stream_heartbeat = HeartbeatRegistry::getInstance().registerThread("ds-stream", 10000);
+            if (system_manager) {
+                system_manager->restoreCheckpoint(current_time);
+            }
+            checkpoint_restored = true;
+        }
+        stream_heartbeat.beat(HB_STAGE_FRAME);
+
         // 이미지 캡처 처리 (통합 - 매 프레임마다)
         // IncidentDetector의 요청을 ImageCaptureHandler가 처리
         if (system_manager) {
@@ -1099,14 +1370,50 @@ static void process_meta(AppCtx *appCtx, NvDsBatchMeta *batch_meta, guint index,
             }
         }
 
-        // 차로별 차량 수 계산을 위한 맵
-        std::map<int, int> lane_vehicle_counts;
+        // 차로별 차량 수 / 속도 합계·샘플 수 (실시간 LOS용) - 값만 초기화
+        lane_vehicle_counts.fill(0);
+        lane_speed_sums.fill(0.0);
+        lane_speed_samples.fill(0);
+
+        // 추론 간격 제어용 프레임 활동 (차량/이동 차량/보행자 수)
+        auto inference_controller = system_manager ? system_manager->getInferenceController() : nullptr;
+        double moving_speed_kmh = inference_controller ? inference_controller->getMovingSpeedKmh() : 0.0;
+        int frame_vehicles = 0;
+        int frame_moving_vehicles = 0;
+        int frame_pedestrians = 0;
+
+        // 프레임 누락 감지 - 누락 직후 초 경계 속도 갱신은 보류 (prev_pos 유지로 2초 창 계산)
+        auto frame_gap_detector = system_manager ? system_manager->getFrameGapDetector() : nullptr;
+        bool speed_update = second_changed &&
+            !(frame_gap_detector && frame_gap_detector->shouldDeferSpeedUpdate(current_time));
+
+        // 주기 도착 분석 - 정지선 통과(실측) 차량만 도착으로 전달
+        auto arrival_monitor = system_manager ? system_manager->getArrivalMonitor() : nullptr;
+
+        // split failure 감지 - 정지선 구역 점유 차로 비트
+        auto split_failure_detector = system_manager ? system_manager->getSplitFailureDetector() : nullptr;
+        uint32_t stop_zone_mask = 0;
+
+        // 차로 변경 집계 - 유지 필터 통과 차로와 비교
+        auto lane_change_counter = (system_manager && system_manager->getStatsGenerator())
+            ? system_manager->getStatsGenerator()->getLaneChangeCounter() : nullptr;
+
+        // PET 감시 - 횡단보도 셀 점유 (배치 단위 단조 시각)
+        auto pet_monitor = system_manager ? system_manager->getPETMonitor() : nullptr;
+        int64_t pet_now_ms = pet_monitor ? std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count() : 0;
 
         // Process each frame in the batch
         for (NvDsMetaList *l_frame = batch_meta->frame_meta_list; l_frame != NULL; l_frame = l_frame->next) {
             NvDsFrameMeta *frame_meta = (NvDsFrameMeta *) l_frame->data;
             if (!frame_meta) continue;
 
+            // 누락 직후 프레임은 직전 위치를 신뢰할 수 없으므로 정지선 통과 판정 보류
+            bool frame_gap = frame_gap_detector &&
+                frame_gap_detector->observeFrame(frame_meta->source_id, frame_meta->frame_num,
+                                                 frame_meta->buf_pts, current_time) &&
+                frame_gap_detector->suspendStopLineOnGap();
+
             // Process each object in the frame
             for (NvDsMetaList *l_obj = frame_meta->obj_meta_list; l_obj != NULL; l_obj = l_obj->next) {
                 NvDsObjectMeta *obj_meta = (NvDsObjectMeta *) l_obj->data;
@@ -1120,9 +1427,11 @@ static void process_meta(AppCtx *appCtx, NvDsBatchMeta *batch_meta, guint index,
                     std::lock_guard<std::mutex> lock(global_mutex);
                     
                     // 새 객체인지 판단
+                    bool new_object = false;
                     if (det_obj.find(id) == det_obj.end()) {
                         det_obj[id].object_id = id;
                         det_obj[id].first_detected_time = current_time;
+                        new_object = true;
                     }
                     
                     // 기본 정보 업데이트 (process_meta가 담당)
@@ -1139,6 +1448,11 @@ static void process_meta(AppCtx *appCtx, NvDsBatchMeta *batch_meta, guint index,
                     // 현재 위치 계산
                     ObjPoint current_pos = getBottomCenter(obj_box);
                     
+                    // 재시작 전 추적 객체 이관 (체크포인트 복원 시)
+                    if (new_object && !restored_objects.empty()) {
+                        adoptRestoredObject(id, class_id, current_pos, current_time);
+                    }
+                    
                     // 차량인 경우 처리
                     if (isVehicleClass(class_id)) {
                         // 차로 판별 및 카운트
@@ -1146,15 +1460,34 @@ static void process_meta(AppCtx *appCtx, NvDsBatchMeta *batch_meta, guint index,
                         if (lane > 0) {
                             lane_vehicle_counts[lane]++;
                         }
+                        if (split_failure_detector) {
+                            stop_zone_mask |= split_failure_detector->zoneBit(current_pos);
+                        }
+                        if (lane_change_counter) {
+                            lane_change_counter->observe(det_obj[id], lane, current_pos);
+                        }
+                        
+                        // 누락 구간을 가로지르는 이동은 통과로 보지 않음 (이번 프레임은 위치만 갱신)
+                        if (frame_gap) {
+                            det_obj[id].last_pos = {-1, -1};
+                        }
                         
                         // Process vehicle in 2K mode if enabled
                         if (vehicle_processor_2k && cached_vehicle_2k_enabled) {
+                            bool was_stop_line_pass = det_obj[id].stop_line_pass;
                             obj_data processed = vehicle_processor_2k->processVehicle(
-                                det_obj[id], obj_box, current_pos, current_time, second_changed, surface);
+                                det_obj[id], obj_box, current_pos, current_time, speed_update, surface);
                             
                             // 반환된 데이터 병합
                             det_obj[id] = processed;
                             
+                            if (arrival_monitor && !was_stop_line_pass && processed.stop_line_pass) {
+                                arrival_monitor->onStopLineCrossing(processed.lane, processed.stop_pass_time,
+                                                                    processed.approach_delay,
+                                                                    processed.stopped_sec,
+                                                                    processed.stop_count);
+                            }
+                            
                             // 데이터 전송 완료 체크
                             if (processed.turn_pass && !processed.data_sent_2k) {
                                 det_obj[id].data_sent_2k = true;
@@ -1165,7 +1498,8 @@ static void process_meta(AppCtx *appCtx, NvDsBatchMeta *batch_meta, guint index,
                         // Process vehicle in 4K mode if enabled
                         if (vehicle_processor_4k && cached_vehicle_4k_enabled) {
                             obj_data processed = vehicle_processor_4k->processVehicle(
-                                det_obj[id], obj_box, current_pos, current_time, second_changed, surface);
+                                det_obj[id], obj_box, current_pos, current_time, second_changed, speed_update,
+                                surface);
                             
                             // 반환된 데이터 병합
                             det_obj[id] = processed;
@@ -1180,6 +1514,18 @@ static void process_meta(AppCtx *appCtx, NvDsBatchMeta *batch_meta, guint index,
                         // last_pos 업데이트 (다음 프레임을 위해)
                         det_obj[id].last_pos = current_pos;
 
+                        // 차로별 속도 누적 (실시간 LOS용)
+                        if (lane > 0 && isValidSpeed(det_obj[id].speed)) {
+                            lane_speed_sums[lane] += det_obj[id].speed;
+                            lane_speed_samples[lane]++;
+                        }
+
+                        // 속도 미계산 차량은 이동으로 간주 (추론 간격 완화 방지)
+                        frame_vehicles++;
+                        if (!isValidSpeed(det_obj[id].speed) || det_obj[id].speed >= moving_speed_kmh) {
+                            frame_moving_vehicles++;
+                        }
+
                         // Process vehicle for incident detection (last_pos 업데이트 후)
                         if (system_manager) {
                             auto incident_detector = system_manager->getIncidentDetector();
@@ -1187,6 +1533,10 @@ static void process_meta(AppCtx *appCtx, NvDsBatchMeta *batch_meta, guint index,
                                 incident_detector->processVehicle(id, det_obj[id], obj_box, surface, current_time);
                             }
                         }
+
+                        if (pet_monitor) {
+                            pet_monitor->observe(id, true, det_obj[id].dir_out, current_pos, pet_now_ms);
+                        }
                     }
                     // 보행자인 경우 처리
                     else if (isPedestrianClass(class_id)) {
@@ -1207,6 +1557,7 @@ static void process_meta(AppCtx *appCtx, NvDsBatchMeta *batch_meta, guint index,
                         
                         // last_pos 업데이트 (다음 프레임을 위해)
                         det_obj[id].last_pos = current_pos;
+                        frame_pedestrians++;
 
                         // Process pedestrian for incident detection (last_pos 업데이트 후)
                         if (system_manager) {
@@ -1215,6 +1566,10 @@ static void process_meta(AppCtx *appCtx, NvDsBatchMeta *batch_meta, guint index,
                                 incident_detector->processPedestrian(id, det_obj[id], obj_box, surface, current_time);
                             }
                         }
+
+                        if (pet_monitor) {
+                            pet_monitor->observe(id, false, -1, current_pos, pet_now_ms);
+                        }
                     }
                 }
                 
@@ -1231,12 +1586,36 @@ static void process_meta(AppCtx *appCtx, NvDsBatchMeta *batch_meta, guint index,
             }
         }
 
+        // 실시간 LOS 모니터에 프레임 데이터 누적 (매 프레임)
+        if (system_manager) {
+            auto los_monitor = system_manager->getLOSMonitor();
+            if (los_monitor) {
+                los_monitor->updateFrame(lane_vehicle_counts, lane_speed_sums, lane_speed_samples);
+            }
+        }
+
+        // 정지선 구역 점유 누적 (매 프레임)
+        if (split_failure_detector) {
+            split_failure_detector->updateFrame(stop_zone_mask, current_time);
+        }
+
+        // PET 감시 - 미관측 객체 셀 이탈 처리 및 이벤트 전송 (매 프레임)
+        if (pet_monitor) {
+            pet_monitor->flush(pet_now_ms, current_time);
+        }
+
+        // 추론 간격 제어기에 프레임 활동 누적 (매 프레임)
+        if (inference_controller) {
+            inference_controller->observeFrame(frame_vehicles, frame_moving_vehicles, frame_pedestrians);
+        }
+
         // Presence 모듈 업데이트를 위한 위치 정보 수집 (매 프레임)
         if (system_manager) {
             std::map<int, ObjPoint> vehicle_positions;
             std::map<int, ObjPoint> pedestrian_positions;
             
             // det_obj에서 현재 프레임의 차량/보행자 위치 수집
+            stream_heartbeat.beat(HB_STAGE_LOCK_WAIT);
             {
                 std::lock_guard<std::mutex> lock(global_mutex);
                 for (const auto& [id, obj] : det_obj) {
@@ -1254,11 +1633,13 @@ static void process_meta(AppCtx *appCtx, NvDsBatchMeta *batch_meta, guint index,
             }        
             
             // Presence 모듈 업데이트 (신호와 무관하게 매 프레임 호출)
+            stream_heartbeat.beat(HB_STAGE_FRAME);
             system_manager->updatePresenceModules(vehicle_positions, pedestrian_positions, current_time);
         }
 
         // 매 초마다 SystemManager 업데이트 (신호 변경 체크 및 대기행렬 업데이트)
         if (second_changed && system_manager) {
+            stream_heartbeat.beat(HB_STAGE_PER_SECOND);
             system_manager->updatePerSecondData(lane_vehicle_counts, current_time);
         }
         
@@ -1268,9 +1649,11 @@ static void process_meta(AppCtx *appCtx, NvDsBatchMeta *batch_meta, guint index,
         }
         
         gst_buffer_unmap(buf, &in_map_info);
+        stream_heartbeat.beat(HB_STAGE_WAIT_BUFFER);
         
     } catch (const std::exception& e) {
         logger->error("Error in process_meta: {}", e.what());
+        stream_heartbeat.beat(HB_STAGE_WAIT_BUFFER);
     }
 }
 
@@ -1634,6 +2017,14 @@ create_pipeline(AppCtx *appCtx,
         goto done;
     }
 
+    // 추론 간격 제어기에 nvinfer 연결 (모듈 초기화가 파이프라인 생성보다 먼저 수행됨)
+    if (system_manager && system_manager->getInferenceController() &&
+        pipeline->common_elements.primary_gie_bin.primary_gie)
+    {
+        system_manager->getInferenceController()->attachSink(
+            std::make_unique<NvInferIntervalSink>(pipeline->common_elements.primary_gie_bin.primary_gie));
+    }
+
     if (tmp_elem2)
     {
         NVGSTDS_LINK_ELEMENT(tmp_elem2, last_elem);
@@ -33,6 +33,7 @@
 #include "deepstream_app.h"
 #include "deepstream_config_file_parser.h"
 #include "nvds_version.h"
+#include "utils/thread_role.h"
 
 using namespace std;
 
@@ -628,6 +629,9 @@ nvds_x_event_thread(gpointer data)
     //     logger = getLogger("DS_log");
     // }
 
+    // 화면 이벤트 처리는 프레임 처리 코어와 분리
+    enterThreadRole("ds-x11");
+
     try{
 
         g_mutex_lock(&disp_lock);// 뮤텍스 잠금
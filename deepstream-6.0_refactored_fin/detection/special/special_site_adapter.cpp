@@ -16,8 +16,6 @@ SpecialSiteAdapter::SpecialSiteAdapter(SignalCalculator* signal_calc, ROIHandler
 }
 
 bool SpecialSiteAdapter::initialize() {
-    std::lock_guard<std::mutex> lock(config_mutex_);
-    
     try {
         auto& config_mgr = ConfigManager::getInstance();
         
@@ -25,11 +23,15 @@ bool SpecialSiteAdapter::initialize() {
         config_.enabled = config_mgr.isSpecialSiteEnabled();
         config_.straight_left = config_mgr.isSpecialSiteStraightLeft();
         config_.right = config_mgr.isSpecialSiteRight();
+        config_.site = config_mgr.getString("processing_modules.special_site.site", "");
+        config_.site_table = config_mgr.getString("processing_modules.special_site.site_table",
+                                                  "config/special_sites.json");
         
         logger->info("Special Site 설정 로드:");
         logger->info("  - enabled: {}", config_.enabled);
         logger->info("  - straight_left: {}", config_.straight_left);
         logger->info("  - right: {}", config_.right);
+        logger->info("  - site: {}", config_.site.empty() ? "(내장 규칙)" : config_.site);
         
         // 2K 모드 확인
         bool is_2k_enabled = config_mgr.isVehicle2KEnabled();
@@ -44,14 +46,18 @@ bool SpecialSiteAdapter::initialize() {
                 logger->warn("현재 설정: 2K={}, 4K={} - Special Site 비활성화", 
                            is_2k_enabled, is_4k_enabled);
                 config_.enabled = false;
-                is_active_ = false;
+                is_active_.store(false, std::memory_order_release);
             } else {
-                is_active_ = true;
+                buildTable();
+                
                 logger->info("========================================");
                 logger->info("Special Site 모드 활성화됨");
-                logger->info("  - 처리 모드: {}", 
-                           config_.straight_left ? "직진/좌회전" : "우회전");
-                logger->info("  - 신호 판단: 타겟신호 ON=직진, OFF=좌회전");
+                logger->info("  - 처리 모드: {}", getModeDescription());
+                logger->info("  - 규칙 ({}개, 위에서부터 처음 일치한 규칙 적용):", 
+                           table_->getRules().size());
+                for (size_t i = 0; i < table_->getRules().size(); i++) {
+                    logger->info("    [{}] {}", i, table_->getRules()[i].source);
+                }
                 logger->info("  - SQLite 저장: 비활성화");
                 logger->info("  - 통계 생성: 자동 비활성화");
                 logger->info("  - 대기행렬 분석: 자동 비활성화");
@@ -65,17 +71,21 @@ bool SpecialSiteAdapter::initialize() {
                 }
                 
                 // 신호 계산기 확인
-                if (!signal_calculator_) {
+                SignalCalculator* signal_calc = signal_calculator_.load(std::memory_order_acquire);
+                if (!signal_calc) {
                     logger->warn("SignalCalculator가 없음 - 신호 기반 방향 결정시 기본값(직진) 사용");
                     logger->warn("ROI 기반 방향 결정만 가능");
                 } else {
                     logger->info("SignalCalculator 연결됨");
                     logger->info("  - 현재 타겟 신호: {}", 
-                                signal_calculator_->isGreenSignal() ? "ON(직진)" : "OFF(좌회전)");
+                                signal_calc->isGreenSignal() ? "ON(직진)" : "OFF(좌회전)");
                 }
+                
+                // 테이블 생성 완료 후 공개
+                is_active_.store(true, std::memory_order_release);
             }
         } else {
-            is_active_ = false;
+            is_active_.store(false, std::memory_order_release);
             logger->info("Special Site 모드 비활성화 (config.enabled=false)");
         }
         
@@ -83,13 +93,36 @@ bool SpecialSiteAdapter::initialize() {
         
     } catch (const std::exception& e) {
         logger->error("Special Site 초기화 실패: {}", e.what());
-        is_active_ = false;
+        is_active_.store(false, std::memory_order_release);
         return false;
     }
 }
 
+void SpecialSiteAdapter::buildTable() {
+    if (!config_.site.empty()) {
+        std::string path = ConfigManager::getInstance().getFullPath(config_.site_table);
+        std::string error;
+        table_ = SpecialSiteTable::load(path, config_.site, error);
+        if (table_) {
+            logger->info("규칙 파일 로드: {} (사이트: {})", path, config_.site);
+            return;
+        }
+        logger->error("규칙 파일 로드 실패: {} - 내장 {} 규칙 사용", error,
+                     config_.straight_left ? "straight_left" : "right");
+    }
+    
+    table_ = SpecialSiteTable::preset(config_.straight_left);
+}
+
+std::string SpecialSiteAdapter::getModeDescription() const {
+    if (table_ && !config_.site.empty() && table_->getSiteName() == config_.site) {
+        return "사이트 규칙 (" + config_.site + ")";
+    }
+    return config_.straight_left ? "직진/좌회전" : "우회전";
+}
+
 void SpecialSiteAdapter::setSignalCalculator(SignalCalculator* signal_calc) {
-    signal_calculator_ = signal_calc;
+    signal_calculator_.store(signal_calc, std::memory_order_release);
     
     if (signal_calc) {
         logger->info("SignalCalculator 연결됨");
@@ -100,107 +133,48 @@ void SpecialSiteAdapter::setSignalCalculator(SignalCalculator* signal_calc) {
     }
 }
 
-int SpecialSiteAdapter::determineDirectionBySignal() const {
-    if (!signal_calculator_) {
-        logger->debug("SignalCalculator 없음 - 기본값(직진) 반환");
-        return 11;  // 기본값: 직진
-    }
-    
-    // 타겟신호 ON=직진(11), OFF=좌회전(21)
-    int direction = signal_calculator_->getDirectionForSpecialSite();
-    
-    logger->trace("신호 기반 방향 결정: {} (타겟신호: {})", 
-                 direction == 11 ? "직진" : "좌회전",
-                 signal_calculator_->isGreenSignal() ? "ON" : "OFF");
-    
-    return direction;
+bool SpecialSiteAdapter::isGreen() const {
+    // 신호 계산기가 없으면 타겟신호 ON(직진)으로 간주
+    SignalCalculator* signal_calc = signal_calculator_.load(std::memory_order_acquire);
+    return signal_calc ? signal_calc->isGreenSignal() : true;
 }
 
-int SpecialSiteAdapter::determineVehicleDirection(const obj_data& obj, bool in_roi, int roi_direction) {
+SpecialSiteDecision SpecialSiteAdapter::decideOnApproach(int turn_type, int lane) const {
     if (!isActive()) {
         // Special Site 비활성화 시 원래 방향 반환
-        return roi_direction;
+        SpecialSiteDecision decision;
+        decision.direction = turn_type;
+        return decision;
     }
     
-    std::lock_guard<std::mutex> lock(config_mutex_);
+    bool green = isGreen();
+    SpecialSiteDecision decision = table_->decide(turn_type, lane, green, SpecialSiteStage::APPROACH);
     
-    // 유턴은 항상 무시
-    if (roi_direction == 41) {
-        logger->trace("Special Site: 유턴 차량 무시 - ID={}", obj.object_id);
-        return -1;  // 무시
-    }
+    logger->trace("Special Site 규칙 적용(정지선 전): roi={}, lane={}, 신호={} -> 규칙={}, 방향={}{}", 
+                 turn_type, lane, green ? "ON" : "OFF", decision.rule_index,
+                 decision.direction, decision.ignore ? " (무시)" : "");
+    return decision;
+}
 
-    // 역방향 차량 무시 (-11, -21, -22, -31, -32, -41)
-    if (roi_direction < -1) {  // -1은 ROI 밖이므로 제외
-        logger->trace("Special Site: 역방향 차량 무시 - ID={}, 방향={}", 
-                     obj.object_id, roi_direction);
-        return -1;  // 무시
-    }    
-    
-    // =============== straight_left 모드 (직진/좌회전 처리) ===============
-    if (config_.straight_left) {
-        logger->trace("Special Site straight_left 모드: ID={}, in_roi={}, roi_direction={}", 
-                     obj.object_id, in_roi, roi_direction);
-        
-        // 1. 우회전 ROI 차량은 무조건 무시
-        if (roi_direction >= 31 && roi_direction <= 32) {
-            logger->debug("Special Site: 우회전 ROI 차량 무시 - ID={}, 방향={}", 
-                        obj.object_id, roi_direction);
-            return -1;  // 무시 (데이터 전송 안함)
-        }
-        
-        // 2. 직진 ROI 차량 - 방향 유지
-        if (roi_direction == 11) {
-            logger->debug("Special Site: 직진 ROI 차량 검출 - ID={}, 방향 유지(11)", 
-                        obj.object_id);
-            return 11;
-        }
-        
-        // 3. 좌회전 ROI 차량 - 방향 유지  
-        if (roi_direction == 21 || roi_direction == 22) {
-            logger->debug("Special Site: 좌회전 ROI 차량 검출 - ID={}, 방향 유지({})", 
-                        obj.object_id, roi_direction);
-            return roi_direction;
-        }
-        
-        // 4. ROI 밖 차량 또는 ROI가 없는 경우 - 신호 기반 판단
-        // roi_direction이 -1(ROI 밖), 0(초기값), 또는 in_roi가 false인 경우
-        if (!in_roi || roi_direction <= 0) {
-            int signal_direction = determineDirectionBySignal();
-            
-            logger->debug("Special Site: ROI 밖 차량, 신호 기반 방향 결정 - ID={}, 방향={} ({})", 
-                        obj.object_id, signal_direction,
-                        signal_direction == 11 ? "직진" : "좌회전");
-            
-            return signal_direction;
-        }
-        
-        // 5. 예상치 못한 경우 - 원래 방향 반환
-        logger->warn("Special Site straight_left: 예상치 못한 roi_direction={} - 원래 값 반환", 
-                    roi_direction);
-        return roi_direction;
+SpecialSiteDecision SpecialSiteAdapter::decideAtStopLine(int stored_direction, int current_roi, int lane) const {
+    if (!isActive()) {
+        SpecialSiteDecision decision;
+        decision.direction = stored_direction > 0 ? stored_direction : current_roi;
+        decision.lane = lane;
+        return decision;
     }
     
-    // =============== right 모드 (우회전만 처리) ===============
-    if (config_.right) {
-        logger->trace("Special Site right 모드: ID={}, in_roi={}, roi_direction={}", 
-                     obj.object_id, in_roi, roi_direction);
-        
-        // 우회전 ROI 차량만 처리
-        if (roi_direction >= 31 && roi_direction <= 32) {
-            logger->debug("Special Site: 우회전 차량 처리 - ID={}, 방향={}", 
-                        obj.object_id, roi_direction);
-            return roi_direction;
-        }
-        
-        // 나머지는 모두 무시
-        logger->debug("Special Site: 우회전 외 차량 무시 - ID={}, 방향={}", 
-                     obj.object_id, roi_direction);
-        return -1;  // 무시
-    }
+    bool green = isGreen();
+    SpecialSiteDecision decision = table_->decideAtStopLine(stored_direction, current_roi, lane, green);
     
-    // ConfigManager에서 Special Site 세부 설정 자동 보정이 안된 오류 상황
-    logger->error("Special Site: 잘못된 설정 (straight_left={}, right={}) - 원래 방향 반환", 
-                 config_.straight_left, config_.right);    
-    return roi_direction;
-}
\ No newline at end of file
+    logger->trace("Special Site 규칙 적용(정지선): 저장={}, 현재 roi={}, lane={}, 신호={} -> 규칙={}, 방향={}, 차로={}{}", 
+                 stored_direction, current_roi, lane, green ? "ON" : "OFF", decision.rule_index,
+                 decision.direction, decision.lane, decision.ignore ? " (무시)" : "");
+    return decision;
+}
+
+int SpecialSiteAdapter::determineVehicleDirection(const obj_data& obj, bool in_roi, int roi_direction) const {
+    // 정지선 전 저장 방향 없이 현재 위치로 판정 (ROI 밖 차량은 방향 코드와 관계없이 -1)
+    SpecialSiteDecision decision = decideAtStopLine(0, in_roi ? roi_direction : -1, obj.lane);
+    return decision.ignore ? -1 : decision.direction;
+}
@@ -4,14 +4,17 @@
  * Special Site 모드 처리를 위한 어댑터 클래스
  * - 진입로 차량 검출이 어려운 특수 교차로 처리
  * - 신호 정보 기반 방향 결정 (타겟신호 ON=직진, OFF=좌회전)
+ * - 사이트별 규칙 테이블(special_site_table)로 방향/차로/카메라 재지정
  * - SQLite 저장 비활성화 제어
  */
 
 #ifndef SPECIAL_SITE_ADAPTER_H
 #define SPECIAL_SITE_ADAPTER_H
 
+#include <atomic>
 #include <memory>
-#include <mutex>
+#include <string>
+#include "special_site_table.h"
 #include "../../common/common_types.h"
 #include "../../common/object_data.h"
 #include "../../utils/config_manager.h"
@@ -32,6 +35,8 @@ struct SpecialSiteConfig {
     bool enabled = false;           // Special Site 모드 활성화 여부
     bool straight_left = false;     // 직진/좌회전 처리 모드
     bool right = false;             // 우회전 처리 모드
+    std::string site;               // 규칙 파일의 사이트명 (빈 값: 내장 straight_left/right 규칙)
+    std::string site_table;         // 규칙 파일 경로
 };
 
 /**
@@ -44,28 +49,35 @@ struct SpecialSiteConfig {
  * 동작 모드:
  * 1. straight_left 모드: 우회전 무시, ROI 밖 차량은 신호 기반 판단
  * 2. right 모드: 우회전만 처리
+ * 3. site 지정: 규칙 파일의 사이트 규칙 적용 (ROI/차로/신호 조건 -> 방향/차로/카메라)
+ *
+ * 스레드 안전성:
+ * - 설정과 규칙 테이블은 initialize()에서 한 번 만들어지고 이후 변경되지 않음
+ * - isActive()/getConfig()/decideOnApproach()/decideAtStopLine()는 스트리밍 스레드에서 잠금 없이 호출
  */
 class SpecialSiteAdapter {
 private:
     // 의존성
-    SignalCalculator* signal_calculator_;
+    std::atomic<SignalCalculator*> signal_calculator_;
     ROIHandler* roi_handler_;
     
-    // 설정
+    // 설정 (initialize 이후 불변)
     SpecialSiteConfig config_;
-    bool is_active_ = false;  // 2K + Special Site 활성화 여부
-    
-    // 뮤텍스
-    mutable std::mutex config_mutex_;
+    std::unique_ptr<const SpecialSiteTable> table_;
+    std::atomic<bool> is_active_{false};  // 2K + Special Site 활성화 여부
     
     // 로거
     std::shared_ptr<spdlog::logger> logger;
     
     /**
-     * @brief 신호 기반 방향 결정
-     * @return 타겟신호 ON=11(직진), OFF=21(좌회전)
+     * @brief 규칙 테이블 생성 (site 지정 시 규칙 파일, 실패/미지정 시 내장 규칙)
+     */
+    void buildTable();
+    
+    /**
+     * @brief 타겟신호 ON 여부 (신호 계산기 없으면 ON)
      */
-    int determineDirectionBySignal() const;
+    bool isGreen() const;
 
 public:
     /**
@@ -91,37 +103,53 @@ public:
      * @return 활성화되어 있으면 true
      */
     bool isActive() const { 
-        std::lock_guard<std::mutex> lock(config_mutex_);
-        return is_active_; 
+        return is_active_.load(std::memory_order_acquire); 
     }
     
     /**
-     * @brief 차량 방향 결정
+     * @brief 정지선 전 방향 ROI 감지 시 규칙 적용 (스트리밍 스레드, 잠금 없음)
+     * @param turn_type 감지된 방향 ROI 코드
+     * @param lane 차로 번호 (0: 미확인)
+     * @return 적용 결과 - 비활성화 시 ROI 방향 그대로
+     */
+    SpecialSiteDecision decideOnApproach(int turn_type, int lane) const;
+    
+    /**
+     * @brief 정지선 통과 시 최종 규칙 적용 (스트리밍 스레드, 잠금 없음)
+     * @param stored_direction 정지선 전 저장한 방향 ROI 코드 (0 이하: 없음)
+     * @param current_roi 정지선 통과 위치의 ROI 방향 코드 (-1: ROI 밖)
+     * @param lane 차로 번호 (0: 미확인)
+     * @return 적용 결과 (최종 방향/차로) - 비활성화 시 ROI 방향 그대로
+     * 
+     * 내장 규칙 (변경 전 분기와 동일):
+     * - straight_left: 우회전 ROI 무시, 정지선 전 저장한 방향(유턴 포함)은 그대로,
+     *   정지선에서 구한 유턴/역방향은 무시, ROI 밖은 신호 기반 (타겟신호 ON=직진, OFF=좌회전)
+     * - right: 정지선 전 마지막 방향 ROI 그대로 (차로 1 고정), 방향 미검출은 스킵
+     */
+    SpecialSiteDecision decideAtStopLine(int stored_direction, int current_roi, int lane) const;
+    
+    /**
+     * @brief 차량 방향 결정 (decide의 방향만 반환)
      * @param obj 차량 객체
      * @param in_roi ROI 내부 여부
      * @param roi_direction ROI에서 검출된 방향
      * @return 결정된 방향 코드, 무시해야 할 경우 -1
-     * 
-     * 동작:
-     * - straight_left 모드: 
-     *   - 우회전 ROI → 무시 (-1)
-     *   - 직진/좌회전 ROI → 원래 방향 유지
-     *   - ROI 밖 → 신호 기반 결정 (타겟신호 ON=직진, OFF=좌회전)
-     * - right 모드:
-     *   - 우회전 ROI → 처리
-     *   - 나머지 → 무시 (-1)
      */
-    int determineVehicleDirection(const obj_data& obj, bool in_roi, int roi_direction);
+    int determineVehicleDirection(const obj_data& obj, bool in_roi, int roi_direction) const;
     
     /**
-     * @brief 현재 설정 반환
+     * @brief 현재 설정 반환 (initialize 이후 불변)
      * @return Special Site 설정
      */
-    SpecialSiteConfig getConfig() const {
-        std::lock_guard<std::mutex> lock(config_mutex_);
+    const SpecialSiteConfig& getConfig() const {
         return config_;
     }
     
+    /**
+     * @brief 처리 모드 설명 (로그용)
+     */
+    std::string getModeDescription() const;
+    
     /**
      * @brief SignalCalculator 설정/변경
      * @param signal_calc 새로운 SignalCalculator 포인터
@@ -0,0 +1,324 @@
+﻿/*
+ * special_site_table.cpp
+ *
+ * Special Site 규칙 테이블 구현
+ */
+
+#include "special_site_table.h"
+#include <fstream>
+#include <initializer_list>
+
+namespace {
+
+const int UTURN_CODE = 41;
+const int MAX_LANE_BIT = 31;
+
+Json::Value makeRule(const Json::Value& roi, const char* action) {
+    Json::Value rule;
+    rule["roi"] = roi;
+    rule["action"] = action;
+    return rule;
+}
+
+Json::Value codes(std::initializer_list<int> values) {
+    Json::Value array(Json::arrayValue);
+    for (int value : values) {
+        array.append(value);
+    }
+    return array;
+}
+
+}  // namespace
+
+bool SpecialSiteTable::parseRoiSlots(const Json::Value& roi, std::vector<int>& slots,
+                                     std::string& error) {
+    slots.clear();
+
+    if (roi.isNull() || (roi.isString() && roi.asString() == "any")) {
+        for (int slot = 0; slot < SLOT_COUNT; slot++) {
+            slots.push_back(slot);
+        }
+        return true;
+    }
+
+    if (roi.isString()) {
+        const std::string keyword = roi.asString();
+        if (keyword == "outside") {
+            // -1: ROI 밖, 0: 방향 미검출 초기값
+            slots.push_back(slotOf(-1));
+            slots.push_back(slotOf(0));
+        } else if (keyword == "reverse") {
+            for (int code = MIN_ROI_CODE; code < -1; code++) {
+                slots.push_back(slotOf(code));
+            }
+        } else if (keyword == "uturn") {
+            slots.push_back(slotOf(UTURN_CODE));
+        } else {
+            error = "알 수 없는 roi 키워드: " + keyword;
+            return false;
+        }
+        return true;
+    }
+
+    if (roi.isArray()) {
+        for (const auto& code : roi) {
+            if (!code.isInt()) {
+                error = "roi 배열에는 정수 방향 코드만 사용 가능";
+                return false;
+            }
+            slots.push_back(slotOf(code.asInt()));
+        }
+        if (slots.empty()) {
+            error = "roi 배열이 비어 있음";
+            return false;
+        }
+        return true;
+    }
+
+    if (roi.isInt()) {
+        slots.push_back(slotOf(roi.asInt()));
+        return true;
+    }
+
+    error = "roi는 방향 코드 배열 또는 키워드(any/outside/reverse/uturn)여야 함";
+    return false;
+}
+
+bool SpecialSiteTable::parseRule(const Json::Value& item, SpecialSiteRule& rule,
+                                 std::vector<int>& slots, std::array<bool, 2>& signal_states,
+                                 std::array<bool, 2>& stages, std::string& error) {
+    if (!item.isObject()) {
+        error = "규칙은 JSON 객체여야 함";
+        return false;
+    }
+
+    if (!parseRoiSlots(item["roi"], slots, error)) {
+        return false;
+    }
+    rule.catch_all = item["roi"].isNull() ||
+                     (item["roi"].isString() && item["roi"].asString() == "any");
+
+    // 차로 조건
+    const Json::Value& lanes = item["lanes"];
+    if (!lanes.isNull()) {
+        if (!lanes.isArray() || lanes.empty()) {
+            error = "lanes는 차로 번호 배열이어야 함";
+            return false;
+        }
+        rule.lane_mask = 0;
+        for (const auto& lane : lanes) {
+            if (!lane.isInt() || lane.asInt() < 0 || lane.asInt() > MAX_LANE_BIT) {
+                error = "lanes 차로 번호는 0~31 범위여야 함";
+                return false;
+            }
+            rule.lane_mask |= (1u << lane.asInt());
+        }
+    }
+
+    // 신호 조건
+    const std::string signal = item.get("signal", "any").asString();
+    if (signal == "any") {
+        signal_states = {true, true};
+    } else if (signal == "green") {
+        signal_states = {false, true};
+    } else if (signal == "red") {
+        signal_states = {true, false};
+    } else {
+        error = "signal은 any/green/red 중 하나여야 함: " + signal;
+        return false;
+    }
+
+    // 관측 시점 조건
+    const std::string observed = item.get("observed", "any").asString();
+    if (observed == "any") {
+        stages = {true, true};
+    } else if (observed == "approach") {
+        stages = {true, false};
+    } else if (observed == "stop_line") {
+        stages = {false, true};
+    } else {
+        error = "observed는 any/approach/stop_line 중 하나여야 함: " + observed;
+        return false;
+    }
+
+    // 동작
+    const std::string action = item.get("action", "keep").asString();
+    if (action == "keep") {
+        rule.action = SpecialSiteAction::KEEP;
+    } else if (action == "ignore") {
+        rule.action = SpecialSiteAction::IGNORE;
+    } else if (action == "signal") {
+        rule.action = SpecialSiteAction::SIGNAL;
+        rule.green_direction = item.get("green_direction", 11).asInt();
+        rule.red_direction = item.get("red_direction", 21).asInt();
+    } else if (action == "set") {
+        rule.action = SpecialSiteAction::SET;
+        rule.direction = item.get("direction", -1).asInt();
+        if (rule.direction <= 0) {
+            error = "action=set에는 양수 direction 필요";
+            return false;
+        }
+    } else {
+        error = "action은 keep/ignore/signal/set 중 하나여야 함: " + action;
+        return false;
+    }
+
+    // 재지정
+    rule.lane_override = item.get("lane", 0).asInt();
+    rule.camera_override = item.get("camera", "").asString();
+    if (rule.lane_override < 0) {
+        error = "lane 재지정 값은 0 이상이어야 함";
+        return false;
+    }
+
+    Json::FastWriter writer;
+    rule.source = writer.write(item);
+    if (!rule.source.empty() && rule.source.back() == '\n') {
+        rule.source.pop_back();
+    }
+    return true;
+}
+
+std::unique_ptr<const SpecialSiteTable> SpecialSiteTable::compile(const std::string& site_name,
+                                                                  const Json::Value& rules,
+                                                                  std::string& error) {
+    if (!rules.isArray() || rules.empty()) {
+        error = "rules 배열이 없거나 비어 있음";
+        return nullptr;
+    }
+    if (rules.size() > UINT16_MAX) {
+        error = "규칙 수 초과";
+        return nullptr;
+    }
+
+    std::unique_ptr<SpecialSiteTable> table(new SpecialSiteTable());
+    table->site_name_ = site_name;
+    table->rules_.reserve(rules.size());
+
+    std::vector<int> slots;
+    for (Json::ArrayIndex i = 0; i < rules.size(); i++) {
+        SpecialSiteRule rule;
+        std::array<bool, 2> signal_states = {true, true};
+        std::array<bool, 2> stages = {true, true};
+
+        if (!parseRule(rules[i], rule, slots, signal_states, stages, error)) {
+            error = "규칙 " + std::to_string(i) + ": " + error;
+            return nullptr;
+        }
+
+        // 규칙 순서대로 후보 목록에 추가 (중복 슬롯은 한 번만)
+        uint16_t index = static_cast<uint16_t>(i);
+        for (int slot : slots) {
+            for (int stage = 0; stage < 2; stage++) {
+                if (!stages[stage]) continue;
+                for (int green = 0; green < 2; green++) {
+                    if (!signal_states[green]) continue;
+                    auto& list = table->candidates_[slot][stage][green];
+                    if (list.empty() || list.back() != index) {
+                        list.push_back(index);
+                    }
+                }
+            }
+        }
+        table->rules_.push_back(std::move(rule));
+    }
+
+    return table;
+}
+
+std::unique_ptr<const SpecialSiteTable> SpecialSiteTable::load(const std::string& path,
+                                                               const std::string& site_name,
+                                                               std::string& error) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        error = "규칙 파일을 열 수 없음: " + path;
+        return nullptr;
+    }
+
+    Json::Value root;
+    Json::Reader reader;
+    if (!reader.parse(file, root)) {
+        error = "규칙 파일 JSON 파싱 실패: " + reader.getFormattedErrorMessages();
+        return nullptr;
+    }
+
+    const Json::Value& site = root["sites"][site_name];
+    if (!site.isObject()) {
+        error = "규칙 파일에 사이트 없음: " + site_name;
+        return nullptr;
+    }
+
+    return compile(site_name, site["rules"], error);
+}
+
+std::unique_ptr<const SpecialSiteTable> SpecialSiteTable::preset(bool straight_left) {
+    Json::Value rules(Json::arrayValue);
+
+    if (straight_left) {
+        // 우회전/역방향 무시, 직진/좌회전 ROI 유지, ROI 밖은 신호 기반
+        // 유턴은 정지선 전에 감지해 저장했으면 그대로 전송, 정지선에서 처음 구한 경우만 무시
+        Json::Value uturn = makeRule("uturn", "ignore");
+        uturn["observed"] = "stop_line";
+        rules.append(uturn);
+        rules.append(makeRule("reverse", "ignore"));
+        rules.append(makeRule(codes({31, 32}), "ignore"));
+        rules.append(makeRule(codes({11, 21, 22}), "keep"));
+        rules.append(makeRule("outside", "signal"));
+    } else {
+        // 정지선 전 마지막 방향 ROI 그대로 전송 (차선 ROI가 없으므로 차로 1 고정)
+        // 방향 ROI 미검출(-1/0)은 방향 미결정으로 스킵
+        Json::Value any = makeRule("any", "keep");
+        any["lane"] = 1;
+        rules.append(any);
+    }
+
+    std::string error;
+    return compile(straight_left ? "straight_left" : "right", rules, error);
+}
+
+SpecialSiteDecision SpecialSiteTable::decide(int roi_direction, int lane, bool green,
+                                             SpecialSiteStage stage) const {
+    SpecialSiteDecision decision;
+    decision.direction = roi_direction > 0 ? roi_direction : -1;
+
+    uint32_t lane_bit = (lane >= 0 && lane <= MAX_LANE_BIT) ? (1u << lane) : 0;
+
+    for (uint16_t index : candidates_[slotOf(roi_direction)][static_cast<int>(stage)][green ? 1 : 0]) {
+        const SpecialSiteRule& rule = rules_[index];
+        if (rule.lane_mask != ALL_LANES && !(rule.lane_mask & lane_bit)) continue;
+
+        decision.matched = true;
+        decision.rule_index = index;
+        decision.catch_all = rule.catch_all;
+        decision.lane_override = rule.lane_override;
+        decision.camera_override = rule.camera_override.empty() ? nullptr : &rule.camera_override;
+
+        switch (rule.action) {
+            case SpecialSiteAction::KEEP:
+                break;
+            case SpecialSiteAction::IGNORE:
+                decision.ignore = true;
+                decision.direction = -1;
+                break;
+            case SpecialSiteAction::SIGNAL:
+                decision.direction = green ? rule.green_direction : rule.red_direction;
+                break;
+            case SpecialSiteAction::SET:
+                decision.direction = rule.direction;
+                break;
+        }
+        return decision;
+    }
+
+    return decision;
+}
+
+SpecialSiteDecision SpecialSiteTable::decideAtStopLine(int stored_direction, int current_roi,
+                                                       int lane, bool green) const {
+    SpecialSiteDecision decision = stored_direction > 0
+        ? decide(stored_direction, lane, green, SpecialSiteStage::APPROACH)
+        : decide(current_roi, lane, green, SpecialSiteStage::STOP_LINE);
+
+    decision.lane = decision.lane_override > 0 ? decision.lane_override : lane;
+    return decision;
+}
@@ -0,0 +1,177 @@
+﻿/*
+ * special_site_table.h
+ *
+ * Special Site 규칙 테이블
+ * - 사이트별 선언형 규칙(ROI/차로/신호 조건 -> 방향/차로/카메라 재지정)을 시작 시 컴파일
+ * - 컴파일 결과는 불변, 스트리밍 스레드에서 잠금 없이 조회
+ */
+
+#ifndef SPECIAL_SITE_TABLE_H
+#define SPECIAL_SITE_TABLE_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../../json/json.h"
+
+// 차로 조건 없음 (모든 차로)
+const uint32_t ALL_LANES = 0xFFFFFFFFu;
+
+/**
+ * @brief 규칙 동작
+ */
+enum class SpecialSiteAction {
+    KEEP,       // ROI 방향 유지
+    IGNORE,     // 전송 안함
+    SIGNAL,     // 타겟신호로 방향 결정 (ON=green_direction, OFF=red_direction)
+    SET         // 지정 방향으로 재지정
+};
+
+/**
+ * @brief ROI 방향 코드 관측 시점
+ */
+enum class SpecialSiteStage {
+    APPROACH = 0,   // 정지선 전 방향 ROI에서 감지해 저장한 코드
+    STOP_LINE = 1   // 정지선 통과 시 현재 위치에서 구한 코드 (저장된 코드 없음)
+};
+
+/**
+ * @brief 컴파일된 규칙 1개
+ *
+ * 조건 (모두 만족해야 일치):
+ * - roi: ROI 방향 코드 집합 (컴파일 시 조회 슬롯으로 전개)
+ * - lanes: 차로 집합 (lane_mask 비트, 비어 있으면 모든 차로)
+ * - signal: 타겟신호 상태 (any/green/red, 컴파일 시 슬롯으로 전개)
+ * - observed: ROI 코드 관측 시점 (any/approach/stop_line, 컴파일 시 슬롯으로 전개)
+ */
+struct SpecialSiteRule {
+    SpecialSiteAction action = SpecialSiteAction::KEEP;
+    uint32_t lane_mask = ALL_LANES;     // bit n = 차로 n (0: 차로 미확인)
+    int direction = -1;                 // SET 방향
+    int green_direction = 11;           // SIGNAL: 타겟신호 ON
+    int red_direction = 21;             // SIGNAL: 타겟신호 OFF
+    int lane_override = 0;              // 차로 재지정 (0: 유지)
+    std::string camera_override;        // 카메라 재지정 (빈 값: 유지)
+    bool catch_all = false;             // roi 조건 없음/"any" (특정 ROI 코드 지정 아님)
+    std::string source;                 // 로그용 원본 요약
+};
+
+/**
+ * @brief 규칙 적용 결과
+ */
+struct SpecialSiteDecision {
+    bool matched = false;               // 일치 규칙 존재 여부
+    bool ignore = false;                // 전송 안함
+    int direction = -1;                 // 최종 방향 (미결정/무시: -1)
+    int lane_override = 0;              // 차로 재지정 (0: 유지)
+    int lane = 0;                       // 최종 차로 (재지정 우선, 정지선 판정에서만 설정, 0: 미확인)
+    const std::string* camera_override = nullptr;   // 카메라 재지정 (nullptr: 없음)
+    int rule_index = -1;                // 일치 규칙 번호 (로그용)
+    bool catch_all = false;             // roi "any" 규칙으로 결정됨 (정지선 전 무시 표시에 사용 안함)
+};
+
+/**
+ * @brief 불변 Special Site 규칙 테이블
+ *
+ * 규칙 파일 형식 (special_site.site_table):
+ * {
+ *   "sites": {
+ *     "<사이트명>": {
+ *       "rules": [
+ *         { "roi": [31, 32], "action": "ignore" },
+ *         { "roi": "outside", "lanes": [1, 2], "action": "signal" },
+ *         { "roi": [11], "signal": "red", "action": "set", "direction": 21, "lane": 1, "camera": "..." },
+ *         { "roi": "uturn", "observed": "stop_line", "action": "ignore" }
+ *       ]
+ *     }
+ *   }
+ * }
+ * - roi: 방향 코드 배열 또는 "any" / "outside"(-1, 0) / "reverse"(-2 이하) / "uturn"(41)
+ * - observed: approach(정지선 전 감지해 저장한 코드) / stop_line(정지선에서 처음 구한 코드)
+ * - 규칙은 위에서부터 평가하여 처음 일치한 규칙 적용
+ *
+ * 컴파일 시 (ROI 슬롯 x 관측 시점 x 신호 상태)별 후보 규칙 번호 목록을 만들어
+ * 조회는 배열 인덱싱 + 후보별 차로 비트 검사만 수행 (할당/잠금 없음)
+ */
+class SpecialSiteTable {
+public:
+    static constexpr int MIN_ROI_CODE = -41;
+    static constexpr int MAX_ROI_CODE = 41;
+    static constexpr int OTHER_SLOT = MAX_ROI_CODE - MIN_ROI_CODE + 1;   // 범위 밖 코드
+    static constexpr int SLOT_COUNT = OTHER_SLOT + 1;
+
+private:
+    std::string site_name_;
+    std::vector<SpecialSiteRule> rules_;
+    // [ROI 슬롯][관측 시점][신호: 0=OFF, 1=ON] -> 후보 규칙 번호 (평가 순서)
+    std::array<std::array<std::array<std::vector<uint16_t>, 2>, 2>, SLOT_COUNT> candidates_;
+
+    SpecialSiteTable() = default;
+
+    static int slotOf(int roi_direction) {
+        return (roi_direction >= MIN_ROI_CODE && roi_direction <= MAX_ROI_CODE)
+               ? roi_direction - MIN_ROI_CODE : OTHER_SLOT;
+    }
+
+    static bool parseRoiSlots(const Json::Value& roi, std::vector<int>& slots, std::string& error);
+    static bool parseRule(const Json::Value& item, SpecialSiteRule& rule,
+                          std::vector<int>& slots, std::array<bool, 2>& signal_states,
+                          std::array<bool, 2>& stages, std::string& error);
+
+public:
+    /**
+     * @brief 규칙 배열 컴파일
+     * @param site_name 사이트명 (로그용)
+     * @param rules 규칙 JSON 배열
+     * @param error 실패 사유 (실패 시)
+     * @return 컴파일된 테이블, 실패 시 nullptr
+     */
+    static std::unique_ptr<const SpecialSiteTable> compile(const std::string& site_name,
+                                                           const Json::Value& rules,
+                                                           std::string& error);
+
+    /**
+     * @brief 규칙 파일에서 사이트 테이블 로드 및 컴파일
+     * @param path 규칙 파일 경로
+     * @param site_name 사이트명
+     * @param error 실패 사유 (실패 시)
+     * @return 컴파일된 테이블, 실패 시 nullptr
+     */
+    static std::unique_ptr<const SpecialSiteTable> load(const std::string& path,
+                                                        const std::string& site_name,
+                                                        std::string& error);
+
+    /**
+     * @brief 기존 straight_left/right 모드와 같은 동작의 내장 테이블
+     * @param straight_left true: 직진/좌회전, false: 우회전
+     */
+    static std::unique_ptr<const SpecialSiteTable> preset(bool straight_left);
+
+    /**
+     * @brief 규칙 적용 (스트리밍 스레드, 잠금 없음)
+     * @param roi_direction ROI 방향 코드 (-1: ROI 밖)
+     * @param lane 차로 번호 (0: 미확인)
+     * @param green 타겟신호 ON 여부
+     * @param stage ROI 코드 관측 시점
+     * @return 적용 결과 (일치 규칙 없으면 matched=false, ROI 방향 유지)
+     */
+    SpecialSiteDecision decide(int roi_direction, int lane, bool green, SpecialSiteStage stage) const;
+
+    /**
+     * @brief 정지선 통과 시 최종 판정
+     * @param stored_direction 정지선 전 저장한 방향 ROI 코드 (0 이하: 없음)
+     * @param current_roi 정지선 통과 위치의 ROI 방향 코드 (-1: ROI 밖)
+     * @param lane 차로 번호 (0: 미확인)
+     * @param green 타겟신호 ON 여부
+     * @return 적용 결과 - 저장된 코드가 있으면 그 코드(approach), 없으면 현재 코드(stop_line)로 판정,
+     *         lane에 재지정 우선 최종 차로 설정
+     */
+    SpecialSiteDecision decideAtStopLine(int stored_direction, int current_roi, int lane, bool green) const;
+
+    const std::string& getSiteName() const { return site_name_; }
+    const std::vector<SpecialSiteRule>& getRules() const { return rules_; }
+};
+
+#endif // SPECIAL_SITE_TABLE_H
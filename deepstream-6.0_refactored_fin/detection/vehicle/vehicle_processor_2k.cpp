@@ -8,6 +8,7 @@
  */
 
 #include "vehicle_processor_2k.h"
+#include "vehicle_size_estimator.h"
 #include "../special/special_site_adapter.h"
 #include "../../calibration/calibration.h"
 #include "../../data/redis/channel_types.h"
@@ -37,6 +38,45 @@ VehicleProcessor2K::VehicleProcessor2K(ROIHandler& roi, RedisClient& redis, SQLi
     if (special_site_adapter && special_site_adapter->isActive()) {
         logger->info("Special Site 모드 활성화됨");
     }
+    
+    loadDelayConfig();
+    
+    if (ConfigManager::getInstance().isVehicleSizeCheckEnabled()) {
+        size_estimator = std::make_unique<VehicleSizeEstimator>();
+        if (!size_estimator->initialize()) {
+            size_estimator.reset();
+        }
+    }
+}
+
+VehicleProcessor2K::~VehicleProcessor2K() = default;
+
+void VehicleProcessor2K::loadDelayConfig() {
+    auto& config = ConfigManager::getInstance();
+    const std::string base_key = "processing_modules.vehicle_analytics.delay";
+    
+    delay_config.enabled = config.isDelayEnabled();
+    if (!delay_config.enabled) {
+        return;
+    }
+    
+    delay_config.free_flow_speed = config.getDouble(base_key + ".free_flow_speed_kmh", 50.0);
+    delay_config.stop_speed = config.getDouble(base_key + ".stop_speed_kmh", 5.0);
+    delay_config.resume_speed = config.getDouble(base_key + ".resume_speed_kmh", 10.0);
+    
+    if (delay_config.free_flow_speed <= 0.0) {
+        logger->warn("잘못된 자유류 속도: {} - 기본값 50km/h 사용", delay_config.free_flow_speed);
+        delay_config.free_flow_speed = 50.0;
+    }
+    if (delay_config.stop_speed <= 0.0 || delay_config.resume_speed < delay_config.stop_speed) {
+        logger->warn("잘못된 정지 판정 속도: {}/{} - 기본값 5/10km/h 사용",
+                    delay_config.stop_speed, delay_config.resume_speed);
+        delay_config.stop_speed = 5.0;
+        delay_config.resume_speed = 10.0;
+    }
+    
+    logger->info("차량 지체 산출 활성화 - 자유류: {:.1f}km/h, 정지: {:.1f}km/h 미만, 출발: {:.1f}km/h 초과",
+                delay_config.free_flow_speed, delay_config.stop_speed, delay_config.resume_speed);
 }
 
 obj_data VehicleProcessor2K::processVehicle(const obj_data& input_obj, const box& obj_box,
@@ -62,7 +102,7 @@ obj_data VehicleProcessor2K::processVehicle(const obj_data& input_obj, const box
         
         // 속도 업데이트 (매 초마다)
         if (second_changed) {
-            updateSpeed(obj, current_pos, current_time);
+            updateSpeed(obj, obj_box, current_pos, current_time);
         }
         
         // ROI 전이 확인
@@ -79,14 +119,25 @@ obj_data VehicleProcessor2K::processVehicle(const obj_data& input_obj, const box
     return obj;
 }
 
-void VehicleProcessor2K::updateSpeed(obj_data& obj, const ObjPoint& current_pos, 
+void VehicleProcessor2K::updateSpeed(obj_data& obj, const box& obj_box, const ObjPoint& current_pos, 
                                     int current_time) {
+    // 현재 위치 도로 평면 투영 (1초 뒤 속도 계산과 크기 추정에서 재사용)
+    ObjPoint ground = {0, 0};
+    bool ground_valid = groundPosition(0, current_pos.x, current_pos.y, ground.x, ground.y);
+    
     // prev_pos가 유효한 경우에만 속도 계산 (1초 전 위치)
     if (isValidPosition(obj.prev_pos) && isValidTimestamp(obj.prev_pos_time)) {
-        // calculateSpeed 사용 (calibration.h의 함수)
-        double speed = calculateSpeed(obj.prev_pos.x, obj.prev_pos.y, 
-                                    current_pos.x, current_pos.y, 
-                                    current_time - obj.prev_pos_time);
+        double speed;
+        if (ground_valid && obj.prev_ground_valid && current_time > obj.prev_pos_time) {
+            // 1초 전 투영 결과 재사용 (calculateSpeed와 같은 축/스케일)
+            double meters = std::hypot(ground.x - obj.prev_ground.x, ground.y - obj.prev_ground.y);
+            speed = meters * 3.6 / (current_time - obj.prev_pos_time);
+        } else {
+            // calculateSpeed 사용 (calibration.h의 함수)
+            speed = calculateSpeed(obj.prev_pos.x, obj.prev_pos.y, 
+                                   current_pos.x, current_pos.y, 
+                                   current_time - obj.prev_pos_time);
+        }
         
         // x축 이동거리가 20픽셀 이상이면 속도 보정
         if (std::fabs(current_pos.x - obj.prev_pos.x) > 20) {
@@ -105,6 +156,10 @@ void VehicleProcessor2K::updateSpeed(obj_data& obj, const ObjPoint& current_pos,
         obj.speed = speed;
         obj.interval_speed = obj.avg_speed;     // 구간속도 = 평균속도
         
+        if (delay_config.enabled) {
+            updateDelay(obj, speed, current_time - obj.prev_pos_time);
+        }
+        
         logger->trace("2K 차량 ID {} 속도: 현재={:.2f}, 평균={:.2f}, 속도 계산 횟수={}", 
                      obj.object_id, speed, obj.avg_speed, obj.num_speed);
     } else {
@@ -112,9 +167,40 @@ void VehicleProcessor2K::updateSpeed(obj_data& obj, const ObjPoint& current_pos,
         obj.num_speed = 0;
     }
     
+    // 차체 크기 추정 (하단 중심 투영 재사용)
+    if (size_estimator && ground_valid) {
+        size_estimator->observe(obj, obj_box, ground);
+    }
+    
     // 항상 위치와 시간 업데이트 (1초 전 위치)
     obj.prev_pos = current_pos;
     obj.prev_pos_time = current_time;
+    obj.prev_ground = ground;
+    obj.prev_ground_valid = ground_valid;
+}
+
+void VehicleProcessor2K::updateDelay(obj_data& obj, double speed, int elapsed_sec) {
+    // 접근로 구간만 누적 (정지선 통과 또는 회전 확정 시 종료)
+    if (obj.stop_line_pass || obj.turn_pass || elapsed_sec <= 0) {
+        return;
+    }
+    
+    // 정지 판정 (히스테리시스 - 정지선 부근 속도 흔들림으로 정지 횟수가 늘지 않도록)
+    if (!obj.is_stopped && speed < delay_config.stop_speed) {
+        obj.is_stopped = true;
+        obj.stop_count++;
+    } else if (obj.is_stopped && speed > delay_config.resume_speed) {
+        obj.is_stopped = false;
+    }
+    if (obj.is_stopped) {
+        obj.stopped_sec += elapsed_sec;
+    }
+    
+    // 지체 = 경과 시간 - 같은 거리를 자유류 속도로 주행하는 시간
+    // 자유류보다 빠른 구간은 앞서 누적된 지체만 상쇄 (0 미만으로 내려가지 않음)
+    double free_flow_sec = elapsed_sec * speed / delay_config.free_flow_speed;
+    double delay = std::max(0.0, obj.approach_delay) + (elapsed_sec - free_flow_sec);
+    obj.approach_delay = std::max(0.0, delay);
 }
 
 // current_pos는 현재 checkROITransition을 호출한 프레임(프레임 #i)에서 해당 객체 ID의 좌표
@@ -136,19 +222,18 @@ void VehicleProcessor2K::checkROITransition(obj_data& obj, const ObjPoint& curre
         int turn_type = roi_handler.isInTurnROI(current_pos);
         
         if (turn_type > 0) {
-            // straight_left 모드에서 우회전 감지 시 무시 표시
-            auto config = special_site_adapter->getConfig();
-            if (config.straight_left && (turn_type >= 31 && turn_type <= 32)) {
-                obj.dir_out = -999;  // 우회전 무시 플래그
-                logger->debug("[SPECIAL-PRE] 우회전 ROI 감지, 무시 예정: ID={}", obj.object_id);
-                return;
-            }
-            // 직진/좌회전 또는 right 모드의 우회전 감지
-            else {
-                obj.dir_out = turn_type;  // 방향 미리 저장 (정지선에서 사용)
-                logger->debug("[SPECIAL-PRE] 방향 ROI 감지: ID={}, 방향={}", 
+            // 특정 ROI 코드를 지정한 무시 규칙이면 표시 (정지선에서 전송 안함)
+            // "any" 규칙은 이후 다른 방향 ROI 진입을 막지 않도록 정지선에서만 판정
+            SpecialSiteDecision decision = special_site_adapter->decideOnApproach(turn_type, lane);
+            if (decision.ignore && !decision.catch_all) {
+                obj.dir_out = -999;  // 무시 플래그
+                logger->debug("[SPECIAL-PRE] 무시 규칙 ROI 감지: ID={}, 방향={}", 
                             obj.object_id, turn_type);
+                return;
             }
+            obj.dir_out = turn_type;  // 방향 미리 저장 (정지선에서 규칙 적용)
+            logger->debug("[SPECIAL-PRE] 방향 ROI 감지: ID={}, 방향={}", 
+                        obj.object_id, turn_type);
         }
     }
     
@@ -169,66 +254,44 @@ void VehicleProcessor2K::checkROITransition(obj_data& obj, const ObjPoint& curre
             
             // Special Site: 정지선 통과 시 최종 처리
             if (special_site_adapter && special_site_adapter->isActive()) {
-                // 우회전 무시 플래그 체크
+                // 무시 플래그 체크
                 if (obj.dir_out == -999) {
-                    logger->info("[SPECIAL-STOPLINE] 우회전 차량 무시: ID={}", obj.object_id);
+                    logger->info("[SPECIAL-STOPLINE] 무시 규칙 차량: ID={}", obj.object_id);
                     return;
                 }
                 
-                // 차로 정보 처리
-                auto config = special_site_adapter->getConfig();
+                // 미리 감지한 방향 ROI, 없으면 현재 위치 ROI 기준으로 규칙 적용
+                int current_roi = obj.dir_out > 0 ? obj.dir_out : roi_handler.isInTurnROI(current_pos);
+                int current_lane = obj.lane > 0 ? obj.lane : lane;
+                SpecialSiteDecision decision = special_site_adapter->decideAtStopLine(
+                    obj.dir_out, current_roi, current_lane);
                 
-                if (config.right) {
-                    // right 모드는 차선 ROI가 없으므로 무조건 차로 1
-                    obj.lane = 1;
-                    logger->debug("[SPECIAL-RIGHT] 차로=1 설정 (차선 ROI 없음): ID={}", obj.object_id);
-                } else if (config.straight_left) {
-                    // straight_left 모드에서 차로 정보 확인
-                    if (obj.lane <= 0) {
-                        int current_lane = roi_handler.getLaneNum(current_pos);
-                        if (current_lane > 0) {
-                            obj.lane = current_lane;
-                        } else {
-                            // 차로 정보가 없으면 스킵
-                            logger->info("[SPECIAL-STOPLINE] 차로 정보 없음, 스킵: ID={}", obj.object_id);
-                            return;
-                        }
-                    }
+                if (decision.ignore || decision.direction <= 0) {
+                    logger->info("[SPECIAL-STOPLINE] 방향 미결정/무시, 스킵: ID={}, ROI={}, 규칙={}", 
+                               obj.object_id, current_roi, decision.rule_index);
+                    return;
                 }
                 
-                // 방향 결정
-                int final_direction = obj.dir_out;
-                
-                // 방향이 아직 결정되지 않은 경우 (방향별 ROI 미검출)
-                if (final_direction <= 0) {
-                    // 신호 기반 방향 결정 (straight_left 모드에서만)
-                    auto config = special_site_adapter->getConfig();
-                    if (config.straight_left) {
-                        int turn = roi_handler.isInTurnROI(current_pos);
-                        bool in_roi = (turn != -1);
-                        final_direction = special_site_adapter->determineVehicleDirection(obj, in_roi, turn);
-                        logger->info("[SPECIAL-SIGNAL] 신호 기반 방향 결정: ID={}, 방향={}", 
-                                   obj.object_id, final_direction);
-                    } else if (config.right) {
-                        // right 모드에서 방향 ROI 미검출이면 스킵
-                        logger->info("[SPECIAL-RIGHT] 우회전 ROI 미검출, 스킵: ID={}", obj.object_id);
-                        return;
-                    }
+                // 차로 정보 처리 (규칙 재지정 우선)
+                if (decision.lane <= 0) {
+                    // 차로 정보가 없으면 스킵
+                    logger->info("[SPECIAL-STOPLINE] 차로 정보 없음, 스킵: ID={}", obj.object_id);
+                    return;
                 }
+                obj.lane = decision.lane;
                 
                 // 최종 데이터 설정 및 전송
-                if (final_direction > 0) {
-                    obj.dir_out = final_direction;
-                    obj.turn_pass = true;
-                    obj.turn_time = current_time;
-                    obj.turn_pass_speed = isValidSpeed(obj.speed) ? obj.speed : 0.0;
-                    
-                    logger->info("[SPECIAL-FINAL] ID={} 정지선 통과 완료: 방향={}, 차로={}", 
-                                obj.object_id, obj.dir_out, obj.lane);
-                    
-                    sendVehicleData(obj, current_time);
-                    return;
-                }
+                obj.dir_out = decision.direction;
+                obj.turn_pass = true;
+                obj.turn_time = current_time;
+                obj.turn_pass_speed = isValidSpeed(obj.speed) ? obj.speed : 0.0;
+                
+                logger->info("[SPECIAL-FINAL] ID={} 정지선 통과 완료: 방향={}, 차로={}, 규칙={}", 
+                            obj.object_id, obj.dir_out, obj.lane, decision.rule_index);
+                
+                sendVehicleData(obj, current_time, 
+                              decision.camera_override ? *decision.camera_override : std::string());
+                return;
             }
         }
     }
@@ -338,15 +401,22 @@ void VehicleProcessor2K::checkROITransition(obj_data& obj, const ObjPoint& curre
     }
 }
 
-void VehicleProcessor2K::sendVehicleData(const obj_data& obj, int current_time) {
+void VehicleProcessor2K::sendVehicleData(const obj_data& obj, int current_time,
+                                         const std::string& camera_override) {
     // data_sent_2k 플래그 체크 (중복 전송 방지)
     if (obj.data_sent_2k) {
         return;
     }
     
     try {
+        // 차종 코드 변환 (크기 검증 활성 시 추정 차체 크기로 교차 검증)
+        std::string vehicle_type_code = getVehicleTypeCode(obj.label);
+        if (size_estimator) {
+            vehicle_type_code = size_estimator->resolveVehicleType(obj, vehicle_type_code);
+        }
+        
         // 메타데이터 생성 (cam_id 제외)
-        std::string metadata = generateMetadata(obj);
+        std::string metadata = generateMetadata(obj, vehicle_type_code, camera_override);
         
         // Redis 전송
         int redis_result = redis_client.sendData(CHANNEL_VEHICLE_2K, metadata);
@@ -364,8 +434,6 @@ void VehicleProcessor2K::sendVehicleData(const obj_data& obj, int current_time)
             logger->debug("Special Site 모드 - SQLite 저장 스킵: ID={}", obj.object_id);
         } else {
             // SQLite 저장 - 3개 파라미터로 호출 (cam_id 없이, 차종 코드 변환)
-            std::string vehicle_type_code = getVehicleTypeCode(obj.label);
-            
             int sqlite_result = sqlite_handler.insertVehicleData(
                 obj.object_id,      // vehicle_id
                 obj,                // obj_data
@@ -384,18 +452,20 @@ void VehicleProcessor2K::sendVehicleData(const obj_data& obj, int current_time)
     }
 }
 
-std::string VehicleProcessor2K::generateMetadata(const obj_data& obj) {
+std::string VehicleProcessor2K::generateMetadata(const obj_data& obj, const std::string& vehicle_type,
+                                                 const std::string& camera_override) {
     std::stringstream ss;
     
-    // 차종 코드 변환
-    std::string vehicle_type = getVehicleTypeCode(obj.label);
-
     // 이미지 저장 경로 가져오기
     auto& config = ConfigManager::getInstance();
     std::string car_image_path = config.getFullImagePath("vehicle_2k");
     
     // CSV 형식으로 메타데이터 생성 (cam_id 제외)
-    // 형식: id,차종,차로,방향,회전검지시각,회전속도,정지선시각,정지선속도,구간속도,최초시각,관측시간,이미지경로,이미지파일명
+    // 기본 13개: id,차종,차로,방향,회전검지시각,회전속도,정지선시각,정지선속도,구간속도,최초시각,관측시간,이미지경로,이미지파일명
+    // 확장 컬럼은 기능 사용 시에만 뒤에 추가 (위치 고정, 필드 수로 구분)
+    // - 13개: 기존 형식 그대로 (카메라 재지정 없음, 지체 산출 비활성)
+    // - 14개: + 카메라ID (Special Site 재지정)
+    // - 17개: + 카메라ID(재지정 없으면 빈 값),접근로지체(초),정지시간(초),정지횟수 (지체 산출 활성)
     ss << obj.object_id << ","
        << vehicle_type << ","
        << obj.lane << ","
@@ -410,6 +480,15 @@ std::string VehicleProcessor2K::generateMetadata(const obj_data& obj) {
        << car_image_path << ","
        << obj.image_name;
     
+    if (delay_config.enabled) {
+        ss << "," << camera_override
+           << "," << std::setprecision(1) << std::max(0.0, obj.approach_delay)
+           << "," << obj.stopped_sec
+           << "," << obj.stop_count;
+    } else if (!camera_override.empty()) {
+        ss << "," << camera_override;
+    }
+    
     return ss.str();
 }
 
@@ -22,6 +22,17 @@ class SiteInfoManager;
 class ImageCropper;
 class ImageStorage;
 class SpecialSiteAdapter;
+class VehicleSizeEstimator;
+
+/**
+ * @brief 차량별 지체/정지 산출 설정 (vehicle_analytics.delay)
+ */
+struct VehicleDelayConfig {
+    bool enabled = false;
+    double free_flow_speed = 50.0;      // 자유류 속도 (km/h)
+    double stop_speed = 5.0;            // 정지 진입 속도 (km/h 미만)
+    double resume_speed = 10.0;         // 정지 해제 속도 (km/h 초과)
+};
 
 /**
  * @brief 차량 감지 처리 클래스 (2K 모드)
@@ -33,6 +44,8 @@ class SpecialSiteAdapter;
  * - obj.last_pos는 이전 프레임 위치 (process_meta에서 관리)
  * - 정지선 체크: obj.last_pos(이전)와 current_pos(현재) 비교
  * - Special Site 모드 지원 (신호 기반 방향 결정)
+ * - 초당 속도 갱신 시 접근로 지체/정지 시간/정지 횟수 누적 (궤적 저장 없음)
+ * - 초당 속도 갱신 시 차체 크기 추정, 전송 시 차종 교차 검증 (size_check 활성 시)
  * 
  * === 데이터 관리 정책 ===
  * - det_obj 직접 수정하지 않음
@@ -51,17 +64,27 @@ private:
     // Special Site 어댑터 (nullptr 가능)
     SpecialSiteAdapter* special_site_adapter;
     
+    // 지체/정지 산출 설정
+    VehicleDelayConfig delay_config;
+    
+    // 차체 크기 기반 차종 검증 (비활성 시 nullptr)
+    std::unique_ptr<VehicleSizeEstimator> size_estimator;
+    
     // 로거
     std::shared_ptr<spdlog::logger> logger;
     
     // ========== 내부 메서드 ==========
-    void updateSpeed(obj_data& obj, const ObjPoint& current_pos, int current_time);
+    void loadDelayConfig();
+    void updateSpeed(obj_data& obj, const box& obj_box, const ObjPoint& current_pos, int current_time);
+    void updateDelay(obj_data& obj, double speed, int elapsed_sec);
     void checkROITransition(obj_data& obj, const ObjPoint& current_pos, 
                            int current_time, const box& obj_box, NvBufSurface* surface);
-    void sendVehicleData(const obj_data& obj, int current_time);
+    void sendVehicleData(const obj_data& obj, int current_time,
+                         const std::string& camera_override = std::string());
     void saveVehicleImage(obj_data& obj, const box& obj_box, 
                          NvBufSurface* surface, int current_time);
-    std::string generateMetadata(const obj_data& obj);
+    std::string generateMetadata(const obj_data& obj, const std::string& vehicle_type,
+                                 const std::string& camera_override = std::string());
 
 public:
     /**
@@ -75,7 +98,7 @@ public:
     /**
      * @brief 소멸자
      */
-    ~VehicleProcessor2K() = default;
+    ~VehicleProcessor2K();
     
     /**
      * @brief 차량 처리 메인 함수 - obj_data를 반환
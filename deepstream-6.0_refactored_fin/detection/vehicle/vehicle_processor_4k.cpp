@@ -89,6 +89,9 @@ VehicleProcessor4K::VehicleProcessor4K(ROIHandler& roi, RedisClient& redis,
     // ImageSaver 인스턴스 생성
     image_saver_ = std::make_unique<ImageSaver>(image_cropper, image_storage);
     
+    // 캡처 상태 메모리 예산 (정지선 미통과 차량 상태 누적 방지)
+    capture_states_.attachBudget("capture_states_4k", 2048);
+    
     // ConfigManager에서 FPS 정보 가져오기
     try {
         auto& config = ConfigManager::getInstance();
@@ -102,7 +105,7 @@ VehicleProcessor4K::VehicleProcessor4K(ROIHandler& roi, RedisClient& redis,
 
 obj_data VehicleProcessor4K::processVehicle(const obj_data& input_obj, const box& obj_box,
                                            const ObjPoint& current_pos, int current_time, 
-                                           bool second_changed, NvBufSurface* surface) {
+                                           bool second_changed, bool speed_update, NvBufSurface* surface) {
     // 입력 데이터 복사
     obj_data obj = input_obj;
     
@@ -127,8 +130,8 @@ obj_data VehicleProcessor4K::processVehicle(const obj_data& input_obj, const box
             return obj;
         }
         
-        // 속도 업데이트 (매 초마다)
-        if (second_changed) {
+        // 속도 업데이트 (매 초마다, 프레임 누락 직후는 보류)
+        if (speed_update) {
             updateSpeed(obj, current_pos, current_time);
         }
         
@@ -405,12 +408,77 @@ void VehicleProcessor4K::cleanupOldStates(int current_time) {
     
     auto it = capture_states_.begin();
     while (it != capture_states_.end()) {
-        if ((current_time - it->second.stop_pass_time) > CLEANUP_TIMEOUT &&
-            it->second.stop_pass_time > 0) {
+        bool expired = it->second.stop_pass_time > 0 &&
+                       (current_time - it->second.stop_pass_time) > CLEANUP_TIMEOUT;
+        
+        // 새 ID로 이관되지 않은 복원 상태
+        bool orphaned = it->first < 0 && (current_time - restored_time_) > CLEANUP_TIMEOUT;
+        
+        if (expired || orphaned) {
             logger->debug("4K 캡처 상태 정리: ID={}", it->first);
             it = capture_states_.erase(it);
         } else {
             ++it;
         }
     }
-}
\ No newline at end of file
+}
+
+void VehicleProcessor4K::saveCheckpoint(CheckpointWriter& writer) const {
+    uint32_t count = 0;
+    for (const auto& entry : capture_states_) {
+        if (entry.first >= 0) count++;
+    }
+    writer.put<uint32_t>(count);
+    
+    for (const auto& [id, state] : capture_states_) {
+        if (id < 0) continue;
+        writer.put<int32_t>(id);
+        writer.put<int32_t>(state.image_count);
+        writer.put<int32_t>(state.last_capture_time);
+        writer.put<int32_t>(state.stop_pass_time);
+        writer.put<uint8_t>((state.stop_line_image_saved ? 0x01 : 0) |
+                            (state.after_stop_image_saved ? 0x02 : 0));
+        writer.put<uint32_t>(static_cast<uint32_t>(state.saved_images.size()));
+        for (const auto& name : state.saved_images) {
+            writer.putString(name);
+        }
+        writer.putString(state.image_path);
+    }
+}
+
+bool VehicleProcessor4K::restoreCheckpoint(CheckpointReader& reader, const CheckpointContext& context) {
+    uint32_t count = reader.get<uint32_t>();
+    
+    for (uint32_t i = 0; i < count; i++) {
+        int id = reader.get<int32_t>();
+        
+        ImageCaptureState state;
+        state.image_count = reader.get<int32_t>();
+        state.last_capture_time = reader.get<int32_t>();
+        state.stop_pass_time = reader.get<int32_t>();
+        uint8_t flags = reader.get<uint8_t>();
+        state.stop_line_image_saved = flags & 0x01;
+        state.after_stop_image_saved = flags & 0x02;
+        uint32_t images = reader.get<uint32_t>();
+        for (uint32_t j = 0; j < images; j++) {
+            state.saved_images.push_back(reader.getString());
+        }
+        state.image_path = reader.getString();
+        
+        capture_states_[checkpointRestoredId(id)] = std::move(state);
+    }
+    
+    restored_time_ = context.current_time;
+    logger->info("4K 캡처 상태 복원: {}대", count);
+    return count > 0;
+}
+
+void VehicleProcessor4K::adoptCaptureState(int restored_id, int new_id) {
+    auto it = capture_states_.find(restored_id);
+    if (it == capture_states_.end()) return;
+    
+    // 삽입 시 축출될 수 있으므로 먼저 꺼낸 후 삽입
+    ImageCaptureState state = std::move(it->second);
+    capture_states_.erase(it);
+    capture_states_[new_id] = std::move(state);
+}
@@ -8,6 +8,9 @@
 #include <vector>
 #include "../../common/common_types.h"
 #include "../../common/object_data.h"
+#include "../../data/checkpoint/checkpoint_codec.h"
+#include "../../data/checkpoint/checkpoint_types.h"
+#include "../../utils/bounded_map.h"
 #include "nvbufsurface.h"
 
 #ifndef __logger__
@@ -62,8 +65,9 @@ private:
         std::string image_path;                 // 이미지 저장 경로 (파일명 제외)
     };
     
-    // 차량별 이미지 캡처 상태 관리
-    std::map<int, ImageCaptureState> capture_states_;
+    // 차량별 이미지 캡처 상태 관리 (메모리 예산 초과 시 LRU 축출)
+    BoundedMap<int, ImageCaptureState> capture_states_;
+    int restored_time_ = 0;                     // 체크포인트 복원 시각 (미이관 상태 정리용)
     
     // FPS 정보 (ConfigManager에서 가져옴)
     int camera_fps_ = 30;
@@ -137,7 +141,8 @@ public:
      * @param obj_box 바운딩 박스
      * @param current_pos 현재 프레임의 bottom_center 위치 (process_meta에서 계산)
      * @param current_time 현재 시간 (초 단위 Unix timestamp)
-     * @param second_changed 초 변경 여부
+     * @param second_changed 초 변경 여부 (상태 정리 주기)
+     * @param speed_update 속도 갱신 여부 (초 변경 + 프레임 누락 보류 아님)
      * @param surface 이미지 서페이스
      * @return 수정된 obj_data (복사본)
      * 
@@ -146,7 +151,28 @@ public:
      */
     obj_data processVehicle(const obj_data& input_obj, const box& obj_box,
                            const ObjPoint& current_pos, int current_time, 
-                           bool second_changed, NvBufSurface* surface);
+                           bool second_changed, bool speed_update, NvBufSurface* surface);
+    
+    /**
+     * @brief 체크포인트 직렬화 (차량별 이미지 캡처 상태)
+     * @param writer 체크포인트 기록기
+     */
+    void saveCheckpoint(CheckpointWriter& writer) const;
+    
+    /**
+     * @brief 체크포인트 복원 - 복원용 음수 ID로 보관 (adoptCaptureState로 새 ID에 이관)
+     * @param reader 체크포인트 판독기
+     * @param context 복원 컨텍스트
+     * @return 복원 적용 시 true
+     */
+    bool restoreCheckpoint(CheckpointReader& reader, const CheckpointContext& context);
+    
+    /**
+     * @brief 복원된 캡처 상태를 새 추적 ID로 이관
+     * @param restored_id 복원용 ID (checkpointRestoredId)
+     * @param new_id 새 추적 ID
+     */
+    void adoptCaptureState(int restored_id, int new_id);
 };
 
 #endif // VEHICLE_PROCESSOR_4K_H
\ No newline at end of file
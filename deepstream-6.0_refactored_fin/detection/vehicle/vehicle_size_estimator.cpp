@@ -0,0 +1,172 @@
+﻿/*
+ * vehicle_size_estimator.cpp
+ *
+ * 차체 크기 추정 및 차종 교차 검증 구현
+ * - 1초마다 투영 3회 (하단 좌/우 모서리, footprint 상단) + 중앙값 갱신
+ * - 중앙값은 고정 크기 표본(VEHICLE_SIZE_SAMPLES)에서 계산 (할당 없음)
+ */
+
+#include "vehicle_size_estimator.h"
+#include "../../calibration/calibration.h"
+#include "../../utils/config_manager.h"
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+VehicleSizeEstimator::VehicleSizeEstimator() {
+    logger = getLogger("DS_VehicleSize_log");
+    logger->info("VehicleSizeEstimator 생성");
+}
+
+bool VehicleSizeEstimator::initialize() {
+    try {
+        loadConfig();
+
+        if (config_.classes.empty()) {
+            logger->error("크기 등급 테이블이 비어 있음 - 차종 크기 검증 비활성화");
+            return false;
+        }
+
+        logger->info("차종 크기 검증 초기화 완료 - 모드: {}, 최소 추정: {}회, footprint 비율: {:.2f}",
+                    config_.override_type ? "재지정" : "검증", config_.min_samples,
+                    config_.footprint_ratio);
+        for (const auto& size_class : config_.classes) {
+            logger->info("  - {}: 차장 {:.1f}m, 차폭 {:.1f}m 이하",
+                        size_class.name, size_class.max_length, size_class.max_width);
+        }
+        return true;
+
+    } catch (const std::exception& e) {
+        logger->error("차종 크기 검증 초기화 실패: {}", e.what());
+        return false;
+    }
+}
+
+void VehicleSizeEstimator::loadConfig() {
+    auto& config = ConfigManager::getInstance();
+    const std::string base_key = "processing_modules.vehicle.size_check";
+
+    config_.enabled = config.isVehicleSizeCheckEnabled();
+    config_.override_type = config.getString(base_key + ".mode", "validate") == "override";
+    config_.min_samples = config.getInt(base_key + ".min_samples", 3);
+    config_.footprint_ratio = config.getDouble(base_key + ".footprint_ratio", 0.4);
+
+    config_.min_samples = std::clamp(config_.min_samples, 1, VEHICLE_SIZE_SAMPLES);
+    if (config_.footprint_ratio <= 0.0 || config_.footprint_ratio > 1.0) {
+        logger->warn("잘못된 footprint_ratio 값: {} - 기본값 0.4 사용", config_.footprint_ratio);
+        config_.footprint_ratio = 0.4;
+    }
+
+    // 크기 등급 테이블 (세 배열 길이가 같고 작은 등급부터 정렬되어야 함)
+    std::vector<double> max_lengths = config.getDoubleArray(base_key + ".max_length_m");
+    std::vector<double> max_widths = config.getDoubleArray(base_key + ".max_width_m");
+    std::vector<std::string> allowed = config.getStringArray(base_key + ".allowed_types");
+
+    config_.classes.clear();
+    if (max_lengths.size() != allowed.size() || max_widths.size() != allowed.size()) {
+        logger->error("크기 등급 테이블 길이 불일치 - max_length_m: {}, max_width_m: {}, allowed_types: {}",
+                     max_lengths.size(), max_widths.size(), allowed.size());
+        return;
+    }
+    if (!std::is_sorted(max_lengths.begin(), max_lengths.end())) {
+        logger->error("max_length_m은 오름차순이어야 함");
+        return;
+    }
+
+    for (size_t i = 0; i < allowed.size(); i++) {
+        VehicleSizeClass size_class;
+        size_class.max_length = max_lengths[i];
+        size_class.max_width = max_widths[i];
+        size_class.name = allowed[i];
+
+        std::stringstream ss(allowed[i]);
+        std::string type;
+        while (std::getline(ss, type, ',')) {
+            if (!type.empty()) {
+                size_class.types.push_back(type);
+            }
+        }
+        if (size_class.types.empty()) {
+            logger->error("크기 등급 {}의 허용 차종이 비어 있음", i);
+            config_.classes.clear();
+            return;
+        }
+        config_.classes.push_back(std::move(size_class));
+    }
+}
+
+bool VehicleSizeEstimator::observe(obj_data& obj, const box& obj_box,
+                                   const ObjPoint& ground_center) const {
+    if (!config_.enabled || obj.turn_pass || obj_box.width <= 0 || obj_box.height <= 0) {
+        return false;
+    }
+
+    double bottom = obj_box.top + obj_box.height;
+    double center_x = obj_box.left + obj_box.width / 2.0;
+    double footprint_y = bottom - obj_box.height * config_.footprint_ratio;
+
+    double left_lon, left_lat, right_lon, right_lat, front_lon, front_lat;
+    if (!groundPosition(0, obj_box.left, bottom, left_lon, left_lat) ||
+        !groundPosition(0, obj_box.left + obj_box.width, bottom, right_lon, right_lat) ||
+        !groundPosition(0, center_x, footprint_y, front_lon, front_lat)) {
+        return false;
+    }
+
+    double width = std::fabs(right_lat - left_lat);
+    double length = std::fabs(front_lon - ground_center.x);
+    if (width <= 0.0 || length <= 0.0 ||
+        width > config_.max_dimension || length > config_.max_dimension) {
+        return false;
+    }
+
+    int slot = obj.size_sample_count % VEHICLE_SIZE_SAMPLES;
+    obj.length_samples[slot] = static_cast<float>(length);
+    obj.width_samples[slot] = static_cast<float>(width);
+    obj.size_sample_count++;
+
+    int count = std::min(obj.size_sample_count, VEHICLE_SIZE_SAMPLES);
+    obj.est_length = median(obj.length_samples, count);
+    obj.est_width = median(obj.width_samples, count);
+    return true;
+}
+
+float VehicleSizeEstimator::median(const std::array<float, VEHICLE_SIZE_SAMPLES>& samples, int count) {
+    std::array<float, VEHICLE_SIZE_SAMPLES> sorted = samples;
+    auto mid = sorted.begin() + count / 2;
+    std::nth_element(sorted.begin(), mid, sorted.begin() + count);
+    return *mid;
+}
+
+const VehicleSizeClass* VehicleSizeEstimator::findClass(double length, double width) const {
+    for (const auto& size_class : config_.classes) {
+        if (length <= size_class.max_length && width <= size_class.max_width) {
+            return &size_class;
+        }
+    }
+    // 모든 등급 초과 - 가장 큰 등급
+    return config_.classes.empty() ? nullptr : &config_.classes.back();
+}
+
+std::string VehicleSizeEstimator::resolveVehicleType(const obj_data& obj, const std::string& vehicle_type) {
+    if (!config_.enabled || obj.size_sample_count < config_.min_samples) {
+        return vehicle_type;
+    }
+
+    const VehicleSizeClass* size_class = findClass(obj.est_length, obj.est_width);
+    if (!size_class) {
+        return vehicle_type;
+    }
+
+    checked_count_++;
+    const auto& types = size_class->types;
+    if (std::find(types.begin(), types.end(), vehicle_type) != types.end()) {
+        return vehicle_type;
+    }
+
+    int mismatches = ++mismatch_count_;
+    const std::string& resolved = config_.override_type ? types.front() : vehicle_type;
+    logger->info("[SIZE-CHECK] ID={} 검지 차종 {} / 추정 {:.1f}x{:.1f}m ({}) -> {} (불일치 {}/{}회)",
+                obj.object_id, vehicle_type, obj.est_length, obj.est_width, size_class->name,
+                resolved, mismatches, checked_count_.load());
+    return resolved;
+}
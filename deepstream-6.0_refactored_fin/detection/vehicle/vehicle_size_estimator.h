@@ -0,0 +1,95 @@
+﻿#ifndef VEHICLE_SIZE_ESTIMATOR_H
+#define VEHICLE_SIZE_ESTIMATOR_H
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../../common/object_data.h"
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+/**
+ * @brief 크기 등급 1개 (size_check 테이블 한 행)
+ *
+ * 추정 차장/차폭이 모두 최대값 이하인 첫 등급에 속함 (테이블은 작은 등급부터)
+ */
+struct VehicleSizeClass {
+    double max_length = 0.0;                // 최대 차장 (m)
+    double max_width = 0.0;                 // 최대 차폭 (m)
+    std::vector<std::string> types;         // 허용 차종 코드 (첫 항목: 재지정 차종)
+    std::string name;                       // 로그용 ("MBUS,MTRUCK" 등)
+};
+
+/**
+ * @brief 차체 크기 기반 차종 검증 설정 (vehicle.size_check)
+ */
+struct VehicleSizeConfig {
+    bool enabled = false;
+    bool override_type = false;             // true: 불일치 시 차종 재지정, false: 검증 로그만
+    int min_samples = 3;                    // 판정에 필요한 최소 추정 횟수
+    double footprint_ratio = 0.4;           // 박스 높이 중 차체 바닥면으로 보는 하단 비율
+    double max_dimension = 30.0;            // 추정값 상한 (m, 초과 시 버림)
+    std::vector<VehicleSizeClass> classes;
+};
+
+/**
+ * @brief 보정된 도로 평면 기준 차장/차폭 추정 및 차종 교차 검증
+ *
+ * 속도 계산과 같은 1초 주기로 박스 하단 footprint를 도로 평면에 투영
+ * - 차폭: 박스 하단 좌/우 모서리의 횡방향 거리
+ * - 차장: 박스 하단 중심(속도 계산 투영 재사용)과 하단에서 footprint_ratio 높이 지점의 종방향 거리
+ * - 차량별 최근 VEHICLE_SIZE_SAMPLES개 추정값의 중앙값 사용 (위치별 원근 오차/박스 흔들림 완화)
+ *
+ * 회전 확정 전(차로 방향 주행 중) 위치에서만 추정
+ * 테이블은 초기화 후 불변이므로 스트리밍 스레드에서 잠금 없이 사용
+ */
+class VehicleSizeEstimator {
+private:
+    VehicleSizeConfig config_;
+
+    // 통계
+    std::atomic<int> checked_count_{0};
+    std::atomic<int> mismatch_count_{0};
+
+    std::shared_ptr<spdlog::logger> logger = nullptr;
+
+    void loadConfig();
+    static float median(const std::array<float, VEHICLE_SIZE_SAMPLES>& samples, int count);
+    const VehicleSizeClass* findClass(double length, double width) const;
+
+public:
+    VehicleSizeEstimator();
+    ~VehicleSizeEstimator() = default;
+
+    /**
+     * @brief 초기화 - config.json의 vehicle.size_check 로드
+     * @return 성공 시 true (크기 테이블 오류 시 false)
+     */
+    bool initialize();
+
+    /**
+     * @brief 크기 추정값 1회 추가 (1초 주기, VehicleProcessor2K::updateSpeed에서 호출)
+     * @param obj 차량 데이터 (추정값/중앙값 갱신)
+     * @param obj_box 현재 바운딩 박스
+     * @param ground_center 박스 하단 중심의 도로 평면 좌표 (종방향, 횡방향 m)
+     * @return 유효한 추정값이 추가되었으면 true
+     */
+    bool observe(obj_data& obj, const box& obj_box, const ObjPoint& ground_center) const;
+
+    /**
+     * @brief 검지 차종과 크기 등급 교차 검증
+     * @param obj 차량 데이터
+     * @param vehicle_type 검지기 라벨 기준 차종 코드
+     * @return 전송/저장할 차종 코드 (재지정 모드에서 불일치 시 크기 등급 차종)
+     */
+    std::string resolveVehicleType(const obj_data& obj, const std::string& vehicle_type);
+
+    int getMismatchCount() const { return mismatch_count_.load(); }
+    bool isEnabled() const { return config_.enabled; }
+};
+
+#endif // VEHICLE_SIZE_ESTIMATOR_H
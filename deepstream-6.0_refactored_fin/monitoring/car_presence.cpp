@@ -1,6 +1,7 @@
 ﻿#include "car_presence.h"
 #include "../../data/redis/redis_client.h"
 #include "../../data/redis/channel_types.h"
+#include "../../data/redis/publish_scheduler.h"
 #include "../../roi_module/roi_handler.h"
 #include "../../utils/config_manager.h"
 #include <algorithm>
@@ -61,6 +62,8 @@ bool CarPresence::initialize() {
             return false;
         }
         
+        lane_vehicle_count_.reset(static_cast<int>(roi_handler_.lane_roi.size()));
+        
         // 통계 시작 시간 기록
         stats_.start_time = std::chrono::steady_clock::now();
         flicker_.last_change_time = stats_.start_time;
@@ -94,7 +97,7 @@ void CarPresence::updateVehicles(const std::map<int, ObjPoint>& vehicle_position
     
     try {
         // 차선별 차량 수 계산
-        lane_vehicle_count_.clear();
+        lane_vehicle_count_.fill(0);
         bool has_vehicles = false;
         
         for (const auto& [id, pos] : vehicle_positions) {
@@ -149,8 +152,9 @@ void CarPresence::processStateTransition(bool has_vehicles, int current_time) {
                 // 차선별 상세 정보 (디버깅)
                 if (logger->level() <= spdlog::level::debug) {
                     std::stringstream ss;
-                    for (const auto& [lane, count] : lane_vehicle_count_) {
-                        ss << " [차선" << lane << ":" << count << "대]";
+                    for (int lane = 1; lane <= lane_vehicle_count_.lanes(); lane++) {
+                        if (lane_vehicle_count_[lane] == 0) continue;
+                        ss << " [차선" << lane << ":" << lane_vehicle_count_[lane] << "대]";
                     }
                     logger->debug("차선별 차량:{}", ss.str());
                 }
@@ -233,6 +237,13 @@ void CarPresence::sendPresenceState(int state, int current_time) {
         // 단순 문자열 형태로 전송 ("0" 또는 "1")
         std::string data = std::to_string(state);
         
+        // 스케줄러가 있으면 정책(히스테리시스/keepalive/전송률)에 따라 비동기 전송
+        if (publish_scheduler_ && publish_scheduler_->submit(CHANNEL_VEHICLE_PRESENCE, data)) {
+            stats_.messages_sent++;
+            logger->info("차량 Presence 상태 제출: {} (시간: {})", state, current_time);
+            return;
+        }
+        
         int result = redis_client_.sendData(CHANNEL_VEHICLE_PRESENCE, data);
         
         if (result == 0) {
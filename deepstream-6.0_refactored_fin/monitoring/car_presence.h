@@ -6,6 +6,7 @@
 #include <map>
 #include <memory>
 #include "../../common/common_types.h"
+#include "../../common/lane_array.h"
 #include "../../common/object_data.h"
 
 #ifndef __logger__
@@ -16,6 +17,7 @@
 // Forward declarations
 class ROIHandler;
 class RedisClient;
+class PublishScheduler;
 
 /**
  * @brief 차량 존재 여부 체크 클래스
@@ -46,6 +48,12 @@ public:
      */
     bool initialize();
     
+    /**
+     * @brief 전송 스케줄러 연결 (nullptr이면 Redis 직접 전송)
+     * @param scheduler 전송 스케줄러 포인터
+     */
+    void setPublishScheduler(PublishScheduler* scheduler) { publish_scheduler_ = scheduler; }
+    
     /**
      * @brief 차량 업데이트 - 매 프레임 호출
      * @param vehicle_positions 현재 프레임의 차량 위치 맵 (id -> position)
@@ -95,6 +103,7 @@ private:
     // 의존성
     ROIHandler& roi_handler_;
     RedisClient& redis_client_;
+    PublishScheduler* publish_scheduler_ = nullptr;
     
     // 로거
     std::shared_ptr<spdlog::logger> logger;
@@ -125,7 +134,7 @@ private:
     struct Statistics {
         int total_state_changes = 0;    // 총 상태 변경 횟수
         int flicker_prevented = 0;      // Anti-flicker로 방지된 횟수
-        int messages_sent = 0;          // Redis 전송 횟수
+        int messages_sent = 0;          // Redis 전송(스케줄러 제출) 횟수
         std::chrono::steady_clock::time_point start_time;
     } stats_;
     
@@ -133,8 +142,8 @@ private:
     bool enabled_ = false;
     bool initialized_ = false;
     
-    // 차선별 차량 수 추적 (디버깅용)
-    std::map<int, int> lane_vehicle_count_;
+    // 차선별 차량 수 추적 (디버깅용, initialize에서 차선 수로 크기 결정)
+    LaneArray<int> lane_vehicle_count_;
     
     // 주기적 통계 출력용
     std::chrono::steady_clock::time_point last_stats_log_time_;
@@ -1,5 +1,6 @@
 ﻿#include "pedestrian_presence.h"
 #include "../../data/redis/channel_types.h"
+#include "../../data/redis/publish_scheduler.h"
 #include "../../data/redis/redis_client.h"
 #include "../../roi_module/roi_handler.h"
 #include "../../roi_module/roi_utils.h"
@@ -265,6 +266,13 @@ void PedestrianPresence::sendPresenceState(int channel_type, int state_value,
         // 단순 문자열 형태로 전송 ("0" 또는 "1")
         std::string data = std::to_string(state_value);
         
+        // 스케줄러가 있으면 정책(히스테리시스/keepalive/전송률)에 따라 비동기 전송
+        if (publish_scheduler_ && publish_scheduler_->submit(channel_type, data)) {
+            logger->info("{} Presence 상태 제출: {} (시간: {})", 
+                        area_name, state_value, current_time);
+            return;
+        }
+        
         int result = redis_client_.sendData(channel_type, data);
         
         if (result == 0) {
@@ -16,6 +16,7 @@
 // Forward declarations
 class ROIHandler;
 class RedisClient;
+class PublishScheduler;
 
 /**
  * @brief 보행자 존재 여부 체크 클래스
@@ -45,6 +46,12 @@ public:
      */
     bool initialize();
     
+    /**
+     * @brief 전송 스케줄러 연결 (nullptr이면 Redis 직접 전송)
+     * @param scheduler 전송 스케줄러 포인터
+     */
+    void setPublishScheduler(PublishScheduler* scheduler) { publish_scheduler_ = scheduler; }
+    
     /**
      * @brief 보행자 업데이트 - 매 프레임 호출
      * @param pedestrian_positions 현재 프레임의 보행자 위치 맵 (id -> position)
@@ -142,6 +149,7 @@ private:
     // 의존성
     ROIHandler& roi_handler_;
     RedisClient& redis_client_;
+    PublishScheduler* publish_scheduler_ = nullptr;
     
     // 로거
     std::shared_ptr<spdlog::logger> logger;
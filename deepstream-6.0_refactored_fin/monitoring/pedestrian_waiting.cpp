@@ -0,0 +1,286 @@
+﻿#include "pedestrian_waiting.h"
+#include "../../data/redis/channel_types.h"
+#include "../../data/redis/redis_client.h"
+#include "../../json/json.h"
+#include "../../roi_module/roi_handler.h"
+#include "../../roi_module/roi_utils.h"
+#include "../../utils/config_manager.h"
+#include <algorithm>
+#include <cmath>
+
+PedestrianWaitMonitor::PedestrianWaitMonitor() {
+    logger = getLogger("DS_PedestrianWait_log");
+    logger->info("PedestrianWaitMonitor 생성");
+}
+
+bool PedestrianWaitMonitor::initialize(RedisClient* redis_client, ROIHandler* roi_handler) {
+    try {
+        redis_client_ = redis_client;
+        if (!redis_client_ || !roi_handler) {
+            logger->error("Redis 클라이언트 또는 ROI 핸들러가 없음 - 보행자 대기 분석 초기화 실패");
+            return false;
+        }
+
+        loadConfig();
+
+        // 대기구역 복사 (map operator[]로 빈 구역이 생기지 않도록 순회)
+        areas_.clear();
+        for (const auto& [key, polygon] : roi_handler->waiting_area_roi) {
+            if (polygon.size() < 3) continue;
+            AreaState area;
+            area.key = key;
+            area.polygon = polygon;
+            areas_.push_back(std::move(area));
+        }
+
+        if (areas_.empty()) {
+            logger->warn("대기구역 ROI 없음 - 보행자 대기 분석 비활성화");
+            return false;
+        }
+
+        waiting_.reserve(64);
+        samples_.reserve(config_.max_samples);
+
+        logger->info("보행자 대기 분석 초기화 완료 - 대기구역: {}개, 보행 시작: 타겟신호 {}, "
+                    "최소 대기: {}초, 최대 대기: {}초",
+                    areas_.size(), config_.walk_on_green ? "녹색 시작" : "녹색 종료",
+                    config_.min_wait_sec, config_.max_wait_sec);
+        return true;
+
+    } catch (const std::exception& e) {
+        logger->error("보행자 대기 분석 초기화 실패: {}", e.what());
+        return false;
+    }
+}
+
+void PedestrianWaitMonitor::loadConfig() {
+    auto& config = ConfigManager::getInstance();
+    const std::string base_key = "processing_modules.pedestrian.waiting";
+
+    config_.enabled = config.isPedestrianWaitingEnabled();
+    config_.min_wait_sec = std::max(0, config.getInt(base_key + ".min_wait_sec", 2));
+    config_.max_wait_sec = config.getInt(base_key + ".max_wait_sec", 300);
+    config_.absence_sec = std::max(1, config.getInt(base_key + ".absence_sec", 2));
+    config_.max_samples = config.getInt(base_key + ".max_samples", 128);
+
+    std::string walk_start = config.getString(base_key + ".walk_start_on", "green_off");
+    if (walk_start == "green_on") {
+        config_.walk_on_green = true;
+    } else {
+        if (walk_start != "green_off") {
+            logger->warn("잘못된 walk_start_on 값: {} - 기본값 green_off 사용", walk_start);
+        }
+        config_.walk_on_green = false;
+    }
+
+    if (config_.max_wait_sec <= config_.min_wait_sec) {
+        logger->warn("잘못된 max_wait_sec 값: {} - 기본값 300초 사용", config_.max_wait_sec);
+        config_.max_wait_sec = 300;
+    }
+    if (config_.max_samples <= 0) {
+        config_.max_samples = 128;
+    }
+}
+
+int PedestrianWaitMonitor::findArea(const ObjPoint& pos) const {
+    for (size_t i = 0; i < areas_.size(); i++) {
+        if (insidePolygon(pos, areas_[i].polygon)) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+void PedestrianWaitMonitor::enterArea(WaitState& state, int area, int current_time) {
+    state.area = area;
+    state.enter_time = current_time;
+    state.last_seen = current_time;
+    state.served = false;
+
+    AreaState& area_state = areas_[area];
+    area_state.count++;
+    area_state.peak_count = std::max(area_state.peak_count, area_state.count);
+}
+
+void PedestrianWaitMonitor::leaveArea(WaitState& state) {
+    if (state.area < 0) return;
+
+    AreaState& area_state = areas_[state.area];
+    area_state.count = std::max(0, area_state.count - 1);
+
+    // 보행 시작 전 충분히 대기한 뒤 사라짐 = 무단횡단 또는 대기 포기
+    if (!state.served && state.last_seen - state.enter_time >= config_.min_wait_sec) {
+        area_state.left_count++;
+        total_left_++;
+    }
+    state.area = -1;
+}
+
+void PedestrianWaitMonitor::updatePedestrians(const std::map<int, ObjPoint>& pedestrian_positions,
+                                              int current_time) {
+    if (!config_.enabled) return;
+
+    std::lock_guard<std::mutex> lock(wait_mutex_);
+
+    for (const auto& [id, pos] : pedestrian_positions) {
+        int area = findArea(pos);
+        auto it = waiting_.find(id);
+
+        if (it == waiting_.end()) {
+            if (area < 0) continue;
+            WaitState state;
+            enterArea(state, area, current_time);
+            waiting_.emplace(id, state);
+            continue;
+        }
+
+        WaitState& state = it->second;
+        if (area == state.area) {
+            state.last_seen = current_time;
+            continue;
+        }
+
+        // 구역 이탈 또는 다른 끝단 구역으로 이동
+        leaveArea(state);
+        if (area < 0) {
+            waiting_.erase(it);
+        } else {
+            enterArea(state, area, current_time);
+        }
+    }
+
+    // 트래커에서 사라진 보행자 정리 (초당 1회)
+    if (current_time == last_sweep_time_) return;
+    last_sweep_time_ = current_time;
+
+    for (auto it = waiting_.begin(); it != waiting_.end();) {
+        if (current_time - it->second.last_seen > config_.absence_sec) {
+            leaveArea(it->second);
+            it = waiting_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+PedestrianWaitSummary PedestrianWaitMonitor::summarize(size_t area_index, int walk_time) {
+    AreaState& area = areas_[area_index];
+
+    PedestrianWaitSummary summary;
+    summary.area = area.key;
+    summary.peak_count = area.peak_count;
+    summary.left_count = area.left_count;
+
+    samples_.clear();
+    long long wait_sum = 0;
+
+    for (auto& [id, state] : waiting_) {
+        if (state.area != static_cast<int>(area_index) || state.served) continue;
+
+        int wait = std::min(std::max(0, walk_time - state.enter_time), config_.max_wait_sec);
+        state.served = true;
+
+        summary.wait_count++;
+        wait_sum += wait;
+        summary.max_wait_sec = std::max(summary.max_wait_sec, wait);
+        if (static_cast<int>(samples_.size()) < config_.max_samples) {
+            samples_.push_back(wait);
+        }
+    }
+
+    if (summary.wait_count > 0) {
+        summary.avg_wait_sec = static_cast<double>(wait_sum) / summary.wait_count;
+
+        auto percentile = [this](double p) {
+            size_t k = static_cast<size_t>(std::ceil(p * samples_.size())) - 1;
+            std::nth_element(samples_.begin(), samples_.begin() + k, samples_.end());
+            return samples_[k];
+        };
+        summary.p50_wait_sec = percentile(0.50);
+        summary.p85_wait_sec = percentile(0.85);
+    }
+
+    // 다음 주기 준비 (현재 대기 인원에서 다시 시작)
+    area.peak_count = area.count;
+    area.left_count = 0;
+
+    total_served_ += summary.wait_count;
+    max_wait_seen_ = std::max(max_wait_seen_, summary.max_wait_sec);
+    return summary;
+}
+
+void PedestrianWaitMonitor::onSignalChange(bool is_green, int timestamp) {
+    if (!config_.enabled || is_green != config_.walk_on_green) return;
+
+    std::vector<PedestrianWaitSummary> summaries;
+    int cycle_sec = 0;
+    {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+
+        summaries.reserve(areas_.size());
+        for (size_t i = 0; i < areas_.size(); i++) {
+            summaries.push_back(summarize(i, timestamp));
+        }
+
+        cycle_sec = last_walk_time_ > 0 ? timestamp - last_walk_time_ : 0;
+        last_walk_time_ = timestamp;
+        cycles_published_++;
+    }
+
+    publish(summaries, timestamp, cycle_sec);
+}
+
+bool PedestrianWaitMonitor::publish(const std::vector<PedestrianWaitSummary>& summaries,
+                                    int walk_time, int cycle_sec) {
+    try {
+        Json::Value root;
+        Json::Value areas(Json::arrayValue);
+        Json::FastWriter writer;
+
+        for (const auto& summary : summaries) {
+            Json::Value item;
+            item["area_no"] = summary.area;
+            item["wait_cnt"] = summary.wait_count;
+            item["avg_wait_sec"] = std::round(summary.avg_wait_sec * 10.0) / 10.0;
+            item["max_wait_sec"] = summary.max_wait_sec;
+            item["p50_wait_sec"] = summary.p50_wait_sec;
+            item["p85_wait_sec"] = summary.p85_wait_sec;
+            item["peak_cnt"] = summary.peak_count;
+            item["left_cnt"] = summary.left_count;
+            areas.append(item);
+
+            logger->debug("대기구역 {} - 대기: {}명, 평균: {:.1f}초, 최대: {}초, P85: {}초, 이탈: {}명",
+                         summary.area, summary.wait_count, summary.avg_wait_sec,
+                         summary.max_wait_sec, summary.p85_wait_sec, summary.left_count);
+        }
+
+        root["walk_strt_unix_tm"] = walk_time;
+        root["cycle_sec"] = cycle_sec;
+        root["areas"] = areas;
+
+        std::string json_data = writer.write(root);
+        int result = redis_client_->sendData(CHANNEL_PED_WAIT, json_data);
+        if (result != 0) {
+            logger->error("보행자 대기 분포 전송 실패 (결과: {})", result);
+            return false;
+        }
+        return true;
+
+    } catch (const std::exception& e) {
+        logger->error("보행자 대기 분포 JSON 생성 실패: {}", e.what());
+        return false;
+    }
+}
+
+void PedestrianWaitMonitor::logStatistics() const {
+    if (!config_.enabled) return;
+
+    std::lock_guard<std::mutex> lock(wait_mutex_);
+
+    logger->info("=== 보행자 대기 분석 통계 ===");
+    logger->info("  전송 주기: {}회, 보행 시작 대기 인원: {}명, 시작 전 이탈: {}명, 최대 대기: {}초",
+                cycles_published_, total_served_, total_left_, max_wait_seen_);
+    for (const auto& area : areas_) {
+        logger->info("  [대기구역 {}] 현재 대기: {}명", area.key, area.count);
+    }
+}
@@ -0,0 +1,136 @@
+﻿#ifndef PEDESTRIAN_WAITING_H
+#define PEDESTRIAN_WAITING_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "../../common/object_data.h"
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+// Forward declarations
+class ROIHandler;
+class RedisClient;
+
+/**
+ * @brief 보행자 대기 분석 설정 (pedestrian.waiting)
+ */
+struct PedestrianWaitConfig {
+    bool enabled = false;
+    bool walk_on_green = false;         // 보행 시작 = 타겟신호 녹색 시작 (false: 녹색 종료)
+    int min_wait_sec = 2;               // 이보다 짧게 머문 이탈은 통과로 간주 (이탈 수 제외)
+    int max_wait_sec = 300;             // 대기 시간 상한 (ROI 오설정/정지 객체 보호)
+    int absence_sec = 2;                // 미관측 보행자 이탈 처리 시간 (초)
+    int max_samples = 128;              // 구역별 주기당 분포 표본 상한
+};
+
+/**
+ * @brief 대기구역 주기 집계 결과 (구역 1개)
+ */
+struct PedestrianWaitSummary {
+    int area = 0;                       // 대기구역 번호 (waiting_area ROI 순서)
+    int wait_count = 0;                 // 보행 시작 시점 대기 인원
+    double avg_wait_sec = 0.0;
+    int max_wait_sec = 0;
+    int p50_wait_sec = 0;
+    int p85_wait_sec = 0;
+    int peak_count = 0;                 // 주기 중 최대 동시 대기 인원
+    int left_count = 0;                 // 보행 시작 전 이탈 (무단횡단/포기)
+};
+
+/**
+ * @brief 횡단보도 끝단 대기구역별 보행자 대기 분석
+ *
+ * PedestrianPresence는 대기구역 존재 여부만 전송하므로
+ * 보행자별 대기 시작 시각을 추적하여 보행 신호 시작 시 주기 분포를 전송
+ * - 보행자당 상태 1개 (구역, 진입 시각, 마지막 관측) - O(1)
+ * - 구역 인원은 진입/이탈 시 증감 (프레임마다 재집계 없음)
+ * - 전송은 보행 시작 시 주기당 1회 (프레임 단위 전송 없음)
+ *
+ * 보행 신호는 신호역산 타겟신호의 녹색 시작/종료 중 설정된 쪽으로 판단
+ */
+class PedestrianWaitMonitor {
+private:
+    struct WaitState {
+        int area = -1;
+        int enter_time = 0;
+        int last_seen = 0;
+        bool served = false;            // 보행 시작 시 이미 집계됨
+    };
+
+    struct AreaState {
+        int key = 0;                    // waiting_area_roi 키
+        std::vector<ObjPoint> polygon;
+        int count = 0;                  // 현재 대기 인원
+        int peak_count = 0;
+        int left_count = 0;
+    };
+
+    PedestrianWaitConfig config_;
+
+    RedisClient* redis_client_ = nullptr;
+
+    std::vector<AreaState> areas_;
+    std::unordered_map<int, WaitState> waiting_;
+    std::vector<int> samples_;          // 보행 시작 시 분포 계산용 (재사용)
+
+    int last_sweep_time_ = 0;
+    int last_walk_time_ = 0;
+
+    mutable std::mutex wait_mutex_;
+
+    // 통계
+    int cycles_published_ = 0;
+    int total_served_ = 0;
+    int total_left_ = 0;
+    int max_wait_seen_ = 0;
+
+    std::shared_ptr<spdlog::logger> logger = nullptr;
+
+    void loadConfig();
+    int findArea(const ObjPoint& pos) const;
+    void enterArea(WaitState& state, int area, int current_time);
+    void leaveArea(WaitState& state);
+    PedestrianWaitSummary summarize(size_t area_index, int walk_time);
+    bool publish(const std::vector<PedestrianWaitSummary>& summaries, int walk_time, int cycle_sec);
+
+public:
+    PedestrianWaitMonitor();
+    ~PedestrianWaitMonitor() = default;
+
+    /**
+     * @brief 초기화 - waiting_area ROI를 구역 목록으로 복사
+     * @param redis_client Redis 클라이언트 포인터
+     * @param roi_handler ROI 핸들러 (waiting_area_roi)
+     * @return 성공 시 true (대기구역 ROI 없으면 false)
+     */
+    bool initialize(RedisClient* redis_client, ROIHandler* roi_handler);
+
+    /**
+     * @brief 보행자 위치 갱신 - 매 프레임 호출
+     * @param pedestrian_positions 보행자 위치 맵 (id -> 하단 중심)
+     * @param current_time 현재 Unix 시각
+     */
+    void updatePedestrians(const std::map<int, ObjPoint>& pedestrian_positions, int current_time);
+
+    /**
+     * @brief 신호 변경 알림 - 보행 시작이면 구역별 대기 분포 전송
+     * @param is_green 타겟신호 녹색 시작 여부
+     * @param timestamp 신호 변경 시각
+     */
+    void onSignalChange(bool is_green, int timestamp);
+
+    /**
+     * @brief 통계 정보 로깅
+     */
+    void logStatistics() const;
+
+    bool isEnabled() const { return config_.enabled; }
+};
+
+#endif // PEDESTRIAN_WAITING_H
@@ -0,0 +1,322 @@
+﻿#include "inference_region.h"
+#include <algorithm>
+#include <cmath>
+#include <dlfcn.h>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+
+constexpr int ALIGN_PX = 4;     // nvdspreprocess 크롭 정렬 단위
+
+RegionRect unite(const RegionRect& a, const RegionRect& b) {
+    RegionRect r;
+    r.left = std::min(a.left, b.left);
+    r.top = std::min(a.top, b.top);
+    r.width = std::max(a.right(), b.right()) - r.left;
+    r.height = std::max(a.bottom(), b.bottom()) - r.top;
+    return r;
+}
+
+bool isNear(const RegionRect& a, const RegionRect& b, int gap) {
+    return a.left <= b.right() + gap && b.left <= a.right() + gap &&
+           a.top <= b.bottom() + gap && b.top <= a.bottom() + gap;
+}
+
+RegionRect alignRect(int left, int top, int right, int bottom, int frame_width, int frame_height) {
+    left = std::clamp(left / ALIGN_PX * ALIGN_PX, 0, frame_width);
+    top = std::clamp(top / ALIGN_PX * ALIGN_PX, 0, frame_height);
+    right = std::clamp((right + ALIGN_PX - 1) / ALIGN_PX * ALIGN_PX, 0, frame_width);
+    bottom = std::clamp((bottom + ALIGN_PX - 1) / ALIGN_PX * ALIGN_PX, 0, frame_height);
+
+    RegionRect r;
+    r.left = left;
+    r.top = top;
+    r.width = right - left;
+    r.height = bottom - top;
+    return r;
+}
+
+// 겹치거나 gap 이내로 인접한 사각형 병합 (병합 결과가 다시 인접할 수 있으므로 변화가 없을 때까지)
+void mergeNear(std::vector<RegionRect>& rects, int gap) {
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (size_t i = 0; i < rects.size() && !merged; i++) {
+            for (size_t j = i + 1; j < rects.size(); j++) {
+                if (isNear(rects[i], rects[j], gap)) {
+                    rects[i] = unite(rects[i], rects[j]);
+                    rects.erase(rects.begin() + j);
+                    merged = true;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+// 병합 시 면적 증가가 가장 작은 쌍 병합
+void mergeCheapest(std::vector<RegionRect>& rects) {
+    size_t best_i = 0;
+    size_t best_j = 1;
+    long long best_growth = -1;
+
+    for (size_t i = 0; i < rects.size(); i++) {
+        for (size_t j = i + 1; j < rects.size(); j++) {
+            long long growth = unite(rects[i], rects[j]).area() - rects[i].area() - rects[j].area();
+            if (best_growth < 0 || growth < best_growth) {
+                best_growth = growth;
+                best_i = i;
+                best_j = j;
+            }
+        }
+    }
+
+    rects[best_i] = unite(rects[best_i], rects[best_j]);
+    rects.erase(rects.begin() + best_j);
+}
+
+std::string trim(const std::string& s) {
+    size_t begin = s.find_first_not_of(" \t\r");
+    if (begin == std::string::npos) return "";
+    size_t end = s.find_last_not_of(" \t\r");
+    return s.substr(begin, end - begin + 1);
+}
+
+std::vector<int> splitInts(const std::string& s) {
+    std::vector<int> values;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ';')) {
+        item = trim(item);
+        if (item.empty()) continue;
+        values.push_back(std::stoi(item));
+    }
+    return values;
+}
+
+}  // namespace
+
+std::vector<RegionRect> computeInferenceRegions(const std::vector<roi>& polygons,
+                                                int frame_width, int frame_height,
+                                                const InferenceRegionParams& params) {
+    std::vector<RegionRect> rects;
+    if (frame_width <= 0 || frame_height <= 0) {
+        return rects;
+    }
+
+    int margin = std::max(0, params.margin_px);
+    int top_margin = std::max(0, params.top_margin_px);
+
+    // 폴리곤별 외곽 사각형 + 여유
+    for (const auto& polygon : polygons) {
+        if (polygon.empty()) continue;
+
+        double min_x = polygon[0].x, max_x = polygon[0].x;
+        double min_y = polygon[0].y, max_y = polygon[0].y;
+        for (const auto& pt : polygon) {
+            min_x = std::min(min_x, pt.x);
+            max_x = std::max(max_x, pt.x);
+            min_y = std::min(min_y, pt.y);
+            max_y = std::max(max_y, pt.y);
+        }
+
+        RegionRect r = alignRect(static_cast<int>(std::floor(min_x)) - margin,
+                                 static_cast<int>(std::floor(min_y)) - margin - top_margin,
+                                 static_cast<int>(std::ceil(max_x)) + margin,
+                                 static_cast<int>(std::ceil(max_y)) + margin,
+                                 frame_width, frame_height);
+        if (r.width > 0 && r.height > 0) {
+            rects.push_back(r);
+        }
+    }
+
+    if (rects.empty()) {
+        return rects;
+    }
+
+    // 인접 병합 후 개수 상한까지 축소 (정렬된 사각형의 합집합은 정렬 유지)
+    size_t max_rects = static_cast<size_t>(std::max(1, params.max_rects));
+    mergeNear(rects, margin);
+    while (rects.size() > max_rects) {
+        mergeCheapest(rects);
+        mergeNear(rects, margin);
+    }
+
+    // 면적 이득이 없으면 전체 프레임 추론 유지
+    long long total_area = 0;
+    for (const auto& r : rects) {
+        total_area += r.area();
+    }
+    double coverage = static_cast<double>(total_area) / (static_cast<double>(frame_width) * frame_height);
+    if (coverage > params.max_coverage) {
+        rects.clear();
+    }
+
+    return rects;
+}
+
+RegionTransform computeRegionTransform(const RegionRect& region, int network_width, int network_height) {
+    RegionTransform t;
+    t.region = region;
+    if (region.width <= 0 || region.height <= 0 || network_width <= 0 || network_height <= 0) {
+        t.scale = 0.0;
+        return t;
+    }
+
+    t.scale = std::min(static_cast<double>(network_width) / region.width,
+                       static_cast<double>(network_height) / region.height);
+    t.pad_x = (network_width - region.width * t.scale) / 2.0;
+    t.pad_y = (network_height - region.height * t.scale) / 2.0;
+    return t;
+}
+
+bool parseNvInferConfig(const std::string& content, NvInferModelParams& params, std::string& error) {
+    params = NvInferModelParams{};
+
+    std::istringstream in(content);
+    std::string line;
+    std::string group;
+    std::vector<int> dims;
+    bool order_set = false;
+
+    try {
+        while (std::getline(in, line)) {
+            line = trim(line);
+            if (line.empty() || line[0] == '#') continue;
+
+            if (line.front() == '[' && line.back() == ']') {
+                group = line.substr(1, line.size() - 2);
+                continue;
+            }
+            if (group != "property") continue;
+
+            size_t eq = line.find('=');
+            if (eq == std::string::npos) continue;
+            std::string key = trim(line.substr(0, eq));
+            std::string value = trim(line.substr(eq + 1));
+
+            if (key == "infer-dims") {
+                dims = splitInts(value);                // C;H;W
+            } else if ((key == "uff-input-dims" || key == "input-dims") && dims.empty()) {
+                dims = splitInts(value);                // C;H;W;order (구버전)
+                if (dims.size() >= 4 && !order_set) {
+                    params.input_order = dims[3];
+                }
+            } else if (key == "uff-input-order") {
+                params.input_order = std::stoi(value);
+                order_set = true;
+            } else if (key == "model-color-format") {
+                params.color_format = std::stoi(value);
+            } else if (key == "net-scale-factor") {
+                params.net_scale_factor = std::stod(value);
+            } else if (key == "offsets") {
+                params.offsets = value;
+            } else if (key == "uff-input-blob-name") {
+                params.tensor_name = value;
+            } else if (key == "batch-size") {
+                params.batch_size = std::stoi(value);
+            }
+        }
+    } catch (const std::exception& e) {
+        error = "잘못된 값: " + line;
+        return false;
+    }
+
+    if (dims.size() < 3 || dims[0] <= 0 || dims[1] <= 0 || dims[2] <= 0) {
+        error = "입력 크기(infer-dims/uff-input-dims) 없음";
+        return false;
+    }
+
+    params.channels = dims[0];
+    params.height = dims[1];
+    params.width = dims[2];
+    return true;
+}
+
+bool checkPreprocessLibrary(const std::string& path, std::string& error) {
+    if (path.empty()) {
+        error = "custom_lib_path 없음";
+        return false;
+    }
+
+    void* handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (!handle) {
+        const char* msg = dlerror();
+        error = msg ? msg : "dlopen 실패";
+        return false;
+    }
+
+    bool ok = true;
+    for (const char* symbol : {"CustomTensorPreparation", "CustomAsyncTransformation"}) {
+        if (!dlsym(handle, symbol)) {
+            error = std::string("필수 함수 없음: ") + symbol;
+            ok = false;
+            break;
+        }
+    }
+
+    dlclose(handle);
+    return ok;
+}
+
+std::string buildPreprocessConfig(const std::vector<RegionRect>& regions, int num_sources,
+                                  const PreprocessParams& params) {
+    const NvInferModelParams& model = params.model;
+    int batch = static_cast<int>(regions.size()) * std::max(1, num_sources);
+
+    std::ostringstream ss;
+    ss << "[property]\n"
+       << "enable=1\n"
+       << "target-unique-ids=" << params.gie_unique_id << "\n"
+       << "network-input-order=" << model.input_order << "\n"
+       << "process-on-frame=1\n"
+       << "unique-id=" << params.gie_unique_id + 100 << "\n"
+       << "gpu-id=0\n"
+       << "maintain-aspect-ratio=1\n"
+       << "symmetric-padding=1\n"
+       << "processing-width=" << model.width << "\n"
+       << "processing-height=" << model.height << "\n"
+       << "scaling-buf-pool-size=6\n"
+       << "tensor-buf-pool-size=6\n"
+       << "network-input-shape=" << batch << ";";
+    if (model.input_order == 1) {
+        ss << model.height << ";" << model.width << ";" << model.channels << "\n";     // NHWC
+    } else {
+        ss << model.channels << ";" << model.height << ";" << model.width << "\n";     // NCHW
+    }
+    ss << "network-color-format=" << model.color_format << "\n"
+       << "tensor-data-type=0\n"
+       << "tensor-name=" << model.tensor_name << "\n"
+       << "scaling-pool-memory-type=0\n"
+       << "scaling-pool-compute-hw=0\n"
+       << "scaling-filter=0\n"
+       << "custom-lib-path=" << params.custom_lib_path << "\n"
+       << "custom-tensor-preparation-function=CustomTensorPreparation\n"
+       << "\n"
+       << "[user-configs]\n"
+       << "pixel-normalization-factor=" << std::setprecision(10) << model.net_scale_factor << "\n";
+    if (!model.offsets.empty()) {
+        ss << "offsets=" << model.offsets << "\n";
+    }
+    ss << "\n"
+       << "[group-0]\n"
+       << "src-ids=";
+    for (int i = 0; i < std::max(1, num_sources); i++) {
+        ss << (i > 0 ? ";" : "") << i;
+    }
+    ss << "\n"
+       << "custom-input-transformation-function=CustomAsyncTransformation\n"
+       << "process-on-roi=1\n";
+
+    for (int i = 0; i < std::max(1, num_sources); i++) {
+        ss << "roi-params-src-" << i << "=";
+        for (size_t k = 0; k < regions.size(); k++) {
+            const auto& r = regions[k];
+            ss << (k > 0 ? ";" : "") << r.left << ";" << r.top << ";" << r.width << ";" << r.height;
+        }
+        ss << "\n";
+    }
+
+    return ss.str();
+}
@@ -0,0 +1,135 @@
+﻿#ifndef INFERENCE_REGION_H
+#define INFERENCE_REGION_H
+
+#include <string>
+#include <vector>
+#include "roi_utils.h"
+
+/**
+ * @brief 추론 영역 사각형 (streammux 해상도 픽셀 좌표)
+ */
+struct RegionRect {
+    int left = 0;
+    int top = 0;
+    int width = 0;
+    int height = 0;
+
+    int right() const { return left + width; }
+    int bottom() const { return top + height; }
+    long long area() const { return static_cast<long long>(width) * height; }
+};
+
+/**
+ * @brief 추론 영역 계산 파라미터 (processing_modules.inference_region)
+ */
+struct InferenceRegionParams {
+    int margin_px = 32;             // ROI 외곽 여유 (전 방향)
+    int top_margin_px = 160;        // 위쪽 추가 여유 (ROI는 객체 하단 중심 기준이므로 차체 높이만큼)
+    int max_rects = 1;              // 최대 사각형 수
+    double max_coverage = 0.85;     // 프레임 대비 면적 비율이 이 값을 넘으면 전체 프레임 추론 유지
+};
+
+/**
+ * @brief primary GIE(nvinfer) 설정 파일에서 읽은 모델 입력 규격
+ */
+struct NvInferModelParams {
+    int channels = 0;                       // infer-dims / uff-input-dims / input-dims
+    int height = 0;
+    int width = 0;
+    int input_order = 0;                    // 0: NCHW, 1: NHWC
+    int color_format = 0;                   // model-color-format (0: RGB, 1: BGR, 2: GRAY)
+    double net_scale_factor = 1.0;          // net-scale-factor
+    std::string offsets;                    // offsets (채널별 평균, ';' 구분)
+    std::string tensor_name;                // uff-input-blob-name (없으면 빈 문자열)
+    int batch_size = 1;                     // batch-size
+};
+
+/**
+ * @brief nvdspreprocess 설정 생성 파라미터
+ */
+struct PreprocessParams {
+    int gie_unique_id = 1;                  // 대상 primary GIE unique-id
+    NvInferModelParams model;               // 모델 입력 규격 (pgie 설정과 동일해야 함)
+    std::string custom_lib_path;
+};
+
+/**
+ * @brief 추론 영역 <-> 네트워크 입력 좌표 변환
+ *
+ * nvdspreprocess(maintain-aspect-ratio=1, symmetric-padding=1)가 영역을 네트워크 입력으로
+ * 스케일하는 방식과 동일하며, nvinfer(input-tensor-meta)가 검출 결과를 프레임 좌표로
+ * 되돌릴 때의 역변환과 같음
+ */
+struct RegionTransform {
+    RegionRect region;
+    double scale = 1.0;                     // 네트워크 픽셀 / 프레임 픽셀
+    double pad_x = 0.0;                     // 좌우 패딩 (네트워크 픽셀, 한쪽)
+    double pad_y = 0.0;                     // 상하 패딩 (네트워크 픽셀, 한쪽)
+
+    void toNetwork(double fx, double fy, double& nx, double& ny) const {
+        nx = (fx - region.left) * scale + pad_x;
+        ny = (fy - region.top) * scale + pad_y;
+    }
+
+    void toFrame(double nx, double ny, double& fx, double& fy) const {
+        fx = (nx - pad_x) / scale + region.left;
+        fy = (ny - pad_y) / scale + region.top;
+    }
+};
+
+/**
+ * @brief ROI 폴리곤들을 감싸는 추론 영역 계산
+ *
+ * 폴리곤별 외곽 사각형에 여유를 더한 뒤, 겹치거나 margin_px 이내로 인접한 사각형을 병합하고
+ * max_rects 개가 될 때까지 병합 시 면적 증가가 가장 작은 쌍을 병합
+ * 결과 사각형끼리는 겹치지 않음 (중복 검출 방지)
+ * @param polygons ROI 폴리곤 목록
+ * @param frame_width 프레임 너비
+ * @param frame_height 프레임 높이
+ * @param params 계산 파라미터
+ * @return 추론 영역 목록 (ROI 없음 또는 면적 이득 없음이면 빈 목록 = 전체 프레임)
+ */
+std::vector<RegionRect> computeInferenceRegions(const std::vector<roi>& polygons,
+                                                int frame_width, int frame_height,
+                                                const InferenceRegionParams& params);
+
+/**
+ * @brief 추론 영역의 네트워크 입력 좌표 변환 계산
+ * @param region 추론 영역
+ * @param network_width 네트워크 입력 너비
+ * @param network_height 네트워크 입력 높이
+ * @return 좌표 변환 (영역 또는 네트워크 크기가 0이면 scale 0)
+ */
+RegionTransform computeRegionTransform(const RegionRect& region, int network_width, int network_height);
+
+/**
+ * @brief nvinfer 설정 파일 내용에서 모델 입력 규격 추출 ([property] 그룹)
+ * @param content 설정 파일 내용
+ * @param params 추출 결과
+ * @param error 실패 사유
+ * @return 입력 크기(dims)를 찾으면 true
+ */
+bool parseNvInferConfig(const std::string& content, NvInferModelParams& params, std::string& error);
+
+/**
+ * @brief nvdspreprocess 커스텀 라이브러리 확인 (로드 + 필수 함수 존재)
+ * @param path 라이브러리 경로
+ * @param error 실패 사유
+ * @return 사용 가능하면 true
+ */
+bool checkPreprocessLibrary(const std::string& path, std::string& error);
+
+/**
+ * @brief nvdspreprocess 설정 파일 내용 생성
+ *
+ * 모든 소스에 같은 추론 영역을 적용 (roi-params-src-N)
+ * nvinfer(input-tensor-meta)는 ROI 메타로 검출 결과를 프레임 좌표로 되돌리므로 후단 처리 변경 없음
+ * @param regions 추론 영역 목록
+ * @param num_sources 소스 수
+ * @param params 모델 입력 규격 / 커스텀 라이브러리
+ * @return 설정 파일 내용
+ */
+std::string buildPreprocessConfig(const std::vector<RegionRect>& regions, int num_sources,
+                                  const PreprocessParams& params);
+
+#endif // INFERENCE_REGION_H
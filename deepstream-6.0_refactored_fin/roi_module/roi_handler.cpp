@@ -541,4 +541,25 @@ bool ROIHandler::isInCalibrationROI(const ObjPoint& pos) const {
 
     // 폴리곤 내부 판단
     return insidePolygon(pos, calibration_roi);
-}
\ No newline at end of file
+}
+
+std::vector<roi> ROIHandler::getAllROIs() const {
+    std::vector<roi> rois;
+
+    for (const auto& pair : single_roi_map) {
+        if (pair.second && !pair.second->empty()) {
+            rois.push_back(*pair.second);
+        }
+    }
+
+    for (const auto& pair : multi_roi_map) {
+        if (!pair.second) continue;
+        for (const auto& entry : *pair.second) {
+            if (!entry.second.empty()) {
+                rois.push_back(entry.second);
+            }
+        }
+    }
+
+    return rois;
+}
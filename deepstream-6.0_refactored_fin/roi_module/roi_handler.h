@@ -192,6 +192,12 @@ public:
      * @return Calibration ROI 내부이면 true, 외부이면 false 반환
      */
     bool isInCalibrationROI(const ObjPoint& pos) const;
+
+    /**
+     * @brief 로드된 모든 ROI 폴리곤을 반환하는 함수 (추론 영역 계산용)
+     * @return 비어있지 않은 ROI 폴리곤 목록
+     */
+    std::vector<roi> getAllROIs() const;
 };
 
 #endif
\ No newline at end of file
@@ -10,11 +10,14 @@
 
 #include "system_manager.h"
 #include "../../analytics/queue/queue_analyzer.h"
+#include "../../calibration/calibration.h"
 #include "../../image/image_cropper.h"
 #include "../../image/image_storage.h"
 #include "../../monitoring/car_presence.h"
 #include "../../monitoring/pedestrian_presence.h"
 #include "../../utils/config_manager.h"
+#include "../../utils/heartbeat_registry.h"
+#include "../../utils/memory_budget.h"
 #include <chrono>
 
 SystemManager::SystemManager() {
@@ -40,6 +43,10 @@ bool SystemManager::initialize(const std::string& config_path,
         
         // ROI Handler 저장
         roi_handler_ = roi_handler;
+        if (roi_handler_) {
+            std::lock_guard<std::mutex> lock(lane_counts_mutex_);
+            last_lane_counts_.reset(static_cast<int>(roi_handler_->lane_roi.size()));
+        }
         logger->info("ROI Handler 설정 완료");
         
         // ====== 1단계: 기반 인프라 초기화 ======
@@ -52,6 +59,23 @@ bool SystemManager::initialize(const std::string& config_path,
         }
         logger->info("Redis 연결 성공");
         
+        // 1-1-1. 전송 스케줄러 (Presence/대기행렬 채널)
+        if (config.isPublishPolicyEnabled()) {
+            RedisClient* redis = redis_client_.get();
+            publish_scheduler_ = std::make_unique<PublishScheduler>(
+                [redis](int channel_type, const std::string& data) {
+                    return redis->sendData(channel_type, data);
+                });
+            if (publish_scheduler_->initialize()) {
+                logger->info("전송 스케줄러 초기화 성공");
+            } else {
+                logger->warn("전송 스케줄러 초기화 실패 - Redis 직접 전송 사용");
+                publish_scheduler_.reset();
+            }
+        } else {
+            logger->info("전송 스케줄러 비활성 (config.json에서 false로 설정됨)");
+        }
+        
         // 1-2. SQLite 핸들러 초기화
         sqlite_handler_ = std::make_unique<SQLiteHandler>();
         if (!sqlite_handler_->isHealthy()) {
@@ -76,6 +100,7 @@ bool SystemManager::initialize(const std::string& config_path,
         if (config.isVehiclePresenceEnabled()) {
             if (roi_handler_) {
                 car_presence_ = std::make_unique<CarPresence>(*roi_handler_, *redis_client_);
+                car_presence_->setPublishScheduler(publish_scheduler_.get());
                 if (car_presence_->initialize()) {
                     logger->info("차량 Presence 모듈 초기화 성공");
                 } else {
@@ -93,6 +118,7 @@ bool SystemManager::initialize(const std::string& config_path,
         if (config.isPedestrianPresenceEnabled()) {
             if (roi_handler_) {
                 ped_presence_ = std::make_unique<PedestrianPresence>(*roi_handler_, *redis_client_);
+                ped_presence_->setPublishScheduler(publish_scheduler_.get());
                 if (ped_presence_->initialize()) {
                     logger->info("보행자 Presence 모듈 초기화 성공");
                 } else {
@@ -131,10 +157,12 @@ bool SystemManager::initialize(const std::string& config_path,
                 logger->info("Special Site 모드 활성화로 대기행렬 분석기 비활성화");
             } else {
                 queue_analyzer_ = std::make_unique<QueueAnalyzer>();
-                if (!queue_analyzer_->initialize(redis_client_.get())) {
+                int queue_lanes = roi_handler_ ? static_cast<int>(roi_handler_->lane_roi.size()) : 0;
+                if (!queue_analyzer_->initialize(redis_client_.get(), queue_lanes)) {
                     logger->error("대기행렬 분석기 초기화 실패");
                     return false;
                 }
+                queue_analyzer_->setPublishScheduler(publish_scheduler_.get());
                 logger->info("대기행렬 분석기 초기화 성공");
             }
         } else {
@@ -178,6 +206,17 @@ bool SystemManager::initialize(const std::string& config_path,
             }
         }
         
+        // 3-4. PET 감시 생성 (횡단보도 ROI + Calibration 필요)
+        if (config.isPETEnabled()) {
+            pet_monitor_ = std::make_unique<PETMonitor>();
+            if (pet_monitor_->initialize(redis_client_.get(), roi_handler_)) {
+                logger->info("PET 감시 초기화 성공");
+            } else {
+                logger->warn("PET 감시 초기화 실패 - PET 감시 없이 계속");
+                pet_monitor_.reset();
+            }
+        }
+        
         // ====== 4단계: 이미지 캡처 핸들러 초기화 및 연결 ======
         
         if (image_cropper && image_storage) {
@@ -247,7 +286,110 @@ bool SystemManager::initialize(const std::string& config_path,
             }
         }
 
-        // 5-2. 신호 계산기 초기화
+        // 5-1-1. 교차로 주기 집계 (신호현시 통계 콜백으로 연결)
+        if (config.isIntersectionEnabled() && stats_gen_) {
+            intersection_aggregator_ = std::make_unique<IntersectionAggregator>();
+            if (intersection_aggregator_->initialize(redis_client_.get(), site_info_.spot_ints_id)) {
+                IntersectionAggregator* aggregator = intersection_aggregator_.get();
+                stats_gen_->setSignalStatsCallback([aggregator](const StatsDataPacket& packet) {
+                    aggregator->onSignalStats(packet);
+                });
+                // 교차로 레코드 1개로 대체 - 접근로별 신호현시 통계는 전송하지 않음
+                if (intersection_aggregator_->replacesApproachStats()) {
+                    stats_gen_->setSignalStatsPublish(false);
+                    logger->info("접근로별 신호현시 통계 전송 생략 (교차로 주기 레코드로 대체)");
+                }
+                logger->info("교차로 주기 집계 초기화 성공 - 역할: {}",
+                            intersection_aggregator_->isLeader() ? "leader" : "member");
+            } else {
+                logger->warn("교차로 주기 집계 초기화 실패 - 비활성화");
+                intersection_aggregator_.reset();
+            }
+        } else {
+            logger->info("교차로 주기 집계 비활성 (config.json 설정 또는 통계 비활성)");
+        }
+
+        // 5-2. 실시간 LOS 모니터 초기화
+        if (config.isLOSEnabled()) {
+            if (roi_handler_ && !roi_handler_->lane_roi.empty()) {
+                los_monitor_ = std::make_unique<LOSMonitor>();
+                if (los_monitor_->initialize(redis_client_.get(), roi_handler_,
+                                             roi_handler_->lane_roi.size())) {
+                    logger->info("LOS 모니터 초기화 성공");
+                } else {
+                    logger->warn("LOS 모니터 초기화 실패 - 비활성화");
+                    los_monitor_.reset();
+                }
+            } else {
+                logger->warn("차선 ROI 없음 - LOS 모니터 비활성화");
+            }
+        } else {
+            logger->info("LOS 모니터 비활성 (config.json 설정 또는 차량 2K/Special Site 조건)");
+        }
+
+        // 5-2-1. 주기 도착 분석 (신호 변경 콜백 수신 - 신호 계산기 시작 전 생성)
+        if (config.isArrivalEnabled()) {
+            bool signal_available = site_info_mgr_->isSignalDbEnabled() &&
+                                    site_info_.supports_signal_calc && site_info_.target_signal > 0;
+            if (!signal_available) {
+                logger->warn("신호역산 미지원 - 주기 도착 분석 비활성화");
+            } else if (roi_handler_ && !roi_handler_->lane_roi.empty()) {
+                arrival_monitor_ = std::make_unique<ArrivalMonitor>();
+                if (arrival_monitor_->initialize(redis_client_.get(), roi_handler_->lane_roi.size())) {
+                    logger->info("주기 도착 분석 초기화 성공");
+                } else {
+                    logger->warn("주기 도착 분석 초기화 실패 - 비활성화");
+                    arrival_monitor_.reset();
+                }
+            } else {
+                logger->warn("차선 ROI 없음 - 주기 도착 분석 비활성화");
+            }
+        } else {
+            logger->info("주기 도착 분석 비활성 (config.json 설정 또는 차량 2K/Special Site 조건)");
+        }
+
+        // 5-2-2. split failure 감지 (신호 변경 콜백 수신 - 신호 계산기 시작 전 생성)
+        if (config.isSplitFailureEnabled()) {
+            bool signal_available = site_info_mgr_->isSignalDbEnabled() &&
+                                    site_info_.supports_signal_calc && site_info_.target_signal > 0;
+            if (!signal_available) {
+                logger->warn("신호역산 미지원 - split failure 감지 비활성화");
+            } else if (roi_handler_ && !roi_handler_->lane_roi.empty()) {
+                split_failure_detector_ = std::make_unique<SplitFailureDetector>();
+                if (split_failure_detector_->initialize(redis_client_.get(), roi_handler_,
+                                                        roi_handler_->lane_roi.size())) {
+                    logger->info("split failure 감지 초기화 성공");
+                } else {
+                    logger->warn("split failure 감지 초기화 실패 - 비활성화");
+                    split_failure_detector_.reset();
+                }
+            } else {
+                logger->warn("차선 ROI 없음 - split failure 감지 비활성화");
+            }
+        } else {
+            logger->info("split failure 감지 비활성 (config.json 설정 또는 차량 2K/Special Site 조건)");
+        }
+
+        // 5-2-3. 보행자 대기 분석 (보행 시작 = 신호 변경 콜백 - 신호 계산기 시작 전 생성)
+        if (config.isPedestrianWaitingEnabled()) {
+            bool signal_available = site_info_mgr_->isSignalDbEnabled() &&
+                                    site_info_.supports_signal_calc && site_info_.target_signal > 0;
+            if (!signal_available) {
+                logger->warn("신호역산 미지원 - 보행자 대기 분석 비활성화");
+            } else if (roi_handler_) {
+                ped_wait_monitor_ = std::make_unique<PedestrianWaitMonitor>();
+                if (ped_wait_monitor_->initialize(redis_client_.get(), roi_handler_)) {
+                    logger->info("보행자 대기 분석 초기화 성공");
+                } else {
+                    logger->warn("보행자 대기 분석 초기화 실패 - 비활성화");
+                    ped_wait_monitor_.reset();
+                }
+            } else {
+                logger->warn("ROI Handler 없음 - 보행자 대기 분석 비활성화");
+            }
+        }
+
+        // 5-3. 신호 계산기 초기화
         if (site_info_mgr_->isSignalDbEnabled()) {
             // 신호역산이 지원되고 타겟 신호가 유효한 경우
             if (site_info_.supports_signal_calc && site_info_.target_signal > 0) {
@@ -272,6 +414,18 @@ bool SystemManager::initialize(const std::string& config_path,
                 } else {
                     logger->error("신호 계산기 시작 실패");
                     signal_calc_.reset();
+                    if (arrival_monitor_) {
+                        logger->warn("신호 없음 - 주기 도착 분석 비활성화");
+                        arrival_monitor_.reset();
+                    }
+                    if (split_failure_detector_) {
+                        logger->warn("신호 없음 - split failure 감지 비활성화");
+                        split_failure_detector_.reset();
+                    }
+                    if (ped_wait_monitor_) {
+                        logger->warn("신호 없음 - 보행자 대기 분석 비활성화");
+                        ped_wait_monitor_.reset();
+                    }
                 }
             } else {
                 logger->info("신호역산 미지원 또는 타겟 신호 없음 - 인터벌 통계만 생성 가능");
@@ -284,23 +438,88 @@ bool SystemManager::initialize(const std::string& config_path,
             }
         }
         
+        // 5-4. 추론 간격 제어기 초기화 (nvinfer 연결은 파이프라인 생성 후)
+        if (config.isInferenceControlEnabled()) {
+            inference_controller_ = std::make_unique<InferenceIntervalController>();
+            if (inference_controller_->initialize()) {
+                logger->info("추론 간격 제어기 초기화 성공");
+            } else {
+                logger->warn("추론 간격 제어기 초기화 실패 - 매 프레임 추론 유지");
+                inference_controller_.reset();
+            }
+        } else {
+            logger->info("추론 간격 제어기 비활성 (config.json 설정 또는 4K 메타 활성)");
+        }
+        
+        // 5-5. 체크포인트 (분석 모듈 생성 후 섹션 등록, 복원은 첫 버퍼 처리 시)
+        if (config.isCheckpointEnabled()) {
+            checkpoint_mgr_ = std::make_unique<CheckpointManager>();
+            if (checkpoint_mgr_->initialize(computeCheckpointFingerprint())) {
+                registerCheckpointSections();
+                logger->info("체크포인트 초기화 성공");
+            } else {
+                logger->warn("체크포인트 초기화 실패 - 상태 저장 없이 계속");
+                checkpoint_mgr_.reset();
+            }
+        } else {
+            logger->info("체크포인트 비활성 (config.json에서 false로 설정됨)");
+        }
+        
+        // 5-6. 프로세스 자원 텔레메트리 (샘플링은 start 이후)
+        if (config.isTelemetryEnabled()) {
+            telemetry_ = std::make_unique<ProcessTelemetry>();
+            if (telemetry_->initialize(redis_client_.get())) {
+                logger->info("텔레메트리 초기화 성공");
+            } else {
+                logger->warn("텔레메트리 초기화 실패 - 자원 사용량 샘플링 없이 계속");
+                telemetry_.reset();
+            }
+        } else {
+            logger->info("텔레메트리 비활성 (config.json에서 false로 설정됨)");
+        }
+        
+        // 5-7. 프레임 누락 감지 (누락률 전송은 Redis 사용)
+        if (config.isFrameGapEnabled()) {
+            frame_gap_detector_ = std::make_unique<FrameGapDetector>();
+            if (frame_gap_detector_->initialize(redis_client_.get())) {
+                logger->info("프레임 누락 감지기 초기화 성공");
+            } else {
+                logger->warn("프레임 누락 감지기 초기화 실패 - 누락 감지 없이 계속");
+                frame_gap_detector_.reset();
+            }
+        } else {
+            logger->info("프레임 누락 감지 비활성 (config.json에서 false로 설정됨)");
+        }
+        
         // ====== 6단계: 최종 상태 로그 ======
         logger->info("=== 활성 모듈 요약 ===");
         logger->info("  기반 인프라:");
         logger->info("    - Redis: 활성");
         logger->info("    - SQLite: 활성");
+        logger->info("    - 전송 스케줄러: {}", publish_scheduler_ ? "활성" : "비활성");
         logger->info("    - 사이트 정보: 활성 (CAM ID: {})", site_info_.spot_camr_id);
         
         logger->info("  Presence 모듈:");
         logger->info("    - 차량 Presence: {}", car_presence_ ? "활성" : "비활성");
         logger->info("    - 보행자 Presence: {}", ped_presence_ ? "활성" : "비활성");
+        logger->info("    - 보행자 대기 분석: {}", ped_wait_monitor_ ? "활성" : "비활성");
         
         logger->info("  분석 모듈:");
         logger->info("    - 통계 생성기: {}", stats_gen_ ? "활성" : "비활성");
         logger->info("    - 대기행렬 분석: {}", queue_analyzer_ ? "활성" : "비활성");
+        logger->info("    - 실시간 LOS: {}", los_monitor_ ? "활성" : "비활성");
+        logger->info("    - 주기 도착 분석: {}", arrival_monitor_ ? "활성" : "비활성");
+        logger->info("    - split failure 감지: {}", split_failure_detector_ ? "활성" : "비활성");
+        logger->info("    - 교차로 주기 집계: {}", intersection_aggregator_ ? 
+                    (intersection_aggregator_->isLeader() ? "활성 (leader)" : "활성 (member)") : "비활성");
         logger->info("    - 돌발상황 감지: {}", incident_detector_ ? "활성" : "비활성");
+        logger->info("    - PET 근접 충돌: {}", pet_monitor_ ? "활성" : "비활성");
         logger->info("    - 신호 계산기: {}", signal_calc_ ? "활성" : "비활성");
         logger->info("    - 이미지 캡처: {}", image_capture_handler_ ? "활성" : "비활성");
+        logger->info("    - 추론 간격 제어: {}", inference_controller_ ? "활성" : "비활성");
+        logger->info("    - 체크포인트: {}", checkpoint_mgr_ ? "활성" : "비활성");
+        logger->info("    - 텔레메트리: {}", telemetry_ ? "활성" : "비활성");
+        logger->info("    - 프레임 누락 감지: {}", frame_gap_detector_ ? "활성" : "비활성");
         logger->info("    - Special Site: {}", 
                     (special_site_adapter_ && special_site_adapter_->isActive()) ? "활성" : "비활성");
         
@@ -321,12 +540,41 @@ void SystemManager::start() {
     
     running_ = true;
     
+    // 스레드 정지 감시 (각 스레드는 자체 시작 시 하트비트 등록)
+    HeartbeatRegistry::getInstance().startSupervisor();
+    
+    // 텔레메트리 샘플러 (다른 모듈 스레드 시작 전 기준 샘플)
+    if (telemetry_) {
+        telemetry_->start();
+    }
+    
+    // 체크포인트 기록 스레드 (복원은 첫 버퍼 처리 시 restoreCheckpoint에서)
+    if (checkpoint_mgr_) {
+        checkpoint_mgr_->start();
+    }
+    
+    // SQLite WAL 체크포인트 스레드 (삽입 연결 대신 주기적으로 PASSIVE 체크포인트)
+    if (sqlite_handler_) {
+        sqlite_handler_->startMaintenance();
+    }
+    
+    // 전송 스케줄러 시작 (Presence/대기행렬 전송 전)
+    if (publish_scheduler_) {
+        publish_scheduler_->start();
+        logger->info("전송 스케줄러 시작");
+    }
+    
     // 통계 생성기 시작 (내부 타이머 시작)
     if (stats_gen_) {
         stats_gen_->start();
         logger->info("통계 생성기 시작");
     }
     
+    // 교차로 주기 집계 (leader만 구독 스레드 시작)
+    if (intersection_aggregator_) {
+        intersection_aggregator_->start();
+    }
+    
     // 신호 계산기는 initialize에서 이미 시작됨
     
     // 대기행렬 분석기는 이벤트 기반이므로 별도 시작 불필요
@@ -357,8 +605,28 @@ void SystemManager::stop() {
     
     running_ = false;
     
+    // 스레드 정지 감시 먼저 중지 (스레드 join 대기 중 정지 오탐 방지)
+    HeartbeatRegistry::getInstance().stopSupervisor();
+    
     // 모듈 중지 (역순)
     
+    // 체크포인트 기록 스레드 (대기 중인 스냅샷 기록 후 종료)
+    if (checkpoint_mgr_) {
+        auto start = std::chrono::steady_clock::now();
+        checkpoint_mgr_->stop();
+        checkpoint_mgr_.reset();
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>
+                      (std::chrono::steady_clock::now() - start);
+        logger->info("체크포인트 중지 완료: {}ms", elapsed.count());
+    }
+    
+    // 추론 간격 제어기 (nvinfer 참조 해제)
+    if (inference_controller_) {
+        inference_controller_->logStatistics();
+        inference_controller_.reset();
+        logger->info("추론 간격 제어기 중지 완료");
+    }
+    
     // Presence 모듈 먼저 중지 (통계 로깅)
     if (car_presence_) {
         auto start = std::chrono::steady_clock::now();
@@ -394,14 +662,47 @@ void SystemManager::stop() {
         logger->info("신호 계산기 중지 완료: {}ms", elapsed.count());
     }
     
+    // 교차로 주기 집계는 신호 계산기(콜백 발생원) 중지 후 중지
+    if (intersection_aggregator_) {
+        auto start = std::chrono::steady_clock::now();
+        intersection_aggregator_->stop();
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>
+                      (std::chrono::steady_clock::now() - start);
+        logger->info("교차로 주기 집계 중지 완료: {}ms", elapsed.count());
+    }
+    
+    // 전송 스케줄러는 Redis 연결 종료 전에 중지 (대기값 전송)
+    if (publish_scheduler_) {
+        auto start = std::chrono::steady_clock::now();
+        publish_scheduler_->stop();
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>
+                      (std::chrono::steady_clock::now() - start);
+        logger->info("전송 스케줄러 중지 완료: {}ms", elapsed.count());
+    }
+    
     // SQLite 연결 종료
     if (sqlite_handler_) {
         auto start = std::chrono::steady_clock::now();
+        sqlite_handler_->stopMaintenance();
+        sqlite_handler_->logStatistics();
         auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>
                       (std::chrono::steady_clock::now() - start);
         logger->info("SQLite 연결 종료 완료: {}ms", elapsed.count());
     }
     
+    // 프레임 누락 감지 (누적 누락률 기록 후 해제)
+    if (frame_gap_detector_) {
+        frame_gap_detector_->logStatistics();
+        frame_gap_detector_.reset();
+    }
+    
+    // 텔레메트리 샘플러 (다른 모듈 종료까지 샘플링, 전송하므로 Redis 종료 전에 중지)
+    if (telemetry_) {
+        telemetry_->stop();
+        telemetry_.reset();
+        logger->info("텔레메트리 중지 완료");
+    }
+    
     // Redis 연결은 마지막에 종료
     if (redis_client_) {
         auto start = std::chrono::steady_clock::now();
@@ -411,6 +712,9 @@ void SystemManager::stop() {
         logger->info("Redis 연결 종료 완료: {}ms", elapsed.count());
     }
     
+    // 추적 상태 메모리 사용량 (종료 시점)
+    MemoryBudget::getInstance().logStatistics();
+    
     // 전체 종료 시간
     auto total_elapsed = std::chrono::duration_cast<std::chrono::milliseconds>
                         (std::chrono::steady_clock::now() - total_start);
@@ -431,9 +735,14 @@ void SystemManager::updatePresenceModules(const std::map<int, ObjPoint>& vehicle
     if (ped_presence_ && ped_presence_->isEnabled()) {
         ped_presence_->updatePedestrians(pedestrian_positions, current_time);
     }
+    
+    // 보행자 대기 분석 (대기구역 진입/이탈만 갱신, 전송은 보행 시작 시)
+    if (ped_wait_monitor_) {
+        ped_wait_monitor_->updatePedestrians(pedestrian_positions, current_time);
+    }
 }
 
-void SystemManager::updatePerSecondData(const std::map<int, int>& lane_counts, int current_time) {
+void SystemManager::updatePerSecondData(const LaneArray<int>& lane_counts, int current_time) {
     if (!running_) return;
     
     // 1. 대기행렬 차로별 차량 수 업데이트 (적색 신호일 때만)
@@ -454,11 +763,42 @@ void SystemManager::updatePerSecondData(const std::map<int, int>& lane_counts, i
         stats_gen_->updateFrameData(lane_counts);
     }
     
+    // 3-1. 실시간 LOS 등급 갱신 (등급 변경시에만 전송)
+    if (los_monitor_) {
+        los_monitor_->updatePerSecond(current_time);
+    }
+    
+    // 3-2. split failure 판정 (적색 초반 관측 종료 시 주기 결과 전송)
+    if (split_failure_detector_) {
+        split_failure_detector_->updatePerSecond(current_time);
+    }
+    
     // 4. 돌발상황 감지기 정기 업데이트
     if (incident_detector_ && incident_detector_->isEnabled()) {
         incident_detector_->updatePerSecond(current_time);
     }
     
+    // 4-1. 추론 간격 갱신 (프레임 누적값 + Presence/신호 상태)
+    if (inference_controller_) {
+        ActivitySample sample;
+        sample.vehicle_present = car_presence_ && car_presence_->isPresent();
+        sample.pedestrian_present = ped_presence_ &&
+            (ped_presence_->isCrosswalkPresent() || ped_presence_->isWaitingAreaPresent());
+        sample.signal_known = signal_calc_ != nullptr;
+        sample.green = signal_calc_ && signal_calc_->isGreenSignal();
+        inference_controller_->updatePerSecond(sample, current_time);
+    }
+    
+    // 4-2. 분석 상태 체크포인트 캡처 (interval_sec마다, 파일 기록은 백그라운드)
+    if (checkpoint_mgr_) {
+        checkpoint_mgr_->capture(current_time);
+    }
+    
+    // 4-3. 소스별 프레임 누락률 전송 (publish_interval_sec마다)
+    if (frame_gap_detector_) {
+        frame_gap_detector_->updatePerSecond(current_time);
+    }
+    
     // 5. Presence 모듈 주기적 통계 출력 (5분마다)
     static auto last_presence_log_time = std::chrono::steady_clock::now();
     auto now = std::chrono::steady_clock::now();
@@ -471,10 +811,107 @@ void SystemManager::updatePerSecondData(const std::map<int, int>& lane_counts, i
         if (ped_presence_) {
             ped_presence_->logStatistics();
         }
+        if (publish_scheduler_) {
+            publish_scheduler_->logStatistics();
+        }
+        if (sqlite_handler_) {
+            sqlite_handler_->logStatistics();
+        }
+        if (los_monitor_) {
+            los_monitor_->logStatistics();
+        }
+        if (arrival_monitor_) {
+            arrival_monitor_->logStatistics();
+        }
+        if (split_failure_detector_) {
+            split_failure_detector_->logStatistics();
+        }
+        if (pet_monitor_) {
+            pet_monitor_->logStatistics();
+        }
+        if (stats_gen_ && stats_gen_->getLaneChangeCounter()) {
+            stats_gen_->getLaneChangeCounter()->logStatistics();
+        }
+        if (ped_wait_monitor_) {
+            ped_wait_monitor_->logStatistics();
+        }
+        if (intersection_aggregator_) {
+            intersection_aggregator_->logStatistics();
+        }
+        if (inference_controller_) {
+            inference_controller_->logStatistics();
+        }
+        if (checkpoint_mgr_) {
+            checkpoint_mgr_->logStatistics();
+        }
+        if (frame_gap_detector_) {
+            frame_gap_detector_->logStatistics();
+        }
+        MemoryBudget::getInstance().logStatistics();
+        if (telemetry_) {
+            telemetry_->logStatistics();
+        }
+        HeartbeatRegistry::getInstance().logStatistics();
         last_presence_log_time = now;
     }
 }
 
+void SystemManager::restoreCheckpoint(int current_time) {
+    if (!checkpoint_mgr_) return;
+    
+    auto start = std::chrono::steady_clock::now();
+    bool restored = checkpoint_mgr_->restore(current_time);
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>
+                  (std::chrono::steady_clock::now() - start);
+    logger->info("체크포인트 복원 {}: {}ms", restored ? "완료" : "없음", elapsed.count());
+}
+
+void SystemManager::registerCheckpointSections() {
+    if (stats_gen_) {
+        StatsGenerator* stats = stats_gen_.get();
+        checkpoint_mgr_->registerSection(CheckpointSection::STATS, "통계 누적값",
+            [stats](CheckpointWriter& w) { stats->saveCheckpoint(w); },
+            [stats](CheckpointReader& r, const CheckpointContext& c) { return stats->restoreCheckpoint(r, c); });
+    }
+    
+    if (queue_analyzer_) {
+        QueueAnalyzer* queue = queue_analyzer_.get();
+        checkpoint_mgr_->registerSection(CheckpointSection::QUEUE, "대기행렬",
+            [queue](CheckpointWriter& w) { queue->saveCheckpoint(w); },
+            [queue](CheckpointReader& r, const CheckpointContext& c) { return queue->restoreCheckpoint(r, c); });
+    }
+    
+    if (incident_detector_ && incident_detector_->isEnabled()) {
+        IncidentDetector* incident = incident_detector_.get();
+        checkpoint_mgr_->registerSection(CheckpointSection::INCIDENT, "돌발상황",
+            [incident](CheckpointWriter& w) { incident->saveCheckpoint(w); },
+            [incident](CheckpointReader& r, const CheckpointContext& c) { return incident->restoreCheckpoint(r, c); });
+    }
+}
+
+uint64_t SystemManager::computeCheckpointFingerprint() const {
+    uint64_t hash = CheckpointManager::HASH_SEED;
+    
+    // ROI 좌표 (차로/정지선/교차로 영역 변경 시 복원 안함)
+    if (roi_handler_) {
+        for (const auto& polygon : roi_handler_->getAllROIs()) {
+            for (const auto& pt : polygon) {
+                hash = CheckpointManager::hashBytes(hash, &pt.x, sizeof(pt.x));
+                hash = CheckpointManager::hashBytes(hash, &pt.y, sizeof(pt.y));
+            }
+        }
+    }
+    
+    // Calibration 값 (도로 평면 좌표 변경 시 복원 안함)
+    hash = CheckpointManager::hashBytes(hash, roadplane[0], sizeof(roadplane[0]));
+    hash = CheckpointManager::hashBytes(hash, &focal[0], sizeof(focal[0]));
+    hash = CheckpointManager::hashBytes(hash, &scale[0], sizeof(scale[0]));
+    hash = CheckpointManager::hashBytes(hash, &frameWidth[0], sizeof(frameWidth[0]));
+    hash = CheckpointManager::hashBytes(hash, &frameHeight[0], sizeof(frameHeight[0]));
+    
+    return hash;
+}
+
 void SystemManager::handleSignalChangeCallback(const SignalChangeEvent& event) {
     logger->info("신호 변경 콜백 수신: {} at {} (페이즈: {})", 
                 event.type == SignalChangeEvent::Type::GREEN_ON ? "GREEN_ON" : "GREEN_OFF",
@@ -492,7 +929,7 @@ void SystemManager::handleSignalChangeCallback(const SignalChangeEvent& event) {
         
         if (is_green) {
             // 녹색 신호 시작 - 잔여 차량으로 대기행렬 분석
-            std::map<int, int> residual_cars;
+            LaneArray<int> residual_cars;
             {
                 std::lock_guard<std::mutex> lock(lane_counts_mutex_);
                 residual_cars = last_lane_counts_;
@@ -523,7 +960,27 @@ void SystemManager::handleSignalChangeCallback(const SignalChangeEvent& event) {
         logger->debug("돌발상황 감지기에 신호 변경 이벤트 전달");
     }
     
-    // 4. 상태 업데이트
+    // 4. 추론 간격 제어기에 알림 (녹색 시작 시 즉시 매 프레임 추론)
+    if (inference_controller_) {
+        inference_controller_->onSignalChange(event.type == SignalChangeEvent::Type::GREEN_ON,
+                                              event.timestamp);
+    }
+    
+    // 5. 주기 도착 분석 / split failure 감지 / 보행자 대기 분석에 알림
+    if (arrival_monitor_) {
+        arrival_monitor_->onSignalChange(event.type == SignalChangeEvent::Type::GREEN_ON,
+                                         event.timestamp);
+    }
+    if (split_failure_detector_) {
+        split_failure_detector_->onSignalChange(event.type == SignalChangeEvent::Type::GREEN_ON,
+                                                event.timestamp);
+    }
+    if (ped_wait_monitor_) {
+        ped_wait_monitor_->onSignalChange(event.type == SignalChangeEvent::Type::GREEN_ON,
+                                          event.timestamp);
+    }
+    
+    // 6. 상태 업데이트
     last_signal_state_ = (event.type == SignalChangeEvent::Type::GREEN_ON);
 }
 
@@ -18,16 +18,28 @@
 #include <memory>
 #include <mutex>
 #include "site_info_manager.h"
+#include "../pipeline/frame_gap_detector.h"
+#include "../pipeline/inference_interval_controller.h"
 #include "../signal/signal_calculator.h"
+#include "../telemetry/process_telemetry.h"
+#include "../../analytics/congestion/los_monitor.h"
+#include "../../analytics/coordination/arrival_monitor.h"
+#include "../../analytics/coordination/split_failure_detector.h"
 #include "../../analytics/incident/incident_detector.h"
+#include "../../analytics/incident/pet_monitor.h"
+#include "../../analytics/intersection/intersection_aggregator.h"
 #include "../../analytics/queue/queue_analyzer.h"
 #include "../../analytics/statistics/stats_generator.h"
+#include "../../common/lane_array.h"
+#include "../../data/checkpoint/checkpoint_manager.h"
+#include "../../data/redis/publish_scheduler.h"
 #include "../../data/redis/redis_client.h"
 #include "../../data/sqlite/sqlite_handler.h"
 #include "../../detection/special/special_site_adapter.h"
 #include "../../image/image_capture_handler.h"
 #include "../../monitoring/car_presence.h"
 #include "../../monitoring/pedestrian_presence.h"
+#include "../../monitoring/pedestrian_waiting.h"
 #include "../../roi_module/roi_handler.h"
 
 #ifndef __logger__
@@ -48,16 +60,26 @@
  * 
  * 관리 모듈:
  * - RedisClient: 데이터 전송
+ * - PublishScheduler: Presence/대기행렬 채널 정책 기반 전송
  * - SQLiteHandler: 데이터베이스 관리
  * - SiteInfoManager: 사이트 정보 관리
  * - SignalCalculator: 신호 역산
  * - StatsGenerator: 통계 생성 (인터벌/신호현시)
  * - QueueAnalyzer: 대기행렬 분석
+ * - LOSMonitor: 실시간 차로별 서비스수준(LOS)
+ * - ArrivalMonitor: 신호 주기별 녹색 도착률/군집비
+ * - SplitFailureDetector: 정지선 구역 점유율 기반 주기 실패 감지
  * - IncidentDetector: 돌발상황 감지 (독립적 이미지 처리)
+ * - PETMonitor: 횡단보도 차량-보행자 PET(Post-Encroachment Time) 감시
  * - ImageCaptureHandler: 대기행렬 이미지 캡처 전용
  * - CarPresence: 차량 존재 감지 (독립적)
  * - PedestrianPresence: 보행자 존재 감지 (독립적)
+ * - PedestrianWaitMonitor: 대기구역별 보행자 대기 인원/시간 분포 (보행 시작 시 전송)
  * - SpecialSiteAdapter: Special Site 모드 처리
+ * - InferenceIntervalController: 장면 활동 기반 추론 간격 제어
+ * - CheckpointManager: 분석 상태 주기 저장 및 재시작 시 복원
+ * - ProcessTelemetry: 스레드별 CPU/RSS/fd/IO 사용량 샘플링
+ * - FrameGapDetector: 소스별 프레임 누락/공백 감지 및 누락률 전송
  */
 class SystemManager {
 private:
@@ -65,19 +87,38 @@ private:
     std::unique_ptr<SiteInfoManager> site_info_mgr_;
     std::unique_ptr<SignalCalculator> signal_calc_;
     std::unique_ptr<RedisClient> redis_client_;
+    std::unique_ptr<PublishScheduler> publish_scheduler_;
     std::unique_ptr<SQLiteHandler> sqlite_handler_;
     std::unique_ptr<StatsGenerator> stats_gen_;
+    std::unique_ptr<IntersectionAggregator> intersection_aggregator_;
     std::unique_ptr<QueueAnalyzer> queue_analyzer_;
+    std::unique_ptr<LOSMonitor> los_monitor_;
+    std::unique_ptr<ArrivalMonitor> arrival_monitor_;
+    std::unique_ptr<SplitFailureDetector> split_failure_detector_;
     std::unique_ptr<IncidentDetector> incident_detector_;
+    std::unique_ptr<PETMonitor> pet_monitor_;
     std::unique_ptr<ImageCaptureHandler> image_capture_handler_;
     
     // Presence 모듈들 (신호와 무관하게 독립적 운영)
     std::unique_ptr<CarPresence> car_presence_;
     std::unique_ptr<PedestrianPresence> ped_presence_;
+    std::unique_ptr<PedestrianWaitMonitor> ped_wait_monitor_;
     
     // Special Site 어댑터
     std::unique_ptr<SpecialSiteAdapter> special_site_adapter_;
     
+    // 추론 간격 제어기 (싱크는 파이프라인 생성 후 연결)
+    std::unique_ptr<InferenceIntervalController> inference_controller_;
+    
+    // 분석 상태 체크포인트 (복원은 첫 버퍼 처리 시)
+    std::unique_ptr<CheckpointManager> checkpoint_mgr_;
+    
+    // 프로세스 자원 텔레메트리 (전용 샘플러 스레드)
+    std::unique_ptr<ProcessTelemetry> telemetry_;
+    
+    // 프레임 누락 감지 (스트리밍 스레드에서 매 프레임 관측)
+    std::unique_ptr<FrameGapDetector> frame_gap_detector_;
+    
     // ROI Handler (차로 정보 획득용)
     ROIHandler* roi_handler_ = nullptr;  // 외부에서 초기화된 것을 받음
     
@@ -87,7 +128,7 @@ private:
     // 상태 추적
     std::atomic<bool> running_{false};
     std::atomic<bool> last_signal_state_{false};  // 이전 신호 상태
-    std::map<int, int> last_lane_counts_;         // 마지막 차로별 차량 수
+    LaneArray<int> last_lane_counts_;             // 마지막 차로별 차량 수
     std::mutex lane_counts_mutex_;
     
     // 로거
@@ -95,6 +136,8 @@ private:
     
     // 내부 메서드
     void handleSignalChangeCallback(const SignalChangeEvent& event);
+    void registerCheckpointSections();
+    uint64_t computeCheckpointFingerprint() const;
 
 public:
     SystemManager();
@@ -144,7 +187,16 @@ public:
      * process_meta에서 매 초마다 한 번만 호출
      * 신호 변경 체크 및 대기행렬 업데이트 자동 처리
      */
-    void updatePerSecondData(const std::map<int, int>& lane_counts, int current_time);
+    void updatePerSecondData(const LaneArray<int>& lane_counts, int current_time);
+    
+    /**
+     * @brief 체크포인트 복원 (체크포인트 비활성 시 무시)
+     * @param current_time 현재 시간
+     * 
+     * process_meta 첫 버퍼에서 1회 호출 (엔진 로딩 후 실제 처리 재개 시각 기준)
+     * deepstream_app의 섹션(det_obj, 4K 캡처 상태)은 그 전에 등록되어 있어야 함
+     */
+    void restoreCheckpoint(int current_time);
     
     /**
      * @brief 현재 신호 상태 조회
@@ -156,16 +208,27 @@ public:
      * @brief 모듈 참조 반환 (외부 모듈에서 사용)
      */
     StatsGenerator* getStatsGenerator() { return stats_gen_.get(); }
+    IntersectionAggregator* getIntersectionAggregator() { return intersection_aggregator_.get(); }
     RedisClient* getRedisClient() { return redis_client_.get(); }
+    PublishScheduler* getPublishScheduler() { return publish_scheduler_.get(); }
     SQLiteHandler* getSQLiteHandler() { return sqlite_handler_.get(); }
     SiteInfoManager* getSiteInfoManager() { return site_info_mgr_.get(); }
     SignalCalculator* getSignalCalculator() { return signal_calc_.get(); }
     QueueAnalyzer* getQueueAnalyzer() { return queue_analyzer_.get(); }
+    LOSMonitor* getLOSMonitor() { return los_monitor_.get(); }
+    ArrivalMonitor* getArrivalMonitor() { return arrival_monitor_.get(); }
+    SplitFailureDetector* getSplitFailureDetector() { return split_failure_detector_.get(); }
     IncidentDetector* getIncidentDetector() { return incident_detector_.get(); }
+    PETMonitor* getPETMonitor() { return pet_monitor_.get(); }
     ImageCaptureHandler* getImageCaptureHandler() { return image_capture_handler_.get(); }
     CarPresence* getCarPresence() { return car_presence_.get(); }
     PedestrianPresence* getPedestrianPresence() { return ped_presence_.get(); }
+    PedestrianWaitMonitor* getPedestrianWaitMonitor() { return ped_wait_monitor_.get(); }
     SpecialSiteAdapter* getSpecialSiteAdapter() { return special_site_adapter_.get(); }
+    InferenceIntervalController* getInferenceController() { return inference_controller_.get(); }
+    CheckpointManager* getCheckpointManager() { return checkpoint_mgr_.get(); }
+    ProcessTelemetry* getTelemetry() { return telemetry_.get(); }
+    FrameGapDetector* getFrameGapDetector() { return frame_gap_detector_.get(); }
 };
 
 #endif // SYSTEM_MANAGER_H
\ No newline at end of file
@@ -0,0 +1,274 @@
+﻿/*
+ * frame_gap_detector.cpp
+ *
+ * 소스별 프레임 누락/공백 감지기 구현
+ * - 프레임마다 frame_num/PTS 차이만 비교 (할당 없음)
+ * - 누락률은 전송 주기 단위로 집계 후 초기화, 누적값은 로그용으로 유지
+ */
+
+#include "frame_gap_detector.h"
+#include "../../data/redis/channel_types.h"
+#include "../../data/redis/redis_client.h"
+#include "../../json/json.h"
+#include "../../utils/config_manager.h"
+#include <algorithm>
+#include <cmath>
+
+FrameGapDetector::FrameGapDetector() {
+    logger = getLogger("DS_FrameGap_log");
+    logger->info("FrameGapDetector 생성");
+}
+
+bool FrameGapDetector::initialize(RedisClient* redis_client) {
+    try {
+        redis_client_ = redis_client;
+        loadConfig();
+        return configure(config_);
+
+    } catch (const std::exception& e) {
+        logger->error("프레임 누락 감지기 초기화 실패: {}", e.what());
+        return false;
+    }
+}
+
+void FrameGapDetector::loadConfig() {
+    auto& config = ConfigManager::getInstance();
+    const std::string base_key = "processing_modules.frame_gap";
+
+    config_.enabled = config.isFrameGapEnabled();
+    config_.camera_fps = config.getCameraFPS();
+    config_.gap_factor = config.getDouble(base_key + ".gap_factor", 1.5);
+    config_.publish_interval_sec = config.getInt(base_key + ".publish_interval_sec", 60);
+    config_.widen_speed_window = config.getBool(base_key + ".widen_speed_window", true);
+    config_.suspend_stop_line = config.getBool(base_key + ".suspend_stop_line", true);
+    config_.max_sources = config.getInt(base_key + ".max_sources", 8);
+}
+
+bool FrameGapDetector::configure(const FrameGapConfig& config) {
+    std::lock_guard<std::mutex> lock(gap_mutex_);
+
+    config_ = config;
+
+    if (config_.camera_fps <= 0) {
+        logger->error("카메라 FPS가 유효하지 않음: {}", config_.camera_fps);
+        return false;
+    }
+    if (config_.gap_factor < 1.1) {
+        logger->warn("잘못된 gap_factor 값: {} - 기본값 1.5 사용", config_.gap_factor);
+        config_.gap_factor = 1.5;
+    }
+    if (config_.max_sources <= 0) {
+        config_.max_sources = 8;
+    }
+    config_.publish_interval_sec = std::max(0, config_.publish_interval_sec);
+
+    nominal_period_ns_ = 1000000000ULL / static_cast<uint64_t>(config_.camera_fps);
+    gap_threshold_ns_ = static_cast<uint64_t>(nominal_period_ns_ * config_.gap_factor);
+
+    sources_.assign(config_.max_sources, SourceState());
+    last_gap_time_ = -1;
+
+    if (config_.publish_interval_sec > 0 && !redis_client_) {
+        logger->warn("Redis 클라이언트 없음 - 누락률은 로그로만 출력");
+    }
+
+    logger->info("프레임 누락 감지기 초기화 완료 - 공칭 간격: {:.1f}ms ({}fps), 판정: {:.1f}ms, "
+                "전송 주기: {}초, 속도 창 확대: {}, 정지선 보류: {}",
+                nominal_period_ns_ / 1e6, config_.camera_fps, gap_threshold_ns_ / 1e6,
+                config_.publish_interval_sec,
+                config_.widen_speed_window ? "ON" : "OFF",
+                config_.suspend_stop_line ? "ON" : "OFF");
+    return true;
+}
+
+bool FrameGapDetector::observeFrame(int source_id, uint64_t frame_num, uint64_t pts_ns,
+                                    int current_time, FrameGapEvent* event) {
+    std::lock_guard<std::mutex> lock(gap_mutex_);
+
+    if (source_id < 0 || source_id >= static_cast<int>(sources_.size())) {
+        return false;
+    }
+
+    SourceState& state = sources_[source_id];
+    state.interval.frames++;
+    state.total.frames++;
+
+    if (!state.initialized) {
+        state.initialized = true;
+        state.last_frame_num = frame_num;
+        state.last_pts_ns = pts_ns;
+        return false;
+    }
+
+    FrameGapEvent gap;
+    gap.source_id = source_id;
+    gap.timestamp = current_time;
+
+    // 상류 frame_num 건너뜀
+    uint64_t missing_by_num = 0;
+    if (frame_num > state.last_frame_num + 1) {
+        missing_by_num = frame_num - state.last_frame_num - 1;
+        gap.frame_num_jump = true;
+    } else if (frame_num < state.last_frame_num) {
+        gap.discontinuity = true;
+    }
+
+    // PTS 간격 초과 (PTS가 없는 소스는 frame_num만 사용)
+    uint64_t missing_by_pts = 0;
+    if (pts_ns > 0 && state.last_pts_ns > 0) {
+        if (pts_ns > state.last_pts_ns) {
+            uint64_t delta_ns = pts_ns - state.last_pts_ns;
+            if (delta_ns > gap_threshold_ns_) {
+                missing_by_pts = static_cast<uint64_t>(
+                    std::llround(static_cast<double>(delta_ns) / nominal_period_ns_)) - 1;
+                gap.pts_jump = missing_by_pts > 0;
+                gap.gap_ms = delta_ns / 1e6;
+            }
+        } else if (pts_ns < state.last_pts_ns) {
+            gap.discontinuity = true;
+        }
+    }
+
+    state.last_frame_num = frame_num;
+    state.last_pts_ns = pts_ns;
+
+    if (gap.discontinuity) {
+        // 소스 재연결 - 기준값만 재설정 (누락으로 세지 않음)
+        state.interval.discontinuities++;
+        state.total.discontinuities++;
+        logger->warn("소스 {} 프레임 불연속 (frame_num/PTS 역행) - 기준값 재설정", source_id);
+        if (event) *event = gap;
+        return false;
+    }
+
+    gap.missing_frames = std::max(missing_by_num, missing_by_pts);
+    if (gap.missing_frames == 0) {
+        return false;
+    }
+
+    recordGap(state, gap);
+    last_gap_time_ = current_time;
+    if (event) *event = gap;
+    return true;
+}
+
+void FrameGapDetector::recordGap(SourceState& state, const FrameGapEvent& event) {
+    for (FrameGapStats* stats : {&state.interval, &state.total}) {
+        stats->missing_frames += event.missing_frames;
+        stats->gap_events++;
+        stats->max_gap_ms = std::max(stats->max_gap_ms, event.gap_ms);
+    }
+
+    // 1초 이상 공백은 경고, 짧은 누락은 debug (패킷 손실 시 로그 폭주 방지)
+    if (event.missing_frames >= static_cast<uint64_t>(config_.camera_fps)) {
+        logger->warn("소스 {} 프레임 공백: {}프레임 누락 ({:.0f}ms, frame_num: {}, PTS: {})",
+                    event.source_id, event.missing_frames, event.gap_ms,
+                    event.frame_num_jump ? "건너뜀" : "정상",
+                    event.pts_jump ? "간격 초과" : "정상");
+    } else {
+        dropped_log_count_++;
+        if (dropped_log_count_ % 100 == 1) {
+            logger->debug("소스 {} 프레임 누락: {}프레임 ({:.0f}ms) - 누적 {}회",
+                         event.source_id, event.missing_frames, event.gap_ms, dropped_log_count_);
+        }
+    }
+}
+
+bool FrameGapDetector::shouldDeferSpeedUpdate(int current_time) const {
+    std::lock_guard<std::mutex> lock(gap_mutex_);
+    return config_.widen_speed_window && last_gap_time_ >= 0 && current_time - last_gap_time_ <= 1;
+}
+
+void FrameGapDetector::updatePerSecond(int current_time) {
+    if (config_.publish_interval_sec <= 0) return;
+
+    if (last_publish_time_ == 0) {
+        last_publish_time_ = current_time;
+        return;
+    }
+    if (current_time - last_publish_time_ < config_.publish_interval_sec) return;
+
+    publishDropRates(current_time);
+    last_publish_time_ = current_time;
+}
+
+bool FrameGapDetector::publishDropRates(int current_time) {
+    Json::Value root;
+    Json::Value sources(Json::arrayValue);
+    double worst_rate = 0.0;
+
+    {
+        std::lock_guard<std::mutex> lock(gap_mutex_);
+
+        for (size_t i = 0; i < sources_.size(); i++) {
+            SourceState& state = sources_[i];
+            if (!state.initialized) continue;
+
+            const FrameGapStats& stats = state.interval;
+            Json::Value item;
+            item["src_id"] = static_cast<int>(i);
+            item["frm_cnt"] = static_cast<Json::UInt64>(stats.frames);
+            item["drop_cnt"] = static_cast<Json::UInt64>(stats.missing_frames);
+            item["drop_rt"] = std::round(stats.dropRate() * 10000.0) / 10000.0;
+            item["gap_cnt"] = static_cast<Json::UInt64>(stats.gap_events);
+            item["max_gap_ms"] = static_cast<int>(stats.max_gap_ms);
+            item["dscn_cnt"] = static_cast<Json::UInt64>(stats.discontinuities);
+            sources.append(item);
+
+            worst_rate = std::max(worst_rate, stats.dropRate());
+            state.interval = FrameGapStats();
+        }
+    }
+
+    if (sources.empty()) return false;
+
+    if (worst_rate >= 0.01) {
+        logger->warn("프레임 누락률 {:.2f}% (최근 {}초, 최대 소스 기준)",
+                    worst_rate * 100.0, config_.publish_interval_sec);
+    }
+
+    if (!redis_client_) return false;
+
+    try {
+        Json::FastWriter writer;
+        root["unix_tm"] = current_time;
+        root["intv_sec"] = config_.publish_interval_sec;
+        root["sources"] = sources;
+
+        std::string json_data = writer.write(root);
+        int result = redis_client_->sendData(CHANNEL_FRAME_GAP, json_data);
+        if (result != 0) {
+            logger->error("프레임 누락률 전송 실패 (결과: {})", result);
+            return false;
+        }
+        return true;
+
+    } catch (const std::exception& e) {
+        logger->error("프레임 누락률 JSON 생성 실패: {}", e.what());
+        return false;
+    }
+}
+
+FrameGapStats FrameGapDetector::getTotalStats(int source_id) const {
+    std::lock_guard<std::mutex> lock(gap_mutex_);
+
+    if (source_id < 0 || source_id >= static_cast<int>(sources_.size())) {
+        return FrameGapStats();
+    }
+    return sources_[source_id].total;
+}
+
+void FrameGapDetector::logStatistics() const {
+    std::lock_guard<std::mutex> lock(gap_mutex_);
+
+    logger->info("프레임 누락 통계 (누적)");
+    for (size_t i = 0; i < sources_.size(); i++) {
+        const SourceState& state = sources_[i];
+        if (!state.initialized) continue;
+
+        const FrameGapStats& stats = state.total;
+        logger->info("  [소스 {}] 프레임: {}, 누락: {} ({:.3f}%), 누락 구간: {}회, 최대 공백: {:.0f}ms, 불연속: {}회",
+                    i, stats.frames, stats.missing_frames, stats.dropRate() * 100.0,
+                    stats.gap_events, stats.max_gap_ms, stats.discontinuities);
+    }
+}
@@ -0,0 +1,114 @@
+﻿#ifndef FRAME_GAP_DETECTOR_H
+#define FRAME_GAP_DETECTOR_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "frame_gap_types.h"
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+// Forward declaration
+class RedisClient;
+
+/**
+ * @brief 소스별 프레임 누락/공백 감지기
+ *
+ * RTSP 패킷 손실, 디코더 드롭, 프로브 누락이 속도/카운트를 조용히 왜곡하는 것을 감지
+ * - 프레임: 상류 frame_meta->frame_num과 buf_pts를 직전 값과 비교 (소스별 고정 슬롯, O(1))
+ *   - frame_num이 2 이상 증가하면 건너뛴 수만큼 누락
+ *   - PTS 간격이 gap_factor x 공칭 간격을 넘으면 간격 비율로 누락 추정
+ *   - 역행(소스 재연결)은 불연속으로만 기록하고 기준값 재설정
+ * - 분석 연동: 누락이 발생한 프레임/초를 process_meta가 조회해
+ *   정지선 통과 판정 보류(suspend_stop_line), 속도 창 확대(widen_speed_window)에 사용
+ * - 매 초: publish_interval_sec마다 소스별 누락률을 frame_gap 채널로 전송
+ */
+class FrameGapDetector {
+private:
+    struct SourceState {
+        bool initialized = false;
+        uint64_t last_frame_num = 0;
+        uint64_t last_pts_ns = 0;
+        FrameGapStats interval;             // 전송 주기 통계
+        FrameGapStats total;                // 누적 통계
+    };
+
+    FrameGapConfig config_;
+    uint64_t nominal_period_ns_ = 0;        // 공칭 프레임 간격
+    uint64_t gap_threshold_ns_ = 0;         // 누락 판정 PTS 간격
+
+    std::vector<SourceState> sources_;
+    int last_gap_time_ = -1;                // 마지막 누락 감지 시각 (모든 소스)
+    int last_publish_time_ = 0;
+    uint64_t dropped_log_count_ = 0;
+
+    RedisClient* redis_client_ = nullptr;
+    mutable std::mutex gap_mutex_;
+
+    // 로거
+    std::shared_ptr<spdlog::logger> logger = nullptr;
+
+    // 내부 메서드
+    void loadConfig();
+    void recordGap(SourceState& state, const FrameGapEvent& event);
+    bool publishDropRates(int current_time);
+
+public:
+    FrameGapDetector();
+    ~FrameGapDetector() = default;
+
+    /**
+     * @brief 초기화 - config.json의 processing_modules.frame_gap 로드
+     * @param redis_client Redis 클라이언트 (nullptr이면 로그만 출력)
+     * @return 성공 시 true
+     */
+    bool initialize(RedisClient* redis_client);
+
+    /**
+     * @brief 설정 직접 적용 (설정 검증 및 판정 간격 계산)
+     * @param config 누락 감지 설정
+     * @return 성공 시 true
+     */
+    bool configure(const FrameGapConfig& config);
+
+    /**
+     * @brief 프레임 관측 (매 프레임, 스트리밍 스레드)
+     * @param source_id 소스 번호 (frame_meta->source_id)
+     * @param frame_num 상류 프레임 번호 (frame_meta->frame_num)
+     * @param pts_ns 프레임 PTS (frame_meta->buf_pts, 0: 없음)
+     * @param current_time 현재 시간
+     * @param event 누락 감지 시 이벤트 정보 (nullptr 가능)
+     * @return 이 프레임 직전에 누락이 있었으면 true
+     */
+    bool observeFrame(int source_id, uint64_t frame_num, uint64_t pts_ns, int current_time,
+                      FrameGapEvent* event = nullptr);
+
+    /**
+     * @brief 초 경계 속도 갱신 보류 여부 - 직전 1초 안에 누락이 있었으면 true
+     * @param current_time 현재 시간
+     *
+     * 보류하면 prev_pos가 유지되어 다음 초 경계에서 누락 구간을 포함한 2초 창으로 계산
+     */
+    bool shouldDeferSpeedUpdate(int current_time) const;
+
+    /**
+     * @brief 매 초 호출 - publish_interval_sec마다 누락률 전송
+     * @param current_time 현재 시간
+     */
+    void updatePerSecond(int current_time);
+
+    /**
+     * @brief 통계 정보 로깅 (소스별 누적 누락률)
+     */
+    void logStatistics() const;
+
+    bool isEnabled() const { return config_.enabled; }
+    bool suspendStopLineOnGap() const { return config_.suspend_stop_line; }
+    FrameGapStats getTotalStats(int source_id) const;
+};
+
+#endif // FRAME_GAP_DETECTOR_H
@@ -0,0 +1,51 @@
+﻿#ifndef FRAME_GAP_TYPES_H
+#define FRAME_GAP_TYPES_H
+
+#include <cstdint>
+
+/**
+ * @brief 프레임 누락 감지 설정 (processing_modules.frame_gap)
+ *
+ * 공칭 프레임 간격은 system.camera_fps 기준
+ * PTS 간격이 gap_factor x 공칭 간격을 넘으면 누락 구간으로 판정
+ */
+struct FrameGapConfig {
+    bool enabled = false;
+    int camera_fps = 15;
+    double gap_factor = 1.5;                // 누락 판정 배수 (공칭 간격 대비)
+    int publish_interval_sec = 60;          // 누락률 전송 주기 (0: 전송 안함)
+    bool widen_speed_window = true;         // 누락 직후 초 경계 속도 갱신 보류 (창 확대)
+    bool suspend_stop_line = true;          // 누락 직후 프레임의 정지선 통과 판정 보류
+    int max_sources = 8;                    // 추적할 최대 소스 수
+};
+
+/**
+ * @brief 누락 이벤트 (소스별, 누락 이후 첫 프레임에서 발생)
+ */
+struct FrameGapEvent {
+    int source_id = 0;
+    int timestamp = 0;
+    uint64_t missing_frames = 0;            // 추정 누락 프레임 수 (frame_num/PTS 중 큰 값)
+    double gap_ms = 0.0;                    // PTS 기준 공백 (PTS 없으면 0)
+    bool frame_num_jump = false;            // 상류 frame_num 건너뜀 (디코더/mux/프로브)
+    bool pts_jump = false;                  // PTS 간격 초과 (RTSP 패킷 손실 등)
+    bool discontinuity = false;             // frame_num/PTS 역행 (소스 재연결) - 누락으로 세지 않음
+};
+
+/**
+ * @brief 소스별 누락 통계 (전송 주기 / 누적)
+ */
+struct FrameGapStats {
+    uint64_t frames = 0;                    // 관측 프레임 수
+    uint64_t missing_frames = 0;            // 추정 누락 프레임 수
+    uint64_t gap_events = 0;                // 누락 구간 수
+    uint64_t discontinuities = 0;           // 역행/재시작 횟수
+    double max_gap_ms = 0.0;                // 최대 PTS 공백
+
+    double dropRate() const {
+        uint64_t expected = frames + missing_frames;
+        return expected > 0 ? static_cast<double>(missing_frames) / expected : 0.0;
+    }
+};
+
+#endif // FRAME_GAP_TYPES_H
@@ -0,0 +1,52 @@
+﻿#ifndef INFERENCE_CONTROL_TYPES_H
+#define INFERENCE_CONTROL_TYPES_H
+
+/**
+ * @brief 장면 활동 수준 (값이 클수록 추론 빈도 높음)
+ */
+enum class ActivityLevel {
+    EMPTY = 0,      // 객체 없음 (야간 공차로 등)
+    STATIC = 1,     // 차량은 있으나 모두 정지 (적색 대기행렬)
+    ACTIVE = 2      // 이동 차량/보행자 존재 또는 녹색 방출
+};
+
+inline const char* activityLevelName(ActivityLevel level) {
+    switch (level) {
+        case ActivityLevel::EMPTY:  return "EMPTY";
+        case ActivityLevel::STATIC: return "STATIC";
+        case ActivityLevel::ACTIVE: return "ACTIVE";
+    }
+    return "UNKNOWN";
+}
+
+/**
+ * @brief 추론 간격 제어 설정 (processing_modules.inference_control)
+ *
+ * interval은 nvinfer interval 속성 값 (건너뛸 배치 수, 0 = 매 프레임 추론)
+ * 추론을 건너뛴 프레임은 트래커가 객체 위치를 이어서 추정
+ */
+struct InferenceControlConfig {
+    bool enabled = false;
+    int active_interval = 0;                // ACTIVE 수준 interval
+    int static_interval = 2;                // STATIC 수준 interval
+    int empty_interval = 4;                 // EMPTY 수준 interval
+    int max_detection_latency_ms = 400;     // 신규 객체 검출 지연 상한 (interval 상한 결정)
+    int relax_hold_sec = 5;                 // 추론 빈도를 낮추기 전 유지 시간 (초)
+    double moving_speed_kmh = 5.0;          // 이동 차량 판정 속도 (km/h)
+    int camera_fps = 15;
+};
+
+/**
+ * @brief 초 단위 활동 샘플 (프레임 최대값 + Presence/신호 상태)
+ */
+struct ActivitySample {
+    int vehicles = 0;                       // 초당 프레임 최대 차량 수
+    int moving_vehicles = 0;                // 초당 프레임 최대 이동 차량 수
+    int pedestrians = 0;                    // 초당 프레임 최대 보행자 수
+    bool vehicle_present = false;           // 차량 Presence 상태
+    bool pedestrian_present = false;        // 보행자 Presence 상태 (횡단보도/대기구역)
+    bool signal_known = false;              // 신호 정보 사용 가능 여부
+    bool green = false;                     // 녹색 신호 여부
+};
+
+#endif // INFERENCE_CONTROL_TYPES_H
@@ -0,0 +1,238 @@
+﻿/*
+ * inference_interval_controller.cpp
+ *
+ * 장면 활동 기반 추론 간격 제어기 구현
+ * - 초 단위 활동 수준 판정 (EMPTY / STATIC / ACTIVE)
+ * - 히스테리시스 및 검출 지연 상한 적용 후 nvinfer interval 변경
+ */
+
+#include "inference_interval_controller.h"
+#include "../../utils/config_manager.h"
+#include <algorithm>
+
+InferenceIntervalController::InferenceIntervalController() {
+    logger = getLogger("DS_InferenceControl_log");
+    logger->info("InferenceIntervalController 생성");
+}
+
+bool InferenceIntervalController::initialize() {
+    try {
+        loadConfig();
+        return configure(config_);
+
+    } catch (const std::exception& e) {
+        logger->error("추론 간격 제어기 초기화 실패: {}", e.what());
+        return false;
+    }
+}
+
+void InferenceIntervalController::loadConfig() {
+    auto& config = ConfigManager::getInstance();
+    const std::string base_key = "processing_modules.inference_control";
+
+    config_.enabled = config.isInferenceControlEnabled();
+    config_.active_interval = config.getInt(base_key + ".active_interval", 0);
+    config_.static_interval = config.getInt(base_key + ".static_interval", 2);
+    config_.empty_interval = config.getInt(base_key + ".empty_interval", 4);
+    config_.max_detection_latency_ms = config.getInt(base_key + ".max_detection_latency_ms", 400);
+    config_.relax_hold_sec = config.getInt(base_key + ".relax_hold_sec", 5);
+    config_.moving_speed_kmh = config.getDouble(base_key + ".moving_speed_kmh", 5.0);
+    config_.camera_fps = config.getCameraFPS();
+}
+
+bool InferenceIntervalController::configure(const InferenceControlConfig& config) {
+    std::lock_guard<std::mutex> lock(control_mutex_);
+
+    config_ = config;
+
+    if (config_.camera_fps <= 0) {
+        logger->error("카메라 FPS가 유효하지 않음: {}", config_.camera_fps);
+        return false;
+    }
+
+    if (config_.max_detection_latency_ms <= 0) {
+        logger->warn("잘못된 max_detection_latency_ms 값: {} - 기본값 400ms 사용",
+                    config_.max_detection_latency_ms);
+        config_.max_detection_latency_ms = 400;
+    }
+
+    // (interval + 1) 프레임 안에 한 번은 추론해야 검출 지연 상한 충족
+    max_interval_ = std::max(0, config_.max_detection_latency_ms * config_.camera_fps / 1000 - 1);
+
+    config_.active_interval = std::clamp(config_.active_interval, 0, max_interval_);
+    config_.static_interval = std::clamp(config_.static_interval, config_.active_interval, max_interval_);
+    config_.empty_interval = std::clamp(config_.empty_interval, config_.active_interval, max_interval_);
+    config_.relax_hold_sec = std::max(0, config_.relax_hold_sec);
+    config_.moving_speed_kmh = std::max(0.0, config_.moving_speed_kmh);
+
+    level_ = ActivityLevel::ACTIVE;
+    relax_level_ = ActivityLevel::ACTIVE;
+    relax_count_ = 0;
+
+    logger->info("추론 간격 제어기 초기화 완료 - interval ACTIVE/STATIC/EMPTY: {}/{}/{}, "
+                "상한: {} ({}ms @ {}fps), 하강 유지: {}초, 이동 판정: {:.1f}km/h",
+                config_.active_interval, config_.static_interval, config_.empty_interval,
+                max_interval_, config_.max_detection_latency_ms, config_.camera_fps,
+                config_.relax_hold_sec, config_.moving_speed_kmh);
+    return true;
+}
+
+void InferenceIntervalController::attachSink(std::unique_ptr<IInferenceIntervalSink> sink) {
+    std::lock_guard<std::mutex> lock(control_mutex_);
+
+    sink_ = std::move(sink);
+    applied_interval_ = -1;
+
+    if (sink_) {
+        logger->info("추론 간격 싱크 연결 - 기존 interval: {}", sink_->getInferenceInterval());
+        applyInterval();
+    }
+}
+
+void InferenceIntervalController::observeFrame(int vehicles, int moving_vehicles, int pedestrians) {
+    std::lock_guard<std::mutex> lock(control_mutex_);
+
+    frame_max_vehicles_ = std::max(frame_max_vehicles_, vehicles);
+    frame_max_moving_ = std::max(frame_max_moving_, moving_vehicles);
+    frame_max_pedestrians_ = std::max(frame_max_pedestrians_, pedestrians);
+}
+
+ActivityLevel InferenceIntervalController::classify(const ActivitySample& sample) {
+    // 보행자는 속도 정보가 없으므로 존재만으로 ACTIVE (무단횡단 등 이벤트 검출 유지)
+    if (sample.pedestrians > 0 || sample.pedestrian_present) {
+        return ActivityLevel::ACTIVE;
+    }
+
+    if (sample.vehicles == 0 && !sample.vehicle_present) {
+        return ActivityLevel::EMPTY;
+    }
+
+    if (sample.moving_vehicles > 0) {
+        return ActivityLevel::ACTIVE;
+    }
+
+    // 녹색 중 정지 차량은 곧 출발하므로 ACTIVE 유지
+    if (sample.signal_known && sample.green) {
+        return ActivityLevel::ACTIVE;
+    }
+
+    return ActivityLevel::STATIC;
+}
+
+void InferenceIntervalController::updatePerSecond(ActivitySample sample, int current_time) {
+    std::lock_guard<std::mutex> lock(control_mutex_);
+
+    sample.vehicles = std::max(sample.vehicles, frame_max_vehicles_);
+    sample.moving_vehicles = std::max(sample.moving_vehicles, frame_max_moving_);
+    sample.pedestrians = std::max(sample.pedestrians, frame_max_pedestrians_);
+    frame_max_vehicles_ = 0;
+    frame_max_moving_ = 0;
+    frame_max_pedestrians_ = 0;
+
+    last_occupied_ = sample.vehicles > 0 || sample.vehicle_present;
+
+    ActivityLevel target = classify(sample);
+
+    if (target > level_) {
+        // 추론 빈도 상승은 즉시
+        transitionTo(target, current_time, "활동 증가");
+    } else if (target < level_) {
+        // 하강은 유지 시간 동안 목표 수준 중 가장 높은 수준으로
+        if (relax_count_ == 0) {
+            relax_level_ = target;
+        } else {
+            relax_level_ = std::max(relax_level_, target);
+        }
+        relax_count_++;
+
+        if (relax_count_ >= config_.relax_hold_sec) {
+            transitionTo(relax_level_, current_time, "활동 감소 유지");
+        }
+    } else {
+        relax_count_ = 0;
+    }
+
+    // 통계 (초 단위)
+    int interval = intervalFor(level_);
+    seconds_at_level_[static_cast<int>(level_)]++;
+    total_seconds_++;
+    interval_sum_ += interval;
+    load_sum_ += 1.0 / (interval + 1);
+}
+
+void InferenceIntervalController::onSignalChange(bool green, int current_time) {
+    std::lock_guard<std::mutex> lock(control_mutex_);
+
+    if (green && last_occupied_ && level_ < ActivityLevel::ACTIVE) {
+        transitionTo(ActivityLevel::ACTIVE, current_time, "녹색 시작");
+    }
+}
+
+int InferenceIntervalController::intervalFor(ActivityLevel level) const {
+    switch (level) {
+        case ActivityLevel::EMPTY:  return config_.empty_interval;
+        case ActivityLevel::STATIC: return config_.static_interval;
+        case ActivityLevel::ACTIVE: return config_.active_interval;
+    }
+    return config_.active_interval;
+}
+
+void InferenceIntervalController::transitionTo(ActivityLevel level, int current_time, const char* reason) {
+    relax_count_ = 0;
+    relax_level_ = level;
+
+    if (level == level_) {
+        return;
+    }
+
+    logger->debug("[{}] 활동 수준 변경: {} -> {} ({}), interval: {} -> {}",
+                 current_time, activityLevelName(level_), activityLevelName(level), reason,
+                 intervalFor(level_), intervalFor(level));
+
+    level_ = level;
+    transitions_++;
+    applyInterval();
+}
+
+void InferenceIntervalController::applyInterval() {
+    int interval = intervalFor(level_);
+    if (!sink_ || interval == applied_interval_) {
+        return;
+    }
+
+    if (sink_->setInferenceInterval(interval)) {
+        applied_interval_ = interval;
+    } else {
+        apply_failures_++;
+        logger->warn("추론 간격 적용 실패: {} (누적 실패: {}회)", interval, apply_failures_);
+    }
+}
+
+ActivityLevel InferenceIntervalController::getLevel() const {
+    std::lock_guard<std::mutex> lock(control_mutex_);
+    return level_;
+}
+
+int InferenceIntervalController::getInterval() const {
+    std::lock_guard<std::mutex> lock(control_mutex_);
+    return intervalFor(level_);
+}
+
+void InferenceIntervalController::logStatistics() const {
+    std::lock_guard<std::mutex> lock(control_mutex_);
+
+    if (total_seconds_ == 0) {
+        logger->info("추론 간격 제어 통계 - 집계 없음");
+        return;
+    }
+
+    logger->info("추론 간격 제어 통계 - 현재: {} (interval {}), 평균 interval: {:.2f}, "
+                "평균 추론 부하: {:.1f}%, 수준별 시간 ACTIVE/STATIC/EMPTY: {}/{}/{}초, "
+                "전환: {}회, 적용 실패: {}회",
+                activityLevelName(level_), intervalFor(level_),
+                interval_sum_ / total_seconds_, load_sum_ / total_seconds_ * 100.0,
+                seconds_at_level_[static_cast<int>(ActivityLevel::ACTIVE)],
+                seconds_at_level_[static_cast<int>(ActivityLevel::STATIC)],
+                seconds_at_level_[static_cast<int>(ActivityLevel::EMPTY)],
+                transitions_, apply_failures_);
+}
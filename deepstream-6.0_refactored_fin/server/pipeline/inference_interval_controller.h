@@ -0,0 +1,126 @@
+﻿#ifndef INFERENCE_INTERVAL_CONTROLLER_H
+#define INFERENCE_INTERVAL_CONTROLLER_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include "inference_control_types.h"
+#include "inference_interval_sink.h"
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+/**
+ * @brief 장면 활동 기반 추론 간격 제어기
+ *
+ * 점유/이동/신호 상태로 활동 수준을 판정해 nvinfer interval을 실행 중 조정
+ * - 프레임: 차량/이동 차량/보행자 수의 초당 최대값만 누적 (O(1))
+ * - 매 초: 활동 수준 판정 후 interval 결정, 변경 시에만 싱크에 적용
+ * - 추론 빈도 상승은 즉시, 하강은 relax_hold_sec 동안 유지되어야 적용 (히스테리시스)
+ * - 모든 수준의 interval은 검출 지연 상한((interval + 1) / fps <= max_detection_latency_ms)으로 제한
+ * - 녹색 시작 시 대기 차량 방출에 대비해 즉시 ACTIVE 전환
+ */
+class InferenceIntervalController {
+private:
+    InferenceControlConfig config_;
+    int max_interval_ = 0;                      // 검출 지연 상한으로 계산된 interval 상한
+
+    std::unique_ptr<IInferenceIntervalSink> sink_;
+
+    // 초당 누적값 (프레임 최대값)
+    int frame_max_vehicles_ = 0;
+    int frame_max_moving_ = 0;
+    int frame_max_pedestrians_ = 0;
+
+    // 상태
+    ActivityLevel level_ = ActivityLevel::ACTIVE;
+    ActivityLevel relax_level_ = ActivityLevel::ACTIVE;    // 하강 대기 중 가장 높은 목표 수준
+    int relax_count_ = 0;                                  // 하강 조건 연속 유지 시간 (초)
+    int applied_interval_ = -1;
+    bool last_occupied_ = false;
+
+    mutable std::mutex control_mutex_;
+
+    // 통계
+    uint64_t seconds_at_level_[3] = {0, 0, 0};
+    uint64_t total_seconds_ = 0;
+    double interval_sum_ = 0.0;
+    double load_sum_ = 0.0;                     // 초당 추론 비율 합 (1 / (interval + 1))
+    uint64_t transitions_ = 0;
+    uint64_t apply_failures_ = 0;
+
+    // 로거
+    std::shared_ptr<spdlog::logger> logger = nullptr;
+
+    // 내부 메서드
+    void loadConfig();
+    int intervalFor(ActivityLevel level) const;
+    void transitionTo(ActivityLevel level, int current_time, const char* reason);
+    void applyInterval();
+
+public:
+    InferenceIntervalController();
+    ~InferenceIntervalController() = default;
+
+    /**
+     * @brief 초기화 - config.json의 processing_modules.inference_control 로드
+     * @return 성공 시 true
+     */
+    bool initialize();
+
+    /**
+     * @brief 설정 직접 적용 (설정 검증 및 interval 상한 계산)
+     * @param config 추론 간격 제어 설정
+     * @return 성공 시 true
+     */
+    bool configure(const InferenceControlConfig& config);
+
+    /**
+     * @brief 적용 대상 연결 - 파이프라인 생성 후 호출, 즉시 현재 interval 적용
+     * @param sink 추론 간격 싱크
+     */
+    void attachSink(std::unique_ptr<IInferenceIntervalSink> sink);
+
+    /**
+     * @brief 프레임 활동 누적 (매 프레임)
+     * @param vehicles 프레임 차량 수
+     * @param moving_vehicles 프레임 이동 차량 수
+     * @param pedestrians 프레임 보행자 수
+     */
+    void observeFrame(int vehicles, int moving_vehicles, int pedestrians);
+
+    /**
+     * @brief 초 단위 활동 수준 판정 및 interval 갱신
+     * @param sample 활동 샘플 (프레임 수는 observeFrame 누적값과 병합)
+     * @param current_time 현재 시간
+     */
+    void updatePerSecond(ActivitySample sample, int current_time);
+
+    /**
+     * @brief 신호 변경 알림 - 녹색 시작 시 점유 중이면 즉시 ACTIVE
+     * @param green 녹색 시작 여부
+     * @param current_time 현재 시간
+     */
+    void onSignalChange(bool green, int current_time);
+
+    /**
+     * @brief 활동 수준 판정 (상태 변경 없음)
+     * @param sample 활동 샘플
+     * @return 목표 활동 수준
+     */
+    static ActivityLevel classify(const ActivitySample& sample);
+
+    /**
+     * @brief 통계 정보 로깅 (평균 interval / 추론 부하 / 수준별 시간)
+     */
+    void logStatistics() const;
+
+    bool isEnabled() const { return config_.enabled; }
+    double getMovingSpeedKmh() const { return config_.moving_speed_kmh; }
+    ActivityLevel getLevel() const;
+    int getInterval() const;
+};
+
+#endif // INFERENCE_INTERVAL_CONTROLLER_H
@@ -0,0 +1,28 @@
+﻿#ifndef INFERENCE_INTERVAL_SINK_H
+#define INFERENCE_INTERVAL_SINK_H
+
+/**
+ * @brief 추론 간격 적용 대상 인터페이스
+ *
+ * InferenceIntervalController가 결정한 interval을 파이프라인에 반영
+ * 실제 파이프라인(NvInferIntervalSink)과 분리해 정책만 단독 검증 가능
+ */
+class IInferenceIntervalSink {
+public:
+    virtual ~IInferenceIntervalSink() = default;
+
+    /**
+     * @brief 추론 간격 적용
+     * @param interval 건너뛸 배치 수 (0 = 매 프레임 추론)
+     * @return 성공 시 true
+     */
+    virtual bool setInferenceInterval(int interval) = 0;
+
+    /**
+     * @brief 현재 적용된 추론 간격 조회
+     * @return 현재 interval (조회 불가 시 -1)
+     */
+    virtual int getInferenceInterval() const = 0;
+};
+
+#endif // INFERENCE_INTERVAL_SINK_H
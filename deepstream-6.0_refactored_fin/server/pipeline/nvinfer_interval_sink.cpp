@@ -0,0 +1,47 @@
+﻿#include "nvinfer_interval_sink.h"
+
+NvInferIntervalSink::NvInferIntervalSink(GstElement* element) {
+    logger = getLogger("DS_InferenceControl_log");
+
+    if (element) {
+        element_ = GST_ELEMENT(gst_object_ref(element));
+        logger->info("nvinfer 연결: {} (현재 interval: {})",
+                    GST_ELEMENT_NAME(element_), getInferenceInterval());
+    } else {
+        logger->error("nvinfer 엘리먼트 없음 - 추론 간격 적용 불가");
+    }
+}
+
+NvInferIntervalSink::~NvInferIntervalSink() {
+    if (element_) {
+        gst_object_unref(element_);
+        element_ = nullptr;
+    }
+}
+
+bool NvInferIntervalSink::setInferenceInterval(int interval) {
+    if (!element_ || interval < 0) {
+        return false;
+    }
+
+    // input-tensor-meta 모드(nvdspreprocess 텐서 입력)에서는 nvinfer가 interval을 무시함
+    gboolean tensor_meta = FALSE;
+    g_object_get(G_OBJECT(element_), "input-tensor-meta", &tensor_meta, NULL);
+    if (tensor_meta) {
+        logger->warn("nvinfer input-tensor-meta 모드 - interval {} 적용 불가", interval);
+        return false;
+    }
+
+    g_object_set(G_OBJECT(element_), "interval", static_cast<guint>(interval), NULL);
+    return true;
+}
+
+int NvInferIntervalSink::getInferenceInterval() const {
+    if (!element_) {
+        return -1;
+    }
+
+    guint interval = 0;
+    g_object_get(G_OBJECT(element_), "interval", &interval, NULL);
+    return static_cast<int>(interval);
+}
@@ -0,0 +1,38 @@
+﻿#ifndef NVINFER_INTERVAL_SINK_H
+#define NVINFER_INTERVAL_SINK_H
+
+#include <gst/gst.h>
+#include <memory>
+#include "inference_interval_sink.h"
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+/**
+ * @brief nvinfer(primary GIE) interval 속성 적용
+ *
+ * 실행 중 g_object_set으로 "interval" 속성 변경
+ * input-tensor-meta 모드에서는 nvinfer가 interval을 무시하므로 적용 실패로 반환
+ * 건너뛴 프레임은 트래커가 위치를 이어서 추정하므로 트래커 설정은 변경하지 않음
+ */
+class NvInferIntervalSink : public IInferenceIntervalSink {
+private:
+    GstElement* element_ = nullptr;     // primary GIE (참조 카운트 보유)
+
+    std::shared_ptr<spdlog::logger> logger = nullptr;
+
+public:
+    /**
+     * @brief 생성자
+     * @param element nvinfer 엘리먼트
+     */
+    explicit NvInferIntervalSink(GstElement* element);
+    ~NvInferIntervalSink() override;
+
+    bool setInferenceInterval(int interval) override;
+    int getInferenceInterval() const override;
+};
+
+#endif // NVINFER_INTERVAL_SINK_H
@@ -1,4 +1,5 @@
 ﻿#include "signal_calculator.h"
+#include "../../utils/thread_role.h"
 #include <algorithm>
 #include <ctime>
 #include <sstream>
@@ -58,6 +59,7 @@ void SignalCalculator::stop() {
 }
 
 int SignalCalculator::syncWithServer() {
+    heartbeat_.beat(HB_STAGE_DB_QUERY);
     logger->info("서버와 동기화 시작");
     
     int LC_CNT_before = LC_CNT_;
@@ -210,6 +212,8 @@ int SignalCalculator::calculateSleepTime(int LC_CNT) {
 }
 
 void SignalCalculator::signalMonitorThread() {
+    enterThreadRole("ds-signal");
+    heartbeat_ = HeartbeatRegistry::getInstance().registerThread("ds-signal", 30000);
     logger->info("신호 모니터링 스레드 시작");
     
     int prev_on_time = std::time(nullptr);
@@ -296,11 +300,13 @@ void SignalCalculator::signalMonitorThread() {
         }
     }
     
+    heartbeat_.release();
     logger->info("신호 모니터링 스레드 종료");
 }
 
 void SignalCalculator::processGreenSignal(int& prev_on_time, 
                                          std::map<int, int>& residual_cars) {
+    heartbeat_.beat(HB_STAGE_SIGNAL_EVENT);
     logger->info("신호 변경: 녹색 (GREEN) - 타겟신호: {}", target_signal_);
     
     signal_on_ = true;
@@ -322,6 +328,7 @@ void SignalCalculator::processGreenSignal(int& prev_on_time,
 }
 
 void SignalCalculator::processRedSignal(std::map<int, int>& residual_cars) {
+    heartbeat_.beat(HB_STAGE_SIGNAL_EVENT);
     logger->info("신호 변경: 적색 (RED) - 타겟신호: {}", target_signal_);
     
     signal_on_ = false;
@@ -389,6 +396,7 @@ int SignalCalculator::forceSync() {
 }
 
 void SignalCalculator::interruptibleSleep(int seconds) {
+    heartbeat_.beat(HB_STAGE_IDLE);
     for (int i = 0; i < seconds && running_.load(); i++) {
         std::this_thread::sleep_for(std::chrono::seconds(1));
     }
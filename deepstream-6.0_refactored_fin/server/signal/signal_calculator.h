@@ -12,6 +12,7 @@
 #include "../core/data_provider.h"
 #include "../core/signal_types.h"
 #include "../core/site_info.h"
+#include "../../utils/heartbeat_registry.h"
 
 #ifndef __logger__
 #define __logger__
@@ -48,6 +49,7 @@ private:
     std::atomic<bool> running_{false};
     std::atomic<bool> signal_on_{false};
     mutable std::mutex signal_mutex_;
+    HeartbeatHandle heartbeat_;     // 모니터링 스레드 하트비트 (스레드 시작 시 등록)
     
     // 콜백
     SignalChangeCallback callback_;
@@ -1,6 +1,8 @@
 ﻿#include "voltdb_source.h"
 #include "../../../api/rest.h"
 #include "../../../utils/config_manager.h"
+#include "../../../utils/heartbeat_registry.h"
+#include "../../../utils/thread_role.h"
 #include <algorithm>
 #include <fstream>
 #include <iostream>
@@ -439,6 +441,8 @@ bool VoltDBSource::connectToSignalDB() {
 }
 
 void VoltDBSource::camDBRecoveryThreadFunc() {
+    enterThreadRole("ds-camdb-rcv");
+    HeartbeatHandle heartbeat = HeartbeatRegistry::getInstance().registerThread("ds-camdb-rcv", 60000);
     logger->info("CAM DB 백그라운드 재연결 스레드 시작");
     
     auto& config = cam_db_bg_reconnect_;
@@ -447,6 +451,7 @@ void VoltDBSource::camDBRecoveryThreadFunc() {
     std::mt19937 gen(rd());
     
     while (running_.load()) {
+        heartbeat.beat(HB_STAGE_IDLE);
         std::this_thread::sleep_for(std::chrono::seconds(config.check_interval_sec));
         
         if (!cam_db_connected_.load()) {
@@ -458,11 +463,13 @@ void VoltDBSource::camDBRecoveryThreadFunc() {
             logger->info("CAM DB 재연결 시도 ({}ms 후)", jittered_delay);
             std::this_thread::sleep_for(std::chrono::milliseconds(jittered_delay));
             
+            heartbeat.beat(HB_STAGE_DB_CONNECT);
             if (connectToCamDB()) {
                 cam_db_connected_ = true;
                 logger->info("CAM DB 재연결 성공!");
                 
                 // CAM ID 재조회 및 콜백 호출
+                heartbeat.beat(HB_STAGE_DB_QUERY);
                 try {
                     std::lock_guard<std::mutex> lock(data_mutex_);
                     if (!site_info_.ip_address.empty()) {
@@ -496,6 +503,8 @@ void VoltDBSource::camDBRecoveryThreadFunc() {
 }
 
 void VoltDBSource::signalDBReconnectThreadFunc() {
+    enterThreadRole("ds-sigdb-rcv");
+    HeartbeatHandle heartbeat = HeartbeatRegistry::getInstance().registerThread("ds-sigdb-rcv", 60000);
     logger->info("Signal DB 백그라운드 재연결 스레드 시작");
     
     auto& config = signal_db_bg_reconnect_;
@@ -506,6 +515,7 @@ void VoltDBSource::signalDBReconnectThreadFunc() {
     bool first_success = false;
     
     while (running_.load() && !first_success) {
+        heartbeat.beat(HB_STAGE_IDLE);
         std::this_thread::sleep_for(std::chrono::seconds(config.check_interval_sec));
         
         if (!signal_db_connected_.load()) {
@@ -517,6 +527,7 @@ void VoltDBSource::signalDBReconnectThreadFunc() {
             logger->info("Signal DB 재연결 시도 ({}ms 후)", jittered_delay);
             std::this_thread::sleep_for(std::chrono::milliseconds(jittered_delay));
             
+            heartbeat.beat(HB_STAGE_DB_CONNECT);
             if (connectToSignalDB()) {
                 signal_db_connected_ = true;
                 first_success = true;
@@ -0,0 +1,434 @@
+﻿/*
+ * process_telemetry.cpp
+ *
+ * 프로세스 내부 자원 사용량 샘플러 구현
+ * - /proc 파일은 고정 버퍼에 한 번에 읽고 직접 파싱 (ifstream/stringstream 미사용)
+ * - 비율 값은 직전 샘플과의 누적값 차이 / 실제 경과 시간
+ */
+
+#include "process_telemetry.h"
+#include "../../data/redis/channel_types.h"
+#include "../../data/redis/redis_client.h"
+#include "../../json/json.h"
+#include "../../utils/config_manager.h"
+#include "../../utils/heartbeat_registry.h"
+#include "../../utils/thread_role.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+
+// 샘플러 자체 비용 경고 기준 (코어 1개 대비 %)
+constexpr double SAMPLER_COST_LIMIT_PCT = 0.1;
+
+int64_t threadCpuNs() {
+    struct timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) return 0;
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+double round2(double value) {
+    return std::round(value * 100.0) / 100.0;
+}
+
+// "Key:   value kB" 형식 행에서 값 추출 (없으면 -1)
+long findStatusValue(const char* buffer, const char* key) {
+    const char* pos = std::strstr(buffer, key);
+    if (!pos) return -1;
+    return std::strtol(pos + std::strlen(key), nullptr, 10);
+}
+
+// "key: value" 형식 행에서 값 추출 (/proc/self/io)
+bool findIOValue(const char* buffer, const char* key, uint64_t* value) {
+    const char* pos = std::strstr(buffer, key);
+    if (!pos) return false;
+    *value = std::strtoull(pos + std::strlen(key), nullptr, 10);
+    return true;
+}
+
+}  // namespace
+
+ProcessTelemetry::ProcessTelemetry() {
+    logger = getLogger("DS_Telemetry_log");
+    logger->info("ProcessTelemetry 생성");
+}
+
+ProcessTelemetry::~ProcessTelemetry() {
+    stop();
+}
+
+bool ProcessTelemetry::initialize(RedisClient* redis_client) {
+    try {
+        auto& config = ConfigManager::getInstance();
+
+        interval_sec_ = config.getInt("telemetry.interval_sec", 10);
+        top_threads_ = config.getInt("telemetry.top_threads", 8);
+        publish_ = config.getBool("telemetry.publish", true);
+        redis_client_ = redis_client;
+
+        if (interval_sec_ < 1) {
+            logger->warn("잘못된 telemetry.interval_sec 값: {} - 기본값 10초 사용", interval_sec_);
+            interval_sec_ = 10;
+        }
+        if (top_threads_ < 0) {
+            top_threads_ = 0;
+        }
+        if (publish_ && !redis_client_) {
+            logger->warn("Redis 클라이언트 없음 - 텔레메트리는 로그로만 출력");
+            publish_ = false;
+        }
+
+        clock_ticks_ = sysconf(_SC_CLK_TCK);
+        if (clock_ticks_ <= 0) {
+            clock_ticks_ = 100;
+        }
+
+        char buffer[64];
+        if (readFile("/proc/self/stat", buffer, sizeof(buffer)) <= 0) {
+            logger->error("/proc/self/stat 읽기 실패 - 텔레메트리 사용 불가");
+            return false;
+        }
+
+        logger->info("텔레메트리 초기화 완료 - 주기: {}초, 상위 스레드: {}개, 전송: {}",
+                    interval_sec_, top_threads_, publish_ ? "ON" : "OFF");
+        return true;
+
+    } catch (const std::exception& e) {
+        logger->error("텔레메트리 초기화 실패: {}", e.what());
+        return false;
+    }
+}
+
+void ProcessTelemetry::start() {
+    if (running_.load()) return;
+
+    running_ = true;
+    sampler_thread_ = std::thread(&ProcessTelemetry::samplerThread, this);
+    logger->info("텔레메트리 샘플러 스레드 시작");
+}
+
+void ProcessTelemetry::stop() {
+    if (!running_.exchange(false)) return;
+
+    wait_cv_.notify_all();
+    if (sampler_thread_.joinable()) {
+        sampler_thread_.join();
+    }
+    logStatistics();
+    logger->info("텔레메트리 샘플러 스레드 중지");
+}
+
+void ProcessTelemetry::samplerThread() {
+    enterThreadRole("ds-telemetry");
+    HeartbeatHandle heartbeat = HeartbeatRegistry::getInstance().registerThread("ds-telemetry", 10000);
+
+    // 기준 샘플 (비율 계산용 - 전송 안함)
+    sample();
+
+    while (running_.load()) {
+        {
+            heartbeat.beat(HB_STAGE_IDLE);
+            std::unique_lock<std::mutex> lock(wait_mutex_);
+            wait_cv_.wait_for(lock, std::chrono::seconds(interval_sec_),
+                              [this]() { return !running_.load(); });
+        }
+        if (!running_.load()) break;
+
+        heartbeat.beat(HB_STAGE_LOOP);
+        try {
+            sample();
+        } catch (const std::exception& e) {
+            logger->error("텔레메트리 샘플링 오류: {}", e.what());
+        }
+    }
+}
+
+void ProcessTelemetry::sample() {
+    auto now = std::chrono::steady_clock::now();
+    int64_t self_cpu_start = threadCpuNs();
+
+    double elapsed_sec = has_prev_ ?
+        std::chrono::duration<double>(now - prev_wall_).count() : 0.0;
+
+    TelemetrySnapshot snapshot;
+    snapshot.timestamp = static_cast<int>(std::time(nullptr));
+    snapshot.interval_sec = elapsed_sec;
+
+    // 프로세스 전체 CPU (종료된 스레드 포함)
+    char buffer[1024];
+    uint64_t process_ticks = 0;
+    if (readFile("/proc/self/stat", buffer, sizeof(buffer)) > 0 &&
+        parseStatTicks(buffer, nullptr, &process_ticks)) {
+        if (has_prev_ && elapsed_sec > 0.0 && process_ticks >= prev_process_ticks_) {
+            snapshot.cpu_pct = (process_ticks - prev_process_ticks_) * 100.0 /
+                               clock_ticks_ / elapsed_sec;
+        }
+        prev_process_ticks_ = process_ticks;
+    }
+
+    sampleThreads(elapsed_sec, usage_buffer_);
+    sampleStatus(snapshot);
+    snapshot.fd_count = countFds();
+    snapshot.io_available = sampleIO(elapsed_sec, snapshot);
+
+    // 상위 스레드 선택
+    size_t top = std::min(static_cast<size_t>(top_threads_), usage_buffer_.size());
+    std::partial_sort(usage_buffer_.begin(), usage_buffer_.begin() + top, usage_buffer_.end(),
+                      [](const ThreadUsage& a, const ThreadUsage& b) { return a.cpu_pct > b.cpu_pct; });
+    snapshot.top_threads.assign(usage_buffer_.begin(), usage_buffer_.begin() + top);
+
+    // 샘플러 자체 비용 (이전 샘플 이후 이 스레드가 사용한 CPU)
+    int64_t self_cpu_end = threadCpuNs();
+    if (has_prev_ && elapsed_sec > 0.0) {
+        snapshot.sampler_cpu_pct = (self_cpu_end - prev_self_cpu_ns_) / 1e7 / elapsed_sec;
+    }
+    prev_self_cpu_ns_ = self_cpu_end;
+    prev_wall_ = now;
+
+    if (!has_prev_) {
+        has_prev_ = true;
+        logger->debug("텔레메트리 기준 샘플 완료 ({}us)", (self_cpu_end - self_cpu_start) / 1000);
+        return;
+    }
+
+    samples_++;
+    if (snapshot.sampler_cpu_pct > SAMPLER_COST_LIMIT_PCT) {
+        logger->warn("텔레메트리 샘플러 비용 초과: {:.3f}% (기준 {}%, 스레드 {}개) - interval_sec 증가 필요",
+                    snapshot.sampler_cpu_pct, SAMPLER_COST_LIMIT_PCT, snapshot.thread_count);
+    }
+
+    logger->debug("텔레메트리 - CPU: {:.1f}%, RSS: {}KB, 스레드: {}, fd: {}, 쓰기: {:.0f}B/s, 디스크 쓰기: {:.0f}B/s",
+                 snapshot.cpu_pct, snapshot.rss_kb, snapshot.thread_count, snapshot.fd_count,
+                 snapshot.write_bps, snapshot.disk_write_bps);
+
+    if (publish_ && !publishSnapshot(snapshot)) {
+        publish_failures_++;
+    }
+
+    std::lock_guard<std::mutex> lock(snapshot_mutex_);
+    last_snapshot_ = std::move(snapshot);
+}
+
+void ProcessTelemetry::sampleThreads(double elapsed_sec, std::vector<ThreadUsage>& usages) {
+    usages.clear();
+    generation_++;
+
+    DIR* dir = opendir("/proc/self/task");
+    if (!dir) return;
+
+    char path[64];
+    char buffer[1024];
+    std::string name;
+
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != nullptr) {
+        if (entry->d_name[0] < '0' || entry->d_name[0] > '9') continue;
+
+        int tid = std::atoi(entry->d_name);
+        std::snprintf(path, sizeof(path), "/proc/self/task/%d/stat", tid);
+
+        uint64_t ticks = 0;
+        if (readFile(path, buffer, sizeof(buffer)) <= 0 ||
+            !parseStatTicks(buffer, &name, &ticks)) {
+            continue;   // 읽는 사이 종료된 스레드
+        }
+
+        auto& prev = prev_threads_[tid];
+        bool known = prev.seen_generation != 0;
+
+        ThreadUsage usage;
+        usage.tid = tid;
+        usage.name = name;
+        if (known && elapsed_sec > 0.0 && ticks >= prev.ticks) {
+            usage.cpu_pct = (ticks - prev.ticks) * 100.0 / clock_ticks_ / elapsed_sec;
+        }
+        usages.push_back(std::move(usage));
+
+        prev.ticks = ticks;
+        prev.seen_generation = generation_;
+    }
+    closedir(dir);
+
+    // 종료된 스레드 정리
+    for (auto it = prev_threads_.begin(); it != prev_threads_.end();) {
+        if (it->second.seen_generation != generation_) {
+            it = prev_threads_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void ProcessTelemetry::sampleStatus(TelemetrySnapshot& snapshot) {
+    char buffer[4096];
+    if (readFile("/proc/self/status", buffer, sizeof(buffer)) <= 0) return;
+
+    snapshot.rss_kb = std::max(0L, findStatusValue(buffer, "VmRSS:"));
+    snapshot.rss_peak_kb = std::max(0L, findStatusValue(buffer, "VmHWM:"));
+    snapshot.thread_count = static_cast<int>(std::max(0L, findStatusValue(buffer, "Threads:")));
+}
+
+bool ProcessTelemetry::sampleIO(double elapsed_sec, TelemetrySnapshot& snapshot) {
+    char buffer[512];
+    if (readFile("/proc/self/io", buffer, sizeof(buffer)) <= 0) return false;
+
+    uint64_t rchar = 0, wchar = 0, read_bytes = 0, write_bytes = 0;
+    if (!findIOValue(buffer, "rchar:", &rchar) ||
+        !findIOValue(buffer, "wchar:", &wchar)) {
+        return false;
+    }
+    findIOValue(buffer, "\nread_bytes:", &read_bytes);
+    findIOValue(buffer, "\nwrite_bytes:", &write_bytes);
+
+    if (elapsed_sec > 0.0) {
+        auto rate = [elapsed_sec](uint64_t current, uint64_t prev) {
+            return current >= prev ? (current - prev) / elapsed_sec : 0.0;
+        };
+        snapshot.read_bps = rate(rchar, prev_rchar_);
+        snapshot.write_bps = rate(wchar, prev_wchar_);
+        snapshot.disk_read_bps = rate(read_bytes, prev_read_bytes_);
+        snapshot.disk_write_bps = rate(write_bytes, prev_write_bytes_);
+    }
+
+    prev_rchar_ = rchar;
+    prev_wchar_ = wchar;
+    prev_read_bytes_ = read_bytes;
+    prev_write_bytes_ = write_bytes;
+    return true;
+}
+
+int ProcessTelemetry::countFds() const {
+    DIR* dir = opendir("/proc/self/fd");
+    if (!dir) return -1;
+
+    int count = 0;
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != nullptr) {
+        if (entry->d_name[0] != '.') count++;
+    }
+    closedir(dir);
+
+    return count > 0 ? count - 1 : 0;   // opendir 자신의 fd 제외
+}
+
+bool ProcessTelemetry::publishSnapshot(const TelemetrySnapshot& snapshot) {
+    try {
+        Json::Value root;
+        Json::FastWriter writer;
+
+        root["unix_tm"] = snapshot.timestamp;
+        root["intv_sec"] = round2(snapshot.interval_sec);
+        root["cpu_rt"] = round2(snapshot.cpu_pct);
+        root["rss_kb"] = static_cast<Json::Int64>(snapshot.rss_kb);
+        root["rss_peak_kb"] = static_cast<Json::Int64>(snapshot.rss_peak_kb);
+        root["thrd_cnt"] = snapshot.thread_count;
+        root["fd_cnt"] = snapshot.fd_count;
+        if (snapshot.io_available) {
+            root["rd_bps"] = static_cast<Json::Int64>(snapshot.read_bps);
+            root["wr_bps"] = static_cast<Json::Int64>(snapshot.write_bps);
+            root["disk_rd_bps"] = static_cast<Json::Int64>(snapshot.disk_read_bps);
+            root["disk_wr_bps"] = static_cast<Json::Int64>(snapshot.disk_write_bps);
+        }
+        root["smpl_cpu_rt"] = std::round(snapshot.sampler_cpu_pct * 1000.0) / 1000.0;
+
+        Json::Value threads(Json::arrayValue);
+        for (const auto& usage : snapshot.top_threads) {
+            Json::Value item;
+            item["tid"] = usage.tid;
+            item["name"] = usage.name;
+            item["cpu_rt"] = round2(usage.cpu_pct);
+            threads.append(item);
+        }
+        root["threads"] = threads;
+
+        std::string json_data = writer.write(root);
+        int result = redis_client_->sendData(CHANNEL_TELEMETRY, json_data);
+
+        if (result != 0) {
+            if (publish_failures_.load() % 100 == 0) {
+                logger->error("텔레메트리 전송 실패 (결과: {})", result);
+            }
+            return false;
+        }
+        return true;
+
+    } catch (const std::exception& e) {
+        logger->error("텔레메트리 JSON 생성 실패: {}", e.what());
+        return false;
+    }
+}
+
+int ProcessTelemetry::readFile(const char* path, char* buffer, size_t size) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return -1;
+
+    ssize_t total = 0;
+    while (static_cast<size_t>(total) < size - 1) {
+        ssize_t n = read(fd, buffer + total, size - 1 - total);
+        if (n <= 0) break;
+        total += n;
+    }
+    close(fd);
+
+    buffer[total] = '\0';
+    return static_cast<int>(total);
+}
+
+bool ProcessTelemetry::parseStatTicks(const char* buffer, std::string* name, uint64_t* ticks) {
+    // 형식: pid (comm) state ppid ... utime(14) stime(15) ...
+    // comm에 공백/괄호가 들어갈 수 있으므로 마지막 ')' 기준
+    const char* open_paren = std::strchr(buffer, '(');
+    const char* close_paren = std::strrchr(buffer, ')');
+    if (!open_paren || !close_paren || close_paren < open_paren) return false;
+
+    if (name) {
+        name->assign(open_paren + 1, close_paren);
+    }
+
+    // ')' 이후 state(3) ~ cmajflt(13) 11개 필드 건너뜀
+    const char* pos = close_paren + 1;
+    for (int field = 0; field < 11; field++) {
+        while (*pos == ' ') pos++;
+        while (*pos && *pos != ' ') pos++;
+        if (!*pos) return false;
+    }
+
+    char* end = nullptr;
+    uint64_t utime = std::strtoull(pos, &end, 10);
+    if (end == pos) return false;
+    uint64_t stime = std::strtoull(end, &end, 10);
+
+    *ticks = utime + stime;
+    return true;
+}
+
+TelemetrySnapshot ProcessTelemetry::getLastSnapshot() const {
+    std::lock_guard<std::mutex> lock(snapshot_mutex_);
+    return last_snapshot_;
+}
+
+void ProcessTelemetry::logStatistics() const {
+    TelemetrySnapshot snapshot = getLastSnapshot();
+
+    logger->info("텔레메트리 통계 - 샘플: {}회, 전송 실패: {}회, 샘플러 비용: {:.3f}%",
+                samples_.load(), publish_failures_.load(), snapshot.sampler_cpu_pct);
+    if (snapshot.timestamp == 0) return;
+
+    logger->info("  프로세스 - CPU: {:.1f}%, RSS: {}KB (최대 {}KB), 스레드: {}, fd: {}",
+                snapshot.cpu_pct, snapshot.rss_kb, snapshot.rss_peak_kb,
+                snapshot.thread_count, snapshot.fd_count);
+    if (snapshot.io_available) {
+        logger->info("  IO - 읽기: {:.0f}B/s, 쓰기: {:.0f}B/s, 디스크 읽기: {:.0f}B/s, 디스크 쓰기: {:.0f}B/s",
+                    snapshot.read_bps, snapshot.write_bps,
+                    snapshot.disk_read_bps, snapshot.disk_write_bps);
+    }
+    for (const auto& usage : snapshot.top_threads) {
+        logger->info("  [{}] {} - CPU: {:.1f}%", usage.tid, usage.name, usage.cpu_pct);
+    }
+}
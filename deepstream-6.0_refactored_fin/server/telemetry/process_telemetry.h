@@ -0,0 +1,165 @@
+﻿/*
+ * process_telemetry.h
+ *
+ * 프로세스 내부 자원 사용량 샘플러
+ * - 스레드별 CPU 사용률 (/proc/self/task/<tid>/stat)
+ * - RSS, 스레드 수 (/proc/self/status), 열린 fd 수 (/proc/self/fd)
+ * - 읽기/쓰기 처리량 (/proc/self/io)
+ */
+
+#ifndef PROCESS_TELEMETRY_H
+#define PROCESS_TELEMETRY_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+// Forward declaration
+class RedisClient;
+
+/**
+ * @brief 스레드별 CPU 사용량 (샘플 구간)
+ */
+struct ThreadUsage {
+    int tid = 0;
+    std::string name;           // comm (최대 15자)
+    double cpu_pct = 0.0;       // 코어 1개 = 100%
+};
+
+/**
+ * @brief 프로세스 자원 사용량 스냅샷 (샘플 구간)
+ */
+struct TelemetrySnapshot {
+    int timestamp = 0;
+    double interval_sec = 0.0;
+
+    double cpu_pct = 0.0;               // 프로세스 전체 (코어 1개 = 100%)
+    long rss_kb = 0;                    // VmRSS
+    long rss_peak_kb = 0;               // VmHWM
+    int thread_count = 0;
+    int fd_count = 0;
+
+    bool io_available = false;          // /proc/self/io 읽기 권한 여부
+    double read_bps = 0.0;              // rchar (페이지 캐시 포함)
+    double write_bps = 0.0;             // wchar
+    double disk_read_bps = 0.0;         // read_bytes (블록 장치)
+    double disk_write_bps = 0.0;        // write_bytes
+
+    double sampler_cpu_pct = 0.0;       // 샘플러 자체 비용
+    std::vector<ThreadUsage> top_threads;   // CPU 사용률 상위 스레드
+};
+
+/**
+ * @brief 프로세스 자원 텔레메트리 샘플러
+ *
+ * 장비 성능 저하 시 스트리밍 스레드/신호 계산/통계 타이머/Redis 재연결/이미지 저장 중
+ * 어느 쪽이 원인인지 구분하기 위한 저비용 주기 샘플러
+ * - 전용 스레드(ds-telemetry)에서 interval_sec마다 /proc 파일을 읽고 직전 샘플과의 차이로 비율 계산
+ * - 파일은 고정 버퍼로 open/read만 수행 (파싱 중 할당 최소화)
+ * - 스레드 이름은 setCurrentThreadName()으로 설정된 comm 사용 (ds-*: 애플리케이션 스레드)
+ * - 결과는 telemetry 채널로 압축 JSON 전송, 5분 통계 로그에 마지막 스냅샷 출력
+ * - 샘플러 자체 CPU 비용을 측정해 0.1% 초과 시 경고
+ */
+class ProcessTelemetry {
+private:
+    // 스레드별 직전 누적 CPU 틱
+    struct ThreadSample {
+        uint64_t ticks = 0;
+        uint64_t seen_generation = 0;
+    };
+
+    // 설정
+    int interval_sec_ = 10;
+    int top_threads_ = 8;
+    bool publish_ = true;
+    long clock_ticks_ = 100;
+
+    RedisClient* redis_client_ = nullptr;
+
+    // 직전 샘플 (샘플러 스레드 전용)
+    std::unordered_map<int, ThreadSample> prev_threads_;
+    uint64_t generation_ = 0;
+    uint64_t prev_process_ticks_ = 0;
+    uint64_t prev_rchar_ = 0;
+    uint64_t prev_wchar_ = 0;
+    uint64_t prev_read_bytes_ = 0;
+    uint64_t prev_write_bytes_ = 0;
+    int64_t prev_self_cpu_ns_ = 0;
+    std::chrono::steady_clock::time_point prev_wall_;
+    bool has_prev_ = false;
+    std::vector<ThreadUsage> usage_buffer_;
+
+    // 마지막 스냅샷
+    TelemetrySnapshot last_snapshot_;
+    mutable std::mutex snapshot_mutex_;
+
+    // 샘플러 스레드
+    std::thread sampler_thread_;
+    std::atomic<bool> running_{false};
+    std::mutex wait_mutex_;
+    std::condition_variable wait_cv_;
+
+    // 통계
+    std::atomic<uint64_t> samples_{0};
+    std::atomic<uint64_t> publish_failures_{0};
+
+    // 로거
+    std::shared_ptr<spdlog::logger> logger = nullptr;
+
+    // 내부 메서드
+    void samplerThread();
+    void sample();
+    void sampleThreads(double elapsed_sec, std::vector<ThreadUsage>& usages);
+    void sampleStatus(TelemetrySnapshot& snapshot);
+    bool sampleIO(double elapsed_sec, TelemetrySnapshot& snapshot);
+    int countFds() const;
+    bool publishSnapshot(const TelemetrySnapshot& snapshot);
+
+    static int readFile(const char* path, char* buffer, size_t size);
+    static bool parseStatTicks(const char* buffer, std::string* name, uint64_t* ticks);
+
+public:
+    ProcessTelemetry();
+    ~ProcessTelemetry();
+
+    /**
+     * @brief 초기화 - config.json의 telemetry 설정 로드
+     * @param redis_client Redis 클라이언트 (nullptr이면 로그만 출력)
+     * @return 성공 시 true
+     */
+    bool initialize(RedisClient* redis_client);
+
+    /**
+     * @brief 샘플러 스레드 시작
+     */
+    void start();
+
+    /**
+     * @brief 샘플러 스레드 중지
+     */
+    void stop();
+
+    /**
+     * @brief 마지막 스냅샷 조회
+     */
+    TelemetrySnapshot getLastSnapshot() const;
+
+    /**
+     * @brief 통계 정보 로깅 (마지막 스냅샷 + 샘플러 비용)
+     */
+    void logStatistics() const;
+};
+
+#endif // PROCESS_TELEMETRY_H
@@ -0,0 +1,74 @@
+﻿/*
+ * bench_bounded_map.cpp
+ *
+ * 추적 상태 맵 접근 비용 비교 (std::map / BoundedMap 예산 비활성 / 예산 활성)
+ *
+ * 동시 60대, 객체당 프레임마다 20회 operator[] 접근 (process_meta의 det_obj 사용 패턴)
+ * 15fps 10분 분량을 처리하고 접근당 평균 시간을 출력
+ */
+
+#include "bounded_map.h"
+#include <chrono>
+#include <cstdio>
+#include <map>
+
+namespace {
+
+const int FPS = 15;
+const int FRAMES = FPS * 600;
+const int ACTIVE = 60;
+const int ACCESSES = 20;
+const int LIFETIME = FPS * 20;
+
+struct State {
+    double values[16] = {};
+};
+
+template <typename Map>
+double run(Map& map) {
+    long long sink = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (int frame = 0; frame < FRAMES; frame++) {
+        MemoryBudget::advanceFrame();
+        for (int s = 0; s < ACTIVE; s++) {
+            int id = s + ACTIVE * ((frame + s * LIFETIME / ACTIVE) / LIFETIME);
+            for (int a = 0; a < ACCESSES; a++) {
+                map[id].values[a % 16] += 1.0;
+            }
+            sink += static_cast<long long>(map[id].values[0]);
+        }
+        // 퇴장 객체 정리
+        if (frame % LIFETIME == 0) {
+            for (auto it = map.begin(); it != map.end();) {
+                if (it->first < frame / LIFETIME * ACTIVE - ACTIVE) {
+                    it = map.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+    }
+
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    if (sink == 42) std::printf(" ");
+    return elapsed / (static_cast<double>(FRAMES) * ACTIVE * (ACCESSES + 1));
+}
+
+}  // namespace
+
+int main() {
+    std::map<int, State> plain;
+    BoundedMap<int, State> unbounded;
+    BoundedMap<int, State> bounded(4096);
+
+    double plain_ns = run(plain);
+    double unbounded_ns = run(unbounded);
+    double bounded_ns = run(bounded);
+
+    std::printf("추적 상태 맵 접근 비용 (동시 %d대, 객체당 프레임 %d회, %d프레임)\n", ACTIVE, ACCESSES + 1, FRAMES);
+    std::printf("  std::map               : %6.1f ns/접근\n", plain_ns);
+    std::printf("  BoundedMap (예산 비활성): %6.1f ns/접근\n", unbounded_ns);
+    std::printf("  BoundedMap (용량 4096)  : %6.1f ns/접근 (LRU 갱신 프레임당 1회)\n", bounded_ns);
+    return 0;
+}
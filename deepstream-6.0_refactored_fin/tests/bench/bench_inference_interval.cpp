@@ -0,0 +1,217 @@
+﻿/*
+ * bench_inference_interval.cpp
+ *
+ * 추론 간격 제어 부하 대비 정확도 리포트 (합성 교차로 시나리오)
+ *
+ * 신호 주기 120초(녹색 40초)의 단일 접근로에 포아송 도착 차량을 생성하고
+ * 매 프레임 InferenceIntervalController를 구동해 실제 추론 프레임을 기록
+ * - 부하: 추론한 프레임 비율 (매 프레임 추론 = 100%)
+ * - 진입 검출 지연: 차량이 화면에 들어온 뒤 첫 추론 프레임까지 시간
+ * - 정지선 통과 위치 오차: 통과 시점부터 첫 추론 프레임까지 이동 거리 (방출 속도 30km/h)
+ * 비교 기준은 interval 0 고정 (제어 비활성)
+ */
+
+#include "inference_interval_controller.h"
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+const int FPS = 15;
+const int DURATION_SEC = 3600;
+const double CYCLE_SEC = 120.0;
+const double GREEN_SEC = 40.0;
+const double APPROACH_SEC = 6.0;        // 진입부터 정지선까지 주행 시간
+const double EXIT_SEC = 2.0;            // 정지선 통과 후 화면 이탈까지
+const double HEADWAY_SEC = 2.0;         // 포화 차두 시간
+const double DISCHARGE_MPS = 30.0 / 3.6;
+
+struct Vehicle {
+    double enter;
+    double reach;       // 정지선 도착
+    double depart;      // 정지선 통과
+    double leave;
+};
+
+bool isGreen(double t) {
+    return std::fmod(t, CYCLE_SEC) < GREEN_SEC;
+}
+
+double nextGreen(double t) {
+    return std::ceil(t / CYCLE_SEC) * CYCLE_SEC;
+}
+
+std::vector<Vehicle> generate(double arrivals_per_min, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::exponential_distribution<double> gap(arrivals_per_min / 60.0);
+
+    std::vector<Vehicle> vehicles;
+    double t = gap(rng);
+    double last_depart = -1e9;
+    while (t < DURATION_SEC - APPROACH_SEC - EXIT_SEC) {
+        Vehicle v;
+        v.enter = t;
+        v.reach = t + APPROACH_SEC;
+        double depart = std::max(v.reach, last_depart + HEADWAY_SEC);
+        while (!isGreen(depart)) {
+            depart = std::max(nextGreen(depart), last_depart + HEADWAY_SEC);
+        }
+        v.depart = depart;
+        v.leave = depart + EXIT_SEC;
+        last_depart = depart;
+        vehicles.push_back(v);
+        t += gap(rng);
+    }
+    return vehicles;
+}
+
+/**
+ * @brief 현재 interval을 기록만 하는 싱크
+ */
+class RecordingSink : public IInferenceIntervalSink {
+public:
+    int interval = 0;
+    bool setInferenceInterval(int value) override { interval = value; return true; }
+    int getInferenceInterval() const override { return interval; }
+};
+
+struct Result {
+    double load_pct = 0.0;
+    double mean_interval = 0.0;
+    double enter_p50_ms = 0.0;
+    double enter_p95_ms = 0.0;
+    double enter_max_ms = 0.0;
+    double cross_p95_m = 0.0;
+    double cross_max_m = 0.0;
+    int late = 0;                       // 진입 검출 지연이 상한 초과한 차량 수
+};
+
+double percentile(std::vector<double> v, double p) {
+    if (v.empty()) return 0.0;
+    std::sort(v.begin(), v.end());
+    size_t idx = static_cast<size_t>(p * (v.size() - 1));
+    return v[idx];
+}
+
+Result run(const std::vector<Vehicle>& vehicles, bool controlled, int latency_ms) {
+    InferenceControlConfig config;
+    config.enabled = true;
+    config.camera_fps = FPS;
+    config.max_detection_latency_ms = latency_ms;
+
+    InferenceIntervalController controller;
+    controller.configure(config);
+    auto sink = std::make_unique<RecordingSink>();
+    RecordingSink* raw_sink = sink.get();
+    controller.attachSink(std::move(sink));
+
+    const int total_frames = DURATION_SEC * FPS;
+    std::vector<char> inferred(total_frames, 0);
+    int since_infer = 1 << 30;
+    long interval_sum = 0;
+    bool was_green = isGreen(0.0);
+
+    for (int f = 0; f < total_frames; f++) {
+        double t = static_cast<double>(f) / FPS;
+        int interval = controlled ? raw_sink->interval : 0;
+        interval_sum += interval;
+
+        if (since_infer >= interval) {
+            inferred[f] = 1;
+            since_infer = 0;
+        } else {
+            since_infer++;
+        }
+
+        int present = 0;
+        int moving = 0;
+        for (const auto& v : vehicles) {
+            if (v.enter > t) break;
+            if (t >= v.leave) continue;
+            present++;
+            if (t < v.reach || t >= v.depart) moving++;
+        }
+        controller.observeFrame(present, moving, 0);
+
+        bool green = isGreen(t);
+        if (green && !was_green) {
+            controller.onSignalChange(true, f / FPS);
+        }
+        was_green = green;
+
+        if ((f + 1) % FPS == 0) {
+            ActivitySample sample;
+            sample.vehicle_present = present > 0;
+            sample.signal_known = true;
+            sample.green = green;
+            controller.updatePerSecond(sample, f / FPS);
+        }
+    }
+
+    // 이벤트 프레임 이후 첫 추론 프레임까지 지연
+    std::vector<int> next_inferred(total_frames + 1, total_frames);
+    for (int f = total_frames - 1; f >= 0; f--) {
+        next_inferred[f] = inferred[f] ? f : next_inferred[f + 1];
+    }
+
+    std::vector<double> enter_ms;
+    std::vector<double> cross_m;
+    Result r;
+    for (const auto& v : vehicles) {
+        int ef = static_cast<int>(std::ceil(v.enter * FPS));
+        int cf = static_cast<int>(std::ceil(v.depart * FPS));
+        if (cf >= total_frames) continue;
+        double e_ms = (next_inferred[ef] - v.enter * FPS) * 1000.0 / FPS;
+        double c_s = (next_inferred[cf] - v.depart * FPS) / FPS;
+        enter_ms.push_back(e_ms);
+        cross_m.push_back(c_s * DISCHARGE_MPS);
+        if (e_ms > latency_ms) r.late++;
+    }
+
+    long inferred_count = std::count(inferred.begin(), inferred.end(), 1);
+    r.load_pct = 100.0 * inferred_count / total_frames;
+    r.mean_interval = static_cast<double>(interval_sum) / total_frames;
+    r.enter_p50_ms = percentile(enter_ms, 0.50);
+    r.enter_p95_ms = percentile(enter_ms, 0.95);
+    r.enter_max_ms = enter_ms.empty() ? 0.0 : *std::max_element(enter_ms.begin(), enter_ms.end());
+    r.cross_p95_m = percentile(cross_m, 0.95);
+    r.cross_max_m = cross_m.empty() ? 0.0 : *std::max_element(cross_m.begin(), cross_m.end());
+    return r;
+}
+
+void print(const char* scenario, const char* mode, size_t vehicles, const Result& r) {
+    std::printf("%-10s %-9s %6zu %7.1f%% %6.2f %8.0f %8.0f %8.0f %8.2f %8.2f %5d\n",
+                scenario, mode, vehicles, r.load_pct, r.mean_interval,
+                r.enter_p50_ms, r.enter_p95_ms, r.enter_max_ms,
+                r.cross_p95_m, r.cross_max_m, r.late);
+}
+
+}  // namespace
+
+int main() {
+    struct Scenario {
+        const char* name;
+        double arrivals_per_min;
+    };
+    const Scenario scenarios[] = {
+        {"night", 0.5},
+        {"offpeak", 6.0},
+        {"peak", 24.0},
+    };
+    const int latency_ms = 400;
+
+    std::printf("추론 간격 제어 부하/정확도 (1시간, %dfps, 검출 지연 상한 %dms)\n", FPS, latency_ms);
+    std::printf("%-10s %-9s %6s %8s %6s %8s %8s %8s %8s %8s %5s\n",
+                "scenario", "mode", "veh", "load", "intv", "ent_p50", "ent_p95", "ent_max",
+                "crs_p95", "crs_max", "late");
+
+    for (const auto& s : scenarios) {
+        auto vehicles = generate(s.arrivals_per_min, 42);
+        print(s.name, "baseline", vehicles.size(), run(vehicles, false, latency_ms));
+        print(s.name, "adaptive", vehicles.size(), run(vehicles, true, latency_ms));
+    }
+    std::printf("ent_*: 진입 검출 지연(ms), crs_*: 정지선 통과 위치 오차(m), late: 지연 상한 초과 차량\n");
+    return 0;
+}
@@ -0,0 +1,115 @@
+﻿/*
+ * bench_lane_array.cpp
+ *
+ * 차로별 프레임 집계 비용 비교 (프레임마다 새로 만드는 std::map / 고정 크기 LaneArray)
+ *
+ * process_meta의 차로별 차량 수/속도 합계/샘플 수 집계 패턴
+ * - 차로당 차량 6대, 차량마다 3개 값 누적 (차로 밖 차량 10% 포함)
+ * - 프레임 끝에서 차로별 평균 속도 계산 (LOS/통계 소비 경로)
+ * 8차로/16차로, 15fps 10분 분량 처리 후 프레임당 평균 시간 출력
+ */
+
+#include "lane_array.h"
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <vector>
+
+namespace {
+
+const int FPS = 15;
+const int FRAMES = FPS * 600;
+const int VEHICLES_PER_LANE = 6;
+
+struct Vehicle {
+    int lane;
+    double speed;
+};
+
+// 프레임별 차량 배치 (차로 밖 차량은 lane 0)
+std::vector<std::vector<Vehicle>> makeFrames(int lanes) {
+    std::vector<std::vector<Vehicle>> frames(64);
+    unsigned seed = 12345;
+    for (auto& vehicles : frames) {
+        int count = lanes * VEHICLES_PER_LANE;
+        for (int i = 0; i < count; i++) {
+            seed = seed * 1103515245u + 12345u;
+            int lane = (seed >> 8) % 10 == 0 ? 0 : 1 + static_cast<int>((seed >> 12) % lanes);
+            vehicles.push_back({lane, 20.0 + (seed >> 20) % 40});
+        }
+    }
+    return frames;
+}
+
+double runMap(const std::vector<std::vector<Vehicle>>& frames, int lanes, double& sink) {
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < FRAMES; frame++) {
+        std::map<int, int> lane_vehicle_counts;
+        std::map<int, double> lane_speed_sums;
+        std::map<int, int> lane_speed_samples;
+
+        for (const auto& v : frames[frame % frames.size()]) {
+            if (v.lane <= 0) continue;
+            lane_vehicle_counts[v.lane]++;
+            lane_speed_sums[v.lane] += v.speed;
+            lane_speed_samples[v.lane]++;
+        }
+        for (int lane = 1; lane <= lanes; lane++) {
+            auto it = lane_speed_samples.find(lane);
+            if (it != lane_speed_samples.end() && it->second > 0) {
+                sink += lane_speed_sums[lane] / it->second + lane_vehicle_counts[lane];
+            }
+        }
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / FRAMES;
+}
+
+double runLaneArray(const std::vector<std::vector<Vehicle>>& frames, int lanes, double& sink) {
+    LaneArray<int> lane_vehicle_counts(lanes);
+    LaneArray<double> lane_speed_sums(lanes);
+    LaneArray<int> lane_speed_samples(lanes);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < FRAMES; frame++) {
+        lane_vehicle_counts.fill(0);
+        lane_speed_sums.fill(0.0);
+        lane_speed_samples.fill(0);
+
+        for (const auto& v : frames[frame % frames.size()]) {
+            lane_vehicle_counts[v.lane]++;
+            lane_speed_sums[v.lane] += v.speed;
+            lane_speed_samples[v.lane]++;
+        }
+        for (int lane = 1; lane <= lanes; lane++) {
+            if (lane_speed_samples[lane] > 0) {
+                sink += lane_speed_sums[lane] / lane_speed_samples[lane] + lane_vehicle_counts[lane];
+            }
+        }
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / FRAMES;
+}
+
+}  // namespace
+
+int main() {
+    std::printf("차로별 프레임 집계 비용 (차로당 %d대, %d프레임)\n", VEHICLES_PER_LANE, FRAMES);
+
+    for (int lanes : {8, 16}) {
+        auto frames = makeFrames(lanes);
+        double map_sink = 0.0;
+        double array_sink = 0.0;
+
+        // 캐시/할당기 예열 후 측정
+        runMap(frames, lanes, map_sink);
+        runLaneArray(frames, lanes, array_sink);
+        map_sink = array_sink = 0.0;
+
+        double map_ns = runMap(frames, lanes, map_sink);
+        double array_ns = runLaneArray(frames, lanes, array_sink);
+
+        std::printf("  %2d차로 - std::map: %7.0f ns/프레임, LaneArray: %6.0f ns/프레임 (%.1f배)%s\n",
+                    lanes, map_ns, array_ns, map_ns / array_ns,
+                    map_sink == array_sink ? "" : " [결과 불일치]");
+    }
+    return 0;
+}
@@ -0,0 +1,416 @@
+﻿/*
+ * bench_shm_ring.cpp
+ *
+ * 초당 10,000건 2K 검지 레코드 전송 시 공유메모리 링 vs Redis PUBLISH 경로 비교
+ *
+ * - 기록 스레드가 100us 간격(10k msg/s)으로 레코드 기록, 수신 스레드가 받아 지연 측정
+ *   (payload 첫 필드 = 기록 시각 steady_clock ns)
+ * - 출력: 종단 지연 p50/p99/p99.9/최대, 기록 호출 p50/p99/최대(파이프라인 스레드가 막히는 시간),
+ *   스레드별 CPU 시간(us/건), 손실 건수
+ *
+ * 전송 경로:
+ * 1. shm: ShmPublisher(64KB 링) -> ShmRingReader(futex 대기)
+ * 2. tcp-relay: Redis 경로 모사 - RedisClient와 같이 PUBLISH마다 응답을 기다리는 동기 호출,
+ *    중계 스레드(서버 역할)가 RESP 해석 후 구독 연결로 message 전달 (127.0.0.1 TCP, TCP_NODELAY)
+ *    Redis 서버 자체의 처리 비용은 포함하지 않으므로 실제 Redis 경로의 하한
+ * 3. redis: hiredis로 빌드되고(DS_BENCH_HIREDIS) DS_BENCH_REDIS=host:port가 있을 때만 실제 Redis 측정
+ *   $ ./_build/bench_shm_ring [경로별 초=5] [payload 바이트=160]
+ */
+
+#include "shm_publisher.h"
+#include "shm_ring_reader.h"
+#include "channel_types.h"
+#include "config_manager.h"
+#include <algorithm>
+#include <arpa/inet.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#ifdef DS_BENCH_HIREDIS
+#include <hiredis/hiredis.h>
+#endif
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const int RATE = 10000;                 // msg/s
+const char* CHANNEL = "detection:vehicle:2k";
+
+int64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+double threadCpuUs() {
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// 2K 검지 레코드 형태 CSV (첫 필드는 기록 시각)
+std::string makeRecord(int64_t send_ns, uint64_t n, size_t length) {
+    char fields[128];
+    std::snprintf(fields, sizeof(fields), "%lld,%llu,1,%d,%d,1,%.1f,%d,%d,0,0,cam01",
+                  static_cast<long long>(send_ns), static_cast<unsigned long long>(n),
+                  static_cast<int>(n % 4) + 1, static_cast<int>(n % 3) + 1,
+                  40.0 + (n % 300) / 10.0, static_cast<int>(n % 120), static_cast<int>(n % 7));
+    std::string record = fields;
+    record += ",/data/img/2k/";
+    while (record.size() < length) {
+        record += static_cast<char>('0' + n % 10);
+    }
+    return record;
+}
+
+struct Result {
+    std::vector<double> latency_us;     // 기록 시각 -> 수신
+    std::vector<double> call_us;        // 기록 호출 시간
+    uint64_t sent = 0;
+    uint64_t lost = 0;
+    double writer_cpu_us = 0;
+    double reader_cpu_us = 0;
+    double relay_cpu_us = 0;
+};
+
+double percentile(std::vector<double> values, double p) {
+    if (values.empty()) return 0.0;
+    std::sort(values.begin(), values.end());
+    size_t index = static_cast<size_t>(p * (values.size() - 1));
+    return values[index];
+}
+
+void printResult(const char* name, const Result& r) {
+    double sent = static_cast<double>(std::max<uint64_t>(r.sent, 1));
+    std::printf("%-10s 수신 %6zu/%6llu (손실 %llu)\n", name, r.latency_us.size(),
+                static_cast<unsigned long long>(r.sent), static_cast<unsigned long long>(r.lost));
+    std::printf("  종단 지연 us   p50 %8.1f  p99 %8.1f  p99.9 %8.1f  최대 %9.1f\n",
+                percentile(r.latency_us, 0.5), percentile(r.latency_us, 0.99),
+                percentile(r.latency_us, 0.999), percentile(r.latency_us, 1.0));
+    std::printf("  기록 호출 us   p50 %8.1f  p99 %8.1f  최대 %9.1f\n",
+                percentile(r.call_us, 0.5), percentile(r.call_us, 0.99), percentile(r.call_us, 1.0));
+    std::printf("  CPU us/건      기록 %6.2f  수신 %6.2f  중계 %6.2f  합계 %6.2f\n",
+                r.writer_cpu_us / sent, r.reader_cpu_us / sent, r.relay_cpu_us / sent,
+                (r.writer_cpu_us + r.reader_cpu_us + r.relay_cpu_us) / sent);
+}
+
+/**
+ * @brief RATE로 count건 기록 (publish는 기록 호출, 실패 시 false)
+ */
+void runWriter(Result& result, uint64_t count, size_t payload_bytes,
+               const std::function<bool(const std::string&)>& publish) {
+    result.call_us.reserve(count);
+    double cpu_start = threadCpuUs();
+    auto start = Clock::now();
+
+    for (uint64_t n = 0; n < count; n++) {
+        std::this_thread::sleep_until(start + std::chrono::microseconds(n * 1000000 / RATE));
+
+        int64_t send_ns = nowNs();
+        std::string record = makeRecord(send_ns, n, payload_bytes);
+        if (!publish(record)) break;
+        result.call_us.push_back((nowNs() - send_ns) / 1e3);
+        result.sent++;
+    }
+    result.writer_cpu_us = threadCpuUs() - cpu_start;
+}
+
+void recordLatency(Result& result, const char* payload) {
+    int64_t send_ns = std::strtoll(payload, nullptr, 10);
+    result.latency_us.push_back((nowNs() - send_ns) / 1e3);
+}
+
+// ==================== 1. 공유메모리 링 ====================
+
+Result runShm(uint64_t count, size_t payload_bytes) {
+    std::string prefix = "ds_bench_" + std::to_string(getpid()) + "_";
+    std::string path = "/tmp/ds_bench_shm_ring_" + std::to_string(getpid()) + ".json";
+    std::ofstream out(path);
+    out << "{ \"redis\": { \"channels\": { \"vehicle_2k\": \"" << CHANNEL << "\" },"
+        << "\"shm_ring\": { \"enabled\": true, \"capacity_kb\": 64,"
+        << "\"name_prefix\": \"" << prefix << "\","
+        << "\"channels\": [\"" << CHANNEL << "\"] } } }";
+    out.close();
+    ConfigManager::getInstance().initialize(path);
+    std::remove(path.c_str());
+
+    std::string name = shmRingName(prefix, CHANNEL);
+    shm_unlink(name.c_str());
+
+    Result result;
+    result.latency_us.reserve(count);
+    ShmPublisher publisher;
+    ds_test::ShmRingReader reader;
+    if (!publisher.initialize() || !reader.open(name)) {
+        std::printf("shm 링 준비 실패\n");
+        shm_unlink(name.c_str());
+        return result;
+    }
+
+    std::atomic<bool> writing{true};
+    std::thread receiver([&]() {
+        double cpu_start = threadCpuUs();
+        ds_test::ShmRecord record;
+        while (true) {
+            bool done = !writing.load();
+            while (reader.next(record)) {
+                recordLatency(result, record.payload.c_str());
+            }
+            if (done) break;
+            reader.wait(100);
+        }
+        result.reader_cpu_us = threadCpuUs() - cpu_start;
+    });
+
+    runWriter(result, count, payload_bytes, [&publisher](const std::string& record) {
+        return publisher.publish(CHANNEL_VEHICLE_2K, record) == 0;
+    });
+    writing = false;
+    receiver.join();
+
+    result.lost = reader.lost;
+    shm_unlink(name.c_str());
+    return result;
+}
+
+// ==================== 2. TCP 중계 (Redis 경로 모사) ====================
+
+bool writeAll(int fd, const std::string& data) {
+    size_t written = 0;
+    while (written < data.size()) {
+        ssize_t n = write(fd, data.data() + written, data.size() - written);
+        if (n <= 0) return false;
+        written += static_cast<size_t>(n);
+    }
+    return true;
+}
+
+std::string respArray(const std::vector<std::string>& items) {
+    std::string out = "*" + std::to_string(items.size()) + "\r\n";
+    for (const auto& item : items) {
+        out += "$" + std::to_string(item.size()) + "\r\n" + item + "\r\n";
+    }
+    return out;
+}
+
+/**
+ * @brief RESP 문자열 배열 1개 해석 (buffer 앞부분, 미완성이면 false)
+ */
+bool parseRespArray(std::string& buffer, std::vector<std::string>& items) {
+    items.clear();
+    size_t pos = 0;
+    size_t eol = buffer.find("\r\n", pos);
+    if (eol == std::string::npos || buffer[0] != '*') return false;
+    long count = std::strtol(buffer.c_str() + 1, nullptr, 10);
+    pos = eol + 2;
+
+    for (long i = 0; i < count; i++) {
+        eol = buffer.find("\r\n", pos);
+        if (eol == std::string::npos) return false;
+        long length = std::strtol(buffer.c_str() + pos + 1, nullptr, 10);
+        pos = eol + 2;
+        if (buffer.size() < pos + length + 2) return false;
+        items.emplace_back(buffer, pos, length);
+        pos += length + 2;
+    }
+    buffer.erase(0, pos);
+    return true;
+}
+
+bool readMore(int fd, std::string& buffer) {
+    char chunk[16384];
+    ssize_t n = read(fd, chunk, sizeof(chunk));
+    if (n <= 0) return false;
+    buffer.append(chunk, static_cast<size_t>(n));
+    return true;
+}
+
+int connectLoopback(int port) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<uint16_t>(port));
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        close(fd);
+        return -1;
+    }
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    return fd;
+}
+
+Result runTcpRelay(uint64_t count, size_t payload_bytes) {
+    Result result;
+    result.latency_us.reserve(count);
+
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t addr_len = sizeof(addr);
+    if (bind(listener, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || listen(listener, 2) != 0 ||
+        getsockname(listener, reinterpret_cast<sockaddr*>(&addr), &addr_len) != 0) {
+        std::printf("tcp-relay 준비 실패: %s\n", std::strerror(errno));
+        close(listener);
+        return result;
+    }
+    int port = ntohs(addr.sin_port);
+
+    // 구독 연결을 먼저 맺고 중계 스레드가 accept 순서로 구분
+    int sub_fd = connectLoopback(port);
+    int sub_server = accept(listener, nullptr, nullptr);
+    int pub_fd = connectLoopback(port);
+    int pub_server = accept(listener, nullptr, nullptr);
+    close(listener);
+    int one = 1;
+    setsockopt(sub_server, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    setsockopt(pub_server, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    // 서버 역할: PUBLISH 해석 -> 구독자에게 message 전달 -> 구독자 수 응답
+    std::thread relay([&]() {
+        double cpu_start = threadCpuUs();
+        std::string buffer;
+        std::vector<std::string> command;
+        while (readMore(pub_server, buffer)) {
+            while (parseRespArray(buffer, command)) {
+                if (command.size() != 3) continue;
+                writeAll(sub_server, respArray({"message", command[1], command[2]}));
+                writeAll(pub_server, ":1\r\n");
+            }
+        }
+        shutdown(sub_server, SHUT_WR);
+        result.relay_cpu_us = threadCpuUs() - cpu_start;
+    });
+
+    std::thread receiver([&]() {
+        double cpu_start = threadCpuUs();
+        std::string buffer;
+        std::vector<std::string> message;
+        while (readMore(sub_fd, buffer)) {
+            while (parseRespArray(buffer, message)) {
+                if (message.size() == 3) recordLatency(result, message[2].c_str());
+            }
+        }
+        result.reader_cpu_us = threadCpuUs() - cpu_start;
+    });
+
+    // RedisClient::publishToChannel과 같이 응답까지 기다리는 동기 호출
+    std::string reply;
+    runWriter(result, count, payload_bytes, [&](const std::string& record) {
+        if (!writeAll(pub_fd, respArray({"PUBLISH", CHANNEL, record}))) return false;
+        size_t eol;
+        while ((eol = reply.find("\r\n")) == std::string::npos) {
+            if (!readMore(pub_fd, reply)) return false;
+        }
+        reply.erase(0, eol + 2);
+        return true;
+    });
+
+    shutdown(pub_fd, SHUT_WR);
+    relay.join();
+    receiver.join();
+    result.lost = result.sent - result.latency_us.size();
+
+    close(pub_fd);
+    close(sub_fd);
+    close(pub_server);
+    close(sub_server);
+    return result;
+}
+
+// ==================== 3. 실제 Redis (hiredis) ====================
+
+#ifdef DS_BENCH_HIREDIS
+Result runRedis(const std::string& target, uint64_t count, size_t payload_bytes) {
+    Result result;
+    result.latency_us.reserve(count);
+
+    size_t colon = target.rfind(':');
+    std::string host = target.substr(0, colon);
+    int port = colon == std::string::npos ? 6379 : std::atoi(target.c_str() + colon + 1);
+
+    redisContext* pub = redisConnect(host.c_str(), port);
+    redisContext* sub = redisConnect(host.c_str(), port);
+    if (!pub || pub->err || !sub || sub->err) {
+        std::printf("Redis 연결 실패 (%s)\n", target.c_str());
+        if (pub) redisFree(pub);
+        if (sub) redisFree(sub);
+        return result;
+    }
+
+    std::string channel = std::string(CHANNEL) + ":bench:" + std::to_string(getpid());
+    freeReplyObject(redisCommand(sub, "SUBSCRIBE %b", channel.c_str(), channel.length()));
+
+    std::thread receiver([&]() {
+        double cpu_start = threadCpuUs();
+        redisReply* reply = nullptr;
+        while (redisGetReply(sub, reinterpret_cast<void**>(&reply)) == REDIS_OK && reply) {
+            bool stop = reply->type == REDIS_REPLY_ARRAY && reply->elements == 3 &&
+                        reply->element[2]->type == REDIS_REPLY_STRING &&
+                        std::strcmp(reply->element[2]->str, "end") == 0;
+            if (!stop && reply->type == REDIS_REPLY_ARRAY && reply->elements == 3) {
+                recordLatency(result, reply->element[2]->str);
+            }
+            freeReplyObject(reply);
+            if (stop) break;
+        }
+        result.reader_cpu_us = threadCpuUs() - cpu_start;
+    });
+
+    runWriter(result, count, payload_bytes, [&](const std::string& record) {
+        redisReply* reply = static_cast<redisReply*>(redisCommand(pub, "PUBLISH %b %b",
+            channel.c_str(), channel.length(), record.c_str(), record.length()));
+        if (!reply) return false;
+        freeReplyObject(reply);
+        return true;
+    });
+
+    freeReplyObject(redisCommand(pub, "PUBLISH %b end", channel.c_str(), channel.length()));
+    receiver.join();
+    result.lost = result.sent - result.latency_us.size();
+
+    redisFree(pub);
+    redisFree(sub);
+    return result;
+}
+#endif
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int seconds = argc > 1 ? std::atoi(argv[1]) : 5;
+    size_t payload_bytes = argc > 2 ? static_cast<size_t>(std::atoi(argv[2])) : 160;
+    uint64_t count = static_cast<uint64_t>(seconds) * RATE;
+
+    std::printf("초당 %d건 x %d초, payload %zu바이트, CPU %u개\n\n", RATE, seconds, payload_bytes,
+                std::thread::hardware_concurrency());
+
+    printResult("shm", runShm(count, payload_bytes));
+    printResult("tcp-relay", runTcpRelay(count, payload_bytes));
+
+#ifdef DS_BENCH_HIREDIS
+    const char* target = std::getenv("DS_BENCH_REDIS");
+    if (target) {
+        printResult("redis", runRedis(target, count, payload_bytes));
+    } else {
+        std::printf("redis      생략 (DS_BENCH_REDIS=host:port 미설정)\n");
+    }
+#else
+    std::printf("redis      생략 (hiredis 없이 빌드)\n");
+#endif
+    return 0;
+}
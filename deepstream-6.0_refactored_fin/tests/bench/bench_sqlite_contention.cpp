@@ -0,0 +1,98 @@
+﻿/*
+ * bench_sqlite_contention.cpp
+ *
+ * 통계 조회 중 삽입 지연 비교 (쓰기 연결 공유 vs 쓰기 연결 + 읽기 풀)
+ *
+ * vehicle_record에 행을 채운 뒤, 읽기 스레드 1개가 통계 형태 집계를 반복하는 동안
+ * 20ms마다 삽입하고 삽입 지연 분포를 출력
+ *   $ ./_build/bench_sqlite_contention [행 수=1000000] [측정 초=15]
+ * - 공유: read_pool_size=0 (임대가 쓰기 연결을 db_mutex로 잠금 - 변경 전 동작)
+ * - 분리: read_pool_size=2
+ */
+
+#include "sqlite_fixture.h"
+#include "sqlite_handler.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Result {
+    double avg_ms = 0.0;
+    double p99_ms = 0.0;
+    double max_ms = 0.0;
+    int inserts = 0;
+    int queries = 0;
+};
+
+Result run(const char* tag, int read_pool_size, int rows, int seconds) {
+    std::string db_file = ds_test::configureSQLite(tag, read_pool_size);
+    auto handler = std::make_unique<SQLiteHandler>();
+    ds_test::fillVehicleRecords(db_file, rows);
+
+    std::atomic<bool> running{true};
+    std::atomic<int> queries{0};
+    std::thread reader([&]() {
+        while (running.load()) {
+            SQLiteReadLease lease = handler->acquireReader(1000);
+            if (lease && ds_test::runStatsQuery(lease.get()) >= 0) {
+                queries++;
+            }
+        }
+    });
+
+    std::vector<double> latencies;
+    auto end = std::chrono::steady_clock::now() + std::chrono::seconds(seconds);
+    int id = 0;
+    while (std::chrono::steady_clock::now() < end) {
+        obj_data obj;
+        obj.object_id = ++id;
+        obj.lane = 1 + id % 4;
+        obj.dir_out = 11;
+        obj.stop_pass_time = static_cast<int>(time(nullptr));
+        obj.stop_pass_speed = 40.0;
+        obj.first_detected_time = obj.stop_pass_time - 5;
+
+        auto start = std::chrono::steady_clock::now();
+        handler->insertVehicleData(id, obj, "PCAR");
+        latencies.push_back(std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count());
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+
+    running = false;
+    reader.join();
+    handler.reset();
+    ds_test::removeSQLiteDir(db_file);
+
+    Result result;
+    std::sort(latencies.begin(), latencies.end());
+    double sum = 0.0;
+    for (double v : latencies) sum += v;
+    result.inserts = static_cast<int>(latencies.size());
+    result.avg_ms = latencies.empty() ? 0.0 : sum / latencies.size();
+    result.p99_ms = latencies.empty() ? 0.0 : latencies[latencies.size() * 99 / 100];
+    result.max_ms = latencies.empty() ? 0.0 : latencies.back();
+    result.queries = queries.load();
+    return result;
+}
+
+void print(const char* name, const Result& r) {
+    std::printf("  %s  삽입 %4d건  평균 %7.2fms  p99 %7.2fms  최대 %7.2fms  (집계 %d회)\n",
+                name, r.inserts, r.avg_ms, r.p99_ms, r.max_ms, r.queries);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int rows = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    int seconds = argc > 2 ? std::atoi(argv[2]) : 15;
+
+    std::printf("통계 조회 중 삽입 지연 (%d행, %d초, 20ms 간격 삽입)\n", rows, seconds);
+    print("공유", run("shared", 0, rows, seconds));
+    print("분리", run("split", 2, rows, seconds));
+    return 0;
+}
@@ -0,0 +1,178 @@
+﻿/*
+ * bench_sqlite_schema.cpp
+ *
+ * 스키마 v1(main_table) 대비 v4(vehicle_record) DB 크기 / 통계 조회 시간 비교
+ *
+ * 24시간 분량 합성 데이터로 v1 DB(차종 문자열, 보조 인덱스 5개)를 만든 뒤 복사본을 마이그레이션하고
+ * StatsQueryHelper와 같은 형태의 5분 구간 통계 쿼리 1회분을 양쪽에서 실행
+ *   $ ./_build/bench_sqlite_schema [행 수=1000000]
+ */
+
+#include "sqlite_schema.h"
+#include "logger.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+const int DAY_SEC = 86400;
+const int WINDOW_SEC = 300;
+const int TURNS[] = {11, 21, 31, 41};
+const char* CLASSES[] = {"MBUS", "LBUS", "PCAR", "MOTOR", "MTRUCK", "LTRUCK"};
+const int LANES = 3;
+
+bool exec(sqlite3* db, const std::string& sql) {
+    char* error = nullptr;
+    if (sqlite3_exec(db, sql.c_str(), nullptr, nullptr, &error) != SQLITE_OK) {
+        std::fprintf(stderr, "SQL 실패: %s\n", error ? error : "?");
+        sqlite3_free(error);
+        return false;
+    }
+    return true;
+}
+
+long long fileSize(const std::string& path) {
+    struct stat st;
+    return stat(path.c_str(), &st) == 0 ? static_cast<long long>(st.st_size) : -1;
+}
+
+// 변경 전 SQLiteHandler가 만들던 main_table (v1)
+bool createV1(const std::string& path, int rows, int now) {
+    sqlite3* db = nullptr;
+    if (sqlite3_open(path.c_str(), &db) != SQLITE_OK) return false;
+    std::string sql = R"SQL(
+        CREATE TABLE main_table(
+            row_id INTEGER PRIMARY KEY AUTOINCREMENT,
+            kncr_cd TEXT, lane_no INTEGER, turn_type_cd INTEGER,
+            turn_dttn_unix_tm INTEGER, turn_dttn_sped REAL,
+            stln_pasg_unix_tm INTEGER, stln_dttn_sped REAL,
+            vhcl_sect_sped REAL, frst_obsrvn_unix_tm INTEGER,
+            vhcl_obsrvn_hr INTEGER, vhcl_dttn_2k_id INTEGER,
+            timestamp INTEGER DEFAULT (strftime('%s', 'now')));
+        CREATE INDEX idx_timestamp ON main_table(timestamp);
+        CREATE INDEX idx_vhcl_dttn_2k_id ON main_table(vhcl_dttn_2k_id);
+        CREATE INDEX idx_turn_type_cd ON main_table(turn_type_cd);
+        CREATE INDEX idx_lane_no ON main_table(lane_no);
+        CREATE INDEX idx_kncr_cd ON main_table(kncr_cd);
+        BEGIN;
+        WITH RECURSIVE seq(n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM seq WHERE n < )SQL" + std::to_string(rows) + R"SQL()
+        INSERT INTO main_table(kncr_cd, lane_no, turn_type_cd, turn_dttn_unix_tm, turn_dttn_sped,
+                               stln_pasg_unix_tm, stln_dttn_sped, vhcl_sect_sped,
+                               frst_obsrvn_unix_tm, vhcl_obsrvn_hr, vhcl_dttn_2k_id, timestamp)
+            SELECT CASE n % 6 WHEN 0 THEN 'MBUS' WHEN 1 THEN 'LBUS' WHEN 2 THEN 'PCAR'
+                              WHEN 3 THEN 'MOTOR' WHEN 4 THEN 'MTRUCK' ELSE 'LTRUCK' END,
+                   1 + n % 3, 11 + 10 * (n % 4),
+                   t + 3, 20.0 + n % 30, t, 30.0 + n % 40, 28.0 + n % 35, t - 8, 11, n % 100000, t
+            FROM (SELECT n, )SQL" + std::to_string(now - DAY_SEC) + " + (n * " + std::to_string(DAY_SEC) +
+        ") / " + std::to_string(rows) + R"SQL( AS t FROM seq);
+        COMMIT;
+        VACUUM;
+    )SQL";
+    bool ok = exec(db, sql);
+    sqlite3_close(db);
+    return ok;
+}
+
+std::vector<std::string> statsQueries(bool v4, int start, int end) {
+    std::string table = v4 ? "vehicle_record" : "main_table";
+    std::string range = " AND stln_pasg_unix_tm >= " + std::to_string(start) +
+                        " AND stln_pasg_unix_tm < " + std::to_string(end);
+    auto cls = [&](int i) {
+        return v4 ? "kncr_id = " + std::to_string(i + 1) : std::string("kncr_cd = '") + CLASSES[i] + "'";
+    };
+
+    std::vector<std::string> queries;
+    for (int turn : TURNS) {
+        std::string where = " FROM " + table + " WHERE turn_type_cd = " + std::to_string(turn) + range;
+        queries.push_back("SELECT COUNT(*)" + where);
+        queries.push_back("SELECT AVG(stln_dttn_sped)" + where);
+        queries.push_back("SELECT AVG(vhcl_sect_sped)" + where);
+        for (int c = 0; c < 6; c++) {
+            queries.push_back("SELECT COUNT(*) FROM " + table + " WHERE turn_type_cd = " +
+                              std::to_string(turn) + " AND " + cls(c) + range);
+        }
+    }
+    for (int c = 0; c < 6; c++) {
+        std::string where = " FROM " + table + " WHERE " + cls(c) + range;
+        queries.push_back("SELECT COUNT(*)" + where);
+        queries.push_back("SELECT AVG(stln_dttn_sped)" + where);
+        queries.push_back("SELECT AVG(vhcl_sect_sped)" + where);
+    }
+    for (int lane = 1; lane <= LANES; lane++) {
+        std::string where = " FROM " + table + " WHERE lane_no = " + std::to_string(lane) + range;
+        queries.push_back("SELECT COUNT(*)" + where);
+        queries.push_back("SELECT AVG(stln_dttn_sped)" + where);
+        queries.push_back("SELECT AVG(vhcl_sect_sped)" + where);
+    }
+    std::string where = " FROM " + table + " WHERE 1" + range;
+    queries.push_back("SELECT COUNT(*)" + where);
+    queries.push_back("SELECT AVG(stln_dttn_sped)" + where);
+    queries.push_back("SELECT AVG(vhcl_sect_sped)" + where);
+    return queries;
+}
+
+double runRound(const std::string& path, bool v4, int start, int end, long long& total) {
+    sqlite3* db = nullptr;
+    sqlite3_open_v2(path.c_str(), &db, SQLITE_OPEN_READONLY, nullptr);
+    auto queries = statsQueries(v4, start, end);
+
+    total = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (const auto& sql : queries) {
+        sqlite3_stmt* stmt = nullptr;
+        if (sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) continue;
+        if (sqlite3_step(stmt) == SQLITE_ROW) {
+            total += sqlite3_column_int64(stmt, 0);
+        }
+        sqlite3_finalize(stmt);
+    }
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    sqlite3_close(db);
+    return ms;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int rows = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    int now = static_cast<int>(time(nullptr));
+
+    std::string dir = "/tmp/ds_bench_schema_" + std::to_string(getpid());
+    std::string v1 = dir + "/v1.db";
+    std::string v4 = dir + "/v4.db";
+    if (std::system(("mkdir -p " + dir).c_str()) != 0) return 1;
+
+    if (!createV1(v1, rows, now)) return 1;
+    if (std::system(("cp " + v1 + " " + v4).c_str()) != 0) return 1;
+
+    sqlite3* db = nullptr;
+    sqlite3_open(v4.c_str(), &db);
+    SQLiteSchema schema(getLogger("DS_SQLite_bench_log"));
+    auto t0 = std::chrono::steady_clock::now();
+    bool migrated = schema.migrate(db);
+    double migrate_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    sqlite3_close(db);
+    if (!migrated) {
+        std::fprintf(stderr, "마이그레이션 실패\n");
+        return 1;
+    }
+
+    int start = now - WINDOW_SEC;
+    long long total_v1 = 0, total_v4 = 0;
+    double ms_v1 = runRound(v1, false, start, now, total_v1);
+    double ms_v4 = runRound(v4, true, start, now, total_v4);
+
+    std::printf("스키마 v1 -> v%d (%d행, 24시간, 5분 구간 통계 쿼리 %zu개)\n",
+                SQLITE_SCHEMA_VERSION, rows, statsQueries(true, 0, 0).size());
+    std::printf("  DB 크기   : %.1fMB -> %.1fMB\n", fileSize(v1) / 1048576.0, fileSize(v4) / 1048576.0);
+    std::printf("  통계 1회  : %.1fms -> %.1fms (결과 합계 %lld / %lld)\n", ms_v1, ms_v4, total_v1, total_v4);
+    std::printf("  변환 시간 : %.0fms\n", migrate_ms);
+
+    if (std::system(("rm -rf " + dir).c_str()) != 0) return 1;
+    return total_v1 == total_v4 ? 0 : 1;
+}
@@ -0,0 +1,205 @@
+﻿/*
+ * bench_thread_role.cpp
+ *
+ * 스레드 역할(CPU 고정/스케줄링 정책/nice) 적용 전후 프레임 루프 지터 비교
+ *
+ * - ds-stream: 주기 PERIOD_US마다 깨어나 WORK_US 분량 계산 (프레임 처리 모사)
+ * - 배경 부하: CPU 수만큼의 ds-sqlite/ds-checkpoint 스레드가 계산 + 1MB 버퍼 복사 반복
+ *   (JPEG 인코딩/SQLite 기록 모사)
+ * - 1단계: 이름만 설정 (thread_roles 비활성과 같음), 2단계: enterThreadRole로 역할 적용
+ * 주기 시작 기준 완료 지연의 p50/p99/p99.9/최대와 주기 초과 횟수 출력
+ *
+ * 역할 설정 (CPU 수에 따라 자동):
+ * - CPU 2개 이상: ds-stream은 마지막 CPU + rr(10), 배경은 나머지 CPU + batch, nice 10
+ * - CPU 1개: CPU 고정 없이 ds-stream rr(10), 배경 batch, nice 10
+ * rr/nice는 CAP_SYS_NICE가 없으면 실패하며, 적용 결과를 함께 출력
+ *   $ ./_build/bench_thread_role [단계별 초=10]
+ */
+
+#include "thread_role.h"
+#include "config_manager.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sched.h>
+#include <string>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const int PERIOD_US = 5000;
+const int WORK_US = 500;
+
+struct PhaseResult {
+    std::vector<double> latency_us;     // 주기 시작 -> 처리 완료
+    int misses = 0;                     // 주기 초과 횟수
+    std::string applied;                // 실제 적용된 스케줄링 상태
+};
+
+// 약 us 마이크로초 분량 계산 (시간 측정 없이 고정 작업량)
+volatile double work_sink = 0.0;
+long long loops_per_us = 0;
+
+void spin(long long loops) {
+    double x = 1.0;
+    for (long long i = 0; i < loops; i++) {
+        x = x * 1.0000001 + 0.0000001;
+    }
+    work_sink = work_sink + x;
+}
+
+void calibrate() {
+    const long long probe = 20000000;
+    auto start = Clock::now();
+    spin(probe);
+    double us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    loops_per_us = std::max(1LL, static_cast<long long>(probe / us));
+}
+
+std::string describeCurrentThread() {
+    int policy = sched_getscheduler(0);
+    sched_param param;
+    sched_getparam(0, &param);
+    int nice = getpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)));
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    sched_getaffinity(0, sizeof(set), &set);
+    std::string cpus;
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (CPU_ISSET(cpu, &set)) cpus += (cpus.empty() ? "" : ",") + std::to_string(cpu);
+    }
+
+    const char* name = policy == SCHED_RR ? "rr" : policy == SCHED_FIFO ? "fifo" :
+                       policy == SCHED_BATCH ? "batch" : policy == SCHED_IDLE ? "idle" : "other";
+    return std::string(name) + (policy == SCHED_RR || policy == SCHED_FIFO
+                                ? "(" + std::to_string(param.sched_priority) + ")" : "") +
+           " nice " + std::to_string(nice) + " cpu [" + cpus + "]";
+}
+
+void enter(const char* name, bool roles) {
+    if (roles) {
+        enterThreadRole(name);
+    } else {
+        setCurrentThreadName(name);
+    }
+}
+
+PhaseResult runPhase(bool roles, int seconds) {
+    PhaseResult result;
+    std::atomic<bool> running{true};
+    std::string background_applied;
+
+    int cpus = std::max(1, static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN)));
+    std::vector<std::thread> background;
+    for (int i = 0; i < cpus; i++) {
+        const char* name = i % 2 == 0 ? "ds-sqlite" : "ds-checkpoint";
+        background.emplace_back([&, name, i]() {
+            enter(name, roles);
+            if (i == 0) background_applied = describeCurrentThread();
+            std::vector<char> src(1 << 20, 1), dst(1 << 20);
+            while (running.load(std::memory_order_relaxed)) {
+                spin(loops_per_us * 200);
+                std::memcpy(dst.data(), src.data(), src.size());
+                src[dst[12345] & 0xFFFFF]++;
+            }
+        });
+    }
+
+    std::thread stream([&]() {
+        enter("ds-stream", roles);
+        result.applied = describeCurrentThread();
+
+        int iterations = seconds * 1000000 / PERIOD_US;
+        result.latency_us.reserve(iterations);
+        auto deadline = Clock::now() + std::chrono::microseconds(PERIOD_US);
+        for (int i = 0; i < iterations; i++) {
+            std::this_thread::sleep_until(deadline);
+            spin(loops_per_us * WORK_US);
+            double latency = std::chrono::duration<double, std::micro>(Clock::now() - deadline).count();
+            result.latency_us.push_back(latency);
+            if (latency > PERIOD_US) result.misses++;
+            deadline += std::chrono::microseconds(PERIOD_US);
+            // 밀린 주기는 건너뜀 (프레임 드롭)
+            auto now = Clock::now();
+            while (deadline < now) deadline += std::chrono::microseconds(PERIOD_US);
+        }
+    });
+
+    stream.join();
+    running = false;
+    for (auto& t : background) t.join();
+
+    result.applied += " / 배경: " + background_applied;
+    return result;
+}
+
+double percentile(std::vector<double> values, double p) {
+    if (values.empty()) return 0.0;
+    std::sort(values.begin(), values.end());
+    size_t index = std::min(values.size() - 1, static_cast<size_t>(p * (values.size() - 1)));
+    return values[index];
+}
+
+void report(const char* label, const PhaseResult& r) {
+    std::printf("  %-10s p50 %7.0f us, p99 %7.0f us, p99.9 %7.0f us, 최대 %7.0f us, 주기 초과 %d/%zu\n",
+                label, percentile(r.latency_us, 0.5), percentile(r.latency_us, 0.99),
+                percentile(r.latency_us, 0.999), percentile(r.latency_us, 1.0),
+                r.misses, r.latency_us.size());
+    std::printf("             적용: %s\n", r.applied.c_str());
+}
+
+// 역할 설정 파일 작성 후 ConfigManager 초기화
+bool configureRoles() {
+    int cpus = std::max(1, static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN)));
+    std::string stream_cpus, background_cpus;
+    if (cpus >= 2) {
+        stream_cpus = "\"cpus\": [" + std::to_string(cpus - 1) + "], ";
+        std::string list;
+        for (int cpu = 0; cpu < cpus - 1; cpu++) list += (list.empty() ? "" : ",") + std::to_string(cpu);
+        background_cpus = "\"cpus\": [" + list + "], ";
+    }
+
+    std::string path = "/tmp/ds_bench_thread_role_" + std::to_string(getpid()) + ".json";
+    std::ofstream out(path);
+    out << "{ \"thread_roles\": { \"enabled\": true, \"threads\": {"
+        << "\"ds-stream\": {" << stream_cpus << "\"policy\": \"rr\", \"priority\": 10},"
+        << "\"ds-sqlite\": {" << background_cpus << "\"policy\": \"batch\", \"nice\": 10},"
+        << "\"ds-checkpoint\": {" << background_cpus << "\"policy\": \"batch\", \"nice\": 10} } } }";
+    out.close();
+
+    // 최소 설정이므로 검증 실패는 무시하고 역할 설정 로드 여부만 확인
+    ConfigManager::getInstance().initialize(path);
+    std::remove(path.c_str());
+    return ConfigManager::getInstance().isThreadRolesEnabled();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int seconds = argc > 1 ? std::max(1, std::atoi(argv[1])) : 10;
+    if (!configureRoles()) {
+        std::fprintf(stderr, "설정 초기화 실패\n");
+        return 1;
+    }
+    calibrate();
+
+    PhaseResult baseline = runPhase(false, seconds);
+    PhaseResult pinned = runPhase(true, seconds);
+
+    std::printf("프레임 루프 지터 (주기 %dus, 처리 %dus, 배경 부하 스레드 %ld개, 단계별 %d초)\n",
+                PERIOD_US, WORK_US, sysconf(_SC_NPROCESSORS_ONLN), seconds);
+    report("역할 없음", baseline);
+    report("역할 적용", pinned);
+    return 0;
+}
@@ -0,0 +1,28 @@
+﻿/*
+ * logger_stub.cpp
+ *
+ * 테스트용 getLogger 대체 구현
+ * - 기본은 null sink (로그 파일 생성 안함)
+ * - DS_TEST_LOG 환경변수가 있으면 stderr로 출력
+ */
+
+#include "logger.hpp"
+#include "../spdlog/sinks/null_sink.h"
+#include "../spdlog/sinks/stdout_sinks.h"
+#include <cstdlib>
+
+std::shared_ptr<spdlog::logger> getLogger(const char* logger_name) {
+    auto existing_logger = spdlog::get(logger_name);
+    if (existing_logger != nullptr) {
+        return existing_logger;
+    }
+
+    std::shared_ptr<spdlog::logger> test_logger;
+    if (std::getenv("DS_TEST_LOG")) {
+        test_logger = spdlog::stderr_logger_mt(logger_name);
+        test_logger->set_level(spdlog::level::trace);
+    } else {
+        test_logger = spdlog::null_logger_mt(logger_name);
+    }
+    return test_logger;
+}
@@ -0,0 +1,196 @@
+﻿/*
+ * shm_ring_reader.h
+ *
+ * 공유메모리 링 테스트/벤치마크용 리더 (shm_ring.h 리더 규칙 1~5 구현)
+ * - dataHandler shm_adaptor.py와 같은 규칙의 C++ 구현 - 기록자 검증용 기준 리더
+ * - next()의 after_copy 훅: 레코드 복사와 덮어쓰기 확인 사이에 호출 (찢어진 읽기 재현용)
+ */
+
+#ifndef SHM_RING_READER_H
+#define SHM_RING_READER_H
+
+#include "shm_ring.h"
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <functional>
+#include <linux/futex.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace ds_test {
+
+struct ShmRecord {
+    ShmRecordHeader header;
+    std::string payload;
+};
+
+class ShmRingReader {
+private:
+    ShmRingHeader* header_ = nullptr;
+    const uint8_t* data_ = nullptr;
+    size_t map_size_ = 0;
+    uint64_t capacity_ = 0;
+    uint64_t read_pos_ = 0;
+    uint64_t expected_seq_ = 0;
+    bool have_seq_ = false;
+
+public:
+    // 통계
+    uint64_t received = 0;
+    uint64_t lost = 0;          // seq 차이로 계산한 손실 레코드 수
+    uint64_t overruns = 0;      // 규칙 1: 읽기 전에 덮어쓰임
+    uint64_t torn = 0;          // 규칙 2: 복사 중 덮어쓰임
+
+    ShmRingReader() = default;
+    ~ShmRingReader() { close(); }
+
+    ShmRingReader(const ShmRingReader&) = delete;
+    ShmRingReader& operator=(const ShmRingReader&) = delete;
+
+    /**
+     * @brief 링 연결 - 현재 commit_pos부터 읽음 (from_start면 0부터)
+     */
+    bool open(const std::string& name, bool from_start = false) {
+        int fd = shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0) return false;
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(ShmRingHeader)) {
+            ::close(fd);
+            return false;
+        }
+        // 헤더의 원자 필드(waiters)는 리더도 갱신하므로 쓰기 가능 매핑
+        void* address = mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (address == MAP_FAILED) return false;
+
+        header_ = static_cast<ShmRingHeader*>(address);
+        map_size_ = st.st_size;
+        if (header_->magic != SHM_RING_MAGIC || header_->version != SHM_RING_VERSION ||
+            header_->header_size + header_->capacity != map_size_) {
+            close();
+            return false;
+        }
+        capacity_ = header_->capacity;
+        data_ = static_cast<const uint8_t*>(address) + header_->header_size;
+        read_pos_ = from_start ? 0 : header_->commit_pos.load(std::memory_order_acquire);
+        return true;
+    }
+
+    void close() {
+        if (header_) {
+            munmap(header_, map_size_);
+            header_ = nullptr;
+            data_ = nullptr;
+        }
+    }
+
+    uint64_t readPos() const { return read_pos_; }
+
+    /**
+     * @brief 다음 레코드 읽기 (없으면 false, 덮어쓰인 레코드는 건너뜀)
+     * @param after_copy 복사 후 덮어쓰기 확인 전에 호출 (테스트 훅)
+     */
+    bool next(ShmRecord& out, const std::function<void()>& after_copy = nullptr) {
+        while (true) {
+            uint64_t commit = header_->commit_pos.load(std::memory_order_acquire);
+
+            // 규칙 5: 기록자 재초기화
+            if (commit < read_pos_) {
+                read_pos_ = commit;
+                have_seq_ = false;
+                return false;
+            }
+            if (commit == read_pos_) return false;
+
+            // 규칙 1: 읽기 전에 덮어쓰임
+            if (commit - read_pos_ > capacity_) {
+                overruns++;
+                read_pos_ = commit;     // 손실 수는 다음 레코드의 seq 차이로 계산
+                continue;
+            }
+
+            uint64_t start = read_pos_;
+            uint64_t offset = start & (capacity_ - 1);
+            uint64_t remain = capacity_ - offset;
+
+            if (remain < sizeof(ShmRecordHeader)) {
+                read_pos_ += remain;        // 채움 레코드 없이 건너뛴 끝 공간
+                continue;
+            }
+
+            ShmRecordHeader record;
+            std::memcpy(&record, data_ + offset, sizeof(record));
+
+            uint64_t size = 0;
+            bool pad = record.length == SHM_RECORD_PAD;
+            if (pad) {
+                size = remain;
+            } else {
+                size = shmRecordSize(record.length);
+                if (size > remain) {
+                    // 헤더가 복사 중 덮어쓰인 경우에만 발생 - 아래 확인에서 버려짐
+                    size = remain;
+                    pad = true;
+                } else {
+                    out.payload.assign(reinterpret_cast<const char*>(data_ + offset + sizeof(record)),
+                                       record.length);
+                }
+            }
+
+            if (after_copy) after_copy();
+
+            // 규칙 2: 복사 후 reserve_pos 확인 (복사 내용이 보였다면 그 전의 예약도 보임)
+            std::atomic_thread_fence(std::memory_order_acquire);
+            uint64_t reserve = header_->reserve_pos.load(std::memory_order_relaxed);
+            if (reserve - start > capacity_) {
+                torn++;
+                read_pos_ = header_->commit_pos.load(std::memory_order_acquire);
+                continue;
+            }
+
+            read_pos_ = start + size;
+            if (pad) continue;
+
+            // 규칙 3: seq 차이 = 손실
+            if (have_seq_ && record.seq > expected_seq_) {
+                lost += record.seq - expected_seq_;
+            }
+            expected_seq_ = record.seq + 1;
+            have_seq_ = true;
+
+            out.header = record;
+            received++;
+            return true;
+        }
+    }
+
+    /**
+     * @brief 규칙 4: 새 레코드가 공개될 때까지 대기
+     * @return 새 레코드 있음 (시간 초과 시 false)
+     */
+    bool wait(int timeout_ms) {
+        if (header_->commit_pos.load(std::memory_order_acquire) != read_pos_) return true;
+
+        header_->waiters.fetch_add(1);
+        uint32_t seen = header_->notify.load();
+        if (header_->commit_pos.load(std::memory_order_acquire) == read_pos_) {
+            timespec timeout{timeout_ms / 1000, (timeout_ms % 1000) * 1000000L};
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&header_->notify), FUTEX_WAIT, seen,
+                    &timeout, nullptr, 0);
+        }
+        header_->waiters.fetch_sub(1);
+        return header_->commit_pos.load(std::memory_order_acquire) != read_pos_;
+    }
+};
+
+}  // namespace ds_test
+
+#endif // SHM_RING_READER_H
@@ -0,0 +1,108 @@
+﻿/*
+ * sqlite_fixture.h
+ *
+ * SQLite 테스트/벤치마크 공통 준비
+ * - 임시 디렉토리에 DB를 두는 설정 파일 작성 후 ConfigManager 재초기화
+ * - vehicle_record 대량 행 생성 (단일 트랜잭션)
+ * - 통계 쿼리 형태의 집계 (차로/회전별 COUNT/AVG 전체 스캔)
+ */
+
+#ifndef SQLITE_FIXTURE_H
+#define SQLITE_FIXTURE_H
+
+#include "config_manager.h"
+#include <sqlite3.h>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+
+namespace ds_test {
+
+/**
+ * @brief 임시 DB 디렉토리 설정 후 ConfigManager 초기화
+ * @param tag 디렉토리 구분자
+ * @param read_pool_size 읽기 풀 크기 (0: 쓰기 연결 공유)
+ * @return DB 파일 경로
+ */
+inline std::string configureSQLite(const std::string& tag, int read_pool_size) {
+    std::string dir = "/tmp/ds_test_sqlite_" + std::to_string(getpid()) + "_" + tag + "/";
+    std::string cmd = "rm -rf " + dir + " && mkdir -p " + dir;
+    if (std::system(cmd.c_str()) != 0) return "";
+
+    std::string config_path = dir + "config.json";
+    std::ofstream out(config_path);
+    out << "{ \"paths\": { \"base_path\": \"" << dir << "\", \"sqlite_db\": {"
+        << "\"filename\": \"test.db\", \"read_pool_size\": " << read_pool_size << ","
+        << "\"checkpoint_interval_sec\": 1 } } }";
+    out.close();
+
+    ConfigManager::getInstance().initialize(config_path);
+    return dir + "test.db";
+}
+
+inline void removeSQLiteDir(const std::string& db_file) {
+    std::string dir = db_file.substr(0, db_file.find_last_of('/'));
+    std::string cmd = "rm -rf " + dir;
+    if (std::system(cmd.c_str()) != 0) return;
+}
+
+/**
+ * @brief vehicle_record에 rows개 행 생성 (최근 1시간 정지선 통과, 4차로, 회전 3종)
+ */
+inline bool fillVehicleRecords(const std::string& db_file, int rows) {
+    sqlite3* db = nullptr;
+    if (sqlite3_open(db_file.c_str(), &db) != SQLITE_OK) {
+        sqlite3_close(db);
+        return false;
+    }
+    sqlite3_busy_timeout(db, 5000);
+
+    std::string sql =
+        "BEGIN;"
+        "WITH RECURSIVE seq(n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM seq WHERE n < " + std::to_string(rows) + ") "
+        "INSERT INTO vehicle_record (kncr_id, lane_no, turn_type_cd, turn_dttn_unix_tm, turn_dttn_sped, "
+        "stln_pasg_unix_tm, stln_dttn_sped, vhcl_sect_sped, frst_obsrvn_unix_tm, vhcl_obsrvn_hr, vhcl_dttn_2k_id) "
+        "SELECT 1 + n % 6, 1 + n % 4, 11 + 10 * (n % 3), strftime('%s','now') - n % 3600, 30.0 + n % 40, "
+        "strftime('%s','now') - n % 3600, 25.0 + n % 50, 28.0 + n % 30, strftime('%s','now') - n % 3600 - 10, 10, n "
+        "FROM seq;"
+        "COMMIT;";
+    bool ok = sqlite3_exec(db, sql.c_str(), nullptr, nullptr, nullptr) == SQLITE_OK;
+    sqlite3_close(db);
+    return ok;
+}
+
+/**
+ * @brief 통계 쿼리 형태 집계 1회 (결과 행 수 반환, 실패 시 -1)
+ */
+inline int runStatsQuery(sqlite3* db) {
+    const char* sql =
+        "SELECT lane_no, turn_type_cd, kncr_id, COUNT(*), AVG(stln_dttn_sped), AVG(vhcl_sect_sped) "
+        "FROM vehicle_record WHERE stln_pasg_unix_tm > 0 GROUP BY lane_no, turn_type_cd, kncr_id";
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) != SQLITE_OK) return -1;
+
+    int rows = 0;
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        rows++;
+    }
+    sqlite3_finalize(stmt);
+    return rc == SQLITE_DONE ? rows : -1;
+}
+
+inline long long countRecords(sqlite3* db) {
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db, "SELECT COUNT(*) FROM vehicle_record", -1, &stmt, nullptr) != SQLITE_OK) return -1;
+    long long count = -1;
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        count = sqlite3_column_int64(stmt, 0);
+    }
+    sqlite3_finalize(stmt);
+    return count;
+}
+
+}  // namespace ds_test
+
+#endif // SQLITE_FIXTURE_H
@@ -0,0 +1,81 @@
+﻿#ifndef TEST_COMMON_H
+#define TEST_COMMON_H
+
+/*
+ * test_common.h
+ *
+ * DeepStream/GPU 없이 실행되는 단위 테스트용 최소 하네스
+ * - TEST_CASE로 등록한 함수를 test_main.cpp가 순서대로 실행
+ * - CHECK 실패 시 위치를 출력하고 해당 테스트를 실패로 기록
+ */
+
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace ds_test {
+
+struct TestCase {
+    const char* name;
+    std::function<void()> fn;
+};
+
+inline std::vector<TestCase>& registry() {
+    static std::vector<TestCase> cases;
+    return cases;
+}
+
+inline int& failureCount() {
+    static int failures = 0;
+    return failures;
+}
+
+struct Registrar {
+    Registrar(const char* name, std::function<void()> fn) {
+        registry().push_back({name, std::move(fn)});
+    }
+};
+
+inline void reportFailure(const char* file, int line, const std::string& message) {
+    failureCount()++;
+    std::cerr << "  FAIL " << file << ":" << line << " - " << message << std::endl;
+}
+
+}  // namespace ds_test
+
+#define TEST_CASE(name) \
+    static void name(); \
+    static ds_test::Registrar name##_registrar(#name, name); \
+    static void name()
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) ds_test::reportFailure(__FILE__, __LINE__, #cond); \
+    } while (0)
+
+#define CHECK_EQ(a, b) \
+    do { \
+        auto _va = (a); \
+        auto _vb = (b); \
+        if (!(_va == _vb)) { \
+            std::ostringstream _os; \
+            _os << #a << " == " << #b << " (" << _va << " vs " << _vb << ")"; \
+            ds_test::reportFailure(__FILE__, __LINE__, _os.str()); \
+        } \
+    } while (0)
+
+#define CHECK_NEAR(a, b, eps) \
+    do { \
+        double _va = (a); \
+        double _vb = (b); \
+        if (std::fabs(_va - _vb) > (eps)) { \
+            std::ostringstream _os; \
+            _os << #a << " ~= " << #b << " (" << _va << " vs " << _vb << ")"; \
+            ds_test::reportFailure(__FILE__, __LINE__, _os.str()); \
+        } \
+    } while (0)
+
+#endif // TEST_COMMON_H
@@ -0,0 +1,24 @@
+﻿#include "test_common.h"
+
+int main() {
+    int failed_cases = 0;
+
+    for (const auto& tc : ds_test::registry()) {
+        int before = ds_test::failureCount();
+        try {
+            tc.fn();
+        } catch (const std::exception& e) {
+            ds_test::reportFailure(__FILE__, __LINE__, std::string("예외: ") + e.what());
+        }
+
+        bool ok = ds_test::failureCount() == before;
+        if (!ok) {
+            failed_cases++;
+        }
+        std::cout << (ok ? "[ OK ] " : "[FAIL] ") << tc.name << std::endl;
+    }
+
+    std::cout << ds_test::registry().size() - failed_cases << "/"
+              << ds_test::registry().size() << " 통과" << std::endl;
+    return failed_cases == 0 ? 0 : 1;
+}
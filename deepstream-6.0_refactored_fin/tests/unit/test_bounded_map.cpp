@@ -0,0 +1,174 @@
+﻿/*
+ * test_bounded_map.cpp
+ *
+ * 용량 제한 추적 상태 맵 테스트
+ * - 용량 초과 시 LRU/OLDEST 축출, 축출 콜백
+ * - 최근 사용 갱신은 프레임당 1회
+ * - 예산 비활성(기본값)이면 무제한 + 축출 없음
+ * - 장시간 소크: ID 누수 트래커에서도 항목 수 상한 유지, 활성 객체는 축출되지 않음
+ */
+
+#include "test_common.h"
+#include "bounded_map.h"
+#include <vector>
+
+namespace {
+
+struct Track {
+    int frames = 0;
+    int first_frame = -1;
+};
+
+}  // namespace
+
+TEST_CASE(lru_evicts_least_recent_frame) {
+    BoundedMap<int, int> map(3);
+    MemoryBudget::advanceFrame();
+    map[1] = 1;
+    map[2] = 2;
+    map[3] = 3;
+
+    MemoryBudget::advanceFrame();
+    map[1] += 10;                   // 1 갱신 -> 가장 오래된 것은 2
+
+    MemoryBudget::advanceFrame();
+    map[4] = 4;
+    CHECK_EQ(map.size(), 3u);
+    CHECK(map.find(2) == map.end());
+    CHECK(map.find(1) != map.end());
+    CHECK_EQ(map.evictions(), 1u);
+}
+
+TEST_CASE(touch_once_per_frame) {
+    BoundedMap<int, int> map(3);
+    MemoryBudget::advanceFrame();
+    map[1] = 1;
+    map[2] = 2;
+    map[3] = 3;
+    map[1] = 5;                     // 같은 프레임 재접근은 순서 변경 없음
+
+    MemoryBudget::advanceFrame();
+    map[4] = 4;
+    CHECK(map.find(1) == map.end());
+    CHECK(map.find(2) != map.end());
+}
+
+TEST_CASE(find_does_not_touch) {
+    BoundedMap<int, int> map(2);
+    MemoryBudget::advanceFrame();
+    map[1] = 1;
+    map[2] = 2;
+
+    MemoryBudget::advanceFrame();
+    CHECK(map.find(1) != map.end());
+    map[3] = 3;
+    CHECK(map.find(1) == map.end());
+}
+
+TEST_CASE(oldest_policy_ignores_access) {
+    BoundedMap<int, int> map(2, BoundedMap<int, int>::Eviction::OLDEST);
+    MemoryBudget::advanceFrame();
+    map[1] = 1;
+    map[2] = 2;
+
+    MemoryBudget::advanceFrame();
+    map[1] = 3;
+    map[3] = 3;
+    CHECK(map.find(1) == map.end());
+    CHECK(map.find(2) != map.end());
+}
+
+TEST_CASE(evict_callback_and_erase) {
+    BoundedMap<int, int> map(2);
+    std::vector<int> evicted;
+    map.setEvictCallback([&](const int& key, int& value) { evicted.push_back(key * 100 + value); });
+
+    MemoryBudget::advanceFrame();
+    map[1] = 7;
+    map[2] = 8;
+    map.erase(2);                   // erase는 순서 목록에서도 제거
+    map[3] = 9;
+    CHECK(evicted.empty());
+
+    MemoryBudget::advanceFrame();
+    map[4] = 1;
+    CHECK_EQ(evicted.size(), 1u);
+    CHECK_EQ(evicted[0], 107);
+
+    for (auto it = map.begin(); it != map.end();) {
+        it = map.erase(it);
+    }
+    CHECK(map.empty());
+    map[5] = 5;
+    map[6] = 6;
+    CHECK_EQ(map.size(), 2u);
+}
+
+TEST_CASE(budget_disabled_by_default_is_unbounded) {
+    BoundedMap<int, int> map;
+    map.attachBudget("test_unbounded", 4);
+    CHECK_EQ(map.capacity(), 0u);
+
+    for (int i = 0; i < 100; i++) {
+        map[i] = i;
+    }
+    CHECK_EQ(map.size(), 100u);
+    CHECK_EQ(map.evictions(), 0u);
+}
+
+TEST_CASE(soak_leaking_tracker) {
+    // 15fps 24시간, 동시 40대, 차량당 약 20초 체류, 퇴장 ID 중 10%는 정리되지 않음 (트래커 ID 누수)
+    const int FPS = 15;
+    const int FRAMES = FPS * 3600 * 24;
+    const int ACTIVE = 40;
+    const int LIFETIME = FPS * 20;
+    const size_t CAPACITY = 512;
+
+    BoundedMap<int, Track> map(CAPACITY);
+    int evicted_active = 0;
+    std::vector<int> slot_id(ACTIVE);
+    std::vector<int> slot_end(ACTIVE);
+    int next_id = 1;
+    for (int s = 0; s < ACTIVE; s++) {
+        slot_id[s] = next_id++;
+        slot_end[s] = LIFETIME * (s + 1) / ACTIVE;
+    }
+    map.setEvictCallback([&](const int& key, Track&) {
+        for (int s = 0; s < ACTIVE; s++) {
+            if (slot_id[s] == key) evicted_active++;
+        }
+    });
+
+    size_t max_size = 0;
+    int restarted = 0;
+    for (int frame = 0; frame < FRAMES; frame++) {
+        MemoryBudget::advanceFrame();
+        for (int s = 0; s < ACTIVE; s++) {
+            if (frame >= slot_end[s]) {
+                if (slot_id[s] % 10 != 0) {
+                    map.erase(slot_id[s]);
+                }
+                slot_id[s] = next_id++;
+                slot_end[s] = frame + LIFETIME;
+            }
+
+            // 프레임당 객체별 여러 번 접근 (process_meta의 det_obj[id] 사용 패턴)
+            Track& t = map[slot_id[s]];
+            if (t.first_frame < 0) {
+                t.first_frame = frame;
+            } else if (t.frames == 0) {
+                restarted++;
+            }
+            t.frames++;
+            map[slot_id[s]].frames += 0;
+            map[slot_id[s]].frames += 0;
+        }
+        max_size = std::max(max_size, map.size());
+    }
+
+    CHECK(max_size <= CAPACITY);
+    CHECK_EQ(evicted_active, 0);
+    CHECK_EQ(restarted, 0);
+    CHECK(map.evictions() > 0);
+    CHECK_EQ(map.size(), CAPACITY);
+}
@@ -0,0 +1,93 @@
+﻿/*
+ * test_heartbeat_registry.cpp
+ *
+ * 하트비트 정지 감시 테스트
+ * - 처리 단계(FRAME 등)에서 deadline 초과 시 정지 감지 + 복구 함수 1회 호출
+ * - 입력 대기(WAIT_BUFFER)/예정된 대기(IDLE)는 deadline을 넘겨도 정지 아님 (RTSP 단절 구간)
+ */
+
+#include "test_common.h"
+#include "heartbeat_registry.h"
+#include "config_manager.h"
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+
+const int DEADLINE_MS = 300;
+const int BLOCK_MS = 1000;
+
+// 감시 주기 100ms, deadline 300ms, 복구 동작 callback
+void loadTestConfig() {
+    static bool loaded = false;
+    if (loaded) return;
+
+    std::string path = "/tmp/ds_test_heartbeat_" + std::to_string(getpid()) + ".json";
+    std::ofstream out(path);
+    out << "{ \"heartbeat\": { \"enabled\": true, \"check_interval_ms\": 100, \"threads\": {"
+        << "\"hb-frame\": {\"recovery\": \"callback\"},"
+        << "\"hb-wait\": {\"recovery\": \"callback\"},"
+        << "\"hb-idle\": {\"recovery\": \"callback\"} } } }";
+    out.close();
+
+    ConfigManager::getInstance().initialize(path);
+    std::remove(path.c_str());
+    HeartbeatRegistry::getInstance().startSupervisor();
+    loaded = true;
+}
+
+void sleepMs(int ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+/**
+ * @brief stage 단계에서 BLOCK_MS 동안 멈춘 스레드의 정지 감지 횟수
+ */
+int blockedStalls(const char* name, HeartbeatStage stage) {
+    std::atomic<int> stalls{0};
+    HeartbeatHandle handle = HeartbeatRegistry::getInstance().registerThread(
+        name, DEADLINE_MS, [&stalls]() { stalls++; });
+    CHECK(handle.valid());
+
+    handle.beat(HB_STAGE_FRAME);
+    handle.beat(stage);
+    sleepMs(BLOCK_MS);
+
+    // 재개 후 정상 처리
+    for (int i = 0; i < 5; i++) {
+        handle.beat(HB_STAGE_FRAME);
+        handle.beat(HB_STAGE_WAIT_BUFFER);
+        sleepMs(50);
+    }
+    handle.release();
+    return stalls.load();
+}
+
+}  // namespace
+
+TEST_CASE(frame_stage_block_is_stall) {
+    loadTestConfig();
+    CHECK_EQ(blockedStalls("hb-frame", HB_STAGE_FRAME), 1);
+}
+
+TEST_CASE(wait_buffer_block_is_not_stall) {
+    loadTestConfig();
+    CHECK_EQ(blockedStalls("hb-wait", HB_STAGE_WAIT_BUFFER), 0);
+}
+
+TEST_CASE(idle_block_is_not_stall) {
+    loadTestConfig();
+    CHECK_EQ(blockedStalls("hb-idle", HB_STAGE_IDLE), 0);
+}
+
+TEST_CASE(wait_stage_classification) {
+    CHECK(heartbeatStageIsWait(HB_STAGE_IDLE));
+    CHECK(heartbeatStageIsWait(HB_STAGE_WAIT_BUFFER));
+    CHECK(!heartbeatStageIsWait(HB_STAGE_LOCK_WAIT));
+    CHECK(!heartbeatStageIsWait(HB_STAGE_FRAME));
+    CHECK(!heartbeatStageIsWait(HB_STAGE_REDIS));
+}
@@ -0,0 +1,209 @@
+﻿/*
+ * test_inference_interval_controller.cpp
+ *
+ * InferenceIntervalController 정책 테스트 (nvinfer 대신 기록용 싱크 사용)
+ */
+
+#include "test_common.h"
+#include "inference_interval_controller.h"
+#include <vector>
+
+namespace {
+
+/**
+ * @brief 적용 요청을 기록하는 싱크
+ */
+class StubSink : public IInferenceIntervalSink {
+public:
+    std::vector<int>* applied;
+    bool accept = true;
+    int current = 0;
+
+    explicit StubSink(std::vector<int>* out) : applied(out) {}
+
+    bool setInferenceInterval(int interval) override {
+        if (!accept) return false;
+        applied->push_back(interval);
+        current = interval;
+        return true;
+    }
+
+    int getInferenceInterval() const override { return current; }
+};
+
+InferenceControlConfig testConfig() {
+    InferenceControlConfig config;
+    config.enabled = true;
+    config.active_interval = 0;
+    config.static_interval = 2;
+    config.empty_interval = 4;
+    config.max_detection_latency_ms = 400;
+    config.relax_hold_sec = 3;
+    config.camera_fps = 15;
+    return config;
+}
+
+ActivitySample emptySample() {
+    return ActivitySample{};
+}
+
+ActivitySample queuedSample(bool green = false) {
+    ActivitySample s;
+    s.vehicles = 5;
+    s.vehicle_present = true;
+    s.signal_known = true;
+    s.green = green;
+    return s;
+}
+
+ActivitySample movingSample() {
+    ActivitySample s = queuedSample(true);
+    s.moving_vehicles = 2;
+    return s;
+}
+
+}  // namespace
+
+TEST_CASE(classify_levels) {
+    CHECK(InferenceIntervalController::classify(emptySample()) == ActivityLevel::EMPTY);
+    CHECK(InferenceIntervalController::classify(queuedSample(false)) == ActivityLevel::STATIC);
+    CHECK(InferenceIntervalController::classify(queuedSample(true)) == ActivityLevel::ACTIVE);
+    CHECK(InferenceIntervalController::classify(movingSample()) == ActivityLevel::ACTIVE);
+
+    ActivitySample ped;
+    ped.pedestrians = 1;
+    CHECK(InferenceIntervalController::classify(ped) == ActivityLevel::ACTIVE);
+}
+
+TEST_CASE(attach_applies_active_interval) {
+    std::vector<int> applied;
+    InferenceIntervalController controller;
+    CHECK(controller.configure(testConfig()));
+    controller.attachSink(std::make_unique<StubSink>(&applied));
+
+    CHECK_EQ(applied.size(), 1u);
+    if (!applied.empty()) CHECK_EQ(applied[0], 0);
+}
+
+TEST_CASE(relax_requires_hold_time) {
+    std::vector<int> applied;
+    InferenceIntervalController controller;
+    CHECK(controller.configure(testConfig()));
+    controller.attachSink(std::make_unique<StubSink>(&applied));
+
+    // relax_hold_sec=3 - 3초째에 하강
+    controller.updatePerSecond(emptySample(), 1);
+    controller.updatePerSecond(emptySample(), 2);
+    CHECK(controller.getLevel() == ActivityLevel::ACTIVE);
+    controller.updatePerSecond(emptySample(), 3);
+    CHECK(controller.getLevel() == ActivityLevel::EMPTY);
+
+    std::vector<int> expected = {0, 4};
+    CHECK(applied == expected);
+}
+
+TEST_CASE(relax_uses_highest_target_during_hold) {
+    std::vector<int> applied;
+    InferenceIntervalController controller;
+    CHECK(controller.configure(testConfig()));
+    controller.attachSink(std::make_unique<StubSink>(&applied));
+
+    controller.updatePerSecond(emptySample(), 1);
+    controller.updatePerSecond(queuedSample(), 2);
+    controller.updatePerSecond(emptySample(), 3);
+    CHECK(controller.getLevel() == ActivityLevel::STATIC);
+    CHECK_EQ(controller.getInterval(), 2);
+}
+
+TEST_CASE(activity_rise_is_immediate) {
+    std::vector<int> applied;
+    InferenceIntervalController controller;
+    CHECK(controller.configure(testConfig()));
+    controller.attachSink(std::make_unique<StubSink>(&applied));
+
+    for (int t = 1; t <= 3; t++) controller.updatePerSecond(emptySample(), t);
+    CHECK(controller.getLevel() == ActivityLevel::EMPTY);
+
+    // 프레임 누적값만으로도 즉시 ACTIVE
+    controller.observeFrame(1, 1, 0);
+    controller.updatePerSecond(emptySample(), 4);
+    CHECK(controller.getLevel() == ActivityLevel::ACTIVE);
+
+    std::vector<int> expected = {0, 4, 0};
+    CHECK(applied == expected);
+}
+
+TEST_CASE(green_start_releases_static_queue) {
+    std::vector<int> applied;
+    InferenceIntervalController controller;
+    CHECK(controller.configure(testConfig()));
+    controller.attachSink(std::make_unique<StubSink>(&applied));
+
+    for (int t = 1; t <= 3; t++) controller.updatePerSecond(queuedSample(), t);
+    CHECK(controller.getLevel() == ActivityLevel::STATIC);
+
+    controller.onSignalChange(true, 4);
+    CHECK(controller.getLevel() == ActivityLevel::ACTIVE);
+    CHECK(!applied.empty() && applied.back() == 0);
+}
+
+TEST_CASE(green_start_ignored_when_empty) {
+    std::vector<int> applied;
+    InferenceIntervalController controller;
+    CHECK(controller.configure(testConfig()));
+    controller.attachSink(std::make_unique<StubSink>(&applied));
+
+    for (int t = 1; t <= 3; t++) controller.updatePerSecond(emptySample(), t);
+    controller.onSignalChange(true, 4);
+    CHECK(controller.getLevel() == ActivityLevel::EMPTY);
+}
+
+TEST_CASE(latency_bound_clamps_intervals) {
+    InferenceControlConfig config = testConfig();
+    config.empty_interval = 30;
+    config.static_interval = 20;
+    config.max_detection_latency_ms = 200;   // 15fps -> 3프레임 -> interval 상한 2
+
+    std::vector<int> applied;
+    InferenceIntervalController controller;
+    CHECK(controller.configure(config));
+    controller.attachSink(std::make_unique<StubSink>(&applied));
+
+    for (int t = 1; t <= 3; t++) controller.updatePerSecond(emptySample(), t);
+    CHECK_EQ(controller.getInterval(), 2);
+}
+
+TEST_CASE(unchanged_interval_not_reapplied) {
+    InferenceControlConfig config = testConfig();
+    config.static_interval = 4;              // STATIC과 EMPTY가 같은 interval
+
+    std::vector<int> applied;
+    InferenceIntervalController controller;
+    CHECK(controller.configure(config));
+    controller.attachSink(std::make_unique<StubSink>(&applied));
+
+    for (int t = 1; t <= 3; t++) controller.updatePerSecond(queuedSample(), t);
+    for (int t = 4; t <= 6; t++) controller.updatePerSecond(emptySample(), t);
+    CHECK(controller.getLevel() == ActivityLevel::EMPTY);
+
+    std::vector<int> expected = {0, 4};
+    CHECK(applied == expected);
+}
+
+TEST_CASE(rejected_interval_is_retried) {
+    std::vector<int> applied;
+    InferenceIntervalController controller;
+    CHECK(controller.configure(testConfig()));
+
+    auto sink = std::make_unique<StubSink>(&applied);
+    StubSink* raw = sink.get();
+    raw->accept = false;                     // input-tensor-meta 모드처럼 적용 거부
+    controller.attachSink(std::move(sink));
+    CHECK(applied.empty());
+
+    // 거부된 값은 적용된 것으로 기록되지 않아 다음 전환 시 다시 시도
+    raw->accept = true;
+    for (int t = 1; t <= 3; t++) controller.updatePerSecond(emptySample(), t);
+    std::vector<int> expected = {4};
+    CHECK(applied == expected);
+}
@@ -0,0 +1,204 @@
+﻿/*
+ * test_inference_region.cpp
+ *
+ * ROI 영역 추론 테스트
+ * - 추론 영역 사각형 생성 (여유, 4px 정렬, 프레임 클램프, 병합, 면적 이득)
+ * - 영역 <-> 네트워크 입력 좌표 변환
+ * - pgie 설정 파싱 / nvdspreprocess 설정 생성 / 커스텀 라이브러리 확인
+ */
+
+#include "test_common.h"
+#include "inference_region.h"
+
+namespace {
+
+const int FRAME_W = 1920;
+const int FRAME_H = 1080;
+
+roi rectRoi(double x0, double y0, double x1, double y1) {
+    return {{x0, y0}, {x1, y0}, {x1, y1}, {x0, y1}};
+}
+
+bool overlaps(const RegionRect& a, const RegionRect& b) {
+    return a.left < b.right() && b.left < a.right() && a.top < b.bottom() && b.top < a.bottom();
+}
+
+const char* PGIE_CONFIG =
+    "[property]\n"
+    "gpu-id=0\n"
+    "# 주석 무시\n"
+    "net-scale-factor=0.0039215697906911373\n"
+    "offsets=0;0;0\n"
+    "model-color-format=1\n"
+    "infer-dims=3;544;960\n"
+    "uff-input-blob-name=input_1\n"
+    "uff-input-order=0\n"
+    "batch-size=2\n"
+    "\n"
+    "[class-attrs-all]\n"
+    "batch-size=99\n";
+
+}  // namespace
+
+TEST_CASE(region_single_polygon_margins_and_alignment) {
+    InferenceRegionParams params;     // margin 32, top_margin 160
+    auto rects = computeInferenceRegions(std::vector<roi>{rectRoi(101, 403, 505, 701)}, FRAME_W, FRAME_H, params);
+
+    CHECK_EQ(rects.size(), 1u);
+    const auto& r = rects[0];
+    CHECK_EQ(r.left, 68);             // 101 - 32 = 69 -> 4px 내림
+    CHECK_EQ(r.top, 208);             // 403 - 32 - 160 = 211 -> 4px 내림
+    CHECK_EQ(r.right(), 540);         // 505 + 32 = 537 -> 4px 올림
+    CHECK_EQ(r.bottom(), 736);        // 701 + 32 = 733 -> 4px 올림
+    CHECK_EQ(r.left % 4, 0);
+    CHECK_EQ(r.width % 4, 0);
+    CHECK_EQ(r.height % 4, 0);
+}
+
+TEST_CASE(region_clamped_to_frame) {
+    InferenceRegionParams params;
+    auto rects = computeInferenceRegions(std::vector<roi>{rectRoi(10, 100, 300, 1075)}, FRAME_W, FRAME_H, params);
+
+    CHECK_EQ(rects.size(), 1u);
+    CHECK_EQ(rects[0].left, 0);
+    CHECK_EQ(rects[0].top, 0);
+    CHECK_EQ(rects[0].bottom(), FRAME_H);
+}
+
+TEST_CASE(region_near_polygons_merged) {
+    InferenceRegionParams params;
+    params.max_rects = 4;
+    // 간격 40px (여유 32px 양쪽으로 이미 겹침)
+    auto rects = computeInferenceRegions(std::vector<roi>{rectRoi(200, 500, 400, 700), rectRoi(440, 500, 640, 700)},
+                                         FRAME_W, FRAME_H, params);
+    CHECK_EQ(rects.size(), 1u);
+}
+
+TEST_CASE(region_far_polygons_respect_max_rects) {
+    InferenceRegionParams params;
+    params.top_margin_px = 0;
+    std::vector<roi> polygons = {rectRoi(100, 600, 300, 800), rectRoi(1500, 600, 1700, 800)};
+
+    params.max_rects = 2;
+    auto two = computeInferenceRegions(polygons, FRAME_W, FRAME_H, params);
+    CHECK_EQ(two.size(), 2u);
+    CHECK(!overlaps(two[0], two[1]));
+
+    params.max_rects = 1;
+    auto one = computeInferenceRegions(polygons, FRAME_W, FRAME_H, params);
+    CHECK_EQ(one.size(), 1u);
+    CHECK(one[0].left <= 68 && one[0].right() >= 1732);
+}
+
+TEST_CASE(region_no_gain_keeps_full_frame) {
+    InferenceRegionParams params;
+    CHECK(computeInferenceRegions(std::vector<roi>{rectRoi(0, 0, 1900, 1060)}, FRAME_W, FRAME_H, params).empty());
+    CHECK(computeInferenceRegions(std::vector<roi>{}, FRAME_W, FRAME_H, params).empty());
+    CHECK(computeInferenceRegions(std::vector<roi>{rectRoi(100, 100, 200, 200)}, 0, 0, params).empty());
+}
+
+TEST_CASE(transform_letterbox_mapping) {
+    RegionRect region;
+    region.left = 320;
+    region.top = 400;
+    region.width = 1280;
+    region.height = 540;
+
+    RegionTransform t = computeRegionTransform(region, 960, 544);
+    CHECK_NEAR(t.scale, 0.75, 1e-9);          // min(960/1280, 544/540)
+    CHECK_NEAR(t.pad_x, 0.0, 1e-9);
+    CHECK_NEAR(t.pad_y, 69.5, 1e-9);          // (544 - 405) / 2
+
+    double nx, ny;
+    t.toNetwork(320, 400, nx, ny);
+    CHECK_NEAR(nx, 0.0, 1e-9);
+    CHECK_NEAR(ny, 69.5, 1e-9);
+    t.toNetwork(1600, 940, nx, ny);
+    CHECK_NEAR(nx, 960.0, 1e-9);
+    CHECK_NEAR(ny, 474.5, 1e-9);
+
+    // 네트워크 좌표 검출 -> 프레임 좌표 복원
+    double fx, fy;
+    t.toFrame(480.0, 272.0, fx, fy);
+    CHECK_NEAR(fx, 960.0, 1e-9);
+    CHECK_NEAR(fy, 670.0, 1e-9);
+
+    for (double x : {320.0, 777.0, 1599.0}) {
+        for (double y : {400.0, 512.5, 939.0}) {
+            t.toNetwork(x, y, nx, ny);
+            t.toFrame(nx, ny, fx, fy);
+            CHECK_NEAR(fx, x, 1e-9);
+            CHECK_NEAR(fy, y, 1e-9);
+        }
+    }
+}
+
+TEST_CASE(transform_invalid_region) {
+    RegionRect empty;
+    CHECK_EQ(computeRegionTransform(empty, 960, 544).scale, 0.0);
+}
+
+TEST_CASE(parse_pgie_config) {
+    NvInferModelParams model;
+    std::string error;
+    CHECK(parseNvInferConfig(PGIE_CONFIG, model, error));
+    CHECK_EQ(model.channels, 3);
+    CHECK_EQ(model.height, 544);
+    CHECK_EQ(model.width, 960);
+    CHECK_EQ(model.input_order, 0);
+    CHECK_EQ(model.color_format, 1);
+    CHECK_NEAR(model.net_scale_factor, 0.0039215697906911373, 1e-15);
+    CHECK_EQ(model.offsets, std::string("0;0;0"));
+    CHECK_EQ(model.tensor_name, std::string("input_1"));
+    CHECK_EQ(model.batch_size, 2);             // [class-attrs-all] 값은 무시
+}
+
+TEST_CASE(parse_pgie_config_legacy_dims_and_errors) {
+    NvInferModelParams model;
+    std::string error;
+    CHECK(parseNvInferConfig("[property]\nuff-input-dims=3;368;640;1\n", model, error));
+    CHECK_EQ(model.height, 368);
+    CHECK_EQ(model.width, 640);
+    CHECK_EQ(model.input_order, 1);
+    CHECK(model.tensor_name.empty());
+
+    CHECK(!parseNvInferConfig("[property]\nbatch-size=1\n", model, error));
+    CHECK(!error.empty());
+    CHECK(!parseNvInferConfig("[property]\ninfer-dims=3;abc;960\n", model, error));
+}
+
+TEST_CASE(preprocess_config_uses_model_params) {
+    PreprocessParams params;
+    std::string error;
+    CHECK(parseNvInferConfig(PGIE_CONFIG, params.model, error));
+    params.custom_lib_path = "/tmp/libcustom.so";
+
+    RegionRect a, b;
+    a.width = b.width = 640;
+    a.height = b.height = 480;
+    std::string text = buildPreprocessConfig({a, b}, 3, params);
+
+    CHECK(text.find("network-input-shape=6;3;544;960\n") != std::string::npos);
+    CHECK(text.find("processing-width=960\n") != std::string::npos);
+    CHECK(text.find("network-color-format=1\n") != std::string::npos);
+    CHECK(text.find("tensor-name=input_1\n") != std::string::npos);
+    CHECK(text.find("pixel-normalization-factor=0.003921569791\n") != std::string::npos);
+    CHECK(text.find("offsets=0;0;0\n") != std::string::npos);
+    CHECK(text.find("roi-params-src-2=") != std::string::npos);
+
+    params.model.input_order = 1;
+    text = buildPreprocessConfig({a}, 1, params);
+    CHECK(text.find("network-input-shape=1;544;960;3\n") != std::string::npos);
+}
+
+TEST_CASE(preprocess_library_check) {
+    std::string error;
+    CHECK(!checkPreprocessLibrary("", error));
+    CHECK(!checkPreprocessLibrary("/nonexistent/libcustom2d_preprocess.so", error));
+    CHECK(!error.empty());
+
+    // 로드는 되지만 필수 함수가 없는 라이브러리
+    error.clear();
+    CHECK(!checkPreprocessLibrary("libm.so.6", error));
+    CHECK(error.find("CustomTensorPreparation") != std::string::npos);
+}
@@ -0,0 +1,158 @@
+﻿/*
+ * test_lane_direction_field.cpp
+ *
+ * 도로 평면 방향 격자 / 역주행 판단 테스트
+ * - 격자 셀이 원근과 무관하게 미터 단위 정사각형인지
+ * - 속도/최소 이동/지속 시간 기준 (정지 차량 흔들림, 서행, 정방향은 미감지)
+ */
+
+#include "test_common.h"
+#include "lane_direction_field.h"
+
+namespace {
+
+const int FPS = 15;
+
+// 정지선이 x=0, 차로가 +x 방향으로 뻗은 2차로 (폭 3.5m, 길이 80m)
+std::vector<LaneDirectionField::GroundLane> twoLanes() {
+    std::vector<LaneDirectionField::GroundLane> lanes(2);
+    for (int i = 0; i < 2; i++) {
+        double y0 = 3.5 * i;
+        double y1 = 3.5 * (i + 1);
+        lanes[i].lane = i + 1;
+        lanes[i].polygon = {{0.0, y0}, {80.0, y0}, {80.0, y1}, {0.0, y1}};
+        lanes[i].anchor = {0.0, (y0 + y1) / 2.0};
+    }
+    return lanes;
+}
+
+ReverseParams defaultParams() {
+    return ReverseParams{};
+}
+
+/**
+ * @brief 등속 이동 시뮬레이션
+ * @return 처음 DETECTED가 나온 프레임 (없으면 -1)
+ */
+int simulate(const LaneDirectionField& field, ReverseTrack& track, double x0, double y,
+             double speed_kmh, int seconds, double jitter_m = 0.0) {
+    const ReverseParams params = defaultParams();
+    double step = speed_kmh / 3.6 / FPS;
+    for (int f = 0; f < seconds * FPS; f++) {
+        double jitter = (f % 2 == 0) ? jitter_m : -jitter_m;
+        double x = x0 + step * f + jitter;
+        int t = 1000 + f / FPS;
+        if (field.updateReverse(track, x, y, t, params) == LaneDirectionField::ReverseStep::DETECTED) {
+            return f;
+        }
+    }
+    return -1;
+}
+
+}  // namespace
+
+TEST_CASE(grid_cells_are_uniform_in_meters) {
+    LaneDirectionField field;
+    CHECK(field.buildGround(twoLanes(), 1.0));
+    CHECK_NEAR(field.getCellSize(), 1.0, 1e-9);
+
+    // 80m x 7m 범위, 1m 셀 - 가까운 곳과 먼 곳 모두 같은 크기
+    CHECK_EQ(field.getValidCellCount(), 80 * 7);
+
+    const auto* near_cell = field.lookupGround(2.5, 1.0);
+    const auto* far_cell = field.lookupGround(77.5, 6.0);
+    CHECK(near_cell != nullptr);
+    CHECK(far_cell != nullptr);
+    if (near_cell && far_cell) {
+        CHECK_EQ(near_cell->lane, 1);
+        CHECK_EQ(far_cell->lane, 2);
+    }
+
+    // 같은 셀 / 인접 셀 경계
+    CHECK(field.lookupGround(10.1, 1.0) == field.lookupGround(10.9, 1.0));
+    CHECK(field.lookupGround(10.9, 1.0) != field.lookupGround(11.1, 1.0));
+
+    // 범위 밖
+    CHECK(field.lookupGround(-0.5, 1.0) == nullptr);
+    CHECK(field.lookupGround(10.0, 8.0) == nullptr);
+}
+
+TEST_CASE(cell_direction_points_to_stop_line) {
+    LaneDirectionField field;
+    CHECK(field.buildGround(twoLanes(), 1.0));
+
+    const auto* cell = field.lookupGround(40.5, 1.5);
+    CHECK(cell != nullptr);
+    if (cell) {
+        CHECK(cell->ex < -0.99f);
+        CHECK(std::fabs(cell->ey) < 0.05f);
+    }
+}
+
+TEST_CASE(oversized_range_grows_cell_size) {
+    std::vector<LaneDirectionField::GroundLane> lanes(1);
+    lanes[0].lane = 1;
+    lanes[0].polygon = {{0.0, 0.0}, {5000.0, 0.0}, {5000.0, 5000.0}, {0.0, 5000.0}};
+    lanes[0].anchor = {0.0, 2500.0};
+
+    LaneDirectionField field;
+    CHECK(field.buildGround(lanes, 1.0));
+    CHECK(field.getCellSize() > 1.0);
+}
+
+TEST_CASE(reverse_vehicle_detected_after_distance_and_duration) {
+    LaneDirectionField field;
+    CHECK(field.buildGround(twoLanes(), 1.0));
+
+    // 정지선(x=0)에서 멀어지는 방향 20km/h - 8m는 약 1.5초에 넘지만 10초 지속 필요
+    ReverseTrack track;
+    int frame = simulate(field, track, 5.0, 1.75, 20.0, 15);
+    CHECK(frame >= 0);
+    double seconds = frame / static_cast<double>(FPS);
+    CHECK(seconds >= defaultParams().min_duration_sec);
+    CHECK(seconds < defaultParams().min_duration_sec + 2);
+}
+
+TEST_CASE(forward_vehicle_not_detected) {
+    LaneDirectionField field;
+    CHECK(field.buildGround(twoLanes(), 1.0));
+
+    ReverseTrack track;
+    CHECK_EQ(simulate(field, track, 75.0, 1.75, -20.0, 12), -1);
+    CHECK_NEAR(track.score_m, 0.0, 1e-9);
+}
+
+TEST_CASE(stopped_vehicle_jitter_not_detected) {
+    LaneDirectionField field;
+    CHECK(field.buildGround(twoLanes(), 1.0));
+
+    // 정지 차량의 박스 흔들림 (프레임마다 ±0.4m, min_step_m 초과)
+    ReverseTrack track;
+    CHECK_EQ(simulate(field, track, 30.0, 1.75, 0.0, 120, 0.4), -1);
+    CHECK(track.score_m < defaultParams().min_distance_m);
+}
+
+TEST_CASE(slow_creep_below_min_speed_not_detected) {
+    LaneDirectionField field;
+    CHECK(field.buildGround(twoLanes(), 1.0));
+
+    // 3km/h로 60초 후진 (50m) - 거리는 넘지만 최소 속도 미달
+    ReverseTrack track;
+    CHECK_EQ(simulate(field, track, 5.0, 1.75, 3.0, 60), -1);
+}
+
+TEST_CASE(leaving_lane_resets_score) {
+    LaneDirectionField field;
+    CHECK(field.buildGround(twoLanes(), 1.0));
+
+    ReverseTrack track;
+    CHECK_EQ(simulate(field, track, 5.0, 1.75, 20.0, 3), -1);
+    CHECK(track.score_m > 0.0);
+
+    // 차로 밖 (y=20m)으로 이동
+    const ReverseParams params = defaultParams();
+    auto step = field.updateReverse(track, track.ground_x + 1.0, 20.0, 1004, params);
+    CHECK(step == LaneDirectionField::ReverseStep::RESET);
+    CHECK_NEAR(track.score_m, 0.0, 1e-9);
+    CHECK_EQ(track.start_time, 0);
+}
@@ -0,0 +1,184 @@
+﻿/*
+ * test_publish_scheduler.cpp
+ *
+ * PublishScheduler 정책 테스트 (Redis 대신 기록용 전송 함수 사용)
+ * - 비병합 채널: 1초 안에 들어온 주기 패킷이 모두 순서대로 전송되는지
+ * - 병합 채널: 최대 전송률 / 변경 전송 / keepalive 동작
+ */
+
+#include "test_common.h"
+#include "publish_scheduler.h"
+#include "channel_types.h"
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct RecordingSink {
+    std::mutex mutex;
+    std::vector<std::pair<int, std::string>> sent;
+
+    PublishScheduler::SendFunction fn() {
+        return [this](int channel_type, const std::string& data) {
+            std::lock_guard<std::mutex> lock(mutex);
+            sent.emplace_back(channel_type, data);
+            return 0;
+        };
+    }
+
+    std::vector<std::string> values(int channel_type) {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<std::string> out;
+        for (const auto& [type, data] : sent) {
+            if (type == channel_type) out.push_back(data);
+        }
+        return out;
+    }
+};
+
+void sleepMs(int ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+PublishPolicy queuePolicy() {
+    PublishPolicy policy;
+    policy.on_change = false;
+    policy.coalesce = false;
+    policy.max_queued = 4;
+    return policy;
+}
+
+PublishPolicy presencePolicy(int max_rate, int keepalive_sec) {
+    PublishPolicy policy;
+    policy.on_change = true;
+    policy.keepalive_sec = keepalive_sec;
+    policy.max_rate_per_sec = max_rate;
+    return policy;
+}
+
+}  // namespace
+
+TEST_CASE(queue_channel_publishes_every_cycle_packet) {
+    RecordingSink sink;
+    PublishScheduler scheduler(sink.fn());
+    scheduler.registerChannel(CHANNEL_QUEUE, "queue", queuePolicy());
+    scheduler.start();
+
+    // 같은 초 안에 두 주기 패킷 + 동일 내용 패킷 (on_change 미적용이어야 함)
+    CHECK(scheduler.submit(CHANNEL_QUEUE, "cycle-1"));
+    CHECK(scheduler.submit(CHANNEL_QUEUE, "cycle-2"));
+    CHECK(scheduler.submit(CHANNEL_QUEUE, "cycle-2"));
+    sleepMs(100);
+    scheduler.stop();
+
+    auto values = sink.values(CHANNEL_QUEUE);
+    CHECK_EQ(values.size(), 3u);
+    if (values.size() == 3) {
+        CHECK_EQ(values[0], std::string("cycle-1"));
+        CHECK_EQ(values[1], std::string("cycle-2"));
+        CHECK_EQ(values[2], std::string("cycle-2"));
+    }
+}
+
+TEST_CASE(queue_channel_drops_oldest_when_full) {
+    RecordingSink sink;
+    auto record = sink.fn();
+
+    // 전송 함수를 막아 큐가 쌓이도록 함
+    std::mutex gate;
+    std::unique_lock<std::mutex> hold(gate);
+    PublishScheduler blocked([&](int type, const std::string& data) {
+        std::lock_guard<std::mutex> wait(gate);
+        return record(type, data);
+    });
+    blocked.registerChannel(CHANNEL_QUEUE, "queue", queuePolicy());
+    blocked.start();
+
+    CHECK(blocked.submit(CHANNEL_QUEUE, "p0"));
+    sleepMs(50);  // p0은 전송 함수에서 대기 중
+    for (int i = 1; i <= 6; i++) {
+        CHECK(blocked.submit(CHANNEL_QUEUE, "p" + std::to_string(i)));
+    }
+    hold.unlock();
+    sleepMs(100);
+    blocked.stop();
+
+    // max_queued=4 - p1, p2는 폐기되고 p3..p6만 남음
+    auto values = sink.values(CHANNEL_QUEUE);
+    std::vector<std::string> expected = {"p0", "p3", "p4", "p5", "p6"};
+    CHECK(values == expected);
+}
+
+TEST_CASE(presence_channel_rate_limit_keeps_latest) {
+    RecordingSink sink;
+    PublishScheduler scheduler(sink.fn());
+    scheduler.registerChannel(CHANNEL_VEHICLE_PRESENCE, "vehicle_presence", presencePolicy(2, 0));
+    scheduler.start();
+
+    CHECK(scheduler.submit(CHANNEL_VEHICLE_PRESENCE, "A"));
+    sleepMs(50);
+    CHECK(scheduler.submit(CHANNEL_VEHICLE_PRESENCE, "B"));
+    CHECK(scheduler.submit(CHANNEL_VEHICLE_PRESENCE, "C"));
+    sleepMs(100);
+
+    // 500ms 간격 미달 - A만 전송
+    CHECK_EQ(sink.values(CHANNEL_VEHICLE_PRESENCE).size(), 1u);
+
+    sleepMs(550);
+    scheduler.stop();
+
+    std::vector<std::string> expected = {"A", "C"};
+    CHECK(sink.values(CHANNEL_VEHICLE_PRESENCE) == expected);
+}
+
+TEST_CASE(presence_channel_suppresses_unchanged_value) {
+    RecordingSink sink;
+    PublishScheduler scheduler(sink.fn());
+    scheduler.registerChannel(CHANNEL_VEHICLE_PRESENCE, "vehicle_presence", presencePolicy(0, 0));
+    scheduler.start();
+
+    CHECK(scheduler.submit(CHANNEL_VEHICLE_PRESENCE, "on"));
+    sleepMs(50);
+    CHECK(scheduler.submit(CHANNEL_VEHICLE_PRESENCE, "on"));
+    sleepMs(50);
+    CHECK(scheduler.submit(CHANNEL_VEHICLE_PRESENCE, "off"));
+    sleepMs(50);
+    scheduler.stop();
+
+    std::vector<std::string> expected = {"on", "off"};
+    CHECK(sink.values(CHANNEL_VEHICLE_PRESENCE) == expected);
+}
+
+TEST_CASE(presence_channel_keepalive_resends_last_value) {
+    RecordingSink sink;
+    PublishScheduler scheduler(sink.fn());
+    scheduler.registerChannel(CHANNEL_PED_CROSSING, "ped_crossing", presencePolicy(0, 1));
+    scheduler.start();
+
+    CHECK(scheduler.submit(CHANNEL_PED_CROSSING, "1"));
+    sleepMs(1200);
+    scheduler.stop();
+
+    auto values = sink.values(CHANNEL_PED_CROSSING);
+    CHECK(values.size() >= 2);
+    for (const auto& v : values) {
+        CHECK_EQ(v, std::string("1"));
+    }
+}
+
+TEST_CASE(unregistered_channel_is_left_to_caller) {
+    RecordingSink sink;
+    PublishScheduler scheduler(sink.fn());
+    scheduler.registerChannel(CHANNEL_QUEUE, "queue", queuePolicy());
+
+    // 시작 전에는 모든 채널이 호출측 직접 전송
+    CHECK(!scheduler.submit(CHANNEL_QUEUE, "x"));
+
+    scheduler.start();
+    CHECK(!scheduler.submit(CHANNEL_VEHICLE_2K, "x"));
+    scheduler.stop();
+    CHECK(sink.values(CHANNEL_VEHICLE_2K).empty());
+}
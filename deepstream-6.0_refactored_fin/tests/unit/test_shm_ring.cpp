@@ -0,0 +1,253 @@
+﻿/*
+ * test_shm_ring.cpp
+ *
+ * 공유메모리 링 기록자(ShmPublisher) + 리더 규칙 테스트 (64KB 링)
+ * - 링을 여러 바퀴 돌아도 레코드가 끝에서 나뉘지 않고 payload/seq가 그대로 읽힘
+ * - 읽기 전에 덮어쓰이면 overrun 처리 후 seq 차이만큼 손실로 계산
+ * - 복사 중 덮어쓰인 레코드(찢어진 읽기)는 버림 - 복사 직후 기록자가 링을 한 바퀴 돌게 해서 재현
+ * - 기록/읽기 스레드 동시 실행 시 손상된 레코드를 받아들이지 않음
+ */
+
+#include "test_common.h"
+#include "shm_ring_reader.h"
+#include "shm_publisher.h"
+#include "channel_types.h"
+#include "config_manager.h"
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <sys/mman.h>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+
+const char* CHANNEL = "detection:vehicle:2k";
+const uint64_t CAPACITY = 64 * 1024;
+
+std::string ringPrefix() {
+    return "ds_test_" + std::to_string(getpid()) + "_";
+}
+
+std::string ringName() {
+    return shmRingName(ringPrefix(), CHANNEL);
+}
+
+// 테스트 종료 시 세그먼트 삭제
+struct RingCleanup {
+    ~RingCleanup() { shm_unlink(ringName().c_str()); }
+} ring_cleanup;
+
+/**
+ * @brief 64KB 링 1개(vehicle_2k)의 기록자 - 모든 테스트가 공유, seq는 0부터
+ */
+ShmPublisher& publisher() {
+    static ShmPublisher* instance = nullptr;
+    if (instance) return *instance;
+
+    std::string path = "/tmp/ds_test_shm_ring_" + std::to_string(getpid()) + ".json";
+    std::ofstream out(path);
+    out << "{ \"redis\": { \"channels\": { \"vehicle_2k\": \"" << CHANNEL << "\" },"
+        << "\"shm_ring\": { \"enabled\": true, \"capacity_kb\": 64,"
+        << "\"name_prefix\": \"" << ringPrefix() << "\","
+        << "\"channels\": [\"" << CHANNEL << "\"] } } }";
+    out.close();
+
+    ConfigManager::getInstance().initialize(path);
+    std::remove(path.c_str());
+
+    shm_unlink(ringName().c_str());
+    instance = new ShmPublisher();
+    CHECK(instance->initialize());
+    return *instance;
+}
+
+// 레코드 n의 payload: "n;" + n에서 정해지는 문자열 (길이 length) - 내용만으로 손상 여부 확인 가능
+std::string makePayload(uint64_t n, size_t length) {
+    std::string payload = std::to_string(n) + ";";
+    while (payload.size() < length) {
+        payload += static_cast<char>('a' + (n * 7 + payload.size()) % 26);
+    }
+    return payload;
+}
+
+// payload가 makePayload 형식과 일치하면 n 반환, 아니면 -1
+int64_t verifyPayload(const std::string& payload) {
+    size_t sep = payload.find(';');
+    if (sep == std::string::npos || sep == 0 || sep > 20) return -1;
+    uint64_t n = std::stoull(payload.substr(0, sep));
+    for (size_t i = sep + 1; i < payload.size(); i++) {
+        if (payload[i] != static_cast<char>('a' + (n * 7 + i) % 26)) return -1;
+    }
+    return static_cast<int64_t>(n);
+}
+
+// 24바이트 헤더와 합쳐 링 끝 잔여 공간이 여러 경우(0/8/16/24 이상)가 되도록 길이 변화
+size_t payloadLength(uint64_t n) {
+    return 40 + (n * 2654435761u) % 3000;
+}
+
+// 기록한 레코드 수 = 다음 seq (기록자는 이 테스트만 사용)
+uint64_t published_count = 0;
+
+/**
+ * @brief 다음 seq로 레코드 기록 (payload에 seq 포함)
+ */
+void publishNext() {
+    uint64_t n = published_count++;
+    CHECK_EQ(publisher().publish(CHANNEL_VEHICLE_2K, makePayload(n, payloadLength(n))), 0);
+}
+
+// 링 한 바퀴 이상 기록
+void publishLap() {
+    uint64_t bytes = 0;
+    while (bytes <= CAPACITY) {
+        bytes += shmRecordSize(payloadLength(published_count));
+        publishNext();
+    }
+}
+
+}  // namespace
+
+TEST_CASE(shm_ring_wraparound_keeps_records_intact) {
+    publisher();
+    ds_test::ShmRingReader reader;
+    CHECK(reader.open(ringName()));
+    uint64_t start_pos = reader.readPos();
+
+    // 링 용량의 1/4 이하씩 기록 후 모두 읽기를 20바퀴 이상 반복
+    ds_test::ShmRecord record;
+    while (reader.readPos() - start_pos < 20 * CAPACITY) {
+        uint64_t first = published_count;
+        for (int i = 0; i < 8; i++) publishNext();
+
+        for (uint64_t n = first; n < published_count; n++) {
+            if (!reader.next(record)) {
+                CHECK(false);
+                return;
+            }
+            CHECK_EQ(record.header.seq, n);
+            CHECK_EQ(record.header.channel, static_cast<uint32_t>(CHANNEL_VEHICLE_2K));
+            CHECK_EQ(record.payload.size(), payloadLength(n));
+            CHECK_EQ(verifyPayload(record.payload), static_cast<int64_t>(n));
+        }
+        CHECK(!reader.next(record));
+    }
+
+    CHECK_EQ(reader.lost, 0u);
+    CHECK_EQ(reader.overruns, 0u);
+    CHECK_EQ(reader.torn, 0u);
+}
+
+TEST_CASE(shm_ring_overrun_counts_lost_records) {
+    publisher();
+    ds_test::ShmRingReader reader;
+    CHECK(reader.open(ringName()));
+
+    ds_test::ShmRecord record;
+    publishNext();
+    CHECK(reader.next(record));
+
+    // 읽지 않는 동안 3바퀴 기록 - 전부 손실
+    uint64_t lost_first = published_count;
+    for (int lap = 0; lap < 3; lap++) publishLap();
+    uint64_t lost_count = published_count - lost_first;
+    CHECK(!reader.next(record));
+    CHECK_EQ(reader.overruns, 1u);
+
+    // 이후 기록은 정상 수신, 손실 수는 seq 차이
+    uint64_t resume = published_count;
+    for (int i = 0; i < 5; i++) publishNext();
+    for (uint64_t n = resume; n < published_count; n++) {
+        CHECK(reader.next(record));
+        CHECK_EQ(record.header.seq, n);
+        CHECK_EQ(verifyPayload(record.payload), static_cast<int64_t>(n));
+    }
+    CHECK_EQ(reader.lost, lost_count);
+    CHECK_EQ(reader.received, 6u);
+}
+
+TEST_CASE(shm_ring_torn_read_is_discarded) {
+    publisher();
+    ds_test::ShmRingReader reader;
+    CHECK(reader.open(ringName()));
+
+    ds_test::ShmRecord record;
+    publishNext();
+    CHECK(reader.next(record));
+
+    // 복사 직후 기록자가 링을 한 바퀴 넘게 기록 -> 복사한 레코드 자리가 덮어쓰임
+    uint64_t torn_seq = published_count;
+    publishNext();
+    bool lapped = false;
+    CHECK(!reader.next(record, [&lapped]() {
+        if (lapped) return;
+        lapped = true;
+        publishLap();
+    }));
+    CHECK(lapped);
+    CHECK_EQ(reader.torn, 1u);
+    CHECK_EQ(reader.received, 1u);
+
+    // 링 안쪽까지만 기록하면 복사한 레코드는 유효
+    uint64_t kept_seq = published_count;
+    publishNext();
+    bool wrote = false;
+    CHECK(reader.next(record, [&wrote]() {
+        if (wrote) return;
+        wrote = true;
+        for (int i = 0; i < 4; i++) publishNext();
+    }));
+    CHECK_EQ(record.header.seq, kept_seq);
+    CHECK_EQ(verifyPayload(record.payload), static_cast<int64_t>(kept_seq));
+    CHECK_EQ(reader.torn, 1u);
+
+    // 버린 레코드부터 한 바퀴 분량이 손실로 계산됨
+    CHECK_EQ(reader.lost, kept_seq - torn_seq);
+}
+
+TEST_CASE(shm_ring_concurrent_reader_never_accepts_corrupt_record) {
+    publisher();
+    ds_test::ShmRingReader reader;
+    CHECK(reader.open(ringName()));
+
+    const uint64_t total = 200000;
+    uint64_t first = published_count;
+    std::atomic<bool> writing{true};
+
+    std::thread writer([&writing, total]() {
+        for (uint64_t i = 0; i < total; i++) {
+            publishNext();
+            if (i % 64 == 0) std::this_thread::yield();
+        }
+        writing = false;
+    });
+
+    uint64_t corrupt = 0;
+    uint64_t first_seq = 0;
+    uint64_t last_seq = 0;
+    ds_test::ShmRecord record;
+    while (true) {
+        bool done = !writing.load();
+        while (reader.next(record)) {
+            int64_t n = verifyPayload(record.payload);
+            if (n < 0 || static_cast<uint64_t>(n) != record.header.seq ||
+                record.payload.size() != payloadLength(record.header.seq)) {
+                corrupt++;
+            }
+            if (reader.received == 1) first_seq = record.header.seq;
+            last_seq = record.header.seq;
+        }
+        if (done) break;
+        reader.wait(100);
+    }
+    writer.join();
+
+    CHECK_EQ(corrupt, 0u);
+    CHECK(reader.received > 0);
+    CHECK(first_seq >= first);
+    CHECK(last_seq < first + total);
+    // 처음~마지막 수신 사이의 레코드는 모두 수신 또는 손실 중 하나
+    CHECK_EQ(reader.received + reader.lost, last_seq - first_seq + 1);
+}
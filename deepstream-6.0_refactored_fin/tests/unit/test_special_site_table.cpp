@@ -0,0 +1,221 @@
+﻿/*
+ * test_special_site_table.cpp
+ *
+ * Special Site 규칙 테이블 테스트
+ * - 내장 straight_left/right 규칙과 config/special_sites.json이 변경 전 분기(하드코딩)와 같은 결과를 내는지
+ *   (정지선 전 방향 ROI x 정지선 ROI x 차로 x 신호) 전체 조합으로 비교
+ * - observed 조건(approach/stop_line) 컴파일/조회
+ */
+
+#include "test_common.h"
+#include "special_site_table.h"
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+const int NO_ROI = -1;
+const int IGNORE_FLAG = -999;
+
+struct Outcome {
+    bool sent = false;
+    int direction = -1;
+    int lane = 0;
+
+    bool operator==(const Outcome& other) const {
+        return sent == other.sent && (!sent || (direction == other.direction && lane == other.lane));
+    }
+};
+
+std::ostream& operator<<(std::ostream& os, const Outcome& o) {
+    if (!o.sent) return os << "skip";
+    return os << "dir=" << o.direction << " lane=" << o.lane;
+}
+
+// 변경 전 SpecialSiteAdapter::determineVehicleDirection (straight_left 분기)
+int legacyStraightLeftDirection(bool in_roi, int roi_direction, bool green) {
+    if (roi_direction == 41) return -1;
+    if (roi_direction < -1) return -1;
+    if (roi_direction >= 31 && roi_direction <= 32) return -1;
+    if (roi_direction == 11) return 11;
+    if (roi_direction == 21 || roi_direction == 22) return roi_direction;
+    if (!in_roi || roi_direction <= 0) return green ? 11 : 21;
+    return roi_direction;
+}
+
+// 변경 전 VehicleProcessor2K::checkROITransition Special Site 분기
+// approach: 정지선 전 프레임의 방향 ROI, stop_roi: 정지선 통과 프레임의 방향 ROI
+Outcome legacyFlow(bool straight_left, int approach, int stop_roi, int obj_lane, int stop_lane, bool green) {
+    int dir_out = 0;
+    for (int turn_type : {approach, stop_roi}) {
+        if (turn_type <= 0) continue;
+        if (straight_left && turn_type >= 31 && turn_type <= 32) {
+            dir_out = IGNORE_FLAG;
+        } else {
+            dir_out = turn_type;
+        }
+    }
+
+    Outcome outcome;
+    if (dir_out == IGNORE_FLAG) return outcome;
+
+    int lane = obj_lane;
+    if (!straight_left) {
+        lane = 1;
+    } else if (lane <= 0) {
+        if (stop_lane <= 0) return outcome;
+        lane = stop_lane;
+    }
+
+    int final_direction = dir_out;
+    if (final_direction <= 0) {
+        if (!straight_left) return outcome;
+        final_direction = legacyStraightLeftDirection(stop_roi != -1, stop_roi, green);
+    }
+    if (final_direction <= 0) return outcome;
+
+    outcome.sent = true;
+    outcome.direction = final_direction;
+    outcome.lane = lane;
+    return outcome;
+}
+
+// 현재 VehicleProcessor2K::checkROITransition Special Site 분기 (규칙 테이블 사용)
+Outcome tableFlow(const SpecialSiteTable& table, int approach, int stop_roi, int obj_lane, int stop_lane,
+                  bool green) {
+    int dir_out = 0;
+    for (int turn_type : {approach, stop_roi}) {
+        if (turn_type <= 0) continue;
+        SpecialSiteDecision decision = table.decide(turn_type, stop_lane, green, SpecialSiteStage::APPROACH);
+        dir_out = (decision.ignore && !decision.catch_all) ? IGNORE_FLAG : turn_type;
+    }
+
+    Outcome outcome;
+    if (dir_out == IGNORE_FLAG) return outcome;
+
+    int current_roi = dir_out > 0 ? dir_out : stop_roi;
+    int current_lane = obj_lane > 0 ? obj_lane : stop_lane;
+    SpecialSiteDecision decision = table.decideAtStopLine(dir_out, current_roi, current_lane, green);
+    if (decision.ignore || decision.direction <= 0 || decision.lane <= 0) return outcome;
+
+    outcome.sent = true;
+    outcome.direction = decision.direction;
+    outcome.lane = decision.lane;
+    return outcome;
+}
+
+// 두 흐름을 전체 조합으로 비교, 불일치 수 반환
+int compareWithLegacy(const SpecialSiteTable& table, bool straight_left) {
+    const std::vector<int> approaches = {NO_ROI, 11, 21, 22, 31, 32, 41, 5};
+    const std::vector<int> stop_rois = {NO_ROI, 0, 11, 21, 22, 31, 32, 41, -11, -21, -41};
+    int mismatches = 0;
+
+    for (int approach : approaches) {
+        for (int stop_roi : stop_rois) {
+            for (int obj_lane : {0, 2}) {
+                for (int stop_lane : {0, 3}) {
+                    for (bool green : {true, false}) {
+                        Outcome expected = legacyFlow(straight_left, approach, stop_roi, obj_lane, stop_lane, green);
+                        Outcome actual = tableFlow(table, approach, stop_roi, obj_lane, stop_lane, green);
+                        if (!(expected == actual)) {
+                            if (mismatches++ < 5) {
+                                std::ostringstream os;
+                                os << table.getSiteName() << " approach=" << approach << " stop=" << stop_roi
+                                   << " obj_lane=" << obj_lane << " stop_lane=" << stop_lane
+                                   << " green=" << green << ": 기존 " << expected << ", 규칙 " << actual;
+                                ds_test::reportFailure(__FILE__, __LINE__, os.str());
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return mismatches;
+}
+
+std::string sitesPath() {
+    return std::string(DS_SOURCE_ROOT) + "/config/special_sites.json";
+}
+
+}  // namespace
+
+TEST_CASE(straight_left_preset_matches_legacy_branch) {
+    auto table = SpecialSiteTable::preset(true);
+    CHECK(table != nullptr);
+    CHECK_EQ(compareWithLegacy(*table, true), 0);
+}
+
+TEST_CASE(right_preset_matches_legacy_branch) {
+    auto table = SpecialSiteTable::preset(false);
+    CHECK(table != nullptr);
+    CHECK_EQ(compareWithLegacy(*table, false), 0);
+}
+
+TEST_CASE(shipped_site_file_matches_legacy_branch) {
+    std::string error;
+    auto straight_left = SpecialSiteTable::load(sitesPath(), "straight_left", error);
+    CHECK(straight_left != nullptr);
+    auto right = SpecialSiteTable::load(sitesPath(), "right", error);
+    CHECK(right != nullptr);
+    if (!straight_left || !right) return;
+
+    CHECK_EQ(compareWithLegacy(*straight_left, true), 0);
+    CHECK_EQ(compareWithLegacy(*right, false), 0);
+}
+
+TEST_CASE(straight_left_sends_stored_uturn_and_drops_reverse) {
+    auto table = SpecialSiteTable::preset(true);
+
+    // 정지선 전 유턴 ROI 감지 -> 저장 후 그대로 전송
+    CHECK(!table->decide(41, 2, true, SpecialSiteStage::APPROACH).ignore);
+    SpecialSiteDecision stored = table->decideAtStopLine(41, 41, 2, true);
+    CHECK(!stored.ignore);
+    CHECK_EQ(stored.direction, 41);
+    CHECK_EQ(stored.lane, 2);
+
+    // 저장된 방향 없이 정지선에서 구한 유턴/역방향은 무시
+    CHECK(table->decideAtStopLine(0, 41, 2, true).ignore);
+    CHECK(table->decideAtStopLine(0, -21, 2, true).ignore);
+
+    // ROI 밖은 신호 기반
+    CHECK_EQ(table->decideAtStopLine(0, -1, 2, true).direction, 11);
+    CHECK_EQ(table->decideAtStopLine(0, -1, 2, false).direction, 21);
+}
+
+TEST_CASE(observed_condition_compiles_per_stage) {
+    Json::Value rules(Json::arrayValue);
+    Json::Value approach_only;
+    approach_only["roi"] = "uturn";
+    approach_only["observed"] = "approach";
+    approach_only["action"] = "set";
+    approach_only["direction"] = 21;
+    rules.append(approach_only);
+
+    std::string error;
+    auto table = SpecialSiteTable::compile("observed", rules, error);
+    CHECK(table != nullptr);
+    if (!table) return;
+
+    CHECK_EQ(table->decide(41, 1, true, SpecialSiteStage::APPROACH).direction, 21);
+    CHECK(!table->decide(41, 1, true, SpecialSiteStage::STOP_LINE).matched);
+
+    Json::Value bad(Json::arrayValue);
+    Json::Value rule;
+    rule["roi"] = "any";
+    rule["observed"] = "later";
+    bad.append(rule);
+    CHECK(SpecialSiteTable::compile("bad", bad, error) == nullptr);
+    CHECK(error.find("observed") != std::string::npos);
+}
+
+TEST_CASE(lane_override_takes_priority_at_stop_line) {
+    auto table = SpecialSiteTable::preset(false);
+
+    SpecialSiteDecision decision = table->decideAtStopLine(31, 31, 3, true);
+    CHECK_EQ(decision.direction, 31);
+    CHECK_EQ(decision.lane, 1);
+    CHECK(table->decideAtStopLine(0, -1, 3, true).direction <= 0);
+}
@@ -0,0 +1,137 @@
+﻿/*
+ * test_split_failure_cycle.cpp
+ *
+ * split failure 주기 관측 테스트
+ * - 적색 관측 구간은 녹색 종료 + 황색(yellow_sec) 이후부터 시작 (황색 중 점유는 ROR에서 제외)
+ * - 황색 중 녹색 재시작/황색 0초/관측 종료 시점
+ */
+
+#include "test_common.h"
+#include "split_failure_cycle.h"
+
+namespace {
+
+const uint32_t LANE1 = 1u << 1;
+const uint32_t LANE2 = 1u << 2;
+const int FRAMES_PER_SEC = 10;
+
+SplitFailureConfig testConfig(int yellow_sec) {
+    SplitFailureConfig config;
+    config.enabled = true;
+    config.gor_threshold = 0.8;
+    config.ror_threshold = 0.8;
+    config.red_window_sec = 5;
+    config.min_green_sec = 5;
+    config.yellow_sec = yellow_sec;
+    return config;
+}
+
+// [from, to) 초 동안 초당 FRAMES_PER_SEC 프레임 점유 누적
+void feed(SplitFailureCycle& cycle, int from, int to, uint32_t mask) {
+    for (int t = from; t < to; t++) {
+        for (int f = 0; f < FRAMES_PER_SEC; f++) {
+            cycle.addFrame(mask, t);
+        }
+    }
+}
+
+// 녹색 0~30초 두 차로 모두 점유, 녹색 종료 30초
+SplitFailureCycle saturatedGreen(int yellow_sec) {
+    SplitFailureCycle cycle;
+    cycle.configure(testConfig(yellow_sec), 2);
+    SplitFailureCycleResult unused;
+    CHECK(cycle.onSignalChange(true, 0, unused) == SplitFailureCycle::Outcome::NONE);
+    feed(cycle, 0, 30, LANE1 | LANE2);
+    CHECK(cycle.onSignalChange(false, 30, unused) == SplitFailureCycle::Outcome::NONE);
+    return cycle;
+}
+
+}  // namespace
+
+TEST_CASE(yellow_occupancy_is_not_red_occupancy) {
+    SplitFailureCycle cycle = saturatedGreen(3);
+
+    // 황색 30~33초: 차로 1은 정지선 구역을 빠져나가는 차량으로 점유, 차로 2는 비어 있음
+    feed(cycle, 30, 33, LANE1);
+    // 적색 33~38초: 차로 1은 33초만 점유, 차로 2는 잔여 대기열로 계속 점유
+    feed(cycle, 33, 34, LANE1 | LANE2);
+    feed(cycle, 34, 38, LANE2);
+
+    SplitFailureCycleResult result;
+    CHECK(cycle.onSecond(37, result) == SplitFailureCycle::Outcome::NONE);
+    CHECK(cycle.onSecond(38, result) == SplitFailureCycle::Outcome::EVALUATED);
+
+    CHECK_EQ(result.green_start, 0);
+    CHECK_EQ(result.green_end, 30);
+    CHECK_EQ(result.red_start, 33);
+    CHECK_EQ(result.green_sec, 30);
+    CHECK_EQ(result.lanes.size(), static_cast<size_t>(2));
+
+    // 차로 1: 황색 점유를 빼면 ROR 0.2 -> 실패 아님 (황색부터 세면 0.8로 실패 판정)
+    CHECK_NEAR(result.lanes[0].gor, 1.0, 1e-9);
+    CHECK_NEAR(result.lanes[0].ror, 0.2, 1e-9);
+    CHECK(!result.lanes[0].failed);
+
+    // 차로 2: 적색 초반 내내 점유 -> 실패
+    CHECK_NEAR(result.lanes[1].ror, 1.0, 1e-9);
+    CHECK(result.lanes[1].failed);
+    CHECK_EQ(result.failed_lanes, 1);
+
+    // 판정 후 다음 녹색까지 결과 없음
+    CHECK(cycle.onSecond(39, result) == SplitFailureCycle::Outcome::NONE);
+}
+
+TEST_CASE(zero_yellow_starts_red_at_green_end) {
+    SplitFailureCycle cycle = saturatedGreen(0);
+    feed(cycle, 30, 32, LANE1);
+    feed(cycle, 32, 35, 0);
+
+    SplitFailureCycleResult result;
+    CHECK(cycle.onSecond(35, result) == SplitFailureCycle::Outcome::EVALUATED);
+    CHECK_EQ(result.red_start, 30);
+    CHECK_NEAR(result.lanes[0].ror, 0.4, 1e-9);
+}
+
+TEST_CASE(green_during_yellow_skips_cycle) {
+    SplitFailureCycle cycle = saturatedGreen(3);
+    feed(cycle, 30, 32, LANE1 | LANE2);
+
+    // 황색 중 녹색 재시작 -> 적색 프레임 없음, 판정 생략
+    SplitFailureCycleResult result;
+    CHECK(cycle.onSignalChange(true, 32, result) == SplitFailureCycle::Outcome::SKIPPED);
+    CHECK_EQ(result.red_start, 33);
+
+    // 새 주기는 정상 판정
+    feed(cycle, 32, 62, LANE1);
+    CHECK(cycle.onSignalChange(false, 62, result) == SplitFailureCycle::Outcome::NONE);
+    feed(cycle, 62, 70, LANE1);
+    CHECK(cycle.onSecond(70, result) == SplitFailureCycle::Outcome::EVALUATED);
+    CHECK_EQ(result.green_start, 32);
+    CHECK_EQ(result.red_start, 65);
+    CHECK(result.lanes[0].failed);
+    CHECK(!result.lanes[1].failed);
+}
+
+TEST_CASE(short_red_is_judged_on_what_was_observed) {
+    SplitFailureCycle cycle = saturatedGreen(3);
+    feed(cycle, 30, 33, 0);
+    feed(cycle, 33, 35, LANE1);
+
+    // 적색 관측 5초 전 녹색 시작 -> 관측한 2초로 판정
+    SplitFailureCycleResult result;
+    CHECK(cycle.onSignalChange(true, 35, result) == SplitFailureCycle::Outcome::EVALUATED);
+    CHECK_NEAR(result.lanes[0].ror, 1.0, 1e-9);
+    CHECK(result.lanes[0].failed);
+}
+
+TEST_CASE(short_green_is_skipped) {
+    SplitFailureCycle cycle;
+    cycle.configure(testConfig(3), 1);
+    SplitFailureCycleResult result;
+    cycle.onSignalChange(true, 0, result);
+    feed(cycle, 0, 3, LANE1);
+    cycle.onSignalChange(false, 3, result);
+    feed(cycle, 3, 11, LANE1);
+    CHECK(cycle.onSecond(11, result) == SplitFailureCycle::Outcome::SKIPPED);
+    CHECK_EQ(result.green_sec, 3);
+}
@@ -0,0 +1,148 @@
+﻿/*
+ * test_sqlite_contention.cpp
+ *
+ * SQLite 쓰기 연결 / 읽기 풀 경합 테스트
+ * - 읽기 풀에서 통계 집계를 반복하는 동안 삽입 지연이 짧게 유지되는지
+ * - 스냅샷 임대는 진행 중 삽입과 무관하게 같은 시점을 읽는지
+ * - 읽기 풀 소진 시 대기 시간 초과로 빈 임대를 반환하고 삽입은 계속되는지
+ * - 읽기 스냅샷이 남아 있어도 PASSIVE 체크포인트가 막히지 않는지
+ */
+
+#include "test_common.h"
+#include "sqlite_fixture.h"
+#include "sqlite_handler.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const int PREFILL_ROWS = 200000;
+
+obj_data testVehicle(int id) {
+    obj_data obj;
+    obj.object_id = id;
+    obj.lane = 1 + id % 4;
+    obj.dir_out = 11;
+    obj.stop_pass_time = static_cast<int>(time(nullptr));
+    obj.stop_pass_speed = 40.0;
+    obj.first_detected_time = obj.stop_pass_time - 5;
+    return obj;
+}
+
+struct Fixture {
+    std::string db_file;
+    std::unique_ptr<SQLiteHandler> handler;
+
+    Fixture(const std::string& tag, int read_pool_size) {
+        db_file = ds_test::configureSQLite(tag, read_pool_size);
+        handler = std::make_unique<SQLiteHandler>();
+        ds_test::fillVehicleRecords(db_file, PREFILL_ROWS);
+    }
+
+    ~Fixture() {
+        handler.reset();
+        ds_test::removeSQLiteDir(db_file);
+    }
+};
+
+}  // namespace
+
+TEST_CASE(readers_do_not_block_inserts) {
+    Fixture fx("contention", 2);
+    CHECK(fx.handler->isHealthy());
+
+    std::atomic<bool> running{true};
+    std::atomic<int> queries{0};
+    std::atomic<int> query_errors{0};
+    std::atomic<long long> query_total_us{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 2; r++) {
+        readers.emplace_back([&]() {
+            while (running.load()) {
+                SQLiteReadLease lease = fx.handler->acquireReader(1000);
+                auto start = std::chrono::steady_clock::now();
+                if (!lease || !lease.isPooled() || ds_test::runStatsQuery(lease.get()) < 0) {
+                    query_errors++;
+                    continue;
+                }
+                query_total_us += std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+                queries++;
+            }
+        });
+    }
+
+    // 20ms마다 삽입 3초
+    std::vector<double> latencies_ms;
+    int failures = 0;
+    for (int i = 0; i < 150; i++) {
+        auto start = std::chrono::steady_clock::now();
+        if (fx.handler->insertVehicleData(1000000 + i, testVehicle(i), "PCAR") != 0) failures++;
+        latencies_ms.push_back(std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count());
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+
+    running = false;
+    for (auto& t : readers) t.join();
+
+    std::sort(latencies_ms.begin(), latencies_ms.end());
+    double max_ms = latencies_ms.back();
+    double query_avg_ms = queries.load() > 0 ? query_total_us.load() / 1000.0 / queries.load() : 0.0;
+    std::printf("    삽입 %zu건, 최대 %.2fms / 동시 집계 %d회, 평균 %.1fms\n",
+                latencies_ms.size(), max_ms, queries.load(), query_avg_ms);
+
+    CHECK_EQ(failures, 0);
+    CHECK_EQ(query_errors.load(), 0);
+    CHECK(queries.load() > 0);
+    // 연결을 공유하면 삽입이 집계 1회(전체 스캔) 동안 대기 - 분리 구조에서는 그보다 훨씬 짧아야 함
+    CHECK(max_ms < query_avg_ms / 4);
+}
+
+TEST_CASE(snapshot_reads_single_point_in_time) {
+    Fixture fx("snapshot", 2);
+
+    SQLiteReadLease lease = fx.handler->acquireReader();
+    CHECK(lease && lease.isPooled());
+    CHECK(lease.beginSnapshot());
+    long long before = ds_test::countRecords(lease.get());
+    CHECK_EQ(before, static_cast<long long>(PREFILL_ROWS));
+
+    for (int i = 0; i < 10; i++) {
+        CHECK_EQ(fx.handler->insertVehicleData(2000000 + i, testVehicle(i), "PCAR"), 0);
+    }
+    CHECK_EQ(ds_test::countRecords(lease.get()), before);
+
+    // 스냅샷 중에도 체크포인트는 대기 없이 반환 (남은 프레임은 다음 주기)
+    auto start = std::chrono::steady_clock::now();
+    CHECK_EQ(fx.handler->checkpointPassive(), 0);
+    CHECK(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(500));
+
+    lease.release();
+    SQLiteReadLease fresh = fx.handler->acquireReader();
+    CHECK(fresh);
+    CHECK_EQ(ds_test::countRecords(fresh.get()), before + 10);
+}
+
+TEST_CASE(exhausted_pool_times_out_and_inserts_continue) {
+    Fixture fx("exhausted", 2);
+
+    SQLiteReadLease a = fx.handler->acquireReader();
+    SQLiteReadLease b = fx.handler->acquireReader();
+    CHECK(a && b);
+
+    auto start = std::chrono::steady_clock::now();
+    SQLiteReadLease c = fx.handler->acquireReader(100);
+    auto waited = std::chrono::steady_clock::now() - start;
+    CHECK(!c);
+    CHECK(waited >= std::chrono::milliseconds(90));
+    CHECK(waited < std::chrono::milliseconds(1000));
+
+    CHECK_EQ(fx.handler->insertVehicleData(3000000, testVehicle(1), "PCAR"), 0);
+
+    a.release();
+    SQLiteReadLease d = fx.handler->acquireReader(100);
+    CHECK(d && d.isPooled());
+}
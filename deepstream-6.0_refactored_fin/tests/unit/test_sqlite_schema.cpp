@@ -0,0 +1,169 @@
+﻿/*
+ * test_sqlite_schema.cpp
+ *
+ * SQLite 스키마 마이그레이션 테스트
+ * - DeepStream v1 main_table -> vehicle_record 이전 (차종 코드 변환, 미등록 코드 등록)
+ * - dataHandler MainTable 형태(img_path_nm, 다른 컬럼 순서) 이전 시 이미지 경로 보존
+ * - 이전 후 호환 뷰 삽입(INSTEAD OF 트리거), 재실행, 상위 버전 거부
+ */
+
+#include "test_common.h"
+#include "sqlite_schema.h"
+#include "logger.hpp"
+#include <string>
+
+namespace {
+
+const char* DEEPSTREAM_V1_SQL = R"SQL(
+    CREATE TABLE main_table(
+        row_id INTEGER PRIMARY KEY AUTOINCREMENT,
+        kncr_cd TEXT,
+        lane_no INTEGER,
+        turn_type_cd INTEGER,
+        turn_dttn_unix_tm INTEGER,
+        turn_dttn_sped REAL,
+        stln_pasg_unix_tm INTEGER,
+        stln_dttn_sped REAL,
+        vhcl_sect_sped REAL,
+        frst_obsrvn_unix_tm INTEGER,
+        vhcl_obsrvn_hr INTEGER,
+        vhcl_dttn_2k_id INTEGER,
+        timestamp INTEGER DEFAULT (strftime('%s', 'now'))
+    );
+    CREATE INDEX idx_timestamp ON main_table(timestamp);
+    CREATE INDEX idx_kncr_cd ON main_table(kncr_cd);
+    CREATE TRIGGER cleanup_main_table AFTER INSERT ON main_table
+    BEGIN
+        DELETE FROM main_table WHERE timestamp < (strftime('%s','now') - 86400);
+    END;
+    INSERT INTO main_table(kncr_cd, lane_no, turn_type_cd, stln_pasg_unix_tm, stln_dttn_sped, vhcl_dttn_2k_id)
+        VALUES ('PCAR', 1, 11, 1000, 40.5, 7),
+               ('LTRUCK', 2, 21, 1001, 30.0, 8),
+               ('OLDCODE', 3, 31, 1002, 20.0, 9);
+)SQL";
+
+// dataHandler sqlite_table.MainTable.create()와 같은 컬럼 순서
+const char* DATAHANDLER_V1_SQL = R"SQL(
+    CREATE TABLE "main_table" (
+        row_id INTEGER PRIMARY KEY AUTOINCREMENT,
+        "vhcl_dttn_2k_id"     INTEGER,
+        "turn_dttn_unix_tm"   INTEGER,
+        "stln_pasg_unix_tm"   INTEGER,
+        "frst_obsrvn_unix_tm" INTEGER,
+        "kncr_cd"             TEXT,
+        "lane_no"             INTEGER,
+        "turn_type_cd"        INTEGER,
+        "turn_dttn_sped"      REAL,
+        "stln_dttn_sped"      REAL,
+        "vhcl_sect_sped"      REAL,
+        "vhcl_obsrvn_hr"      INTEGER,
+        "img_path_nm"         TEXT,
+        timestamp INTEGER DEFAULT (strftime('%s', 'now'))
+    );
+    CREATE INDEX idx_label ON "main_table"("kncr_cd");
+    INSERT INTO main_table(vhcl_dttn_2k_id, stln_pasg_unix_tm, kncr_cd, lane_no, turn_type_cd, img_path_nm)
+        VALUES (21, 2000, 'MBUS', 1, 11, '/data/images/2k/21.jpg'),
+               (22, 2001, 'PCAR', 2, 21, NULL);
+)SQL";
+
+struct Db {
+    sqlite3* db = nullptr;
+
+    Db() { sqlite3_open(":memory:", &db); }
+    ~Db() { sqlite3_close(db); }
+
+    bool exec(const std::string& sql) {
+        return sqlite3_exec(db, sql.c_str(), nullptr, nullptr, nullptr) == SQLITE_OK;
+    }
+
+    std::string text(const std::string& sql) {
+        sqlite3_stmt* stmt = nullptr;
+        std::string value = "<none>";
+        if (sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) return "<error>";
+        if (sqlite3_step(stmt) == SQLITE_ROW) {
+            const unsigned char* v = sqlite3_column_text(stmt, 0);
+            value = v ? reinterpret_cast<const char*>(v) : "<null>";
+        }
+        sqlite3_finalize(stmt);
+        return value;
+    }
+
+    long long number(const std::string& sql) {
+        std::string v = text(sql);
+        try {
+            return std::stoll(v);
+        } catch (...) {
+            return -1;
+        }
+    }
+};
+
+SQLiteSchema schema() {
+    return SQLiteSchema(getLogger("DS_SQLite_test_log"));
+}
+
+}  // namespace
+
+TEST_CASE(migrate_deepstream_v1_table) {
+    Db db;
+    CHECK(db.exec(DEEPSTREAM_V1_SQL));
+    SQLiteSchema s = schema();
+    CHECK(s.migrate(db.db));
+
+    CHECK_EQ(SQLiteSchema::getVersion(db.db), SQLITE_SCHEMA_VERSION);
+    CHECK_EQ(db.text("SELECT type FROM sqlite_master WHERE name = 'main_table'"), std::string("view"));
+    CHECK_EQ(db.number("SELECT COUNT(*) FROM vehicle_record"), 3LL);
+    CHECK_EQ(db.number("SELECT kncr_id FROM vehicle_record WHERE vhcl_dttn_2k_id = 7"), 3LL);    // PCAR
+    CHECK_EQ(db.number("SELECT kncr_id FROM vehicle_record WHERE vhcl_dttn_2k_id = 8"), 6LL);    // LTRUCK
+    CHECK(db.number("SELECT kncr_id FROM vehicle_record WHERE vhcl_dttn_2k_id = 9") > 6);        // 신규 등록
+    CHECK_EQ(db.text("SELECT kncr_cd FROM main_table WHERE vhcl_dttn_2k_id = 9"), std::string("OLDCODE"));
+    CHECK_EQ(db.text("SELECT stln_dttn_sped FROM main_table WHERE vhcl_dttn_2k_id = 7"), std::string("40.5"));
+    CHECK_EQ(db.text("SELECT img_path_nm FROM main_table WHERE vhcl_dttn_2k_id = 7"), std::string("<null>"));
+    CHECK_EQ(db.number("SELECT COUNT(*) FROM sqlite_master WHERE name IN ('idx_timestamp', 'idx_kncr_cd', "
+                       "'cleanup_main_table')"), 0LL);
+}
+
+TEST_CASE(migrate_datahandler_table_keeps_image_path) {
+    Db db;
+    CHECK(db.exec(DATAHANDLER_V1_SQL));
+    SQLiteSchema s = schema();
+    CHECK(s.migrate(db.db));
+
+    CHECK_EQ(db.number("SELECT COUNT(*) FROM vehicle_record"), 2LL);
+    CHECK_EQ(db.text("SELECT img_path_nm FROM vehicle_record WHERE vhcl_dttn_2k_id = 21"),
+             std::string("/data/images/2k/21.jpg"));
+    CHECK_EQ(db.text("SELECT img_path_nm FROM main_table WHERE vhcl_dttn_2k_id = 21"),
+             std::string("/data/images/2k/21.jpg"));
+    CHECK_EQ(db.text("SELECT img_path_nm FROM main_table WHERE vhcl_dttn_2k_id = 22"), std::string("<null>"));
+    CHECK_EQ(db.number("SELECT kncr_id FROM vehicle_record WHERE vhcl_dttn_2k_id = 21"), 1LL);     // MBUS
+    CHECK_EQ(db.number("SELECT stln_pasg_unix_tm FROM vehicle_record WHERE vhcl_dttn_2k_id = 22"), 2001LL);
+}
+
+TEST_CASE(view_insert_after_migration) {
+    Db db;
+    CHECK(db.exec(DATAHANDLER_V1_SQL));
+    SQLiteSchema s = schema();
+    CHECK(s.migrate(db.db));
+
+    CHECK(db.exec("INSERT INTO main_table(vhcl_dttn_2k_id, kncr_cd, lane_no, turn_type_cd, img_path_nm) "
+                  "VALUES (30, 'NEWCODE', 1, 11, '/img/30.jpg')"));
+    CHECK_EQ(db.text("SELECT img_path_nm FROM vehicle_record WHERE vhcl_dttn_2k_id = 30"), std::string("/img/30.jpg"));
+    CHECK_EQ(db.text("SELECT kncr_cd FROM main_table WHERE vhcl_dttn_2k_id = 30"), std::string("NEWCODE"));
+}
+
+TEST_CASE(migrate_is_idempotent_and_refuses_newer) {
+    Db db;
+    CHECK(db.exec(DEEPSTREAM_V1_SQL));
+    SQLiteSchema s = schema();
+    CHECK(s.migrate(db.db));
+    CHECK(s.migrate(db.db));
+    CHECK_EQ(db.number("SELECT COUNT(*) FROM vehicle_record"), 3LL);
+
+    Db fresh;
+    CHECK(s.migrate(fresh.db));
+    CHECK_EQ(SQLiteSchema::getVersion(fresh.db), SQLITE_SCHEMA_VERSION);
+    CHECK_EQ(fresh.number("SELECT COUNT(*) FROM vehicle_class"), 6LL + 1LL);      // 1~6 + UNKNOWN(0)
+
+    CHECK(fresh.exec("PRAGMA user_version = " + std::to_string(SQLITE_SCHEMA_VERSION + 1)));
+    CHECK(!s.migrate(fresh.db));
+}
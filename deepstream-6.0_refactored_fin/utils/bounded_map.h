@@ -0,0 +1,200 @@
+﻿#ifndef BOUNDED_MAP_H
+#define BOUNDED_MAP_H
+
+#include <functional>
+#include <list>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include "memory_budget.h"
+
+/**
+ * @brief 용량 제한 추적 상태 맵
+ *
+ * std::map 인터페이스(operator[], find, erase, 범위 for)를 유지하면서
+ * 용량 초과 삽입 시 가장 오래 접근하지 않은(LRU) 또는 가장 먼저 삽입된(OLDEST) 항목을 축출
+ * - 용량 무제한(0, 예산 비활성)이면 순서를 관리하지 않음 (std::map과 동일한 비용)
+ * - operator[]로 접근한 항목만 최근 사용으로 갱신하며 프레임당 1회만 갱신
+ *   (MemoryBudget::advanceFrame 기준, find/범위 for는 순서 유지)
+ * - 축출 콜백으로 종료 처리 가능 (예: 진행 중 이벤트 종료 메시지)
+ * - MemoryBudget 사용량에 연결하면 항목 수/축출 횟수 집계
+ * - 스레드 안전하지 않음 (std::map과 동일하게 소유 모듈의 락으로 보호)
+ */
+template <typename K, typename V>
+class BoundedMap {
+public:
+    enum class Eviction {
+        LRU,        // 가장 오래 접근하지 않은 항목
+        OLDEST      // 가장 먼저 삽입된 항목
+    };
+
+    using map_type = std::map<K, V>;
+    using iterator = typename map_type::iterator;
+    using const_iterator = typename map_type::const_iterator;
+    using EvictCallback = std::function<void(const K&, V&)>;
+
+    // 항목당 추정 크기 (맵 노드 + 순서 리스트 노드 + 위치 해시 노드)
+    static constexpr size_t ENTRY_BYTES = sizeof(std::pair<const K, V>) + 32 +
+                                          sizeof(K) + 16 + sizeof(K) + 32;
+
+private:
+    struct OrderNode {
+        K key;
+        uint64_t touched_frame;     // 마지막 갱신 프레임
+    };
+    using order_list = std::list<OrderNode>;
+
+    map_type items_;
+    order_list order_;      // front: 최근 사용 (OLDEST: 최근 삽입), 용량 제한 시에만 관리
+    std::unordered_map<K, typename order_list::iterator> positions_;
+
+    size_t capacity_ = 0;   // 0: 무제한
+    Eviction policy_ = Eviction::LRU;
+    EvictCallback on_evict_;
+    MemoryBudget::Usage* usage_ = nullptr;
+    uint64_t evictions_ = 0;
+
+    bool tracking() const { return capacity_ > 0; }
+
+    void track(const K& key) {
+        order_.push_front(OrderNode{key, MemoryBudget::currentFrame()});
+        positions_[key] = order_.begin();
+    }
+
+    void touch(const K& key) {
+        auto pos = positions_.find(key);
+        if (pos == positions_.end()) return;
+
+        uint64_t frame = MemoryBudget::currentFrame();
+        if (pos->second->touched_frame == frame) return;
+        pos->second->touched_frame = frame;
+        order_.splice(order_.begin(), order_, pos->second);
+    }
+
+    void updateUsage() {
+        if (!usage_) return;
+        size_t entries = items_.size();
+        usage_->entries = entries;
+        if (entries > usage_->peak_entries.load()) {
+            usage_->peak_entries = entries;
+        }
+    }
+
+    void evictOne() {
+        if (order_.empty()) return;
+
+        K key = order_.back().key;
+        order_.pop_back();
+        positions_.erase(key);
+
+        auto it = items_.find(key);
+        if (it != items_.end()) {
+            if (on_evict_) on_evict_(it->first, it->second);
+            items_.erase(it);
+        }
+
+        evictions_++;
+        if (usage_) usage_->evictions++;
+    }
+
+public:
+    BoundedMap() = default;
+    explicit BoundedMap(size_t capacity, Eviction policy = Eviction::LRU)
+        : capacity_(capacity), policy_(policy) {}
+
+    BoundedMap(const BoundedMap&) = delete;
+    BoundedMap& operator=(const BoundedMap&) = delete;
+
+    /**
+     * @brief 메모리 예산 모듈 연결 - 모듈에 배정된 용량 적용
+     * @param name 모듈 이름 (config.json memory_budget 키)
+     * @param default_capacity 설정이 없을 때 최대 항목 수
+     * @param policy 축출 정책
+     */
+    void attachBudget(const std::string& name, size_t default_capacity, Eviction policy = Eviction::LRU) {
+        usage_ = MemoryBudget::getInstance().registerModule(name, default_capacity, ENTRY_BYTES);
+        policy_ = policy;
+        capacity_ = usage_->capacity;
+
+        // 예산 연결 전 삽입된 항목은 키 순서로 순서 목록에 등록
+        order_.clear();
+        positions_.clear();
+        if (tracking()) {
+            for (const auto& item : items_) {
+                track(item.first);
+            }
+        }
+        while (tracking() && items_.size() > capacity_) {
+            evictOne();
+        }
+        updateUsage();
+    }
+
+    void setEvictCallback(EvictCallback callback) { on_evict_ = std::move(callback); }
+
+    /**
+     * @brief 항목 접근 (없으면 삽입, 용량 초과 시 축출 후 삽입)
+     */
+    V& operator[](const K& key) {
+        auto it = items_.find(key);
+        if (it != items_.end()) {
+            if (tracking() && policy_ == Eviction::LRU) {
+                touch(key);
+            }
+            return it->second;
+        }
+
+        if (tracking()) {
+            while (items_.size() >= capacity_) {
+                evictOne();
+            }
+            track(key);
+        }
+        V& value = items_[key];
+        updateUsage();
+        return value;
+    }
+
+    iterator find(const K& key) { return items_.find(key); }
+    const_iterator find(const K& key) const { return items_.find(key); }
+    size_t count(const K& key) const { return items_.count(key); }
+
+    iterator erase(iterator it) {
+        if (tracking()) {
+            auto pos = positions_.find(it->first);
+            if (pos != positions_.end()) {
+                order_.erase(pos->second);
+                positions_.erase(pos);
+            }
+        }
+        iterator next = items_.erase(it);
+        updateUsage();
+        return next;
+    }
+
+    size_t erase(const K& key) {
+        auto it = items_.find(key);
+        if (it == items_.end()) return 0;
+        erase(it);
+        return 1;
+    }
+
+    void clear() {
+        items_.clear();
+        order_.clear();
+        positions_.clear();
+        updateUsage();
+    }
+
+    iterator begin() { return items_.begin(); }
+    iterator end() { return items_.end(); }
+    const_iterator begin() const { return items_.begin(); }
+    const_iterator end() const { return items_.end(); }
+
+    size_t size() const { return items_.size(); }
+    bool empty() const { return items_.empty(); }
+    size_t capacity() const { return capacity_; }
+    uint64_t evictions() const { return evictions_; }
+};
+
+#endif // BOUNDED_MAP_H
@@ -74,6 +74,10 @@ void ConfigManager::logAllSettings() const {
         logger->debug("    * absence_frames: {}", cached_flags.vehicle_presence_absence_frames);
         logger->debug("    * anti_flicker: {}", cached_flags.vehicle_presence_anti_flicker);
     }
+    logger->info("  - vehicle.size_check.enabled: {}", cached_flags.vehicle_size_check_enabled);
+    if (cached_flags.vehicle_size_check_enabled) {
+        logger->debug("    * mode: {}", getString("processing_modules.vehicle.size_check.mode", "validate"));
+    }
     
     // Processing Modules - Pedestrian
     logger->info("[Pedestrian 처리 모듈]");
@@ -84,12 +88,46 @@ void ConfigManager::logAllSettings() const {
         logger->debug("    * absence_frames: {}", cached_flags.pedestrian_presence_absence_frames);
         logger->debug("    * anti_flicker: {}", cached_flags.pedestrian_presence_anti_flicker);
     }
+    logger->info("  - pedestrian.waiting.enabled: {}", cached_flags.pedestrian_waiting_enabled);
+    if (cached_flags.pedestrian_waiting_enabled) {
+        logger->debug("    * walk_start_on: {}, min_wait_sec: {}",
+                     getString("processing_modules.pedestrian.waiting.walk_start_on", "green_off"),
+                     getInt("processing_modules.pedestrian.waiting.min_wait_sec", 2));
+    }
     
     // Processing Modules - Analytics
     logger->info("[Analytics 모듈]");
     logger->info("  - statistics: {}", cached_flags.statistics_enabled);
     logger->info("  - stats_interval_minutes: {}", cached_flags.stats_interval_minutes);
     logger->info("  - wait_queue: {}", cached_flags.wait_queue_enabled);
+    logger->info("  - los: {}", cached_flags.los_enabled);
+    logger->info("  - intersection: {}", cached_flags.intersection_enabled);
+    if (cached_flags.intersection_enabled) {
+        logger->info("    * role: {}, approach_no: {}/{}",
+                    getString("processing_modules.vehicle_analytics.intersection.role", "member"),
+                    getInt("processing_modules.vehicle_analytics.intersection.approach_no", 1),
+                    getInt("processing_modules.vehicle_analytics.intersection.approach_count", 4));
+    }
+    logger->info("  - lane_change: {}", cached_flags.lane_change_enabled);
+    if (cached_flags.lane_change_enabled) {
+        logger->debug("    * persist_frames: {}",
+                     getInt("processing_modules.vehicle_analytics.lane_change.persist_frames", 8));
+    }
+    logger->info("  - arrival: {}", cached_flags.arrival_enabled);
+    if (cached_flags.arrival_enabled) {
+        logger->debug("    * yellow_sec: {}", getInt("processing_modules.vehicle_analytics.arrival.yellow_sec", 3));
+    }
+    logger->info("  - split_failure: {}", cached_flags.split_failure_enabled);
+    if (cached_flags.split_failure_enabled) {
+        logger->debug("    * gor/ror_threshold: {}/{}",
+                     getDouble("processing_modules.vehicle_analytics.split_failure.gor_threshold", 0.8),
+                     getDouble("processing_modules.vehicle_analytics.split_failure.ror_threshold", 0.8));
+    }
+    logger->info("  - delay: {}", cached_flags.delay_enabled);
+    if (cached_flags.delay_enabled) {
+        logger->debug("    * free_flow_speed_kmh: {}",
+                     getDouble("processing_modules.vehicle_analytics.delay.free_flow_speed_kmh", 50.0));
+    }
     if (cached_flags.statistics_enabled) {
         logger->info("    * 다음 정각 기준으로 {}분 간격 통계 생성", cached_flags.stats_interval_minutes);
     }
@@ -100,6 +138,93 @@ void ConfigManager::logAllSettings() const {
     logger->info("  - abnormal_stop_sequence: {}", cached_flags.abnormal_stop_enabled);
     logger->info("  - pedestrian_jaywalk: {}", cached_flags.pedestrian_jaywalk_enabled);
     logger->info("  - incident_event_enabled (종합): {}", cached_flags.incident_event_enabled);
+    logger->info("  - pet: {}", cached_flags.pet_enabled);
+    if (cached_flags.pet_enabled) {
+        logger->debug("    * cell_size_m: {}, threshold_sec: {}, turning_only: {}",
+                     getDouble("processing_modules.incident_event.pet.cell_size_m", 1.0),
+                     getDouble("processing_modules.incident_event.pet.threshold_sec", 1.5),
+                     getBool("processing_modules.incident_event.pet.turning_only", true));
+    }
+    
+    // Processing Modules - Inference Control
+    logger->info("[추론 간격 제어]");
+    logger->info("  - inference_control.enabled: {}", cached_flags.inference_control_enabled);
+    if (cached_flags.inference_control_enabled) {
+        logger->debug("    * interval ACTIVE/STATIC/EMPTY: {}/{}/{}",
+                     getInt("processing_modules.inference_control.active_interval", 0),
+                     getInt("processing_modules.inference_control.static_interval", 2),
+                     getInt("processing_modules.inference_control.empty_interval", 4));
+        logger->debug("    * max_detection_latency_ms: {}",
+                     getInt("processing_modules.inference_control.max_detection_latency_ms", 400));
+        logger->debug("    * relax_hold_sec: {}",
+                     getInt("processing_modules.inference_control.relax_hold_sec", 5));
+    }
+    logger->info("  - inference_region.enabled: {}", cached_flags.inference_region_enabled);
+    if (cached_flags.inference_region_enabled) {
+        logger->debug("    * margin_px: {}, top_margin_px: {}, max_rects: {}",
+                     getInt("processing_modules.inference_region.margin_px", 32),
+                     getInt("processing_modules.inference_region.top_margin_px", 160),
+                     getInt("processing_modules.inference_region.max_rects", 1));
+        logger->debug("    * preprocess config_file: {}",
+                     getString("processing_modules.inference_region.preprocess.config_file"));
+    }
+    
+    // Processing Modules - Frame Gap
+    logger->info("[프레임 누락 감지]");
+    logger->info("  - frame_gap.enabled: {}", cached_flags.frame_gap_enabled);
+    if (cached_flags.frame_gap_enabled) {
+        logger->debug("    * gap_factor: {}, publish_interval_sec: {}, max_sources: {}",
+                     getDouble("processing_modules.frame_gap.gap_factor", 1.5),
+                     getInt("processing_modules.frame_gap.publish_interval_sec", 60),
+                     getInt("processing_modules.frame_gap.max_sources", 8));
+        logger->debug("    * widen_speed_window: {}, suspend_stop_line: {}",
+                     getBool("processing_modules.frame_gap.widen_speed_window", true),
+                     getBool("processing_modules.frame_gap.suspend_stop_line", true));
+    }
+    
+    // Checkpoint
+    logger->info("[체크포인트]");
+    logger->info("  - checkpoint.enabled: {}", cached_flags.checkpoint_enabled);
+    if (cached_flags.checkpoint_enabled) {
+        logger->debug("    * path: {}", getString("checkpoint.path", "data/checkpoint.bin"));
+        logger->debug("    * interval_sec: {}, max_age_sec: {}, adopt_radius_px: {}",
+                     getInt("checkpoint.interval_sec", 5),
+                     getInt("checkpoint.max_age_sec", 120),
+                     getInt("checkpoint.adopt_radius_px", 80));
+    }
+    
+    // Memory Budget
+    logger->info("[추적 상태 메모리 예산]");
+    logger->info("  - memory_budget.enabled: {}", cached_flags.memory_budget_enabled);
+    if (cached_flags.memory_budget_enabled) {
+        logger->debug("    * tracked_objects: {}, capture_states_4k: {}",
+                     getInt("memory_budget.tracked_objects", 4096),
+                     getInt("memory_budget.capture_states_4k", 2048));
+        logger->debug("    * incident_vehicles: {}, incident_pedestrians: {}",
+                     getInt("memory_budget.incident_vehicles", 2048),
+                     getInt("memory_budget.incident_pedestrians", 1024));
+    }
+    
+    // Telemetry
+    logger->info("[프로세스 텔레메트리]");
+    logger->info("  - telemetry.enabled: {}", cached_flags.telemetry_enabled);
+    if (cached_flags.telemetry_enabled) {
+        logger->debug("    * interval_sec: {}, top_threads: {}, publish: {}",
+                     getInt("telemetry.interval_sec", 10),
+                     getInt("telemetry.top_threads", 8),
+                     getBool("telemetry.publish", true));
+    }
+    
+    // Heartbeat
+    logger->info("[스레드 정지 감시]");
+    logger->info("  - heartbeat.enabled: {}", cached_flags.heartbeat_enabled);
+    if (cached_flags.heartbeat_enabled) {
+        logger->debug("    * check_interval_ms: {}", getInt("heartbeat.check_interval_ms", 1000));
+    }
+    
+    // Thread roles
+    logger->info("[스레드 역할 설정]");
+    logger->info("  - thread_roles.enabled: {}", cached_flags.thread_roles_enabled);
     
     // Special Site
     logger->info("[특별 개소 설정]");
@@ -109,6 +234,11 @@ void ConfigManager::logAllSettings() const {
         logger->info("    * right: {}", cached_flags.special_site_right);
         logger->info("    * 모드: {}", 
                     cached_flags.special_site_straight_left ? "직진/좌회전" : "우회전");
+        std::string site = getString("processing_modules.special_site.site", "");
+        if (!site.empty()) {
+            logger->info("    * site: {} ({})", site, 
+                        getString("processing_modules.special_site.site_table", "config/special_sites.json"));
+        }
     }
     
     // 4K Only Mode
@@ -122,6 +252,10 @@ void ConfigManager::logAllSettings() const {
     logger->info("[경로 설정]");
     logger->info("  - base_path: {}", cached_flags.base_path);
     logger->info("  - db_filename: {}", cached_flags.db_filename);
+    logger->debug("    * read_pool_size: {}, busy_timeout_ms: {}, checkpoint_interval_sec: {}",
+                 getInt("paths.sqlite_db.read_pool_size", 2),
+                 getInt("paths.sqlite_db.busy_timeout_ms", 2000),
+                 getInt("paths.sqlite_db.checkpoint_interval_sec", 30));
     logger->info("  - log_path: {}", cached_flags.log_path);
     logger->info("  - images_path: {}", getImagePath(""));
     logger->info("  - rois_path: {}", getROIPath());
@@ -137,6 +271,17 @@ void ConfigManager::logAllSettings() const {
     logger->info("[Redis 설정]");
     logger->info("  - host: {}", cached_flags.redis_host);
     logger->info("  - port: {}", cached_flags.redis_port);
+    logger->info("  - publish_policy.enabled: {}", cached_flags.publish_policy_enabled);
+    if (cached_flags.publish_policy_enabled) {
+        logger->debug("    * tick_ms: {}", getInt("redis.publish_policy.tick_ms", 50));
+    }
+    logger->info("  - shm_ring.enabled: {}", cached_flags.shm_ring_enabled);
+    if (cached_flags.shm_ring_enabled) {
+        logger->debug("    * capacity_kb: {}, exclusive: {}, channels: {}개",
+                     getInt("redis.shm_ring.capacity_kb", 1024),
+                     getBool("redis.shm_ring.exclusive", false),
+                     getStringArray("redis.shm_ring.channels").size());
+    }
     
     // Redis Channels
     logger->info("[Redis 채널]");
@@ -149,6 +294,15 @@ void ConfigManager::logAllSettings() const {
     logger->info("  - vehicle_presence: {}", getRedisChannel("vehicle_presence"));
     logger->info("  - ped_crossing: {}", getRedisChannel("ped_crossing"));
     logger->info("  - ped_waiting: {}", getRedisChannel("ped_waiting"));
+    logger->info("  - los: {}", getRedisChannel("los"));
+    logger->info("  - intersection_approach: {}", getRedisChannel("intersection_approach"));
+    logger->info("  - intersection: {}", getRedisChannel("intersection"));
+    logger->info("  - telemetry: {}", getRedisChannel("telemetry"));
+    logger->info("  - frame_gap: {}", getRedisChannel("frame_gap"));
+    logger->info("  - arrival: {}", getRedisChannel("arrival"));
+    logger->info("  - split_failure: {}", getRedisChannel("split_failure"));
+    logger->info("  - pet: {}", getRedisChannel("pet"));
+    logger->info("  - ped_wait: {}", getRedisChannel("ped_wait"));
     
     // VoltDB - CAM DB
     if (cached_flags.operation_mode == "voltdb") {
@@ -192,11 +346,29 @@ void ConfigManager::logAllSettings() const {
     logger->info("  - 차량 2K 메타데이터: {}", cached_flags.vehicle_2k_enabled ? "ON" : "OFF");
     logger->info("  - 차량 4K 메타데이터: {}", cached_flags.vehicle_4k_enabled ? "ON" : "OFF");
     logger->info("  - 차량 Presence: {}", cached_flags.vehicle_presence_enabled ? "ON" : "OFF");
+    logger->info("  - 차종 크기 검증: {}", cached_flags.vehicle_size_check_enabled ? "ON" : "OFF");
     logger->info("  - 보행자 메타데이터: {}", cached_flags.pedestrian_meta_enabled ? "ON" : "OFF");
     logger->info("  - 보행자 Presence: {}", cached_flags.pedestrian_presence_enabled ? "ON" : "OFF");
+    logger->info("  - 보행자 대기 분석: {}", cached_flags.pedestrian_waiting_enabled ? "ON" : "OFF");
     logger->info("  - 통계 생성: {}", cached_flags.statistics_enabled ? "ON" : "OFF");
     logger->info("  - 대기행렬 분석: {}", cached_flags.wait_queue_enabled ? "ON" : "OFF");
+    logger->info("  - 실시간 LOS: {}", cached_flags.los_enabled ? "ON" : "OFF");
+    logger->info("  - 교차로 주기 집계: {}", cached_flags.intersection_enabled ? "ON" : "OFF");
+    logger->info("  - 차로 변경 집계: {}", cached_flags.lane_change_enabled ? "ON" : "OFF");
+    logger->info("  - 주기 도착 분석: {}", cached_flags.arrival_enabled ? "ON" : "OFF");
+    logger->info("  - split failure 감지: {}", cached_flags.split_failure_enabled ? "ON" : "OFF");
+    logger->info("  - 차량 지체 산출: {}", cached_flags.delay_enabled ? "ON" : "OFF");
     logger->info("  - 돌발이벤트: {}", cached_flags.incident_event_enabled ? "ON" : "OFF");
+    logger->info("  - PET 근접 충돌: {}", cached_flags.pet_enabled ? "ON" : "OFF");
+    logger->info("  - 추론 간격 제어: {}", cached_flags.inference_control_enabled ? "ON" : "OFF");
+    logger->info("  - ROI 영역 추론: {}", cached_flags.inference_region_enabled ? "ON" : "OFF");
+    logger->info("  - 프레임 누락 감지: {}", cached_flags.frame_gap_enabled ? "ON" : "OFF");
+    logger->info("  - 체크포인트: {}", cached_flags.checkpoint_enabled ? "ON" : "OFF");
+    logger->info("  - 메모리 예산: {}", cached_flags.memory_budget_enabled ? "ON" : "OFF");
+    logger->info("  - 텔레메트리: {}", cached_flags.telemetry_enabled ? "ON" : "OFF");
+    logger->info("  - 스레드 정지 감시: {}", cached_flags.heartbeat_enabled ? "ON" : "OFF");
+    logger->info("  - 스레드 역할 설정: {}", cached_flags.thread_roles_enabled ? "ON" : "OFF");
+    logger->info("  - 공유메모리 링 전송: {}", cached_flags.shm_ring_enabled ? "ON" : "OFF");
     if (cached_flags.special_site_enabled) {
         logger->info("  - Special Site: ON ({})", 
                     cached_flags.special_site_straight_left ? "직진/좌회전" : "우회전");
@@ -234,9 +406,14 @@ void ConfigManager::cacheAllFlags() {
     bool raw_pedestrian_presence = getBool("processing_modules.pedestrian.presence_check.enabled", false);
     bool raw_statistics = getBool("processing_modules.vehicle_analytics.statistics", false);
     bool raw_wait_queue = getBool("processing_modules.vehicle_analytics.wait_queue", false);
+    bool raw_los = getBool("processing_modules.vehicle_analytics.los.enabled", false);
+    bool raw_arrival = getBool("processing_modules.vehicle_analytics.arrival.enabled", false);
+    bool raw_split_failure = getBool("processing_modules.vehicle_analytics.split_failure.enabled", false);
+    bool raw_delay = getBool("processing_modules.vehicle_analytics.delay.enabled", false);
     bool raw_reverse_driving = getBool("processing_modules.incident_event.reverse_driving", false);
     bool raw_abnormal_stop = getBool("processing_modules.incident_event.abnormal_stop_sequence", false);
     bool raw_pedestrian_jaywalk = getBool("processing_modules.incident_event.pedestrian_jaywalk", false);
+    bool raw_pet = getBool("processing_modules.incident_event.pet.enabled", false);
     
     // 4K 전용 모드 체크
     cached_flags.is_4k_only_mode = (!raw_vehicle_2k && raw_vehicle_4k);
@@ -257,6 +434,10 @@ void ConfigManager::cacheAllFlags() {
     cached_flags.vehicle_presence_absence_frames = getInt("processing_modules.vehicle.presence_check.absence_frames", 3);
     cached_flags.vehicle_presence_anti_flicker = getBool("processing_modules.vehicle.presence_check.anti_flicker", true);
     
+    // 차종 크기 검증 (2K 차량 처리에서만 사용)
+    bool raw_size_check = getBool("processing_modules.vehicle.size_check.enabled", false);
+    cached_flags.vehicle_size_check_enabled = cached_flags.vehicle_2k_enabled ? raw_size_check : false;
+    
     // 보행자 설정 (4K 전용 모드에서는 강제 비활성화)
     cached_flags.pedestrian_meta_enabled = cached_flags.is_4k_only_mode ? false : raw_pedestrian_meta;
     cached_flags.pedestrian_presence_enabled = cached_flags.is_4k_only_mode ? false : raw_pedestrian_presence;
@@ -264,11 +445,23 @@ void ConfigManager::cacheAllFlags() {
     cached_flags.pedestrian_presence_absence_frames = getInt("processing_modules.pedestrian.presence_check.absence_frames", 3);
     cached_flags.pedestrian_presence_anti_flicker = getBool("processing_modules.pedestrian.presence_check.anti_flicker", true);
     
+    // 보행자 대기 분석 (보행 시작은 신호역산 기반 - 신호 DB 조건은 SystemManager에서 확인)
+    bool raw_pedestrian_waiting = getBool("processing_modules.pedestrian.waiting.enabled", false);
+    cached_flags.pedestrian_waiting_enabled = cached_flags.is_4k_only_mode ? false : raw_pedestrian_waiting;
+    
     // 분석 설정 (차량 2K 비활성 또는 4K 전용 모드에서는 강제 비활성화)
     cached_flags.statistics_enabled = (!cached_flags.vehicle_2k_enabled || cached_flags.is_4k_only_mode) 
                                      ? false : raw_statistics;
     cached_flags.wait_queue_enabled = (!cached_flags.vehicle_2k_enabled || cached_flags.is_4k_only_mode) 
                                      ? false : raw_wait_queue;
+    cached_flags.los_enabled = (!cached_flags.vehicle_2k_enabled || cached_flags.is_4k_only_mode) 
+                              ? false : raw_los;
+    cached_flags.arrival_enabled = (!cached_flags.vehicle_2k_enabled || cached_flags.is_4k_only_mode) 
+                                  ? false : raw_arrival;
+    cached_flags.split_failure_enabled = (!cached_flags.vehicle_2k_enabled || cached_flags.is_4k_only_mode) 
+                                        ? false : raw_split_failure;
+    cached_flags.delay_enabled = (!cached_flags.vehicle_2k_enabled || cached_flags.is_4k_only_mode) 
+                                ? false : raw_delay;
     cached_flags.stats_interval_minutes = getInt("processing_modules.vehicle_analytics.stats_interval_minutes", 5);
 
     // stats_interval_minutes 검증 (60의 약수만 허용)
@@ -292,6 +485,8 @@ void ConfigManager::cacheAllFlags() {
     cached_flags.incident_event_enabled = cached_flags.reverse_driving_enabled || 
                                          cached_flags.abnormal_stop_enabled || 
                                          cached_flags.pedestrian_jaywalk_enabled;
+    // PET는 차량/보행자 추적을 함께 쓰는 별도 모듈 (incident_event_enabled와 무관)
+    cached_flags.pet_enabled = incident_allowed ? raw_pet : false;
     
     // Special Site 설정
     cached_flags.special_site_enabled = getBool("processing_modules.special_site.enabled", false);
@@ -322,15 +517,66 @@ void ConfigManager::cacheAllFlags() {
                 cached_flags.special_site_right = false;
             }
             
-            // Special Site 모드에서는 통계와 대기행렬 자동 비활성화
-            if (cached_flags.statistics_enabled || cached_flags.wait_queue_enabled) {
-                logger->warn("Special Site 모드 활성화 - 통계와 대기행렬 자동 비활성화");
+            // Special Site 모드에서는 통계, 대기행렬, LOS, 신호 연동 분석 자동 비활성화
+            if (cached_flags.statistics_enabled || cached_flags.wait_queue_enabled ||
+                cached_flags.los_enabled || cached_flags.arrival_enabled ||
+                cached_flags.split_failure_enabled) {
+                logger->warn("Special Site 모드 활성화 - 통계, 대기행렬, LOS, 신호 연동 분석 자동 비활성화");
                 cached_flags.statistics_enabled = false;
                 cached_flags.wait_queue_enabled = false;
+                cached_flags.los_enabled = false;
+                cached_flags.arrival_enabled = false;
+                cached_flags.split_failure_enabled = false;
             }
         }
     }
     
+    // 교차로 주기 집계 (신호현시 통계 기반 - 통계 비활성시 강제 비활성화)
+    bool raw_intersection = getBool("processing_modules.vehicle_analytics.intersection.enabled", false);
+    cached_flags.intersection_enabled = cached_flags.statistics_enabled ? raw_intersection : false;
+    
+    // 차로 변경 집계 (인터벌 통계와 함께 전송 - 통계 비활성시 강제 비활성화)
+    bool raw_lane_change = getBool("processing_modules.vehicle_analytics.lane_change.enabled", false);
+    cached_flags.lane_change_enabled = cached_flags.statistics_enabled ? raw_lane_change : false;
+    
+    // ROI 영역 추론 (nvdspreprocess 설정 파일 경로 필요)
+    cached_flags.inference_region_enabled = getBool("processing_modules.inference_region.enabled", false);
+    if (cached_flags.inference_region_enabled &&
+        getString("processing_modules.inference_region.preprocess.config_file").empty()) {
+        logger->warn("inference_region.preprocess.config_file 없음 - ROI 영역 추론 비활성화");
+        cached_flags.inference_region_enabled = false;
+    }
+    
+    // 추론 간격 제어 - 강제 비활성화 조건
+    // - 4K 메타: 번호판 크롭을 위해 매 프레임 검출 필요
+    // - ROI 영역 추론: nvinfer가 input-tensor-meta 모드에서 interval 속성을 무시
+    bool raw_inference_control = getBool("processing_modules.inference_control.enabled", false);
+    cached_flags.inference_control_enabled = raw_inference_control;
+    if (raw_inference_control && cached_flags.vehicle_4k_enabled) {
+        cached_flags.inference_control_enabled = false;
+    } else if (raw_inference_control && cached_flags.inference_region_enabled) {
+        logger->warn("ROI 영역 추론 활성 (input-tensor-meta) - nvinfer interval 미적용으로 추론 간격 제어 비활성화");
+        cached_flags.inference_control_enabled = false;
+    }
+    
+    // 프레임 누락 감지
+    cached_flags.frame_gap_enabled = getBool("processing_modules.frame_gap.enabled", false);
+    
+    // 체크포인트
+    cached_flags.checkpoint_enabled = getBool("checkpoint.enabled", false);
+    
+    // 추적 상태 메모리 예산
+    cached_flags.memory_budget_enabled = getBool("memory_budget.enabled", false);
+    
+    // 프로세스 자원 텔레메트리
+    cached_flags.telemetry_enabled = getBool("telemetry.enabled", false);
+    
+    // 스레드 하트비트 정지 감시
+    cached_flags.heartbeat_enabled = getBool("heartbeat.enabled", false);
+    
+    // 스레드 역할별 CPU/스케줄링 설정
+    cached_flags.thread_roles_enabled = getBool("thread_roles.enabled", false);
+    
     // System 설정
     cached_flags.camera_fps = getInt("system.camera_fps", 15);
     cached_flags.log_level = getString("system.log_level", "info");
@@ -339,6 +585,8 @@ void ConfigManager::cacheAllFlags() {
     // Redis 설정
     cached_flags.redis_host = getString("redis.host", "127.0.0.1");
     cached_flags.redis_port = getInt("redis.port", 6379);
+    cached_flags.shm_ring_enabled = getBool("redis.shm_ring.enabled", false);
+    cached_flags.publish_policy_enabled = getBool("redis.publish_policy.enabled", false);
     
     // Path 설정
     cached_flags.base_path = getString("paths.base_path", 
@@ -541,6 +789,32 @@ bool ConfigManager::getBool(const std::string& key, bool default_value) const {
     return default_value;
 }
 
+std::vector<double> ConfigManager::getDoubleArray(const std::string& key) const {
+    std::vector<double> result;
+    const Json::Value* value = getJsonValue(key);
+    if (value && value->isArray()) {
+        for (const auto& item : *value) {
+            if (item.isNumeric()) {
+                result.push_back(item.asDouble());
+            }
+        }
+    }
+    return result;
+}
+
+std::vector<std::string> ConfigManager::getStringArray(const std::string& key) const {
+    std::vector<std::string> result;
+    const Json::Value* value = getJsonValue(key);
+    if (value && value->isArray()) {
+        for (const auto& item : *value) {
+            if (item.isString()) {
+                result.push_back(item.asString());
+            }
+        }
+    }
+    return result;
+}
+
 const Json::Value* ConfigManager::getJsonValue(const std::string& key) const {
     std::vector<std::string> parts;
     std::stringstream ss(key);
@@ -61,6 +61,7 @@ private:
         int vehicle_presence_detect_frames = 1;
         int vehicle_presence_absence_frames = 3;
         bool vehicle_presence_anti_flicker = true;
+        bool vehicle_size_check_enabled = false;
         bool is_4k_only_mode = false;
         
         // 보행자 관련
@@ -69,23 +70,53 @@ private:
         int pedestrian_presence_detect_frames = 1;
         int pedestrian_presence_absence_frames = 3;
         bool pedestrian_presence_anti_flicker = true;
+        bool pedestrian_waiting_enabled = false;
         
         // 분석 관련
         bool statistics_enabled = false;
         bool wait_queue_enabled = false;
         int stats_interval_minutes = 5;
+        bool los_enabled = false;
+        bool intersection_enabled = false;
+        bool lane_change_enabled = false;
+        bool arrival_enabled = false;
+        bool split_failure_enabled = false;
+        bool delay_enabled = false;
         
         // 돌발이벤트 관련
         bool reverse_driving_enabled = false;
         bool abnormal_stop_enabled = false;
         bool pedestrian_jaywalk_enabled = false;
         bool incident_event_enabled = false;
+        bool pet_enabled = false;
+        
+        // 추론 간격 제어 / 추론 영역
+        bool inference_control_enabled = false;
+        bool inference_region_enabled = false;
+        
+        // 프레임 누락 감지
+        bool frame_gap_enabled = false;
         
         // Special Site 관련
         bool special_site_enabled = false;
         bool special_site_straight_left = false;
         bool special_site_right = false;
         
+        // 체크포인트 (분석 상태 저장/복원)
+        bool checkpoint_enabled = false;
+        
+        // 추적 상태 메모리 예산
+        bool memory_budget_enabled = false;
+        
+        // 프로세스 자원 텔레메트리
+        bool telemetry_enabled = false;
+        
+        // 스레드 하트비트 정지 감시
+        bool heartbeat_enabled = false;
+        
+        // 스레드 역할별 CPU/스케줄링 설정
+        bool thread_roles_enabled = false;
+        
         // System
         int camera_fps = 15;
         std::string log_level = "info";
@@ -94,6 +125,8 @@ private:
         // Redis
         std::string redis_host = "127.0.0.1";
         int redis_port = 6379;
+        bool shm_ring_enabled = false;
+        bool publish_policy_enabled = false;
         
         // Paths
         std::string base_path;
@@ -163,25 +196,54 @@ public:
     int getVehiclePresenceDetectFrames() const { return cached_flags.vehicle_presence_detect_frames; }
     int getVehiclePresenceAbsenceFrames() const { return cached_flags.vehicle_presence_absence_frames; }
     bool getVehiclePresenceAntiFlicker() const { return cached_flags.vehicle_presence_anti_flicker; }
+    bool isVehicleSizeCheckEnabled() const { return cached_flags.vehicle_size_check_enabled; }
     
     bool isPedestrianMetaEnabled() const { return cached_flags.pedestrian_meta_enabled; }
     bool isPedestrianPresenceEnabled() const { return cached_flags.pedestrian_presence_enabled; }
     int getPedestrianPresenceDetectFrames() const { return cached_flags.pedestrian_presence_detect_frames; }
     int getPedestrianPresenceAbsenceFrames() const { return cached_flags.pedestrian_presence_absence_frames; }
     bool getPedestrianPresenceAntiFlicker() const { return cached_flags.pedestrian_presence_anti_flicker; }
+    bool isPedestrianWaitingEnabled() const { return cached_flags.pedestrian_waiting_enabled; }
     
     bool isStatisticsEnabled() const { return cached_flags.statistics_enabled; }
     int getStatsIntervalMinutes() const { return cached_flags.stats_interval_minutes; }
     bool isWaitQueueEnabled() const { return cached_flags.wait_queue_enabled; }
+    bool isLOSEnabled() const { return cached_flags.los_enabled; }
+    bool isIntersectionEnabled() const { return cached_flags.intersection_enabled; }
+    bool isLaneChangeEnabled() const { return cached_flags.lane_change_enabled; }
+    bool isArrivalEnabled() const { return cached_flags.arrival_enabled; }
+    bool isSplitFailureEnabled() const { return cached_flags.split_failure_enabled; }
+    bool isDelayEnabled() const { return cached_flags.delay_enabled; }
     
     // 돌발이벤트 개별 설정 (캐시된 값 반환)
     bool isReverseDrivingEnabled() const { return cached_flags.reverse_driving_enabled; }
     bool isAbnormalStopEnabled() const { return cached_flags.abnormal_stop_enabled; }
     bool isPedestrianJaywalkEnabled() const { return cached_flags.pedestrian_jaywalk_enabled; }
+    bool isPETEnabled() const { return cached_flags.pet_enabled; }
     
     // 돌발이벤트 통합 체크 (캐시된 값 반환)
     bool isIncidentEventEnabled() const { return cached_flags.incident_event_enabled; }
     
+    // 추론 간격 제어 (캐시된 값 반환)
+    bool isInferenceControlEnabled() const { return cached_flags.inference_control_enabled; }
+    bool isInferenceRegionEnabled() const { return cached_flags.inference_region_enabled; }
+    bool isFrameGapEnabled() const { return cached_flags.frame_gap_enabled; }
+    
+    // 체크포인트 (캐시된 값 반환)
+    bool isCheckpointEnabled() const { return cached_flags.checkpoint_enabled; }
+    
+    // 추적 상태 메모리 예산 (캐시된 값 반환)
+    bool isMemoryBudgetEnabled() const { return cached_flags.memory_budget_enabled; }
+    
+    // 프로세스 자원 텔레메트리 (캐시된 값 반환)
+    bool isTelemetryEnabled() const { return cached_flags.telemetry_enabled; }
+    
+    // 스레드 하트비트 정지 감시 (캐시된 값 반환)
+    bool isHeartbeatEnabled() const { return cached_flags.heartbeat_enabled; }
+    
+    // 스레드 역할별 CPU/스케줄링 설정 (캐시된 값 반환)
+    bool isThreadRolesEnabled() const { return cached_flags.thread_roles_enabled; }
+    
     // Special Site 설정 (캐시된 값 반환)
     bool isSpecialSiteEnabled() const { return cached_flags.special_site_enabled; }
     bool isSpecialSiteStraightLeft() const { return cached_flags.special_site_straight_left; }
@@ -197,6 +259,8 @@ public:
     // Redis 설정 (캐시된 값 반환)
     std::string getRedisHost() const { return cached_flags.redis_host; }
     int getRedisPort() const { return cached_flags.redis_port; }
+    bool isShmRingEnabled() const { return cached_flags.shm_ring_enabled; }
+    bool isPublishPolicyEnabled() const { return cached_flags.publish_policy_enabled; }
     std::string getRedisChannel(const std::string& channel_key) const;
     
     // 기능 플래그
@@ -207,6 +271,8 @@ public:
     int getInt(const std::string& key, int default_value = 0) const;
     double getDouble(const std::string& key, double default_value = 0.0) const;
     bool getBool(const std::string& key, bool default_value = false) const;
+    std::vector<double> getDoubleArray(const std::string& key) const;
+    std::vector<std::string> getStringArray(const std::string& key) const;
 };
 
 #endif // CONFIG_MANAGER_H
\ No newline at end of file
@@ -0,0 +1,249 @@
+﻿#include "heartbeat_registry.h"
+#include "config_manager.h"
+#include "thread_role.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+HeartbeatRegistry::HeartbeatRegistry() : epoch_(std::chrono::steady_clock::now()) {
+    logger = getLogger("DS_Heartbeat_log");
+}
+
+HeartbeatRegistry::~HeartbeatRegistry() {
+    stopSupervisor();
+}
+
+HeartbeatRegistry& HeartbeatRegistry::getInstance() {
+    static HeartbeatRegistry instance;
+    return instance;
+}
+
+void HeartbeatRegistry::loadConfig() {
+    if (initialized_) return;
+
+    auto& config = ConfigManager::getInstance();
+    enabled_ = config.isHeartbeatEnabled();
+    check_interval_ms_ = config.getInt("heartbeat.check_interval_ms", 1000);
+    if (check_interval_ms_ < 100) {
+        logger->warn("잘못된 heartbeat.check_interval_ms 값: {} - 기본값 1000ms 사용", check_interval_ms_);
+        check_interval_ms_ = 1000;
+    }
+    initialized_ = true;
+
+    logger->info("하트비트 감시 {} (확인 주기: {}ms)", enabled_ ? "활성" : "비활성", check_interval_ms_);
+}
+
+HeartbeatHandle HeartbeatRegistry::registerThread(const std::string& name, int default_deadline_ms,
+                                                  std::function<void()> on_stall) {
+    std::lock_guard<std::mutex> lock(slots_mutex_);
+    loadConfig();
+    if (!enabled_) return HeartbeatHandle();
+
+    for (auto& slot : slots_) {
+        if (slot.in_use.load()) continue;
+
+        auto& config = ConfigManager::getInstance();
+        std::string key = "heartbeat.threads." + name;
+
+        std::strncpy(slot.name, name.c_str(), sizeof(slot.name) - 1);
+        slot.name[sizeof(slot.name) - 1] = '\0';
+        slot.deadline_ms = config.getInt(key + ".deadline_ms", default_deadline_ms);
+        if (slot.deadline_ms < check_interval_ms_) {
+            slot.deadline_ms = check_interval_ms_;
+        }
+        slot.recovery = parseRecovery(config.getString(key + ".recovery", "log"));
+        slot.on_stall = std::move(on_stall);
+        slot.stalled = false;
+        slot.stall_start_ms = 0;
+        slot.stalls = 0;
+        slot.longest_stall_ms = 0;
+        slot.word.store((static_cast<uint64_t>(nowMs()) << 8) | HB_STAGE_LOOP, std::memory_order_relaxed);
+        slot.in_use = true;
+
+        logger->info("하트비트 등록 - {}: 정지 판정 {}ms, 복구: {}",
+                    slot.name, slot.deadline_ms, recoveryName(slot.recovery));
+        return HeartbeatHandle(&slot);
+    }
+
+    logger->warn("하트비트 슬롯 부족 ({}개) - {} 감시 안함", MAX_SLOTS, name);
+    return HeartbeatHandle();
+}
+
+void HeartbeatRegistry::releaseSlot(HeartbeatSlot* slot) {
+    std::lock_guard<std::mutex> lock(slots_mutex_);
+
+    if (slot->stalled) {
+        logger->warn("정지 상태로 종료된 스레드: {}", slot->name);
+    }
+    slot->on_stall = nullptr;
+    slot->stalled = false;
+    slot->in_use = false;
+}
+
+void HeartbeatRegistry::startSupervisor() {
+    {
+        std::lock_guard<std::mutex> lock(slots_mutex_);
+        loadConfig();
+    }
+    if (!enabled_ || running_.load()) return;
+
+    running_ = true;
+    supervisor_thread_ = std::thread(&HeartbeatRegistry::supervisorThread, this);
+    logger->info("하트비트 감시 스레드 시작");
+}
+
+void HeartbeatRegistry::stopSupervisor() {
+    if (!running_.exchange(false)) return;
+
+    wait_cv_.notify_all();
+    if (supervisor_thread_.joinable()) {
+        supervisor_thread_.join();
+    }
+    logStatistics();
+    logger->info("하트비트 감시 스레드 중지");
+}
+
+void HeartbeatRegistry::supervisorThread() {
+    enterThreadRole("ds-watchdog");
+
+    while (running_.load()) {
+        {
+            std::unique_lock<std::mutex> lock(wait_mutex_);
+            wait_cv_.wait_for(lock, std::chrono::milliseconds(check_interval_ms_),
+                              [this]() { return !running_.load(); });
+        }
+        if (!running_.load()) break;
+
+        try {
+            checkSlots();
+        } catch (const std::exception& e) {
+            logger->error("하트비트 확인 중 오류: {}", e.what());
+        }
+    }
+}
+
+void HeartbeatRegistry::checkSlots() {
+    std::vector<std::function<void()>> callbacks;
+    bool abort_requested = false;
+
+    {
+        std::lock_guard<std::mutex> lock(slots_mutex_);
+        int64_t now_ms = nowMs();
+
+        for (auto& slot : slots_) {
+            if (!slot.in_use.load()) continue;
+
+            uint64_t word = slot.word.load(std::memory_order_relaxed);
+            int stage = static_cast<int>(word & 0xFF);
+            int64_t last_beat_ms = static_cast<int64_t>(word >> 8);
+            int64_t blocked_ms = now_ms - last_beat_ms;
+
+            bool overdue = !heartbeatStageIsWait(stage) && blocked_ms > slot.deadline_ms;
+
+            if (!overdue) {
+                if (slot.stalled) {
+                    int64_t stall_ms = last_beat_ms - slot.stall_start_ms;
+                    if (stall_ms > slot.longest_stall_ms) {
+                        slot.longest_stall_ms = stall_ms;
+                    }
+                    slot.stalled = false;
+                    logger->warn("스레드 정지 해제 - {}: 약 {}ms 정지 후 재개 (현재 단계: {})",
+                                slot.name, stall_ms, heartbeatStageName(stage));
+                }
+                continue;
+            }
+
+            if (slot.stalled) continue;     // 정지 구간당 1회만 처리
+
+            slot.stalled = true;
+            slot.stall_start_ms = last_beat_ms;
+            slot.stalls++;
+
+            logger->error("스레드 정지 감지 - {}: 단계 {}, {}ms 정지 (기준 {}ms), 복구: {}",
+                         slot.name, heartbeatStageName(stage), blocked_ms, slot.deadline_ms,
+                         recoveryName(slot.recovery));
+            logSlotSnapshot(now_ms);
+
+            switch (slot.recovery) {
+                case StallRecovery::CALLBACK:
+                    if (slot.on_stall) {
+                        callbacks.push_back(slot.on_stall);
+                    } else {
+                        logger->warn("  {} 복구 함수 미등록 - 로그만 기록", slot.name);
+                    }
+                    break;
+                case StallRecovery::ABORT:
+                    abort_requested = true;
+                    break;
+                case StallRecovery::LOG:
+                default:
+                    break;
+            }
+        }
+    }
+
+    // 복구 함수는 락 밖에서 호출 (복구 중 등록/해제 허용)
+    for (auto& callback : callbacks) {
+        try {
+            callback();
+        } catch (const std::exception& e) {
+            logger->error("정지 복구 함수 실패: {}", e.what());
+        }
+    }
+
+    if (abort_requested) {
+        logger->critical("정지 복구 정책(abort)에 따라 프로세스 종료");
+        logger->flush();
+        std::abort();
+    }
+}
+
+void HeartbeatRegistry::logSlotSnapshot(int64_t now_ms) const {
+    for (const auto& slot : slots_) {
+        if (!slot.in_use.load()) continue;
+
+        uint64_t word = slot.word.load(std::memory_order_relaxed);
+        logger->info("  [{}] 단계: {}, 마지막 하트비트: {}ms 전",
+                    slot.name, heartbeatStageName(static_cast<int>(word & 0xFF)),
+                    now_ms - static_cast<int64_t>(word >> 8));
+    }
+}
+
+void HeartbeatRegistry::logStatistics() const {
+    std::lock_guard<std::mutex> lock(slots_mutex_);
+    if (!enabled_) return;
+
+    int64_t now_ms = nowMs();
+    int active = 0;
+    for (const auto& slot : slots_) {
+        if (slot.in_use.load()) active++;
+    }
+    logger->info("하트비트 통계 - 감시 스레드: {}개", active);
+
+    for (const auto& slot : slots_) {
+        if (!slot.in_use.load()) continue;
+
+        uint64_t word = slot.word.load(std::memory_order_relaxed);
+        int64_t current_stall_ms = slot.stalled ? now_ms - slot.stall_start_ms : 0;
+        logger->info("  [{}] 정지: {}회, 최장: {}ms{}, 단계: {}",
+                    slot.name, slot.stalls, std::max(slot.longest_stall_ms, current_stall_ms),
+                    slot.stalled ? " (정지 중)" : "",
+                    heartbeatStageName(static_cast<int>(word & 0xFF)));
+    }
+}
+
+StallRecovery HeartbeatRegistry::parseRecovery(const std::string& value) {
+    if (value == "callback") return StallRecovery::CALLBACK;
+    if (value == "abort") return StallRecovery::ABORT;
+    return StallRecovery::LOG;
+}
+
+const char* HeartbeatRegistry::recoveryName(StallRecovery recovery) {
+    switch (recovery) {
+        case StallRecovery::CALLBACK: return "callback";
+        case StallRecovery::ABORT:    return "abort";
+        case StallRecovery::LOG:
+        default:                      return "log";
+    }
+}
@@ -0,0 +1,231 @@
+﻿#ifndef HEARTBEAT_REGISTRY_H
+#define HEARTBEAT_REGISTRY_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+/**
+ * @brief 하트비트 단계 태그 (정지 시 어느 구간에서 멈췄는지 표시)
+ */
+enum HeartbeatStage : uint8_t {
+    HB_STAGE_IDLE = 0,          // 예정된 대기 (cv/sleep) - 정지 감시 제외
+    HB_STAGE_LOOP = 1,          // 루프 일반 처리
+    HB_STAGE_WAIT_BUFFER = 2,   // 다음 버퍼 대기 (스트리밍) - 정지 감시 제외 (입력 단절은 정지 아님)
+    HB_STAGE_LOCK_WAIT = 3,     // 공유 락 대기
+    HB_STAGE_FRAME = 4,         // 프레임 메타데이터 처리
+    HB_STAGE_PER_SECOND = 5,    // 매 초 분석 갱신
+    HB_STAGE_DB_QUERY = 6,      // VoltDB 조회
+    HB_STAGE_DB_CONNECT = 7,    // VoltDB 연결
+    HB_STAGE_REDIS = 8,         // Redis 송수신
+    HB_STAGE_SQLITE = 9,        // SQLite 조회/기록
+    HB_STAGE_SIGNAL_EVENT = 10, // 신호 변경 이벤트 처리 (콜백)
+    HB_STAGE_FILE_WRITE = 11    // 파일 기록
+};
+
+/**
+ * @brief 단계 태그 이름
+ */
+inline const char* heartbeatStageName(int stage) {
+    switch (stage) {
+        case HB_STAGE_IDLE:         return "idle";
+        case HB_STAGE_LOOP:         return "loop";
+        case HB_STAGE_WAIT_BUFFER:  return "wait_buffer";
+        case HB_STAGE_LOCK_WAIT:    return "lock_wait";
+        case HB_STAGE_FRAME:        return "frame";
+        case HB_STAGE_PER_SECOND:   return "per_second";
+        case HB_STAGE_DB_QUERY:     return "db_query";
+        case HB_STAGE_DB_CONNECT:   return "db_connect";
+        case HB_STAGE_REDIS:        return "redis";
+        case HB_STAGE_SQLITE:       return "sqlite";
+        case HB_STAGE_SIGNAL_EVENT: return "signal_event";
+        case HB_STAGE_FILE_WRITE:   return "file_write";
+        default:                    return "unknown";
+    }
+}
+
+/**
+ * @brief 차단 대기 단계 여부 (입력/일정 대기 - 길어져도 정지로 보지 않음)
+ */
+inline bool heartbeatStageIsWait(int stage) {
+    return stage == HB_STAGE_IDLE || stage == HB_STAGE_WAIT_BUFFER;
+}
+
+/**
+ * @brief 정지 감지 시 복구 동작
+ */
+enum class StallRecovery {
+    LOG,        // 로그만 (전체 스레드 단계 스냅샷 포함)
+    CALLBACK,   // 스레드 소유 모듈이 등록한 복구 함수 호출 (없으면 LOG)
+    ABORT       // 프로세스 종료 (서비스 관리자가 재시작)
+};
+
+/**
+ * @brief 스레드별 하트비트 슬롯 (고정 배열, 등록 후 주소 고정)
+ *
+ * word = (기준 시각 이후 ms << 8) | 단계 - 하트비트 1회는 relaxed store 1번
+ */
+struct HeartbeatSlot {
+    std::atomic<uint64_t> word{0};
+    std::atomic<bool> in_use{false};
+
+    // 등록 시 설정 (레지스트리 락 보호)
+    char name[16] = {0};
+    int64_t deadline_ms = 0;
+    StallRecovery recovery = StallRecovery::LOG;
+    std::function<void()> on_stall;
+
+    // 감시 스레드 전용
+    bool stalled = false;
+    int64_t stall_start_ms = 0;
+    uint64_t stalls = 0;
+    int64_t longest_stall_ms = 0;
+};
+
+/**
+ * @brief 하트비트 핸들 (스레드가 소유, 소멸 시 슬롯 반환)
+ *
+ * 레지스트리 비활성/슬롯 부족 시 빈 핸들 - beat()는 아무 동작 안함
+ */
+class HeartbeatHandle {
+private:
+    HeartbeatSlot* slot_ = nullptr;
+
+public:
+    HeartbeatHandle() = default;
+    explicit HeartbeatHandle(HeartbeatSlot* slot) : slot_(slot) {}
+    ~HeartbeatHandle() { release(); }
+
+    HeartbeatHandle(const HeartbeatHandle&) = delete;
+    HeartbeatHandle& operator=(const HeartbeatHandle&) = delete;
+    HeartbeatHandle(HeartbeatHandle&& other) noexcept : slot_(other.slot_) { other.slot_ = nullptr; }
+    HeartbeatHandle& operator=(HeartbeatHandle&& other) noexcept {
+        if (this != &other) {
+            release();
+            slot_ = other.slot_;
+            other.slot_ = nullptr;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief 하트비트 + 현재 단계 기록 (relaxed store 1회)
+     * @param stage 현재 단계 태그
+     */
+    inline void beat(HeartbeatStage stage);
+
+    void release();
+    bool valid() const { return slot_ != nullptr; }
+};
+
+/**
+ * @brief 장기 실행 스레드 하트비트 레지스트리 및 정지 감시 (싱글톤)
+ *
+ * 네트워크 호출/뮤텍스 대기로 멈춘 스레드를 통계 누락 전에 감지
+ * - 각 스레드는 루프마다 자기 슬롯에 시각+단계를 relaxed store (락 없음)
+ * - 감시 스레드(ds-watchdog)가 check_interval_ms마다 슬롯을 확인해 스레드별 deadline 초과 시
+ *   정지 단계/정지 시간을 기록하고 설정된 복구 동작 수행 (정지 구간당 1회)
+ * - 정지 감지 시 모든 슬롯의 단계를 함께 출력 (락 보유 스레드 추적용)
+ * - IDLE(예정된 대기)/WAIT_BUFFER(입력 대기) 단계는 감시 제외
+ *   (RTSP 단절로 버퍼가 오지 않는 구간은 소스 재연결 로직의 몫)
+ * - 스레드별 deadline/recovery는 config.json heartbeat.threads.<스레드 이름>
+ */
+class HeartbeatRegistry {
+public:
+    static constexpr size_t MAX_SLOTS = 32;
+
+private:
+    std::array<HeartbeatSlot, MAX_SLOTS> slots_;
+    mutable std::mutex slots_mutex_;    // 등록/해제/감시 (하트비트 자체는 락 없음)
+
+    std::chrono::steady_clock::time_point epoch_;
+    bool enabled_ = false;
+    bool initialized_ = false;
+    int check_interval_ms_ = 1000;
+
+    // 감시 스레드
+    std::thread supervisor_thread_;
+    std::atomic<bool> running_{false};
+    std::mutex wait_mutex_;
+    std::condition_variable wait_cv_;
+
+    std::shared_ptr<spdlog::logger> logger = nullptr;
+
+    HeartbeatRegistry();
+    void loadConfig();
+    void supervisorThread();
+    void checkSlots();
+    void logSlotSnapshot(int64_t now_ms) const;
+
+    static StallRecovery parseRecovery(const std::string& value);
+    static const char* recoveryName(StallRecovery recovery);
+
+public:
+    static HeartbeatRegistry& getInstance();
+    ~HeartbeatRegistry();
+
+    HeartbeatRegistry(const HeartbeatRegistry&) = delete;
+    HeartbeatRegistry& operator=(const HeartbeatRegistry&) = delete;
+
+    /**
+     * @brief 스레드 등록 - 스레드 함수 시작 시 호출
+     * @param name 스레드 이름 (config 키, setCurrentThreadName과 동일하게 사용)
+     * @param default_deadline_ms 설정이 없을 때 정지 판정 시간
+     * @param on_stall 복구 함수 (recovery=callback일 때 감시 스레드에서 호출)
+     * @return 하트비트 핸들 (비활성/슬롯 부족 시 빈 핸들)
+     */
+    HeartbeatHandle registerThread(const std::string& name, int default_deadline_ms,
+                                   std::function<void()> on_stall = nullptr);
+
+    /**
+     * @brief 슬롯 반환 (핸들 소멸 시)
+     */
+    void releaseSlot(HeartbeatSlot* slot);
+
+    /**
+     * @brief 감시 스레드 시작/중지
+     */
+    void startSupervisor();
+    void stopSupervisor();
+
+    /**
+     * @brief 스레드별 정지 횟수/최장 정지 시간 로깅
+     */
+    void logStatistics() const;
+
+    /**
+     * @brief 기준 시각 이후 ms (하트비트 시각)
+     */
+    int64_t nowMs() const {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - epoch_).count();
+    }
+
+    bool isEnabled() const { return enabled_; }
+};
+
+inline void HeartbeatHandle::beat(HeartbeatStage stage) {
+    if (!slot_) return;
+    uint64_t now_ms = static_cast<uint64_t>(HeartbeatRegistry::getInstance().nowMs());
+    slot_->word.store((now_ms << 8) | stage, std::memory_order_relaxed);
+}
+
+inline void HeartbeatHandle::release() {
+    if (!slot_) return;
+    HeartbeatRegistry::getInstance().releaseSlot(slot_);
+    slot_ = nullptr;
+}
+
+#endif // HEARTBEAT_REGISTRY_H
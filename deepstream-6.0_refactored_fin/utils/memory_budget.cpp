@@ -0,0 +1,76 @@
+﻿#include "memory_budget.h"
+#include "config_manager.h"
+
+MemoryBudget::MemoryBudget() {
+    logger = getLogger("DS_MemoryBudget_log");
+}
+
+MemoryBudget& MemoryBudget::getInstance() {
+    static MemoryBudget instance;
+    return instance;
+}
+
+void MemoryBudget::loadConfig() {
+    if (initialized_) return;
+
+    auto& config = ConfigManager::getInstance();
+    enabled_ = config.isMemoryBudgetEnabled();
+    initialized_ = true;
+
+    logger->info("메모리 예산 {} (용량 초과 시 축출)", enabled_ ? "활성" : "비활성 - 집계만 수행");
+}
+
+MemoryBudget::Usage* MemoryBudget::registerModule(const std::string& name, size_t default_capacity,
+                                                  size_t entry_bytes) {
+    std::lock_guard<std::mutex> lock(modules_mutex_);
+    loadConfig();
+
+    for (auto& usage : modules_) {
+        if (usage->name == name) return usage.get();
+    }
+
+    int configured = ConfigManager::getInstance().getInt("memory_budget." + name,
+                                                         static_cast<int>(default_capacity));
+    if (configured < 0) {
+        logger->warn("잘못된 memory_budget.{} 값: {} - 기본값 {} 사용", name, configured, default_capacity);
+        configured = static_cast<int>(default_capacity);
+    }
+
+    auto usage = std::make_unique<Usage>();
+    usage->name = name;
+    usage->capacity = enabled_ ? static_cast<size_t>(configured) : 0;
+    usage->entry_bytes = entry_bytes;
+
+    logger->info("메모리 예산 등록 - {}: 최대 {}개 (항목당 약 {}B, 최대 약 {}KB)",
+                name, usage->capacity, entry_bytes, usage->capacity * entry_bytes / 1024);
+
+    modules_.push_back(std::move(usage));
+    return modules_.back().get();
+}
+
+size_t MemoryBudget::totalLiveBytes() const {
+    std::lock_guard<std::mutex> lock(modules_mutex_);
+
+    size_t total = 0;
+    for (const auto& usage : modules_) {
+        total += usage->liveBytes();
+    }
+    return total;
+}
+
+void MemoryBudget::logStatistics() const {
+    std::lock_guard<std::mutex> lock(modules_mutex_);
+
+    size_t total = 0;
+    for (const auto& usage : modules_) {
+        total += usage->liveBytes();
+    }
+    logger->info("메모리 예산 통계 - {}개 모듈, 추적 상태 약 {}KB", modules_.size(), total / 1024);
+
+    for (const auto& usage : modules_) {
+        logger->info("  [{}] 항목: {}/{} (최대 {}), 약 {}KB, 축출: {}회",
+                    usage->name, usage->entries.load(), usage->capacity,
+                    usage->peak_entries.load(), usage->liveBytes() / 1024,
+                    usage->evictions.load());
+    }
+}
@@ -0,0 +1,91 @@
+﻿#ifndef MEMORY_BUDGET_H
+#define MEMORY_BUDGET_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+/**
+ * @brief 추적 상태 메모리 예산 관리 (싱글톤)
+ *
+ * 추적 ID별 상태 컨테이너(det_obj, 4K 캡처 상태, 돌발 추적 상태)의
+ * 모듈별 최대 항목 수를 config.json에서 읽어 배정하고 사용량을 집계
+ * - 용량 초과 시 컨테이너(BoundedMap)가 LRU/오래된 순으로 축출
+ * - 사용 바이트는 항목 수 x 항목당 추정 크기 (노드 오버헤드 포함, 문자열 힙 제외)
+ * - 카운터는 atomic - 컨테이너 소유 스레드와 통계 로깅 스레드가 달라도 안전
+ */
+class MemoryBudget {
+public:
+    /**
+     * @brief 모듈별 사용량 (등록 후 주소 고정)
+     */
+    struct Usage {
+        std::string name;
+        size_t capacity = 0;                    // 최대 항목 수 (0: 무제한)
+        size_t entry_bytes = 0;                 // 항목당 추정 크기
+        std::atomic<size_t> entries{0};
+        std::atomic<size_t> peak_entries{0};
+        std::atomic<uint64_t> evictions{0};
+
+        size_t liveBytes() const { return entries.load() * entry_bytes; }
+    };
+
+private:
+    std::vector<std::unique_ptr<Usage>> modules_;
+    mutable std::mutex modules_mutex_;
+    bool enabled_ = true;
+    bool initialized_ = false;
+
+    std::shared_ptr<spdlog::logger> logger = nullptr;
+
+    // 프레임 번호 (BoundedMap LRU 갱신을 프레임당 1회로 제한)
+    static inline std::atomic<uint64_t> frame_counter_{0};
+
+    MemoryBudget();
+    void loadConfig();
+
+public:
+    static MemoryBudget& getInstance();
+
+    MemoryBudget(const MemoryBudget&) = delete;
+    MemoryBudget& operator=(const MemoryBudget&) = delete;
+
+    /**
+     * @brief 모듈 등록 - config.json의 memory_budget.<name> 값을 용량으로 배정
+     * @param name 모듈 이름 (config 키)
+     * @param default_capacity 설정이 없을 때 최대 항목 수
+     * @param entry_bytes 항목당 추정 크기
+     * @return 사용량 포인터 (같은 이름은 같은 포인터, 프로세스 종료까지 유효)
+     */
+    Usage* registerModule(const std::string& name, size_t default_capacity, size_t entry_bytes);
+
+    /**
+     * @brief 전체 추정 사용 바이트
+     */
+    size_t totalLiveBytes() const;
+
+    /**
+     * @brief 모듈별 사용량/축출 통계 로깅
+     */
+    void logStatistics() const;
+
+    bool isEnabled() const { return enabled_; }
+
+    /**
+     * @brief 프레임 진행 (배치 처리 시작 시 1회 호출)
+     */
+    static void advanceFrame() { frame_counter_.fetch_add(1, std::memory_order_relaxed); }
+
+    static uint64_t currentFrame() { return frame_counter_.load(std::memory_order_relaxed); }
+};
+
+#endif // MEMORY_BUDGET_H
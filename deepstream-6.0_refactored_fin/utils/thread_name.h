@@ -0,0 +1,21 @@
+﻿#ifndef THREAD_NAME_H
+#define THREAD_NAME_H
+
+#include <cstring>
+#include <pthread.h>
+
+/**
+ * @brief 현재 스레드 이름 설정 (/proc/self/task/<tid>/comm, top -H, gdb에 표시)
+ *
+ * 리눅스 제한으로 최대 15자 - 초과분은 잘라서 설정
+ * 애플리케이션이 생성한 스레드는 "ds-" 접두사 사용 (텔레메트리 집계 기준)
+ * @param name 스레드 이름
+ */
+inline void setCurrentThreadName(const char* name) {
+    char truncated[16];
+    std::strncpy(truncated, name, sizeof(truncated) - 1);
+    truncated[sizeof(truncated) - 1] = '\0';
+    pthread_setname_np(pthread_self(), truncated);
+}
+
+#endif // THREAD_NAME_H
@@ -0,0 +1,165 @@
+﻿#include "thread_role.h"
+#include "config_manager.h"
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <pthread.h>
+#include <sched.h>
+#include <sstream>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+
+const int NICE_UNSET = INT_MIN;
+
+std::string joinCpus(const std::vector<int>& cpus) {
+    std::stringstream ss;
+    for (size_t i = 0; i < cpus.size(); i++) {
+        if (i > 0) ss << ",";
+        ss << cpus[i];
+    }
+    return ss.str();
+}
+
+}  // namespace
+
+ThreadRoleRegistry::ThreadRoleRegistry() {
+    logger = getLogger("DS_ThreadRole_log");
+}
+
+ThreadRoleRegistry& ThreadRoleRegistry::getInstance() {
+    static ThreadRoleRegistry instance;
+    return instance;
+}
+
+void ThreadRoleRegistry::loadConfig() {
+    if (initialized_) return;
+
+    auto& config = ConfigManager::getInstance();
+    enabled_ = config.isThreadRolesEnabled();
+    online_cpus_ = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+    initialized_ = true;
+
+    logger->info("스레드 역할 설정 {} (온라인 CPU: {}개)", enabled_ ? "활성" : "비활성", online_cpus_);
+}
+
+bool ThreadRoleRegistry::parsePolicy(const std::string& name, int& policy) {
+    if (name == "other")      policy = SCHED_OTHER;
+    else if (name == "batch") policy = SCHED_BATCH;
+    else if (name == "idle")  policy = SCHED_IDLE;
+    else if (name == "fifo")  policy = SCHED_FIFO;
+    else if (name == "rr")    policy = SCHED_RR;
+    else return false;
+    return true;
+}
+
+const char* ThreadRoleRegistry::policyName(int policy) {
+    switch (policy) {
+        case SCHED_OTHER: return "other";
+        case SCHED_BATCH: return "batch";
+        case SCHED_IDLE:  return "idle";
+        case SCHED_FIFO:  return "fifo";
+        case SCHED_RR:    return "rr";
+        default:          return "keep";
+    }
+}
+
+bool ThreadRoleRegistry::loadRole(const std::string& name, ThreadRoleSettings& settings) const {
+    auto& config = ConfigManager::getInstance();
+    std::string key = "thread_roles.threads." + name;
+
+    for (double cpu : config.getDoubleArray(key + ".cpus")) {
+        int index = static_cast<int>(cpu);
+        if (index < 0 || index >= online_cpus_ || index >= CPU_SETSIZE) {
+            logger->warn("{}: 잘못된 CPU 번호 {} 무시 (온라인 CPU: {}개)", name, index, online_cpus_);
+            continue;
+        }
+        settings.cpus.push_back(index);
+    }
+
+    std::string policy = config.getString(key + ".policy", "");
+    if (!policy.empty() && !parsePolicy(policy, settings.policy)) {
+        logger->warn("{}: 알 수 없는 policy '{}' - 스케줄링 정책 유지", name, policy);
+    }
+
+    if (settings.policy == SCHED_FIFO || settings.policy == SCHED_RR) {
+        int min_priority = sched_get_priority_min(settings.policy);
+        int max_priority = sched_get_priority_max(settings.policy);
+        settings.priority = config.getInt(key + ".priority", min_priority);
+        if (settings.priority < min_priority || settings.priority > max_priority) {
+            logger->warn("{}: priority {} 범위 밖 ({}~{}) - {} 사용",
+                        name, settings.priority, min_priority, max_priority, min_priority);
+            settings.priority = min_priority;
+        }
+    }
+
+    int nice = config.getInt(key + ".nice", NICE_UNSET);
+    if (nice != NICE_UNSET) {
+        settings.has_nice = true;
+        settings.nice = std::max(-20, std::min(19, nice));
+    }
+
+    return !settings.cpus.empty() || settings.policy >= 0 || settings.has_nice;
+}
+
+void ThreadRoleRegistry::apply(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    loadConfig();
+    if (!enabled_) return;
+
+    ThreadRoleSettings settings;
+    if (!loadRole(name, settings)) {
+        logger->debug("{}: 역할 설정 없음 - 기본 스케줄링 유지", name);
+        return;
+    }
+
+    pid_t tid = static_cast<pid_t>(syscall(SYS_gettid));
+
+    // CPU 고정
+    if (!settings.cpus.empty()) {
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        for (int cpu : settings.cpus) {
+            CPU_SET(cpu, &cpu_set);
+        }
+        int result = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+        if (result != 0) {
+            logger->warn("{}: CPU 고정 실패 [{}] - {}", name, joinCpus(settings.cpus), std::strerror(result));
+            settings.cpus.clear();
+        }
+    }
+
+    // 스케줄링 정책 (FIFO/RR만 우선순위 사용)
+    if (settings.policy >= 0) {
+        sched_param param;
+        std::memset(&param, 0, sizeof(param));
+        param.sched_priority = settings.priority;
+        int result = pthread_setschedparam(pthread_self(), settings.policy, &param);
+        if (result != 0) {
+            logger->warn("{}: 스케줄링 정책 {} 설정 실패 - {}{}", name, policyName(settings.policy),
+                        std::strerror(result), result == EPERM ? " (CAP_SYS_NICE 필요)" : "");
+            settings.policy = -1;
+        }
+    }
+
+    // nice (리눅스는 스레드 단위로 적용)
+    if (settings.has_nice) {
+        if (setpriority(PRIO_PROCESS, static_cast<id_t>(tid), settings.nice) != 0) {
+            int error = errno;
+            logger->warn("{}: nice {} 설정 실패 - {}{}", name, settings.nice, std::strerror(error),
+                        error == EACCES || error == EPERM ? " (CAP_SYS_NICE 필요)" : "");
+            settings.has_nice = false;
+        }
+    }
+
+    logger->info("스레드 역할 적용 - {} (tid {}): CPU [{}], 정책: {}{}, nice: {}",
+                name, tid,
+                settings.cpus.empty() ? "유지" : joinCpus(settings.cpus),
+                policyName(settings.policy),
+                (settings.policy == SCHED_FIFO || settings.policy == SCHED_RR)
+                    ? "(" + std::to_string(settings.priority) + ")" : std::string(),
+                settings.has_nice ? std::to_string(settings.nice) : std::string("유지"));
+}
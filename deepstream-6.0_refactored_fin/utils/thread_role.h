@@ -0,0 +1,77 @@
+﻿#ifndef THREAD_ROLE_H
+#define THREAD_ROLE_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "thread_name.h"
+
+#ifndef __logger__
+#define __logger__
+#include "logger.hpp"
+#endif
+
+/**
+ * @brief 스레드 역할별 실행 설정 (config.json thread_roles.threads.<스레드 이름>)
+ */
+struct ThreadRoleSettings {
+    std::vector<int> cpus;          // 허용 CPU 번호 (비어 있으면 변경 안함)
+    int policy = -1;                // SCHED_OTHER/BATCH/IDLE/FIFO/RR (-1: 변경 안함)
+    int priority = 0;               // SCHED_FIFO/RR 우선순위 (1~99)
+    bool has_nice = false;
+    int nice = 0;                   // nice 값 (-20~19, SCHED_OTHER/BATCH에서만 의미)
+};
+
+/**
+ * @brief 스레드 역할 레지스트리 (싱글톤)
+ *
+ * 애플리케이션이 생성한 스레드는 시작 시 enterThreadRole()로 이름을 설정하고
+ * 같은 이름의 역할 설정(CPU 고정, 스케줄링 정책/우선순위, nice)을 자기 자신에게 적용
+ * - 프레임 처리(ds-stream)와 JPEG 저장/SQLite/체크포인트 등 배경 작업을 다른 코어로 분리
+ * - thread_roles.enabled=false 또는 설정 없는 스레드는 이름만 설정 (기존 동작)
+ * - 권한 부족(SCHED_FIFO/RR, 음수 nice는 CAP_SYS_NICE 필요) 시 경고 후 해당 항목만 건너뜀
+ *
+ * 설정 예:
+ *   "ds-stream": { "cpus": [2, 3], "policy": "rr", "priority": 10 }
+ *   "ds-sqlite": { "cpus": [0, 1], "policy": "batch", "nice": 10 }
+ */
+class ThreadRoleRegistry {
+private:
+    std::mutex mutex_;
+    bool initialized_ = false;
+    bool enabled_ = false;
+    int online_cpus_ = 0;
+
+    std::shared_ptr<spdlog::logger> logger = nullptr;
+
+    ThreadRoleRegistry();
+    void loadConfig();
+    bool loadRole(const std::string& name, ThreadRoleSettings& settings) const;
+
+    static bool parsePolicy(const std::string& name, int& policy);
+    static const char* policyName(int policy);
+
+public:
+    static ThreadRoleRegistry& getInstance();
+
+    ThreadRoleRegistry(const ThreadRoleRegistry&) = delete;
+    ThreadRoleRegistry& operator=(const ThreadRoleRegistry&) = delete;
+
+    /**
+     * @brief 현재 스레드에 역할 설정 적용 (스레드 함수 시작 시 1회)
+     * @param name 스레드 이름 (역할 키)
+     */
+    void apply(const std::string& name);
+};
+
+/**
+ * @brief 스레드 시작 처리 - 이름 설정 + 역할 설정 적용
+ * @param name 스레드 이름 ("ds-" 접두사, 최대 15자)
+ */
+inline void enterThreadRole(const char* name) {
+    setCurrentThreadName(name);
+    ThreadRoleRegistry::getInstance().apply(name);
+}
+
+#endif // THREAD_ROLE_H